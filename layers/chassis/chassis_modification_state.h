@@ -112,4 +112,17 @@ struct CreateBuffer {
     VkBufferCreateInfo modified_create_info;
 };
 
+// Lets GPU-AV add its own command buffers to the batches of a queue submission
+struct QueueSubmit {
+    std::vector<VkSubmitInfo> modified_submits;
+    std::vector<std::vector<VkCommandBuffer>> modified_command_buffers;
+    const VkSubmitInfo* pSubmits;
+};
+
+struct QueueSubmit2 {
+    std::vector<VkSubmitInfo2> modified_submits;
+    std::vector<std::vector<VkCommandBufferSubmitInfo>> modified_command_buffers;
+    const VkSubmitInfo2* pSubmits;
+};
+
 }  // namespace chassis
@@ -0,0 +1,279 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "utils/vk_layer_utils.h"
+
+namespace vvl {
+
+// Maps the keys handed out by insert() to 64-bit values. Built for the handle wrapping table, where every API call does
+// one or more lookups from any number of threads while inserts and erases only happen on object creation/destruction.
+//
+// A key stores a slot index in its low 32 bits and the generation of that slot in its high 32 bits. A lookup is a direct
+// index into slot storage followed by a compare against the key stored in the slot, so find() never takes a lock. The
+// generation is bumped every time a slot is reused, so a stale key is never resolved to the slot's new occupant.
+//
+// Slots live in segments of doubling size (kMinSegmentSize, 2x, 4x, ...) which are only released by the destructor, so
+// a slot never moves once published and readers need no reclamation scheme. insert() and erase() share a mutex which
+// guards the free list and segment allocation.
+class concurrent_handle_table {
+  public:
+    // Same shape as the FindResult returned by concurrent_unordered_map so callers can compare against end() and read
+    // the value through ->second.
+    class FindResult {
+      public:
+        FindResult(bool found, uint64_t value) : result_(found, value) {}
+        bool operator==(const FindResult &other) const {
+            if (!result_.first && !other.result_.first) {
+                return true;
+            }
+            return result_ == other.result_;
+        }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+        const std::pair<bool, uint64_t> *operator->() const { return &result_; }
+
+      private:
+        std::pair<bool, uint64_t> result_;
+    };
+
+    concurrent_handle_table() = default;
+    concurrent_handle_table(const concurrent_handle_table &) = delete;
+    concurrent_handle_table &operator=(const concurrent_handle_table &) = delete;
+    ~concurrent_handle_table() {
+        for (auto &segment : segments_) {
+            delete[] segment.load(std::memory_order_relaxed);
+        }
+    }
+
+    FindResult end() const { return FindResult(false, 0); }
+
+    // Store value in a free slot and return the (never 0) key which refers to it
+    uint64_t insert(uint64_t value) {
+        std::lock_guard<std::mutex> guard(lock_);
+        uint32_t index;
+        if (!free_list_.empty()) {
+            index = free_list_.back();
+            free_list_.pop_back();
+        } else {
+            index = next_index_++;
+            assert(next_index_ != 0);  // ran out of 32-bit slot indices
+            AllocateSegmentFor(index);
+        }
+        Slot &slot = *GetSlot(index);
+        slot.generation++;
+        if (slot.generation == 0) {
+            slot.generation = 1;
+        }
+        const uint64_t key = (uint64_t(slot.generation) << 32) | index;
+
+        // Seqlock style publication, see find()
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.value.store(value, std::memory_order_relaxed);
+        slot.key.store(key, std::memory_order_release);
+        ++size_;
+        return key;
+    }
+
+    FindResult find(uint64_t key) const {
+        const Slot *slot = GetSlot(static_cast<uint32_t>(key));
+        if (!slot || slot->key.load(std::memory_order_acquire) != key) {
+            return end();
+        }
+        const uint64_t value = slot->value.load(std::memory_order_relaxed);
+        // If the slot was erased and reused while the value was being read, the key no longer matches
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->key.load(std::memory_order_relaxed) != key) {
+            return end();
+        }
+        return FindResult(true, value);
+    }
+
+    bool contains(uint64_t key) const { return find(key) != end(); }
+
+    // Remove key and return the value it referred to
+    FindResult pop(uint64_t key) {
+        std::lock_guard<std::mutex> guard(lock_);
+        Slot *slot = GetSlot(static_cast<uint32_t>(key));
+        if (!slot || slot->key.load(std::memory_order_relaxed) != key) {
+            return end();
+        }
+        const uint64_t value = slot->value.load(std::memory_order_relaxed);
+        Release(*slot, static_cast<uint32_t>(key));
+        return FindResult(true, value);
+    }
+
+    bool erase(uint64_t key) { return pop(key) != end(); }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> guard(lock_);
+        return size_;
+    }
+
+  private:
+    struct Slot {
+        // Key of the current occupant, 0 while the slot is free
+        std::atomic<uint64_t> key{0};
+        std::atomic<uint64_t> value{0};
+        // Only accessed while holding lock_
+        uint32_t generation{0};
+    };
+
+    static constexpr uint32_t kMinSegmentBits = 10;
+    static constexpr uint32_t kMinSegmentSize = 1u << kMinSegmentBits;
+    // Enough doubling segments to address every 32-bit index
+    static constexpr uint32_t kMaxSegments = 32 - kMinSegmentBits + 1;
+
+    // Segment s holds kMinSegmentSize << s slots, starting at index kMinSegmentSize * ((1 << s) - 1)
+    static uint32_t SegmentIndex(uint32_t index) {
+        return static_cast<uint32_t>(MostSignificantBit((index >> kMinSegmentBits) + 1));
+    }
+    static uint32_t SegmentBase(uint32_t segment) { return kMinSegmentSize * ((1u << segment) - 1); }
+
+    const Slot *GetSlot(uint32_t index) const {
+        const uint32_t segment = SegmentIndex(index);
+        const Slot *slots = segments_[segment].load(std::memory_order_acquire);
+        return slots ? &slots[index - SegmentBase(segment)] : nullptr;
+    }
+    Slot *GetSlot(uint32_t index) { return const_cast<Slot *>(std::as_const(*this).GetSlot(index)); }
+
+    void AllocateSegmentFor(uint32_t index) {
+        const uint32_t segment = SegmentIndex(index);
+        if (!segments_[segment].load(std::memory_order_relaxed)) {
+            segments_[segment].store(new Slot[size_t(kMinSegmentSize) << segment], std::memory_order_release);
+        }
+    }
+
+    void Release(Slot &slot, uint32_t index) {
+        slot.key.store(0, std::memory_order_relaxed);
+        free_list_.push_back(index);
+        --size_;
+    }
+
+    std::atomic<Slot *> segments_[kMaxSegments]{};
+    mutable std::mutex lock_;
+    std::vector<uint32_t> free_list_;
+    uint32_t next_index_{0};
+    size_t size_{0};
+};
+
+// Maps the keys handed out by a concurrent_handle_table to 64-bit values, addressed by the slot index each key carries.
+// Lets code which keeps data per wrapped handle skip hashing: find() is a direct index followed by a compare against the
+// key stored in the slot, and never takes a lock.
+//
+// A slot holds a single key at a time. insert() fails while the slot of a key is still held by an older key, which
+// happens when the handle table reused the slot before the older key was erased here, so callers need a fallback for
+// such keys. Only insert keys which are live in the handle table: any other value addresses an arbitrary index.
+//
+// Slot storage and publication work as in concurrent_handle_table.
+class concurrent_wrapped_handle_map {
+  public:
+    using FindResult = concurrent_handle_table::FindResult;
+
+    concurrent_wrapped_handle_map() = default;
+    concurrent_wrapped_handle_map(const concurrent_wrapped_handle_map &) = delete;
+    concurrent_wrapped_handle_map &operator=(const concurrent_wrapped_handle_map &) = delete;
+    ~concurrent_wrapped_handle_map() {
+        for (auto &segment : segments_) {
+            delete[] segment.load(std::memory_order_relaxed);
+        }
+    }
+
+    FindResult end() const { return FindResult(false, 0); }
+
+    bool insert(uint64_t key, uint64_t value) {
+        assert(key != 0);
+        std::lock_guard<std::mutex> guard(lock_);
+        const uint32_t index = static_cast<uint32_t>(key);
+        AllocateSegmentFor(index);
+        Slot &slot = *GetSlot(index);
+        if (slot.key.load(std::memory_order_relaxed) != 0) {
+            return false;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.value.store(value, std::memory_order_relaxed);
+        slot.key.store(key, std::memory_order_release);
+        return true;
+    }
+
+    FindResult find(uint64_t key) const {
+        const Slot *slot = GetSlot(static_cast<uint32_t>(key));
+        if (!slot || slot->key.load(std::memory_order_acquire) != key) {
+            return end();
+        }
+        const uint64_t value = slot->value.load(std::memory_order_relaxed);
+        // If the key was erased and its slot reused while the value was being read, the key no longer matches
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->key.load(std::memory_order_relaxed) != key) {
+            return end();
+        }
+        return FindResult(true, value);
+    }
+
+    // Erase key if it is mapped to value
+    bool erase(uint64_t key, uint64_t value) {
+        std::lock_guard<std::mutex> guard(lock_);
+        Slot *slot = GetSlot(static_cast<uint32_t>(key));
+        if (!slot || slot->key.load(std::memory_order_relaxed) != key || slot->value.load(std::memory_order_relaxed) != value) {
+            return false;
+        }
+        slot->key.store(0, std::memory_order_relaxed);
+        return true;
+    }
+
+  private:
+    struct Slot {
+        // Key of the current holder, 0 while the slot is free
+        std::atomic<uint64_t> key{0};
+        std::atomic<uint64_t> value{0};
+    };
+
+    static constexpr uint32_t kMinSegmentBits = 10;
+    static constexpr uint32_t kMinSegmentSize = 1u << kMinSegmentBits;
+    static constexpr uint32_t kMaxSegments = 32 - kMinSegmentBits + 1;
+
+    static uint32_t SegmentIndex(uint32_t index) {
+        return static_cast<uint32_t>(MostSignificantBit((index >> kMinSegmentBits) + 1));
+    }
+    static uint32_t SegmentBase(uint32_t segment) { return kMinSegmentSize * ((1u << segment) - 1); }
+
+    const Slot *GetSlot(uint32_t index) const {
+        const uint32_t segment = SegmentIndex(index);
+        const Slot *slots = segments_[segment].load(std::memory_order_acquire);
+        return slots ? &slots[index - SegmentBase(segment)] : nullptr;
+    }
+    Slot *GetSlot(uint32_t index) { return const_cast<Slot *>(std::as_const(*this).GetSlot(index)); }
+
+    void AllocateSegmentFor(uint32_t index) {
+        const uint32_t segment = SegmentIndex(index);
+        if (!segments_[segment].load(std::memory_order_relaxed)) {
+            segments_[segment].store(new Slot[size_t(kMinSegmentSize) << segment], std::memory_order_release);
+        }
+    }
+
+    std::atomic<Slot *> segments_[kMaxSegments]{};
+    std::mutex lock_;
+};
+
+}  // namespace vvl
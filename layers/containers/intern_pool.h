@@ -0,0 +1,110 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "containers/custom_containers.h"
+
+namespace vvl {
+
+// Table of the distinct values of T, each stored once and referred to by a 32-bit index. Equal values have equal indices.
+//
+// Values are appended to fixed size chunks which never move, so Get() is lock free and only Intern() of a value not seen
+// before takes the lock. Values are never released before the pool itself; index 0 is always the default constructed T.
+// Intern() returns kOverflow once max_chunks chunks are full, the caller decides how to report it.
+template <typename T, typename Hash = std::hash<T>>
+class intern_pool {
+  public:
+    using Index = uint32_t;
+    static constexpr Index kDefault = 0;
+    static constexpr Index kOverflow = ~0u;
+    static constexpr uint32_t kChunkBits = 10;
+    static constexpr uint32_t kChunkSize = 1u << kChunkBits;
+
+    explicit intern_pool(uint32_t max_chunks) : max_chunks_(max_chunks), chunks_(new std::atomic<T *>[max_chunks]) {
+        for (uint32_t i = 0; i < max_chunks_; ++i) {
+            chunks_[i].store(nullptr, std::memory_order_relaxed);
+        }
+        chunks_[0].store(new T[kChunkSize](), std::memory_order_relaxed);
+        indices_.emplace(T(), kDefault);
+    }
+    ~intern_pool() {
+        for (uint32_t i = 0; i < max_chunks_; ++i) {
+            delete[] chunks_[i].load(std::memory_order_relaxed);
+        }
+    }
+    intern_pool(const intern_pool &) = delete;
+    intern_pool &operator=(const intern_pool &) = delete;
+
+    Index Intern(const T &value) {
+        const size_t hash = Hash()(value);
+        // Direct mapped per thread cache in front of the locked lookup. The entries may come from another pool of the same
+        // type, so they are only trusted after comparing the value they point to.
+        thread_local std::array<Index, kCacheSize> cache = {};
+        Index &cached = cache[hash % kCacheSize];
+        if (cached < Size() && Get(cached) == value) {
+            return cached;
+        }
+
+        std::lock_guard<std::mutex> guard(lock_);
+        auto found = indices_.find(value);
+        if (found != indices_.end()) {
+            cached = found->second;
+            return cached;
+        }
+        const size_t size = size_.load(std::memory_order_relaxed);
+        const uint32_t chunk = static_cast<uint32_t>(size >> kChunkBits);
+        if (chunk >= max_chunks_) {
+            return kOverflow;
+        }
+        T *storage = chunks_[chunk].load(std::memory_order_relaxed);
+        if (!storage) {
+            storage = new T[kChunkSize]();
+            chunks_[chunk].store(storage, std::memory_order_release);
+        }
+        const Index index = static_cast<Index>(size);
+        storage[index & (kChunkSize - 1)] = value;
+        size_.store(size + 1, std::memory_order_release);
+        indices_.emplace(value, index);
+        cached = index;
+        return index;
+    }
+
+    // index must have been returned by Intern() of this pool
+    const T &Get(Index index) const {
+        return chunks_[index >> kChunkBits].load(std::memory_order_acquire)[index & (kChunkSize - 1)];
+    }
+    size_t Size() const { return size_.load(std::memory_order_acquire); }
+    size_t Capacity() const { return size_t(max_chunks_) << kChunkBits; }
+
+  private:
+    static constexpr uint32_t kCacheSize = 64;
+
+    const uint32_t max_chunks_;
+    std::unique_ptr<std::atomic<T *>[]> chunks_;
+    std::atomic<size_t> size_{1};  // kDefault
+    std::mutex lock_;
+    vvl::unordered_map<T, Index, Hash> indices_;
+};
+
+}  // namespace vvl
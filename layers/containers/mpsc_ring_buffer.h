@@ -0,0 +1,106 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace vvl {
+
+// Bounded queue which any number of threads push to and a single thread pops from, without locks.
+//
+// Every cell carries a sequence number telling which lap of the ring it is ready for. A producer claims a position by
+// advancing the tail with a compare-exchange, fills the cell and then publishes it by bumping its sequence. The consumer
+// only ever looks at the cell at its own head, so it needs no atomic read-modify-write at all. try_push() fails instead
+// of waiting when the consumer is a whole ring behind, which keeps memory bounded by the capacity chosen up front.
+template <typename T>
+class mpsc_ring_buffer {
+  public:
+    // capacity must be a power of two
+    explicit mpsc_ring_buffer(uint32_t capacity) : mask_(capacity - 1), cells_(new Cell[capacity]) {
+        assert(capacity > 0 && (capacity & mask_) == 0);
+        for (uint32_t i = 0; i < capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    mpsc_ring_buffer(const mpsc_ring_buffer &) = delete;
+    mpsc_ring_buffer &operator=(const mpsc_ring_buffer &) = delete;
+
+    uint32_t capacity() const { return mask_ + 1; }
+
+    // May be called from any thread, returns false if the queue is full
+    bool try_push(T &&value) {
+        uint64_t position = tail_.load(std::memory_order_relaxed);
+        Cell *cell;
+        while (true) {
+            cell = &cells_[position & mask_];
+            const uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const int64_t lap = static_cast<int64_t>(sequence - position);
+            if (lap == 0) {
+                if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (lap < 0) {
+                // The consumer has not popped this cell since the previous lap
+                return false;
+            } else {
+                // Another producer claimed this position
+                position = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Must only be called from the consumer thread
+    bool try_pop(T &value) {
+        Cell &cell = cells_[head_ & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != head_ + 1) {
+            return false;
+        }
+        value = std::move(cell.value);
+        cell.sequence.store(head_ + capacity(), std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    // Must only be called from the consumer thread. A push which is still in progress does not count.
+    bool empty() const { return cells_[head_ & mask_].sequence.load(std::memory_order_acquire) != head_ + 1; }
+
+    // Positions claimed by producers so far, including pushes which are still in progress
+    uint64_t push_count() const { return tail_.load(std::memory_order_acquire); }
+    // Must only be called from the consumer thread
+    uint64_t pop_count() const { return head_; }
+
+  private:
+    struct Cell {
+        std::atomic<uint64_t> sequence;
+        T value;
+    };
+
+    const uint32_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    // Producers and the consumer hammer different ends of the ring, keep them on separate cache lines
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    alignas(64) uint64_t head_{0};
+};
+
+}  // namespace vvl
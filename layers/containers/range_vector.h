@@ -22,11 +22,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <sstream>
 #include <utility>
+#include <vector>
 #include <cstdint>
 #include "custom_containers.h"
 
@@ -1433,6 +1436,176 @@ class small_range_map {
     std::array<bool, N> in_use_;
 };
 
+// Fixed size block arena for the nodes of a node based ImplMap (i.e. std::map).
+//
+// Nodes are carved out of chunks of growing size instead of being allocated one by one, and freed nodes go to a free list
+// for reuse. When the last live node is freed (e.g. the map is cleared) the arena rewinds to the start of its first chunk,
+// so a map which is repeatedly filled and cleared only touches the heap the first time. Chunks are released with the arena.
+class node_arena {
+  public:
+    static constexpr size_t kAlignment = alignof(std::max_align_t);
+
+    node_arena() = default;
+    node_arena(const node_arena &) = delete;
+    node_arena &operator=(const node_arena &) = delete;
+
+    // The first allocation sets the block size, returns nullptr for any other size
+    void *allocate(size_t size) {
+        const size_t stride = Stride(size);
+        if (block_size_ == 0) {
+            block_size_ = stride;
+        } else if (stride != block_size_) {
+            return nullptr;
+        }
+        ++live_count_;
+        if (free_list_) {
+            FreeBlock *block = free_list_;
+            free_list_ = block->next;
+            return block;
+        }
+        if (chunk_index_ == chunks_.size() || chunk_used_ == chunks_[chunk_index_].count) {
+            NextChunk();
+        }
+        Chunk &chunk = chunks_[chunk_index_];
+        return chunk.data.get() + block_size_ * chunk_used_++;
+    }
+
+    void deallocate(void *block) {
+        assert(live_count_ > 0);
+        if (--live_count_ == 0) {
+            // Everything is free, start over at the front of the first chunk
+            free_list_ = nullptr;
+            chunk_index_ = 0;
+            chunk_used_ = 0;
+            return;
+        }
+        auto free_block = static_cast<FreeBlock *>(block);
+        free_block->next = free_list_;
+        free_list_ = free_block;
+    }
+
+    bool owns_size(size_t size) const { return block_size_ != 0 && Stride(size) == block_size_; }
+    size_t live_count() const { return live_count_; }
+    size_t capacity() const {
+        size_t total = 0;
+        for (const auto &chunk : chunks_) {
+            total += chunk.count;
+        }
+        return total;
+    }
+
+  private:
+    struct FreeBlock {
+        FreeBlock *next;
+    };
+    struct Chunk {
+        std::unique_ptr<uint8_t[]> data;
+        size_t count;
+    };
+    static constexpr size_t kMinChunkBlocks = 8;
+    static constexpr size_t kMaxChunkBlocks = 512;
+
+    static size_t Stride(size_t size) {
+        size = std::max(size, sizeof(FreeBlock));
+        return (size + kAlignment - 1) & ~(kAlignment - 1);
+    }
+
+    void NextChunk() {
+        if (!chunks_.empty() && chunk_index_ + 1 < chunks_.size()) {
+            // Reuse the chunks kept from before the last rewind
+            ++chunk_index_;
+        } else {
+            const size_t count = std::min(kMinChunkBlocks << std::min<size_t>(chunks_.size(), 6), kMaxChunkBlocks);
+            chunks_.emplace_back(Chunk{std::unique_ptr<uint8_t[]>(new uint8_t[block_size_ * count]), count});
+            chunk_index_ = chunks_.size() - 1;
+        }
+        chunk_used_ = 0;
+    }
+
+    std::vector<Chunk> chunks_;
+    size_t chunk_index_ = 0;
+    size_t chunk_used_ = 0;
+    size_t block_size_ = 0;
+    size_t live_count_ = 0;
+    FreeBlock *free_list_ = nullptr;
+};
+
+// Allocator handing out single nodes larger than MinSize from a node_arena shared by all its rebound copies. For a std::map
+// that is only the tree nodes, anything else (e.g. debug iterator proxies) goes to the heap.
+//
+// A copy constructed container gets an arena of its own. Moving an allocator shares the arena instead of leaving the source
+// without one, so a moved-from container stays usable (and MSVC's std::map allocates a new sentinel node for it).
+template <typename T, size_t MinSize = sizeof(T)>
+class arena_allocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+    template <typename U>
+    struct rebind {
+        using other = arena_allocator<U, MinSize>;
+    };
+
+    arena_allocator() : arena_(std::make_shared<node_arena>()) {}
+    arena_allocator(const arena_allocator &other) noexcept : arena_(other.arena_) {}
+    arena_allocator(arena_allocator &&other) noexcept : arena_(other.arena_) {}
+    arena_allocator &operator=(const arena_allocator &other) noexcept {
+        arena_ = other.arena_;
+        return *this;
+    }
+    arena_allocator &operator=(arena_allocator &&other) noexcept {
+        arena_ = other.arena_;
+        return *this;
+    }
+    template <typename U>
+    arena_allocator(const arena_allocator<U, MinSize> &other) : arena_(other.arena_) {}
+
+    arena_allocator select_on_container_copy_construction() const { return arena_allocator(); }
+
+    T *allocate(size_t n) {
+        if (UseArena(n)) {
+            if (void *block = arena_->allocate(sizeof(T))) {
+                return static_cast<T *>(block);
+            }
+        }
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n) {
+        if (UseArena(n) && arena_->owns_size(sizeof(T))) {
+            arena_->deallocate(p);
+        } else {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    const node_arena &arena() const { return *arena_; }
+
+    template <typename U>
+    bool operator==(const arena_allocator<U, MinSize> &other) const {
+        return arena_ == other.arena_;
+    }
+    template <typename U>
+    bool operator!=(const arena_allocator<U, MinSize> &other) const {
+        return arena_ != other.arena_;
+    }
+
+  private:
+    template <typename U, size_t>
+    friend class arena_allocator;
+
+    static constexpr bool UseArena(size_t n) {
+        return n == 1 && sizeof(T) > MinSize && alignof(T) <= node_arena::kAlignment;
+    }
+
+    std::shared_ptr<node_arena> arena_;
+};
+
+// std::map with arena allocated nodes, for use as the range map "ImplMap" of maps which see a lot of splits and infills
+template <typename Key, typename T, typename RangeKey = range<Key>>
+using arena_map = std::map<RangeKey, T, std::less<RangeKey>, arena_allocator<std::pair<const RangeKey, T>>>;
+
 // Forward index iterator, tracking an index value and the appropos lower bound
 // returns an index_type, lower_bound pair.  Supports ++,  offset, and seek affecting the index,
 // lower bound updates as needed. As the index may specify a range for which no entry exist, dereferenced
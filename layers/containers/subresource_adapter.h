@@ -105,6 +105,11 @@ class RangeEncoder {
                (range.baseArrayLayer < limits_.arrayLayer) && ((range.baseArrayLayer + range.layerCount) <= limits_.arrayLayer) &&
                (range.aspectMask & limits_.aspectMask);
     }
+    // True if a normalized range covers every subresource of the image
+    inline bool CoversAll(const VkImageSubresourceRange& range) const {
+        return (range.baseMipLevel == 0) && (range.levelCount == limits_.mipLevel) && (range.baseArrayLayer == 0) &&
+               (range.layerCount == limits_.arrayLayer) && ((range.aspectMask & limits_.aspectMask) == limits_.aspectMask);
+    }
 
     inline IndexType Encode(const Subresource& pos) const { return (this->*(encode_function_))(pos); }
     inline IndexType Encode(const VkImageSubresource& subres) const { return Encode(Subresource(*this, subres)); }
@@ -32,7 +32,7 @@
 
 bool CoreChecks::ReportInvalidCommandBuffer(const vvl::CommandBuffer &cb_state, const Location &loc, const char *vuid) const {
     bool skip = false;
-    for (const auto &entry : cb_state.broken_bindings) {
+    for (const auto &entry : cb_state.GetBrokenBindings()) {
         const auto &obj = entry.first;
         const char *cause_str = (obj.type == kVulkanObjectTypeDescriptorSet)   ? " or updated"
                                 : (obj.type == kVulkanObjectTypeCommandBuffer) ? " or rerecorded"
@@ -279,12 +279,13 @@ bool CoreChecks::PreCallValidateBeginCommandBuffer(VkCommandBuffer commandBuffer
             }
         }
     }
-    if (CbState::Recording == cb_state->state) {
+    const CbState state = cb_state->GetState();
+    if (CbState::Recording == state) {
         skip |= LogError("VUID-vkBeginCommandBuffer-commandBuffer-00049", commandBuffer, error_obj.location,
                          "Cannot call Begin on %s in the RECORDING state. Must first call "
                          "vkEndCommandBuffer().",
                          FormatHandle(commandBuffer).c_str());
-    } else if (CbState::Recorded == cb_state->state || CbState::InvalidComplete == cb_state->state) {
+    } else if (CbState::Recorded == state || CbState::InvalidComplete == state) {
         VkCommandPool cmd_pool = cb_state->allocate_info.commandPool;
         const auto *pool = cb_state->command_pool;
         if (!(VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT & pool->createFlags)) {
@@ -330,9 +331,10 @@ bool CoreChecks::PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer,
         skip |= InsideRenderPass(cb_state, error_obj.location, "VUID-vkEndCommandBuffer-commandBuffer-00060");
     }
 
-    if (cb_state.state == CbState::InvalidComplete || cb_state.state == CbState::InvalidIncomplete) {
+    const CbState state = cb_state.GetState();
+    if (state == CbState::InvalidComplete || state == CbState::InvalidIncomplete) {
         skip |= ReportInvalidCommandBuffer(cb_state, error_obj.location, "VUID-vkEndCommandBuffer-commandBuffer-00059");
-    } else if (CbState::Recording != cb_state.state) {
+    } else if (CbState::Recording != state) {
         skip |= LogError("VUID-vkEndCommandBuffer-commandBuffer-00059", commandBuffer, error_obj.location,
                          "Cannot call End on %s when not in the RECORDING state. Must first call vkBeginCommandBuffer().",
                          FormatHandle(commandBuffer).c_str());
@@ -813,7 +813,8 @@ bool CoreChecks::PreCallValidateGetDescriptorSetLayoutSupportKHR(VkDevice device
 // Return true if state is acceptable, or false and write an error message into error string
 bool CoreChecks::ValidateDrawState(const DescriptorSet &descriptor_set, uint32_t set_index, const BindingVariableMap &bindings,
                                    const std::vector<uint32_t> &dynamic_offsets, const vvl::CommandBuffer &cb_state,
-                                   const Location &loc, const vvl::DrawDispatchVuid &vuids) const {
+                                   std::optional<uint64_t> changed_since, const Location &loc,
+                                   const vvl::DrawDispatchVuid &vuids) const {
     bool result = false;
     VkFramebuffer framebuffer = cb_state.activeFramebuffer ? cb_state.activeFramebuffer->VkHandle() : VK_NULL_HANDLE;
     // NOTE: GPU-AV needs non-const state objects to do lazy updates of descriptor state of only the dynamically used
@@ -831,7 +832,8 @@ bool CoreChecks::ValidateDrawState(const DescriptorSet &descriptor_set, uint32_t
             return result;
         }
 
-        if (descriptor_set.SkipBinding(*binding, binding_pair.second.variable->is_dynamic_accessed)) {
+        if (descriptor_set.SkipBinding(*binding, binding_pair.second.variable->is_dynamic_accessed) ||
+            !DescriptorSet::IsBindingChangedSince(*binding, changed_since)) {
             continue;
         }
         vvl::DescriptorBindingInfo binding_info;
@@ -1809,12 +1811,12 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet &dst_set, const VkWrite
                          FormatHandle(dst_layout->Handle()).c_str());
     }
 
-    const auto *used_handle = dst_set.InUse();
+    const auto used_handle = dst_set.InUse();
     if (used_handle && !(dest.IsBindless())) {
         skip |= LogError("VUID-vkUpdateDescriptorSets-None-03047", objlist, dst_binding_loc,
                          "(%" PRIu32 ") was created with %s, but %s is in use by %s.", update.dstBinding,
                          string_VkDescriptorBindingFlags(dest.binding_flags).c_str(), FormatHandle(update.dstSet).c_str(),
-                         FormatHandle(*used_handle).c_str());
+                         FormatHandle(used_handle).c_str());
     }
     // We know that binding is valid, verify update and do update on each descriptor
     if ((dest.type != VK_DESCRIPTOR_TYPE_MUTABLE_EXT) && (dest.type != update.descriptorType)) {
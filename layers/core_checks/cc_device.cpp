@@ -19,7 +19,6 @@
  * This file deals with anything related to Phyiscal Devices, Logical Devices, or Device Queues Families, Device Masks, etc
  */
 
-#include <fstream>
 #include <vector>
 
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
@@ -457,22 +456,16 @@ void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Locat
 #endif
         validation_cache_path += ".bin";
 
-        std::vector<char> validation_cache_data;
-        std::ifstream read_file(validation_cache_path.c_str(), std::ios::in | std::ios::binary);
+        // The cache file is not in the VK_EXT_validation_cache format, it is mapped by LoadFile instead of being read here
+        VkValidationCacheCreateInfoEXT cacheCreateInfo = vku::InitStructHelper();
+        CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
 
-        if (read_file) {
-            std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(validation_cache_data));
-            read_file.close();
-        } else {
+        const uint32_t config_id = GetSpirvValidationConfigId(
+            PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4)), device_extensions, enabled_features);
+        if (!CastFromHandle<ValidationCache *>(core_validation_cache)->LoadFile(validation_cache_path, config_id)) {
             LogInfo("WARNING-cache-file-error", device, loc,
                     "Cannot open shader validation cache at %s for reading (it may not exist yet)", validation_cache_path.c_str());
         }
-
-        VkValidationCacheCreateInfoEXT cacheCreateInfo = vku::InitStructHelper();
-        cacheCreateInfo.initialDataSize = validation_cache_data.size();
-        cacheCreateInfo.pInitialData = validation_cache_data.data();
-        cacheCreateInfo.flags = 0;
-        CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
     }
 }
 
@@ -484,37 +477,10 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
 
     if (core_validation_cache) {
         Location loc(Func::vkDestroyDevice);
-        size_t validation_cache_size = 0;
-        void *validation_cache_data = nullptr;
-
-        CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, nullptr);
-
-        validation_cache_data = (char *)malloc(sizeof(char) * validation_cache_size);
-        if (!validation_cache_data) {
-            LogInfo("WARNING-cache-memory-error", device, loc, "Validation Cache Memory Error");
-            return;
-        }
-
-        VkResult result =
-            CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, validation_cache_data);
-
-        if (result != VK_SUCCESS) {
-            LogInfo("WARNING-cache-retrieval-error", device, loc, "Validation Cache Retrieval Error");
-            free(validation_cache_data);
-            return;
-        }
-
-        if (validation_cache_path.size() > 0) {
-            std::ofstream write_file(validation_cache_path.c_str(), std::ios::out | std::ios::binary);
-            if (write_file) {
-                write_file.write(static_cast<char *>(validation_cache_data), validation_cache_size);
-                write_file.close();
-            } else {
-                LogInfo("WARNING-cache-write-error", device, loc, "Cannot open shader validation cache at %s for writing",
-                        validation_cache_path.c_str());
-            }
+        if (!CastFromHandle<ValidationCache *>(core_validation_cache)->SaveFile()) {
+            LogInfo("WARNING-cache-write-error", device, loc, "Cannot open shader validation cache at %s for writing",
+                    validation_cache_path.c_str());
         }
-        free(validation_cache_data);
         CoreLayerDestroyValidationCacheEXT(device, core_validation_cache, NULL);
     }
 }
@@ -799,10 +765,10 @@ bool CoreChecks::ValidateObjectNotInUse(const vvl::StateObject *obj_node, const
     auto obj_struct = obj_node->Handle();
     bool skip = false;
 
-    const auto *used_handle = obj_node->InUse();
+    const auto used_handle = obj_node->InUse();
     if (used_handle) {
         skip |= LogError(error_code, device, loc, "can't be called on %s that is currently in use by %s.",
-                         FormatHandle(obj_struct).c_str(), FormatHandle(*used_handle).c_str());
+                         FormatHandle(obj_struct).c_str(), FormatHandle(used_handle).c_str());
     }
     return skip;
 }
@@ -1602,7 +1602,7 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                 // if the bound set is not copmatible, the rest will just be extra redundant errors
                 for (const auto &set_binding_pair : pipeline->active_slots) {
                     uint32_t set_index = set_binding_pair.first;
-                    const auto set_info = last_bound_state.per_set[set_index];
+                    const auto &set_info = last_bound_state.per_set[set_index];
                     if (!set_info.bound_descriptor_set) {
                         skip |= LogError(vuid.compatible_pipeline_08600, cb_state.GetObjectList(bind_point), loc,
                                          "%s uses set #%" PRIu32 " but that set is not bound.", FormatHandle(*pipeline).c_str(),
@@ -1627,19 +1627,25 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                         // Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
                         // any dynamic descriptors, always revalidate rather than caching the values. We currently only
                         // apply this optimization if IsManyDescriptors is true, to avoid the overhead of copying the
-                        // binding_req_map which could potentially be expensive.
-                        bool need_validate =
+                        // binding_req_map which could potentially be expensive. The pipeline identity stands in for the
+                        // binding_req_map, as it is the pipeline's active_slots. If only the contents of the set changed,
+                        // only the bindings updated since the last validation are revalidated.
+                        const bool need_full_validate =
                             // Revalidate each time if the set has dynamic offsets
                             set_info.dynamicOffsets.size() > 0 ||
-                            // Revalidate if descriptor set (or contents) has changed
+                            // Revalidate if descriptor set has changed
                             set_info.validated_set != descriptor_set ||
-                            set_info.validated_set_change_count != descriptor_set->GetChangeCount() ||
+                            // Revalidate if the pipeline changed, it can use bindings the last validation did not look at
+                            set_info.validated_pipeline != pipeline ||
                             (!disabled[image_layout_validation] &&
                              set_info.validated_set_image_layout_change_count != cb_state.image_layout_change_count);
 
-                        if (need_validate) {
-                            skip |= ValidateDrawState(*descriptor_set, set_index, set_binding_pair.second, set_info.dynamicOffsets, cb_state,
-                                                      loc, vuid);
+                        if (need_full_validate) {
+                            skip |= ValidateDrawState(*descriptor_set, set_index, set_binding_pair.second, set_info.dynamicOffsets,
+                                                      cb_state, std::nullopt, loc, vuid);
+                        } else if (set_info.validated_set_change_count != descriptor_set->GetChangeCount()) {
+                            skip |= ValidateDrawState(*descriptor_set, set_index, set_binding_pair.second, set_info.dynamicOffsets,
+                                                      cb_state, set_info.validated_set_change_count, loc, vuid);
                         }
                     }
                 }
@@ -1677,7 +1683,7 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                 // if the bound set is not copmatible, the rest will just be extra redundant errors
                 for (const auto &set_binding_pair : shader_state->active_slots) {
                     uint32_t set_index = set_binding_pair.first;
-                    const auto set_info = last_bound_state.per_set[set_index];
+                    const auto &set_info = last_bound_state.per_set[set_index];
                     if (!set_info.bound_descriptor_set) {
                         const LogObjectList objlist(cb_state.Handle(), shader_state->Handle());
                         skip |= LogError(vuid.compatible_pipeline_08600, objlist, loc,
@@ -1700,18 +1706,23 @@ bool CoreChecks::ValidateActionState(const vvl::CommandBuffer &cb_state, const V
                         // We can skip validating the descriptor set if "nothing" has changed since the last validation.
                         // Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
                         // any dynamic descriptors, always revalidate rather than caching the values.
-                        bool need_validate =
+                        const bool need_full_validate =
                             // Revalidate each time if the set has dynamic offsets
                             set_info.dynamicOffsets.size() > 0 ||
-                            // Revalidate if descriptor set (or contents) has changed
+                            // Revalidate if descriptor set has changed
                             set_info.validated_set != descriptor_set ||
-                            set_info.validated_set_change_count != descriptor_set->GetChangeCount() ||
+                            // Revalidate if the cached state comes from a pipeline, it is only recorded for pipelines
+                            set_info.validated_pipeline != nullptr ||
                             (!disabled[image_layout_validation] &&
                              set_info.validated_set_image_layout_change_count != cb_state.image_layout_change_count);
 
-                        if (need_validate) {
-                            skip |= ValidateDrawState(*descriptor_set, set_index, set_binding_pair.second, set_info.dynamicOffsets, cb_state,
-                                                      loc, vuid);
+                        if (need_full_validate) {
+                            skip |= ValidateDrawState(*descriptor_set, set_index, set_binding_pair.second, set_info.dynamicOffsets,
+                                                      cb_state, std::nullopt, loc, vuid);
+                        } else if (set_info.validated_set_change_count != descriptor_set->GetChangeCount()) {
+                            // Only the contents changed, revalidate the bindings updated since the last validation
+                            skip |= ValidateDrawState(*descriptor_set, set_index, set_binding_pair.second, set_info.dynamicOffsets,
+                                                      cb_state, set_info.validated_set_change_count, loc, vuid);
                         }
                     }
                 }
@@ -198,7 +198,8 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
     for (const auto &layout_map_entry : cb_state.image_layout_map) {
         const auto image = layout_map_entry.first;
         const auto image_state = Get<vvl::Image>(image);
-        if (!image_state) {
+        // Entries of destroyed images are kept until the command buffer is reset, the handle may have been reused
+        if (!image_state || image_state->GetId() != layout_map_entry.second.id) {
             continue;
         }
         const auto &layout_map = layout_map_entry.second.map->GetLayoutMap();
@@ -210,8 +211,47 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
         assert(global_map);
         auto global_map_guard = global_map->ReadLock();
 
-        // Note: don't know if it would matter
-        // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
+        auto report_mismatch = [&](VkImageLayout initial_layout, VkImageLayout image_layout,
+                                   const GlobalImageLayoutRangeMap::RangeType &intersected_range) {
+            if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
+                // TODO: Set memory invalid which is in mem_tracker currently
+                return;
+            }
+            if (image_layout == initial_layout) {
+                return;
+            }
+            const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
+            if (ImageLayoutMatches(aspect_mask, image_layout, initial_layout)) {
+                return;
+            }
+            // We can report all the errors for the intersected range directly
+            for (auto index : sparse_container::range_view<GlobalImageLayoutRangeMap::RangeType>(intersected_range)) {
+                const auto subresource = image_state->subresource_encoder.Decode(index);
+                const LogObjectList objlist(cb_state.Handle(), image_state->Handle());
+                skip |= LogError("UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout", objlist, loc,
+                                 "command buffer %s expects %s (subresource: aspectMask 0x%x array layer %" PRIu32
+                                 ", mip level %" PRIu32 ") to be in layout %s--instead, current layout is %s.",
+                                 FormatHandle(cb_state).c_str(), FormatHandle(*image_state).c_str(), subresource.aspectMask,
+                                 subresource.arrayLayer, subresource.mipLevel, string_VkImageLayout(initial_layout),
+                                 string_VkImageLayout(image_layout));
+            }
+        };
+
+        // Whole image barriers leave both the command buffer and the image with a single layout for all subresources,
+        // which only needs one comparison
+        const auto *cb_entry = layout_map_entry.second.map->GetUniformEntry();
+        const VkImageLayout *current_layout_uniform = overlay_map->GetUniformLayout();
+        if (!current_layout_uniform && overlay_map->empty()) {
+            current_layout_uniform = global_map->GetUniformLayout();
+        }
+        if (cb_entry && current_layout_uniform) {
+            assert(cb_entry->initial_layout != image_layout_map::kInvalidLayout);
+            report_mismatch(cb_entry->initial_layout, *current_layout_uniform, overlay_map->WholeRange());
+            if (cb_entry->current_layout != image_layout_map::kInvalidLayout) {
+                overlay_map->SetUniformLayout(cb_entry->current_layout);
+            }
+            continue;
+        }
 
         auto pos = layout_map.begin();
         const auto end = layout_map.end();
@@ -233,25 +273,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const vvl::Comm
                 image_layout = current_layout->pos_B->lower_bound->second;
             }
             const auto intersected_range = pos->first & current_layout->range;
-            if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
-                // TODO: Set memory invalid which is in mem_tracker currently
-            } else if (image_layout != initial_layout) {
-                const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
-                const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
-                if (!matches) {
-                    // We can report all the errors for the intersected range directly
-                    for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
-                        const auto subresource = image_state->subresource_encoder.Decode(index);
-                        const LogObjectList objlist(cb_state.Handle(), image_state->Handle());
-                        skip |= LogError("UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout", objlist, loc,
-                                         "command buffer %s expects %s (subresource: aspectMask 0x%x array layer %" PRIu32
-                                         ", mip level %" PRIu32 ") to be in layout %s--instead, current layout is %s.",
-                                         FormatHandle(cb_state).c_str(), FormatHandle(*image_state).c_str(), subresource.aspectMask,
-                                         subresource.arrayLayer, subresource.mipLevel, string_VkImageLayout(initial_layout),
-                                         string_VkImageLayout(image_layout));
-                    }
-                }
-            }
+            report_mismatch(initial_layout, image_layout, intersected_range);
             if (pos->first.includes(intersected_range.end)) {
                 current_layout.seek(intersected_range.end);
             } else {
@@ -274,6 +296,12 @@ void CoreChecks::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_state) {
         const auto image_state = Get<vvl::Image>(image);
         if (image_state && image_state->GetId() == layout_map_entry.second.id && layout_map_entry.second.map) {
             auto guard = image_state->layout_range_map->WriteLock();
+            if (const auto *cb_entry = layout_map_entry.second.map->GetUniformEntry()) {
+                if (cb_entry->current_layout != image_layout_map::kInvalidLayout) {
+                    image_state->layout_range_map->SetUniformLayout(cb_entry->current_layout);
+                }
+                continue;
+            }
             sparse_container::splice(*image_state->layout_range_map, layout_map_entry.second.map->GetLayoutMap(), GlobalLayoutUpdater());
         }
     }
@@ -500,7 +500,11 @@ bool CoreChecks::ValidateQueueFamilyIndices(const Location &loc, const vvl::Comm
         }
 
         // Ensure that any bound images or buffers created with SHARING_MODE_CONCURRENT have access to the current queue family
-        for (const auto &state_object : cb_state.object_bindings) {
+        for (const auto &binding : cb_state.object_bindings) {
+            const auto &state_object = binding.object;
+            if (state_object->Destroyed()) {
+                continue;
+            }
             switch (state_object->Type()) {
                 case kVulkanObjectTypeImage: {
                     auto image_state = static_cast<const vvl::Image *>(state_object.get());
@@ -546,7 +550,7 @@ bool CoreChecks::ValidateCommandBufferState(const vvl::CommandBuffer &cb_state,
     }
 
     // Validate that cmd buffers have been updated
-    switch (cb_state.state) {
+    switch (cb_state.GetState()) {
         case CbState::InvalidIncomplete:
         case CbState::InvalidComplete:
             skip |= ReportInvalidCommandBuffer(cb_state, loc, vuid);
@@ -613,7 +617,7 @@ bool CoreChecks::ValidatePrimaryCommandBufferState(
                                  FormatHandle(sub_cb->primaryCommandBuffer).c_str());
             }
 
-            if (sub_cb->state != CbState::Recorded) {
+            if (sub_cb->GetState() != CbState::Recorded) {
                 const char *const finished_cb_vuid = (loc.function == Func::vkQueueSubmit)
                                                          ? "VUID-vkQueueSubmit-pCommandBuffers-00072"
                                                          : "VUID-vkQueueSubmit2-commandBuffer-03876";
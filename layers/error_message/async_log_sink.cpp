@@ -0,0 +1,139 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "async_log_sink.h"
+
+#include <cinttypes>
+
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include "logging.h"
+
+AsyncLogSink::AsyncLogSink(FILE *output, uint32_t capacity) : output_(output), queue_(capacity) {
+    writer_ = std::thread(&AsyncLogSink::Run, this);
+}
+
+AsyncLogSink::~AsyncLogSink() {
+    {
+        std::lock_guard<std::mutex> guard(wake_lock_);
+        stop_.store(true);
+        wake_.notify_one();
+    }
+    // Run() drains the queue once more after seeing stop_, so nothing pushed before this point is lost
+    writer_.join();
+}
+
+AsyncLogSink::Entry AsyncLogSink::MakeEntry(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                             VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                             const VkDebugUtilsMessengerCallbackDataEXT &callback_data) {
+    Entry entry;
+    entry.severity = message_severity;
+    entry.type = message_type;
+    entry.message_id_name = callback_data.pMessageIdName ? callback_data.pMessageIdName : "";
+    entry.message_id_number = callback_data.messageIdNumber;
+    entry.message = callback_data.pMessage ? callback_data.pMessage : "";
+    entry.objects.resize(callback_data.objectCount);
+    for (uint32_t i = 0; i < callback_data.objectCount; ++i) {
+        const VkDebugUtilsObjectNameInfoEXT &src = callback_data.pObjects[i];
+        Object &object = entry.objects[i];
+        object.type = src.objectType;
+        object.handle = src.objectHandle;
+        object.has_name = src.pObjectName != nullptr;
+        if (object.has_name) {
+            object.name = src.pObjectName;
+        }
+    }
+    return entry;
+}
+
+void AsyncLogSink::Push(Entry &&entry) {
+    if (!queue_.try_push(std::move(entry))) {
+        dropped_count_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    // Pairs with the fence in Run(), either the writer sees this entry before it sleeps or this sees the writer waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (writer_waiting_.load(std::memory_order_relaxed)) {
+        // Under the lock the writer is either blocked already or has not checked the queue yet
+        std::lock_guard<std::mutex> guard(wake_lock_);
+        wake_.notify_one();
+    }
+}
+
+void AsyncLogSink::Flush() {
+    // A push still in progress is waited for as well, its producer notifies the writer as soon as it is published
+    const uint64_t pushed_count = queue_.push_count();
+    std::unique_lock<std::mutex> guard(wake_lock_);
+    flushed_.wait(guard, [this, pushed_count]() { return written_count_ >= pushed_count; });
+}
+
+void AsyncLogSink::Run() {
+    while (true) {
+        const bool stopping = stop_.load();
+        Drain();
+        std::unique_lock<std::mutex> guard(wake_lock_);
+        written_count_ = queue_.pop_count();
+        flushed_.notify_all();
+        if (stopping) {
+            break;
+        }
+        writer_waiting_.store(true, std::memory_order_relaxed);
+        // Pairs with the fence in Push(), a producer which did not see writer_waiting_ set has its entry seen here
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        wake_.wait(guard, [this]() { return stop_.load() || !queue_.empty(); });
+        writer_waiting_.store(false, std::memory_order_relaxed);
+    }
+}
+
+void AsyncLogSink::Drain() {
+    Entry entry;
+    while (queue_.try_pop(entry)) {
+        Write(entry);
+    }
+    const uint64_t dropped_count = dropped_count_.load(std::memory_order_relaxed);
+    if (dropped_count != reported_dropped_count_) {
+        fprintf(output_, "Validation layer log queue was full, %" PRIu64 " message(s) were dropped\n",
+                dropped_count - reported_dropped_count_);
+        fflush(output_);
+        reported_dropped_count_ = dropped_count;
+    }
+}
+
+void AsyncLogSink::Write(const Entry &entry) const {
+    std::vector<VkDebugUtilsObjectNameInfoEXT> objects(entry.objects.size());
+    for (size_t i = 0; i < entry.objects.size(); ++i) {
+        objects[i] = vku::InitStructHelper();
+        objects[i].objectType = entry.objects[i].type;
+        objects[i].objectHandle = entry.objects[i].handle;
+        objects[i].pObjectName = entry.objects[i].has_name ? entry.objects[i].name.c_str() : nullptr;
+    }
+
+    VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
+    callback_data.pMessageIdName = entry.message_id_name.c_str();
+    callback_data.messageIdNumber = entry.message_id_number;
+    callback_data.pMessage = entry.message.c_str();
+    callback_data.objectCount = static_cast<uint32_t>(objects.size());
+    callback_data.pObjects = objects.data();
+    MessengerLogCallback(entry.severity, entry.type, &callback_data, output_);
+}
+
+VKAPI_ATTR VkBool32 VKAPI_CALL MessengerAsyncLogCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                         VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                         const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                         void *user_data) {
+    static_cast<AsyncLogSink *>(user_data)->Push(AsyncLogSink::MakeEntry(message_severity, message_type, *callback_data));
+    return false;
+}
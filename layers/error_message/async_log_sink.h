@@ -0,0 +1,100 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "containers/mpsc_ring_buffer.h"
+
+// Output of the layer's own log messenger (VK_DBG_LAYER_ACTION_LOG_MSG) when the log_async setting is enabled.
+//
+// The messenger callbacks run while DebugReport::LogMsg holds debug_output_mutex, so with a synchronous callback every
+// thread which reports a message waits on the formatting and file I/O of all the others. Instead LogMsg copies the
+// callback data with MakeEntry() under the lock and only Push()es it to a bounded lock-free queue once the lock is
+// released. A background thread formats and writes the entries with MessengerLogCallback(). Messages which arrive while
+// the queue is full are dropped and their number is written to the log instead. Flush() waits for everything queued so
+// far to be written, which vkDestroyDevice does, and the destructor writes out everything still queued when the instance
+// is destroyed.
+class AsyncLogSink {
+  public:
+    static constexpr uint32_t kDefaultCapacity = 4096;
+
+    explicit AsyncLogSink(FILE *output, uint32_t capacity = kDefaultCapacity);
+    ~AsyncLogSink();
+    AsyncLogSink(const AsyncLogSink &) = delete;
+    AsyncLogSink &operator=(const AsyncLogSink &) = delete;
+
+    struct Object {
+        VkObjectType type{VK_OBJECT_TYPE_UNKNOWN};
+        uint64_t handle{0};
+        std::string name;
+        bool has_name{false};
+    };
+    struct Entry {
+        VkDebugUtilsMessageSeverityFlagBitsEXT severity{};
+        VkDebugUtilsMessageTypeFlagsEXT type{0};
+        std::string message_id_name;
+        int32_t message_id_number{0};
+        std::string message;
+        std::vector<Object> objects;
+    };
+
+    // Copies everything the callback data points to
+    static Entry MakeEntry(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity, VkDebugUtilsMessageTypeFlagsEXT message_type,
+                           const VkDebugUtilsMessengerCallbackDataEXT &callback_data);
+    // May be called from any thread without a lock
+    void Push(Entry &&entry);
+    // Returns once every entry pushed before the call is written to the output
+    void Flush();
+
+    uint64_t DroppedCount() const { return dropped_count_.load(std::memory_order_relaxed); }
+
+  private:
+    void Run();
+    void Drain();
+    void Write(const Entry &entry) const;
+
+    FILE *output_;
+    vvl::mpsc_ring_buffer<Entry> queue_;
+    std::atomic<uint64_t> dropped_count_{0};
+    uint64_t reported_dropped_count_{0};
+
+    // Only used to put the writer thread to sleep while the queue is empty, and Flush() until the writer caught up
+    std::mutex wake_lock_;
+    std::condition_variable wake_;
+    std::condition_variable flushed_;
+    // Number of entries popped and written by the writer, guarded by wake_lock_
+    uint64_t written_count_{0};
+    std::atomic<bool> writer_waiting_{false};
+    std::atomic<bool> stop_{false};
+    std::thread writer_;
+};
+
+// Messenger callback for the layer's own log output, user_data is the AsyncLogSink. DebugReport::LogMsg does not call it and
+// pushes to the sink itself once debug_output_mutex is released.
+VKAPI_ATTR VkBool32 VKAPI_CALL MessengerAsyncLogCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                         VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                         const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                         void *user_data);
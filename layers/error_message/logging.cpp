@@ -16,8 +16,10 @@
  */
 #include "logging.h"
 
+#include <algorithm>
 #include <csignal>
 #include <cstring>
+#include <iterator>
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #include <debugapi.h>
 #endif
@@ -90,23 +92,8 @@ void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
     SetDebugUtilsSeverityFlags(callbacks);
 }
 
-// Returns TRUE if the number of times this message has been logged is over the set limit
-bool DebugReport::UpdateLogMsgCounts(int32_t vuid_hash) const {
-    auto vuid_count_it = duplicate_message_count_map.find(vuid_hash);
-    if (vuid_count_it == duplicate_message_count_map.end()) {
-        duplicate_message_count_map.emplace(vuid_hash, 1);
-        return false;
-    } else {
-        if (vuid_count_it->second >= duplicate_message_limit) {
-            return true;
-        } else {
-            vuid_count_it->second++;
-            return false;
-        }
-    }
-}
-
-bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const {
+bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid,
+                              uint32_t message_id, std::optional<AsyncLogSink::Entry> &async_entry) const {
     bool bail = false;
     std::vector<VkDebugUtilsLabelEXT> queue_labels;
     std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
@@ -167,7 +154,7 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
         object_name_infos.push_back(object_name_info);
     }
 
-    const uint32_t message_id_number = text_vuid ? hash_util::VuidHash(text_vuid) : 0U;
+    const uint32_t message_id_number = text_vuid ? message_id : 0U;
 
     VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
     callback_data.flags = 0;
@@ -235,8 +222,12 @@ bool DebugReport::DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, c
         if (current_callback.IsUtils() && (current_callback.debug_utils_msg_flags & severity) &&
             (current_callback.debug_utils_msg_type & types)) {
             callback_data.pMessage = composite.c_str();
-            if (current_callback.debug_utils_callback_function_ptr(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity),
-                                                                   types, &callback_data, current_callback.pUserData)) {
+            const auto message_severity = static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(severity);
+            if (current_callback.debug_utils_callback_function_ptr == MessengerAsyncLogCallback) {
+                // Pushed by LogMsg once debug_output_mutex is released
+                async_entry = AsyncLogSink::MakeEntry(message_severity, types, callback_data);
+            } else if (current_callback.debug_utils_callback_function_ptr(message_severity, types, &callback_data,
+                                                                          current_callback.pUserData)) {
                 bail = true;
             }
         } else if (!current_callback.IsUtils() && (current_callback.debug_report_msg_flags & msg_flags)) {
@@ -517,17 +508,17 @@ VKAPI_ATTR void DeactivateInstanceDebugCallbacks(DebugReport *debug_report) {
 
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
-bool DebugReport::LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
+// Called without debug_output_mutex, everything it reads is either atomic or only written while the layer is created.
+bool DebugReport::LogMsgEnabled(uint32_t message_id, VkDebugUtilsMessageSeverityFlagsEXT severity,
                                 VkDebugUtilsMessageTypeFlagsEXT type) {
-    if (!(active_severities & severity) || !(active_types & type)) {
+    if (!(active_severities.load(std::memory_order_relaxed) & severity) || !(active_types.load(std::memory_order_relaxed) & type)) {
         return false;
     }
     // If message is in filter list, bail out very early
-    const uint32_t message_id = hash_util::VuidHash(vuid_text);
-    if (filter_message_ids.find(message_id) != filter_message_ids.end()) {
+    if (filter_message_ids.contains(message_id)) {
         return false;
     }
-    if ((duplicate_message_limit > 0) && UpdateLogMsgCounts(static_cast<int32_t>(message_id))) {
+    if ((duplicate_message_limit > 0) && !duplicate_message_counts.TryIncrement(message_id, duplicate_message_limit)) {
         // Count for this particular message is over the limit, ignore it
         return false;
     }
@@ -542,11 +533,13 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
     VkDebugUtilsMessageTypeFlagsEXT type;
 
     DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    // The VUID is hashed once, the result is used for filtering, duplicate counting and the reported messageIdNumber
+    const uint32_t message_id = hash_util::VuidHash(vuid_text);
     // Avoid logging cost if msg is to be ignored
-    if (!LogMsgEnabled(vuid_text, severity, type)) {
+    if (!LogMsgEnabled(message_id, severity, type)) {
         return false;
     }
+    std::unique_lock<std::mutex> lock(debug_output_mutex);
 
     // Best guess at an upper bound for message length. At least some of the extra space
     // should get used to store the VUID URL and text in the common case, without additional allocations.
@@ -587,17 +580,18 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
 
     // Append the spec error text to the error message, unless it contains a word treated as special
     if ((vuid_text.find("VUID-") != std::string::npos)) {
-        // Linear search makes no assumptions about the layout of the string table. This is not fast, but it does not need to be at
-        // this point in the error reporting path
-        uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
+        // The string table is generated sorted by VUID (see generate_spec_error_message.py)
+        const vuid_spec_text_pair *spec_begin = std::begin(vuid_spec_text);
+        const vuid_spec_text_pair *spec_end = std::end(vuid_spec_text);
+        const vuid_spec_text_pair *spec_entry =
+            std::lower_bound(spec_begin, spec_end, vuid_text, [](const vuid_spec_text_pair &entry, std::string_view vuid) {
+                return std::string_view(entry.vuid) < vuid;
+            });
         const char *spec_text = nullptr;
         std::string spec_type;
-        for (uint32_t i = 0; i < num_vuids; i++) {
-            if (0 == strncmp(vuid_text.data(), vuid_spec_text[i].vuid, vuid_text.size())) {
-                spec_text = vuid_spec_text[i].spec_text;
-                spec_type = vuid_spec_text[i].url_id;
-                break;
-            }
+        if (spec_entry != spec_end && vuid_text == spec_entry->vuid) {
+            spec_text = spec_entry->spec_text;
+            spec_type = spec_entry->url_id;
         }
 
         // Construct and append the specification text and link to the appropriate version of the spec
@@ -643,7 +637,20 @@ bool DebugReport::LogMsg(VkFlags msg_flags, const LogObjectList &objects, const
         }
     }
 
-    return DebugLogMsg(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data());
+    std::optional<AsyncLogSink::Entry> async_entry;
+    const bool bail = DebugLogMsg(msg_flags, objects, str_plus_spec_text.c_str(), vuid_text.data(), message_id, async_entry);
+    lock.unlock();
+    if (async_entry) {
+        // The queue is lock-free, threads logging at the same time don't wait on each other here
+        async_log_sink->Push(std::move(*async_entry));
+    }
+    return bail;
+}
+
+void DebugReport::FlushLogOutput() {
+    if (async_log_sink) {
+        async_log_sink->Flush();
+    }
 }
 
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback([[maybe_unused]] VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
@@ -18,8 +18,13 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <bitset>
+#include <cassert>
 #include <cstdarg>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -28,6 +33,7 @@
 #include <vulkan/utility/vk_struct_helper.hpp>
 
 #include "vk_layer_config.h"
+#include "error_message/async_log_sink.h"
 #include "containers/custom_containers.h"
 #include "generated/vk_layer_dispatch_table.h"
 #include "generated/vk_object_types.h"
@@ -177,13 +183,83 @@ class TypedHandleWrapper {
     VulkanTypedHandle handle_;
 };
 
+// Message ids muted through the message_id_filter setting. Every message is checked against it before being formatted, so
+// a bitset indexed by the low bits of the id rejects most of them without looking at the exact set. The set is only
+// written while the layer is created, after which it can be read from any thread.
+class MessageIdSet {
+  public:
+    void insert(uint32_t message_id) {
+        prefilter_.set(message_id & kPrefilterMask);
+        message_ids_.insert(message_id);
+    }
+    bool contains(uint32_t message_id) const {
+        return prefilter_.test(message_id & kPrefilterMask) && message_ids_.find(message_id) != message_ids_.end();
+    }
+    bool empty() const { return message_ids_.empty(); }
+    size_t size() const { return message_ids_.size(); }
+
+  private:
+    static constexpr uint32_t kPrefilterBits = 4096;
+    static constexpr uint32_t kPrefilterMask = kPrefilterBits - 1;
+
+    std::bitset<kPrefilterBits> prefilter_;
+    // Message ids are already hashes, so use unordered_set for its trivial hashing
+    vvl::unordered_set<uint32_t> message_ids_;
+};
+
+// Number of times each message id has been logged, used to enforce duplicate_message_limit without taking a lock.
+// Message ids and their counts are packed into the words of an open addressed table indexed by the low bits of the id,
+// which are updated with a compare-exchange. Ids which do not find a slot within a few probes are counted in a locked map.
+class MessageIdCounts {
+  public:
+    // Returns true for the first limit occurrences of message_id, false once the message should no longer be logged
+    bool TryIncrement(uint32_t message_id, uint32_t limit) {
+        assert(limit > 0);
+        for (uint32_t probe = 0; probe < kMaxProbes; ++probe) {
+            std::atomic<uint64_t> &entry = entries_[(message_id + probe) & kEntryMask];
+            uint64_t value = entry.load(std::memory_order_relaxed);
+            while (true) {
+                if (value == 0) {
+                    // Counts start at 1, so an empty slot is never mistaken for message id 0
+                    if (entry.compare_exchange_weak(value, Pack(message_id, 1), std::memory_order_relaxed)) {
+                        return true;
+                    }
+                } else if (static_cast<uint32_t>(value >> 32) != message_id) {
+                    break;
+                } else if (static_cast<uint32_t>(value) >= limit) {
+                    return false;
+                } else if (entry.compare_exchange_weak(value, value + 1, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+        }
+        std::lock_guard<std::mutex> guard(overflow_lock_);
+        uint32_t &count = overflow_counts_[message_id];
+        if (count >= limit) {
+            return false;
+        }
+        ++count;
+        return true;
+    }
+
+  private:
+    static constexpr uint32_t kEntryCount = 4096;
+    static constexpr uint32_t kEntryMask = kEntryCount - 1;
+    static constexpr uint32_t kMaxProbes = 8;
+
+    static uint64_t Pack(uint32_t message_id, uint32_t count) { return (uint64_t(message_id) << 32) | count; }
+
+    std::array<std::atomic<uint64_t>, kEntryCount> entries_{};
+    std::mutex overflow_lock_;
+    vvl::unordered_map<uint32_t, uint32_t> overflow_counts_;
+};
+
 struct Location;
 
 class DebugReport {
   public:
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
-    // We use unordered_set to use trivial hashing for filter_message_ids as we already store hashed values
-    vvl::unordered_set<uint32_t> filter_message_ids{};
+    MessageIdSet filter_message_ids{};
     // This mutex is defined as mutable since the normal usage for a debug report object is as 'const'. The mutable keyword allows
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_output_mutex;
@@ -191,6 +267,8 @@ class DebugReport {
     const void *instance_pnext_chain{};
     bool force_default_log_callback{false};
     uint32_t device_created = 0;
+    // Set when the layer's log output is written from a background thread (log_async setting)
+    std::unique_ptr<AsyncLogSink> async_log_sink;
 
     void SetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo);
     void SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo);
@@ -215,6 +293,8 @@ class DebugReport {
 
     bool LogMsg(VkFlags msg_flags, const LogObjectList &objects, const Location *loc, std::string_view vuid_text,
                 const char *format, va_list argptr);
+    // Returns once the messages logged so far are written to the layer's log output, called when a device is destroyed
+    void FlushLogOutput();
 
     void BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
     void EndQueueDebugUtilsLabel(VkQueue queue);
@@ -227,14 +307,15 @@ class DebugReport {
     void EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer);
 
   private:
-    bool UpdateLogMsgCounts(int32_t vuid_hash) const;
-    bool DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid) const;
-    bool LogMsgEnabled(std::string_view vuid_text, VkDebugUtilsMessageSeverityFlagsEXT severity,
-                       VkDebugUtilsMessageTypeFlagsEXT type);
-
-    VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
-    VkDebugUtilsMessageTypeFlagsEXT active_types{0};
-    mutable vvl::unordered_map<uint32_t, uint32_t> duplicate_message_count_map{};
+    // The message for async_log_sink is returned in async_entry rather than queued, so that it is pushed without the lock
+    bool DebugLogMsg(VkFlags msg_flags, const LogObjectList &objects, const char *message, const char *text_vuid,
+                     uint32_t message_id, std::optional<AsyncLogSink::Entry> &async_entry) const;
+    bool LogMsgEnabled(uint32_t message_id, VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type);
+
+    // Read without debug_output_mutex by LogMsgEnabled(), so that filtered messages never wait on the messages being logged
+    std::atomic<VkDebugUtilsMessageSeverityFlagsEXT> active_severities{0};
+    std::atomic<VkDebugUtilsMessageTypeFlagsEXT> active_types{0};
+    MessageIdCounts duplicate_message_counts{};
 
     vvl::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debug_utils_queue_labels;
     vvl::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debug_utils_cmd_buffer_labels;
@@ -69,9 +69,8 @@ void debug_printf::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo
     }
 }
 
-// Free the device memory and descriptor set associated with a command buffer.
+// Free the descriptor set associated with a command buffer, the output memory is reclaimed with the command buffer's allocator.
 void debug_printf::Validator::DestroyBuffer(BufferInfo &buffer_info) {
-    vmaDestroyBuffer(vmaAllocator, buffer_info.output_mem_block.buffer, buffer_info.output_mem_block.allocation);
     if (buffer_info.desc_set != VK_NULL_HANDLE) {
         desc_set_manager->PutBackDescriptorSet(buffer_info.desc_pool, buffer_info.desc_set);
     }
@@ -146,6 +145,9 @@ void debug_printf::Validator::PreCallRecordCreateShadersEXT(VkDevice device, uin
                                              chassis_state);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         chassis_state.unique_shader_ids[i] = unique_shader_module_id++;
+    }
+    // Every shader of the call is instrumented independently
+    GetInstrumentationThreadPool().ParallelFor(createInfoCount, [&](size_t i) {
         const bool pass = InstrumentShader(
             vvl::make_span(static_cast<const uint32_t *>(pCreateInfos[i].pCode), pCreateInfos[i].codeSize / sizeof(uint32_t)),
             chassis_state.instrumented_spirv[i], chassis_state.unique_shader_ids[i], record_obj.location);
@@ -153,7 +155,7 @@ void debug_printf::Validator::PreCallRecordCreateShadersEXT(VkDevice device, uin
             chassis_state.instrumented_create_info[i].pCode = chassis_state.instrumented_spirv[i].data();
             chassis_state.instrumented_create_info[i].codeSize = chassis_state.instrumented_spirv[i].size() * sizeof(uint32_t);
         }
-    }
+    });
 }
 
 static debug_printf::vartype vartype_lookup(char intype) {
@@ -408,7 +410,7 @@ void debug_printf::Validator::AnalyzeAndGenerateMessage(VkCommandBuffer command_
     memset(debug_output_buffer, 0, 4 * (debug_output_buffer[spvtools::kDebugOutputSizeOffset] + spvtools::kDebugOutputDataOffset));
 }
 
-// For the given command buffer, map its debug data buffers and read their contents for analysis.
+// For the given command buffer, read the contents of its debug data buffers for analysis.
 void debug_printf::CommandBuffer::PostProcess(VkQueue queue, const Location &loc) {
     auto *device_state = static_cast<debug_printf::Validator *>(&dev_data);
     if (has_draw_cmd || has_trace_rays_cmd || has_dispatch_cmd) {
@@ -418,8 +420,6 @@ void debug_printf::CommandBuffer::PostProcess(VkQueue queue, const Location &loc
         uint32_t ray_trace_index = 0;
 
         for (auto &buffer_info : gpu_buffer_list) {
-            char *data;
-
             uint32_t operation_index = 0;
             if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
                 operation_index = draw_index;
@@ -434,11 +434,8 @@ void debug_printf::CommandBuffer::PostProcess(VkQueue queue, const Location &loc
                 assert(false);
             }
 
-            VkResult result = vmaMapMemory(device_state->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&data);
-            if (result == VK_SUCCESS) {
-                device_state->AnalyzeAndGenerateMessage(VkHandle(), queue, buffer_info, operation_index, (uint32_t *)data, loc);
-                vmaUnmapMemory(device_state->vmaAllocator, buffer_info.output_mem_block.allocation);
-            }
+            auto *data = static_cast<uint32_t *>(buffer_info.output_mem_block.host_ptr);
+            device_state->AnalyzeAndGenerateMessage(VkHandle(), queue, buffer_info, operation_index, data, loc);
         }
     }
 }
@@ -669,13 +666,8 @@ void debug_printf::Validator::AllocateDebugPrintfResources(const VkCommandBuffer
     }
 
     // Allocate memory for the output block that the gpu will use to return values for printf
-    DeviceMemoryBlock output_block = {};
-    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-    buffer_info.size = output_buffer_byte_size;
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-    result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &output_block.buffer, &output_block.allocation, nullptr);
+    gpuav::BufferRange output_block = {};
+    result = cb_node->buffer_allocator.Allocate(output_buffer_byte_size, output_block);
     if (result != VK_SUCCESS) {
         ReportSetupProblem(cmd_buffer, loc, "Unable to allocate device memory.  Device could become unstable.");
         aborted = true;
@@ -683,19 +675,14 @@ void debug_printf::Validator::AllocateDebugPrintfResources(const VkCommandBuffer
     }
 
     // Clear the output block to zeros so that only printf values from the gpu will be present
-    uint32_t *data;
-    result = vmaMapMemory(vmaAllocator, output_block.allocation, reinterpret_cast<void **>(&data));
-    if (result == VK_SUCCESS) {
-        memset(data, 0, output_buffer_byte_size);
-        vmaUnmapMemory(vmaAllocator, output_block.allocation);
-    }
+    memset(output_block.host_ptr, 0, output_buffer_byte_size);
 
     VkWriteDescriptorSet desc_writes = vku::InitStructHelper();
     const uint32_t desc_count = 1;
 
     // Write the descriptor
     output_desc_buffer_info.buffer = output_block.buffer;
-    output_desc_buffer_info.offset = 0;
+    output_desc_buffer_info.offset = output_block.offset;
 
     desc_writes.descriptorCount = 1;
     desc_writes.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
@@ -761,4 +748,5 @@ void debug_printf::CommandBuffer::ResetCBState() {
         debug_printf->DestroyBuffer(buffer_info);
     }
     buffer_infos.clear();
+    buffer_allocator.Reset();
 }
@@ -24,17 +24,12 @@ namespace debug_printf {
 
 class Validator;
 
-struct DeviceMemoryBlock {
-    VkBuffer buffer;
-    VmaAllocation allocation;
-};
-
 struct BufferInfo {
-    DeviceMemoryBlock output_mem_block;
+    gpuav::BufferRange output_mem_block;
     VkDescriptorSet desc_set;
     VkDescriptorPool desc_pool;
     VkPipelineBindPoint pipeline_bind_point;
-    BufferInfo(DeviceMemoryBlock output_mem_block, VkDescriptorSet desc_set, VkDescriptorPool desc_pool,
+    BufferInfo(gpuav::BufferRange output_mem_block, VkDescriptorSet desc_set, VkDescriptorPool desc_pool,
                VkPipelineBindPoint pipeline_bind_point)
         : output_mem_block(output_mem_block), desc_set(desc_set), desc_pool(desc_pool), pipeline_bind_point(pipeline_bind_point){};
 };
@@ -72,7 +72,14 @@ static uint32_t BitBufferSize(uint32_t num_bits) {
 gpuav::DescriptorSet::DescriptorSet(const VkDescriptorSet handle, vvl::DescriptorPool *pool,
                                     const std::shared_ptr<vvl::DescriptorSetLayout const> &layout, uint32_t variable_count,
                                     ValidationStateTracker *state_data)
-    : vvl::DescriptorSet(handle, pool, layout, variable_count, state_data) {}
+    : vvl::DescriptorSet(handle, pool, layout, variable_count, state_data) {
+    // Shader instrumentation is tracking inline uniform blocks as scalars, so they only get one state each
+    binding_state_start_.reserve(bindings_.size());
+    for (const auto &binding : bindings_) {
+        binding_state_start_.emplace_back(descriptor_state_count_);
+        descriptor_state_count_ += (binding->type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) ? 1 : binding->count;
+    }
+}
 
 gpuav::DescriptorSet::~DescriptorSet() {
     Destroy();
@@ -259,23 +266,93 @@ static glsl::DescriptorState GetInData(const vvl::MutableDescriptor &desc) {
 }
 
 template <typename Binding>
-void FillBindingInData(const Binding &binding, glsl::DescriptorState *data, uint32_t &index) {
-    for (uint32_t di = 0; di < binding.count; di++) {
+void FillBindingInData(const Binding &binding, glsl::DescriptorState *data, uint32_t first, uint32_t count) {
+    for (uint32_t di = first; di < first + count; di++) {
         if (!binding.updated[di]) {
-            data[index++] = glsl::DescriptorState();
+            data[di] = glsl::DescriptorState();
         } else {
-            data[index++] = GetInData(binding.descriptors[di]);
+            data[di] = GetInData(binding.descriptors[di]);
         }
     }
 }
 
 // Inline Uniforms are currently treated as a single descriptor. Writes to any offsets cause the whole range to be valid.
 template <>
-void FillBindingInData(const vvl::InlineUniformBinding &binding, glsl::DescriptorState *data, uint32_t &index) {
-    data[index++] = glsl::DescriptorState(DescriptorClass::InlineUniform, glsl::kDebugInputBindlessSkipId, vvl::kU32Max);
+void FillBindingInData(const vvl::InlineUniformBinding &, glsl::DescriptorState *data, uint32_t, uint32_t) {
+    data[0] = glsl::DescriptorState(DescriptorClass::InlineUniform, glsl::kDebugInputBindlessSkipId, vvl::kU32Max);
 }
 }  // namespace gpuav
 
+void gpuav::DescriptorSet::FillState(glsl::DescriptorState *data, const DirtyRange &range) const {
+    const auto &binding = *bindings_[range.binding_index];
+    data += binding_state_start_[range.binding_index];
+    switch (binding.descriptor_class) {
+        case DescriptorClass::InlineUniform:
+            FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(binding), data, range.first, range.count);
+            break;
+        case DescriptorClass::GeneralBuffer:
+            FillBindingInData(static_cast<const vvl::BufferBinding &>(binding), data, range.first, range.count);
+            break;
+        case DescriptorClass::TexelBuffer:
+            FillBindingInData(static_cast<const vvl::TexelBinding &>(binding), data, range.first, range.count);
+            break;
+        case DescriptorClass::Mutable:
+            FillBindingInData(static_cast<const vvl::MutableBinding &>(binding), data, range.first, range.count);
+            break;
+        case DescriptorClass::PlainSampler:
+            FillBindingInData(static_cast<const vvl::SamplerBinding &>(binding), data, range.first, range.count);
+            break;
+        case DescriptorClass::ImageSampler:
+            FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(binding), data, range.first, range.count);
+            break;
+        case DescriptorClass::Image:
+            FillBindingInData(static_cast<const vvl::ImageBinding &>(binding), data, range.first, range.count);
+            break;
+        case DescriptorClass::AccelerationStructure:
+            FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(binding), data, range.first, range.count);
+            break;
+        default:
+            assert(false);
+    }
+}
+
+// Record the descriptors touched by a write or copy update, following the same roll over into the next bindings
+void gpuav::DescriptorSet::MarkDirty(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) {
+    if (all_dirty_) {
+        return;
+    }
+    for (uint32_t index = GetIndexFromBinding(binding); descriptor_count > 0 && index < bindings_.size(); index++) {
+        const uint32_t binding_count = bindings_[index]->count;
+        if (array_element >= binding_count) {
+            // Bindings with descriptorCount == 0 are skipped
+            array_element -= binding_count;
+            continue;
+        }
+        const uint32_t count = std::min(descriptor_count, binding_count - array_element);
+        DirtyRange range{index, array_element, count};
+        if (bindings_[index]->type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) {
+            // The counts are in bytes, but there is only one state for the whole block
+            range = {index, 0, 1};
+        }
+        if (!dirty_ranges_.empty() && dirty_ranges_.back().binding_index == index && dirty_ranges_.back().first <= range.first &&
+            dirty_ranges_.back().first + dirty_ranges_.back().count >= range.first) {
+            auto &last = dirty_ranges_.back();
+            last.count = std::max(last.first + last.count, range.first + range.count) - last.first;
+        } else if (dirty_ranges_.size() < kMaxDirtyRanges) {
+            dirty_ranges_.emplace_back(range);
+        } else {
+            all_dirty_ = true;
+            dirty_ranges_.clear();
+            return;
+        }
+        descriptor_count -= count;
+        array_element = 0;
+    }
+}
+
+// The state of a version is only written again while nothing else holds a reference to it. Command buffers keep the states they
+// were recorded with until they are reset, which covers any submission of them that could still be executing. Otherwise the
+// next version is a copy of the last one, either way only the descriptors written since then are encoded again.
 std::shared_ptr<gpuav::DescriptorSet::State> gpuav::DescriptorSet::GetCurrentState() {
     auto guard = Lock();
     Validator *gv_dev = static_cast<Validator *>(state_data_);
@@ -283,31 +360,34 @@ std::shared_ptr<gpuav::DescriptorSet::State> gpuav::DescriptorSet::GetCurrentSta
     if (last_used_state_ && last_used_state_->version == cur_version) {
         return last_used_state_;
     }
+    const bool incremental = !all_dirty_ && last_used_state_ && last_used_state_->data;
+    if (incremental && last_used_state_.use_count() == 1) {
+        State &state = *last_used_state_;
+        for (const auto &range : dirty_ranges_) {
+            FillState(state.data, range);
+            const VkDeviceSize offset = (binding_state_start_[range.binding_index] + range.first) * sizeof(glsl::DescriptorState);
+            [[maybe_unused]] VkResult result =
+                vmaFlushAllocation(state.allocator, state.allocation, offset, range.count * sizeof(glsl::DescriptorState));
+            assert(result == VK_SUCCESS);
+        }
+        state.version = cur_version;
+        dirty_ranges_.clear();
+        return last_used_state_;
+    }
+
     auto next_state = std::make_shared<State>();
     next_state->set = VkHandle();
     next_state->version = cur_version;
     next_state->allocator = gv_dev->vmaAllocator;
 
-    uint32_t descriptor_count = 0;  // Number of descriptors, including all array elements
-    if (GetBindingCount() > 0) {
-        for (const auto &binding : *this) {
-            // Shader instrumentation is tracking inline uniform blocks as scalars. Don't try to validate inline uniform
-            // blocks
-            if (binding->type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) {
-                descriptor_count++;
-            } else {
-                descriptor_count += binding->count;
-            }
-        }
-    }
-    if (descriptor_count == 0) {
+    if (descriptor_state_count_ == 0) {
         // no descriptors case, return a dummy state object
         last_used_state_ = next_state;
         return last_used_state_;
     }
 
     VkBufferCreateInfo buffer_info = vku::InitStruct<VkBufferCreateInfo>();
-    buffer_info.size = descriptor_count * sizeof(glsl::DescriptorState);
+    buffer_info.size = descriptor_state_count_ * sizeof(glsl::DescriptorState);
     buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
 
     // The descriptor state buffer can be very large (4mb+ in some games). Allocating it as HOST_CACHED
@@ -319,41 +399,21 @@ std::shared_ptr<gpuav::DescriptorSet::State> gpuav::DescriptorSet::GetCurrentSta
     if (result != VK_SUCCESS) {
         return nullptr;
     }
-    glsl::DescriptorState *data{nullptr};
-    result = vmaMapMemory(next_state->allocator, next_state->allocation, reinterpret_cast<void **>(&data));
+    result = vmaMapMemory(next_state->allocator, next_state->allocation, reinterpret_cast<void **>(&next_state->data));
     assert(result == VK_SUCCESS);
-    uint32_t index = 0;
-    for (uint32_t i = 0; i < bindings_.size(); i++) {
-        const auto &binding = *bindings_[i];
-        switch (binding.descriptor_class) {
-            case DescriptorClass::InlineUniform:
-                FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::GeneralBuffer:
-                FillBindingInData(static_cast<const vvl::BufferBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::TexelBuffer:
-                FillBindingInData(static_cast<const vvl::TexelBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::Mutable:
-                FillBindingInData(static_cast<const vvl::MutableBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::PlainSampler:
-                FillBindingInData(static_cast<const vvl::SamplerBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::ImageSampler:
-                FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::Image:
-                FillBindingInData(static_cast<const vvl::ImageBinding &>(binding), data, index);
-                break;
-            case DescriptorClass::AccelerationStructure:
-                FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(binding), data, index);
-                break;
-            default:
-                assert(false);
+    if (incremental) {
+        memcpy(next_state->data, last_used_state_->data, static_cast<size_t>(buffer_info.size));
+        for (const auto &range : dirty_ranges_) {
+            FillState(next_state->data, range);
+        }
+    } else {
+        for (uint32_t i = 0; i < bindings_.size(); i++) {
+            FillState(next_state->data, DirtyRange{i, 0, bindings_[i]->count});
         }
     }
+    dirty_ranges_.clear();
+    all_dirty_ = false;
+
     VkBufferDeviceAddressInfo buffer_device_address_info = vku::InitStructHelper();
     buffer_device_address_info.buffer = next_state->buffer;
 
@@ -366,11 +426,9 @@ std::shared_ptr<gpuav::DescriptorSet::State> gpuav::DescriptorSet::GetCurrentSta
     }
     assert(next_state->device_addr != 0);
 
-    // Flush the descriptor state buffer before unmapping so that the new state is visible to the GPU
+    // Flush the descriptor state buffer so that the new state is visible to the GPU
     result = vmaFlushAllocation(next_state->allocator, next_state->allocation, 0, VK_WHOLE_SIZE);
-    // No good way to handle this error, we should still try to unmap.
     assert(result == VK_SUCCESS);
-    vmaUnmapMemory(next_state->allocator, next_state->allocation);
 
     last_used_state_ = next_state;
     return next_state;
@@ -475,20 +533,30 @@ std::map<uint32_t, std::vector<uint32_t>> gpuav::DescriptorSet::State::UsedDescr
     return used_descs;
 }
 
-gpuav::DescriptorSet::State::~State() { vmaDestroyBuffer(allocator, buffer, allocation); }
+gpuav::DescriptorSet::State::~State() {
+    if (data) {
+        vmaUnmapMemory(allocator, allocation);
+    }
+    vmaDestroyBuffer(allocator, buffer, allocation);
+}
 
 void gpuav::DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
+    // The writes are marked dirty by PerformWriteUpdate()
     vvl::DescriptorSet::PerformPushDescriptorsUpdate(write_count, write_descs);
     current_version_++;
 }
 
 void gpuav::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &write_desc) {
     vvl::DescriptorSet::PerformWriteUpdate(write_desc);
+    auto guard = Lock();
+    MarkDirty(write_desc.dstBinding, write_desc.dstArrayElement, write_desc.descriptorCount);
     current_version_++;
 }
 
 void gpuav::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &copy_desc, const vvl::DescriptorSet &src_set) {
     vvl::DescriptorSet::PerformCopyUpdate(copy_desc, src_set);
+    auto guard = Lock();
+    MarkDirty(copy_desc.dstBinding, copy_desc.dstArrayElement, copy_desc.descriptorCount);
     current_version_++;
 }
 
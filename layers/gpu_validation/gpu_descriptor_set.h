@@ -25,6 +25,9 @@
 namespace gpuav {
 
 class Validator;
+namespace glsl {
+struct DescriptorState;
+}  // namespace glsl
 
 class DescriptorSet : public vvl::DescriptorSet {
   public:
@@ -42,6 +45,8 @@ class DescriptorSet : public vvl::DescriptorSet {
         VmaAllocation allocation{nullptr};
         VkBuffer buffer{VK_NULL_HANDLE};
         VkDeviceAddress device_addr{0};
+        // Input states stay mapped for their whole lifetime, so that later versions can be written incrementally
+        glsl::DescriptorState *data{nullptr};
 
         std::map<uint32_t, std::vector<uint32_t>> UsedDescriptors(const DescriptorSet &set) const;
     };
@@ -62,9 +67,25 @@ class DescriptorSet : public vvl::DescriptorSet {
         VkBuffer buffer{VK_NULL_HANDLE};
         VkDeviceAddress device_addr{0};
     };
+    // Descriptors written since last_used_state_ was filled, relative to the start of the binding
+    struct DirtyRange {
+        uint32_t binding_index;
+        uint32_t first;
+        uint32_t count;
+    };
+    // Past this many ranges, the next state is filled from scratch
+    static constexpr size_t kMaxDirtyRanges = 64;
+
     std::lock_guard<std::mutex> Lock() const { return std::lock_guard<std::mutex>(state_lock_); }
+    void MarkDirty(uint32_t binding, uint32_t array_element, uint32_t descriptor_count);
+    void FillState(glsl::DescriptorState *data, const DirtyRange &range) const;
 
     Layout layout_;
+    // Index of the first glsl::DescriptorState of each binding, and the total number of them
+    std::vector<uint32_t> binding_state_start_;
+    uint32_t descriptor_state_count_{0};
+    std::vector<DirtyRange> dirty_ranges_;
+    bool all_dirty_{true};
     std::atomic<uint32_t> current_version_{0};
     std::shared_ptr<State> last_used_state_;
     std::shared_ptr<State> output_state_;
@@ -87,6 +87,12 @@ void gpuav::Validator::UpdateCmdBufImageLayouts(const vvl::CommandBuffer &cb_sta
         auto image_state = Get<vvl::Image>(image);
         if (image_state && image_state->GetId() == layout_map_entry.second.id) {
             auto guard = image_state->layout_range_map->WriteLock();
+            if (const auto *cb_entry = subres_map->GetUniformEntry()) {
+                if (cb_entry->current_layout != image_layout_map::kInvalidLayout) {
+                    image_state->layout_range_map->SetUniformLayout(cb_entry->current_layout);
+                }
+                continue;
+            }
             sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
         }
     }
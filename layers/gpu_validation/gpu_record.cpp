@@ -16,10 +16,6 @@
  */
 
 #include <cmath>
-#include <fstream>
-#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
-#include <unistd.h>
-#endif
 #include "utils/cast_utils.h"
 #include "utils/shader_utils.h"
 #include "utils/hash_util.h"
@@ -30,9 +26,6 @@
 #include "generated/layer_chassis_dispatch.h"
 #include "chassis/chassis_modification_state.h"
 
-// Generated shaders
-#include "generated/gpu_inst_shader_hash.h"
-
 void gpuav::Validator::PreCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo,
                                                  const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer,
                                                  const RecordObject &record_obj, chassis::CreateBuffer &chassis_state) {
@@ -51,6 +44,82 @@ void gpuav::Validator::PreCallRecordCreateBuffer(VkDevice device, const VkBuffer
     BaseClass::PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj, chassis_state);
 }
 
+// The deferred checks of a batch which could not be submitted ahead of the submission are put at the start of the batch
+void gpuav::Validator::AddInlineChecks(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
+                                       chassis::QueueSubmit &chassis_state) {
+    auto queue_state = Get<gpuav::Queue>(queue);
+    if (!queue_state) {
+        return;
+    }
+    const std::vector<std::vector<VkCommandBuffer>> inline_checks = queue_state->TakeInlineChecks();
+    if (inline_checks.empty()) {
+        return;
+    }
+    chassis_state.modified_submits.assign(pSubmits, pSubmits + submitCount);
+    chassis_state.modified_command_buffers.resize(submitCount);
+    for (uint32_t i = 0; i < submitCount && i < inline_checks.size(); ++i) {
+        if (inline_checks[i].empty()) {
+            continue;
+        }
+        std::vector<VkCommandBuffer> &command_buffers = chassis_state.modified_command_buffers[i];
+        command_buffers = inline_checks[i];
+        command_buffers.insert(command_buffers.end(), pSubmits[i].pCommandBuffers,
+                               pSubmits[i].pCommandBuffers + pSubmits[i].commandBufferCount);
+        chassis_state.modified_submits[i].commandBufferCount = static_cast<uint32_t>(command_buffers.size());
+        chassis_state.modified_submits[i].pCommandBuffers = command_buffers.data();
+    }
+    chassis_state.pSubmits = chassis_state.modified_submits.data();
+}
+
+void gpuav::Validator::AddInlineChecks(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
+                                       chassis::QueueSubmit2 &chassis_state) {
+    auto queue_state = Get<gpuav::Queue>(queue);
+    if (!queue_state) {
+        return;
+    }
+    const std::vector<std::vector<VkCommandBuffer>> inline_checks = queue_state->TakeInlineChecks();
+    if (inline_checks.empty()) {
+        return;
+    }
+    chassis_state.modified_submits.assign(pSubmits, pSubmits + submitCount);
+    chassis_state.modified_command_buffers.resize(submitCount);
+    for (uint32_t i = 0; i < submitCount && i < inline_checks.size(); ++i) {
+        if (inline_checks[i].empty()) {
+            continue;
+        }
+        std::vector<VkCommandBufferSubmitInfo> &command_buffers = chassis_state.modified_command_buffers[i];
+        for (VkCommandBuffer checks_cb : inline_checks[i]) {
+            VkCommandBufferSubmitInfo cb_info = vku::InitStructHelper();
+            cb_info.commandBuffer = checks_cb;
+            command_buffers.emplace_back(cb_info);
+        }
+        command_buffers.insert(command_buffers.end(), pSubmits[i].pCommandBufferInfos,
+                               pSubmits[i].pCommandBufferInfos + pSubmits[i].commandBufferInfoCount);
+        chassis_state.modified_submits[i].commandBufferInfoCount = static_cast<uint32_t>(command_buffers.size());
+        chassis_state.modified_submits[i].pCommandBufferInfos = command_buffers.data();
+    }
+    chassis_state.pSubmits = chassis_state.modified_submits.data();
+}
+
+void gpuav::Validator::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
+                                                const RecordObject &record_obj, chassis::QueueSubmit &chassis_state) {
+    BaseClass::PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj, chassis_state);
+    AddInlineChecks(queue, submitCount, pSubmits, chassis_state);
+}
+
+void gpuav::Validator::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
+                                                 const RecordObject &record_obj, chassis::QueueSubmit2 &chassis_state) {
+    BaseClass::PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj, chassis_state);
+    AddInlineChecks(queue, submitCount, pSubmits, chassis_state);
+}
+
+void gpuav::Validator::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits,
+                                                    VkFence fence, const RecordObject &record_obj,
+                                                    chassis::QueueSubmit2 &chassis_state) {
+    BaseClass::PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj, chassis_state);
+    AddInlineChecks(queue, submitCount, pSubmits, chassis_state);
+}
+
 void gpuav::Validator::PostCallRecordGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
                                                                  VkPhysicalDeviceProperties *device_props,
                                                                  const RecordObject &record_obj) {
@@ -129,8 +198,7 @@ void gpuav::Validator::PreCallRecordCreateShaderModule(VkDevice device, const Vk
         chassis_state.instrumented_create_info.codeSize = chassis_state.instrumented_spirv.size() * sizeof(uint32_t);
         chassis_state.unique_shader_id = shader_id;
         if (gpuav_settings.cache_instrumented_shaders) {
-            instrumented_shaders.emplace(shader_id,
-                                         std::make_pair(chassis_state.instrumented_spirv.size(), chassis_state.instrumented_spirv));
+            instrumented_shaders.Add(shader_id, chassis_state.instrumented_spirv);
         }
     }
 }
@@ -141,17 +209,24 @@ void gpuav::Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t c
                                                      const RecordObject &record_obj, chassis::ShaderObject &chassis_state) {
     BaseClass::PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                              chassis_state);
+    std::vector<uint32_t> to_instrument;
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         if (gpuav_settings.select_instrumented_shaders && !CheckForGpuAvEnabled(pCreateInfos[i].pNext)) continue;
         if (gpuav_settings.cache_instrumented_shaders) {
             const uint32_t shader_hash = hash_util::ShaderHash(pCreateInfos[i].pCode, pCreateInfos[i].codeSize);
-            if (CheckForCachedInstrumentedShader(i, chassis_state.unique_shader_ids[i], chassis_state)) {
+            chassis_state.unique_shader_ids[i] = shader_hash;
+            if (CheckForCachedInstrumentedShader(i, shader_hash, chassis_state)) {
                 continue;
             }
-            chassis_state.unique_shader_ids[i] = shader_hash;
         } else {
             chassis_state.unique_shader_ids[i] = unique_shader_module_id++;
         }
+        to_instrument.push_back(i);
+    }
+
+    // Every shader of the call is instrumented independently
+    GetInstrumentationThreadPool().ParallelFor(to_instrument.size(), [&](size_t job) {
+        const uint32_t i = to_instrument[job];
         const bool pass = InstrumentShader(
             vvl::make_span(static_cast<const uint32_t *>(pCreateInfos[i].pCode), pCreateInfos[i].codeSize / sizeof(uint32_t)),
             chassis_state.instrumented_spirv[i], chassis_state.unique_shader_ids[i], record_obj.location);
@@ -159,12 +234,10 @@ void gpuav::Validator::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t c
             chassis_state.instrumented_create_info[i].pCode = chassis_state.instrumented_spirv[i].data();
             chassis_state.instrumented_create_info[i].codeSize = chassis_state.instrumented_spirv[i].size() * sizeof(uint32_t);
             if (gpuav_settings.cache_instrumented_shaders) {
-                instrumented_shaders.emplace(
-                    chassis_state.unique_shader_ids[i],
-                    std::make_pair(chassis_state.instrumented_spirv[i].size(), chassis_state.instrumented_spirv[i]));
+                instrumented_shaders.Add(chassis_state.unique_shader_ids[i], chassis_state.instrumented_spirv[i]);
             }
         }
-    }
+    });
 }
 
 // Clean up device-related resources
@@ -175,26 +248,15 @@ void gpuav::Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAlloc
     for (auto &[key, shared_resources] : shared_validation_resources_map) {
         shared_resources->Destroy(*this);
     }
-    if (app_buffer_device_addresses.buffer) {
-        vmaDestroyBuffer(vmaAllocator, app_buffer_device_addresses.buffer, app_buffer_device_addresses.allocation);
-    }
-    if (gpuav_settings.cache_instrumented_shaders && !instrumented_shaders.empty()) {
-        std::ofstream file_stream(instrumented_shader_cache_path, std::ofstream::out | std::ofstream::binary);
-        if (file_stream) {
-            file_stream.write(INST_SHADER_GIT_HASH, sizeof(INST_SHADER_GIT_HASH));
-            uint32_t datasize = static_cast<uint32_t>(instrumented_shaders.size());
-            file_stream.write(reinterpret_cast<char *>(&datasize), sizeof(uint32_t));
-            for (auto &record : instrumented_shaders) {
-                // Hash of shader
-                file_stream.write(reinterpret_cast<const char *>(&record.first), sizeof(uint32_t));
-                // Size of vector of code
-                auto vector_size = record.second.first;
-                file_stream.write(reinterpret_cast<const char *>(&vector_size), sizeof(uint32_t));
-                // Vector contents
-                file_stream.write(reinterpret_cast<const char *>(record.second.second.data()), vector_size * sizeof(uint32_t));
-            }
-            file_stream.close();
-        }
+    // The tables themselves are kept, the command buffers destroyed below still release them
+    if (app_bda_table) {
+        DestroyBDATable(*app_bda_table);
+    }
+    for (auto &table : retired_bda_tables) {
+        DestroyBDATable(*table);
+    }
+    if (gpuav_settings.cache_instrumented_shaders) {
+        instrumented_shaders.Save();
     }
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 }
@@ -279,6 +341,18 @@ void gpuav::Validator::PostCallRecordCmdNextSubpass2(VkCommandBuffer commandBuff
     RecordCmdNextSubpassLayouts(commandBuffer, pSubpassBeginInfo->contents);
 }
 
+void gpuav::Validator::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
+    BaseClass::PostCallRecordEndCommandBuffer(commandBuffer, record_obj);
+    if (record_obj.result != VK_SUCCESS) {
+        return;
+    }
+    auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
+    if (!cb_state) {
+        return;
+    }
+    RecordDeferredDispatchChecks(*cb_state, record_obj.location);
+}
+
 void gpuav::Validator::PostCallRecordCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                                            VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount,
                                                            const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount,
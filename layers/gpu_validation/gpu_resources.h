@@ -35,6 +35,14 @@ struct DeviceMemoryBlock {
     }
 };
 
+// Part of one of the persistently mapped buffers handed out by gpu_tracker::BufferSubAllocator
+struct BufferRange {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    void *host_ptr = nullptr;
+};
+
 struct AccelerationStructureBuildValidationState {
     // some resources can be used each time so only to need to create once
     bool initialized = false;
@@ -73,7 +81,6 @@ class CommandResources {
     static constexpr uint32_t push_constant_words = 2;
     VkPushConstantRange GetPushConstantRange();
     VkDescriptorSet instrumentation_desc_set = VK_NULL_HANDLE;
-    VkDescriptorPool instrumentation_desc_pool = VK_NULL_HANDLE;
     uint32_t operation_index =
         0;  // Draw/dispatch/trace rays index in cmd buffer. 0 for all other operations (TODO: maintain it correctly)
     VkPipelineBindPoint pipeline_bind_point = VK_PIPELINE_BIND_POINT_MAX_ENUM;
@@ -175,9 +182,8 @@ class PreCopyBufferToImageResources : public CommandResources {
     VkDescriptorSet desc_set = VK_NULL_HANDLE;
     VkBuffer src_buffer = VK_NULL_HANDLE;
 
-    // Buffer holding the copy regions obtained from pRegions
-    VkBuffer copy_src_regions_buffer = VK_NULL_HANDLE;
-    VmaAllocation copy_src_regions_allocation = VK_NULL_HANDLE;
+    // Buffer holding the copy regions obtained from pRegions, owned by the command buffer
+    BufferRange copy_src_regions = {};
 
     void Destroy(Validator &validator) final;
     bool LogCustomValidationMessage(Validator &validator, const uint32_t *error_record, const uint32_t operation_index,
@@ -187,7 +193,6 @@ class PreCopyBufferToImageResources : public CommandResources {
         VkDescriptorSetLayout ds_layout = VK_NULL_HANDLE;
         VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
         VkPipeline pipeline = VK_NULL_HANDLE;
-        VmaPool copy_regions_pool = VK_NULL_HANDLE;
 
         void Destroy(Validator &validator);
     };
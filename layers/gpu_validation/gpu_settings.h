@@ -19,6 +19,7 @@
 struct GpuAVSettings {
     bool validate_descriptors = true;
     bool validate_indirect_buffer = true;
+    bool batch_indirect_dispatch_checks = false;
     bool validate_copies = true;
     bool validate_ray_query = true;
     bool vma_linear_output = true;
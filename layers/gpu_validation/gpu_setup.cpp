@@ -16,7 +16,6 @@
  */
 
 #include <cmath>
-#include <fstream>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
 #include <unistd.h>
 #endif
@@ -38,7 +37,6 @@
 #include "generated/gpu_pre_draw_vert.h"
 #include "generated/gpu_pre_dispatch_comp.h"
 #include "generated/gpu_pre_trace_rays_rgen.h"
-#include "generated/gpu_inst_shader_hash.h"
 
 std::shared_ptr<vvl::Buffer> gpuav::Validator::CreateBufferState(VkBuffer handle, const VkBufferCreateInfo *pCreateInfo) {
     return std::make_shared<Buffer>(*this, handle, pCreateInfo, *desc_heap);
@@ -141,27 +139,13 @@ void gpuav::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const
                                      shaderInt64 && enabled_features.bufferDeviceAddress);
 
     if (buffer_device_address_enabled) {
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        // We need 2 words per address (address and size), 1 word for the start of sizes index, 2 words for the address section
-        // bounds, and 2 more words for the size section bounds
-        app_bda_buffer_size =
-            (1 + (gpuav_settings.gpuav_max_buffer_device_addresses + 2) + (gpuav_settings.gpuav_max_buffer_device_addresses + 2)) *
-            8;  // 64 bit words
-        buffer_info.size = app_bda_buffer_size;
-        // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
-        // and manually flushing it at the end of the state updates is faster than using HOST_COHERENT.
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-        VkResult result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &app_buffer_device_addresses.buffer,
-                                          &app_buffer_device_addresses.allocation, nullptr);
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(device, loc,
-                               "Unable to allocate device memory for buffer device address data. Device could become unstable.",
-                               true);
+        // The table starts with room for gpuav_max_buffer_device_addresses and grows when more addresses are in use
+        app_bda_table = CreateBDATable(std::max(gpuav_settings.gpuav_max_buffer_device_addresses, 1u), loc);
+        if (!app_bda_table) {
             aborted = true;
             return;
         }
+        EnableBufferAddressChangeTracking();
     }
 
     if (IsExtEnabled(device_extensions.vk_ext_descriptor_buffer)) {
@@ -233,26 +217,12 @@ void gpuav::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const
 #endif
         instrumented_shader_cache_path += ".bin";
 
-        std::ifstream file_stream(instrumented_shader_cache_path, std::ifstream::in | std::ifstream::binary);
-        if (file_stream) {
-            char inst_shader_hash[sizeof(INST_SHADER_GIT_HASH)];
-            file_stream.read(inst_shader_hash, sizeof(inst_shader_hash));
-            if (!strncmp(inst_shader_hash, INST_SHADER_GIT_HASH, sizeof(INST_SHADER_GIT_HASH))) {
-                uint32_t num_shaders = 0;
-                file_stream.read(reinterpret_cast<char *>(&num_shaders), sizeof(uint32_t));
-                for (uint32_t i = 0; i < num_shaders; ++i) {
-                    uint32_t hash;
-                    uint32_t shader_length;
-                    std::vector<uint32_t> shader_code;
-                    file_stream.read(reinterpret_cast<char *>(&hash), sizeof(uint32_t));
-                    file_stream.read(reinterpret_cast<char *>(&shader_length), sizeof(uint32_t));
-                    shader_code.resize(shader_length);
-                    file_stream.read(reinterpret_cast<char *>(shader_code.data()), 4 * shader_length);
-                    instrumented_shaders.emplace(hash, std::make_pair(shader_length, std::move(shader_code)));
-                }
-            }
-            file_stream.close();
-        }
+        // Everything besides the original SPIR-V which changes the output of InstrumentShader
+        hash_util::HashCombiner config_hash;
+        config_hash << gpuav_settings.validate_descriptors << buffer_device_address_enabled
+                    << (enabled_features.rayQuery && gpuav_settings.validate_ray_query) << desc_set_bind_index
+                    << PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
+        instrumented_shaders.Load(instrumented_shader_cache_path, config_hash.Value());
     }
 
     // Create command indices buffer
@@ -370,10 +340,6 @@ void gpuav::PreCopyBufferToImageResources::SharedResources::Destroy(gpuav::Valid
         DispatchDestroyPipeline(validator.device, pipeline, nullptr);
         pipeline = VK_NULL_HANDLE;
     }
-    if (copy_regions_pool != VK_NULL_HANDLE) {
-        vmaDestroyPool(validator.vmaAllocator, copy_regions_pool);
-        copy_regions_pool = VK_NULL_HANDLE;
-    }
 }
 
 void gpuav::AccelerationStructureBuildValidationState::Destroy(VkDevice device, VmaAllocator &vmaAllocator) {
@@ -474,13 +440,8 @@ void gpuav::RestorablePipelineState::Restore(VkCommandBuffer command_buffer) con
     }
 }
 
-void gpuav::CommandResources::Destroy(gpuav::Validator &validator) {
-    if (instrumentation_desc_set != VK_NULL_HANDLE) {
-        validator.desc_set_manager->PutBackDescriptorSet(instrumentation_desc_pool, instrumentation_desc_set);
-        instrumentation_desc_set = VK_NULL_HANDLE;
-        instrumentation_desc_pool = VK_NULL_HANDLE;
-    }
-}
+// The instrumentation descriptor set is owned, and recycled, by the command buffer
+void gpuav::CommandResources::Destroy(gpuav::Validator &) { instrumentation_desc_set = VK_NULL_HANDLE; }
 
 void gpuav::PreDrawResources::Destroy(gpuav::Validator &validator) {
     if (buffer_desc_set != VK_NULL_HANDLE) {
@@ -511,11 +472,5 @@ void gpuav::PreCopyBufferToImageResources::Destroy(gpuav::Validator &validator)
         desc_pool = VK_NULL_HANDLE;
     }
 
-    if (copy_src_regions_buffer != VK_NULL_HANDLE) {
-        vmaDestroyBuffer(validator.vmaAllocator, copy_src_regions_buffer, copy_src_regions_allocation);
-        copy_src_regions_buffer = VK_NULL_HANDLE;
-        copy_src_regions_allocation = VK_NULL_HANDLE;
-    }
-
     CommandResources::Destroy(validator);
 }
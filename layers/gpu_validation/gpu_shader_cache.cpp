@@ -0,0 +1,242 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_validation/gpu_shader_cache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+#include <vulkan/vulkan_core.h>
+#include "utils/hash_util.h"
+#include "generated/gpu_inst_shader_hash.h"
+
+namespace gpu_tracker {
+
+// Cache file layout:
+//   FileHeader
+//   FileEntry[entry_count]
+//   SPIR-V code of every entry, at FileEntry::offset
+struct InstrumentedShaderCache::FileHeader {
+    uint32_t magic;
+    uint32_t file_version;
+    // INST_SHADER_GIT_HASH of the layer which wrote the file, it only changes with the GLSL instrumentation shaders
+    char build_id[48];
+    // INST_PASS_GIT_HASH of the layer which wrote the file, it changes with the passes in gpu_validation/spirv
+    char pass_id[48];
+    // VK_HEADER_VERSION_COMPLETE of the layer which wrote the file
+    uint32_t layer_version;
+    uint32_t entry_count;
+    // Hash of the FileEntry table
+    uint64_t entries_checksum;
+};
+
+struct InstrumentedShaderCache::FileEntry {
+    uint64_t config_hash;
+    uint32_t shader_hash;
+    uint32_t word_count;
+    // In bytes, from the start of the file
+    uint64_t offset;
+    // Hash of the code
+    uint64_t checksum;
+};
+
+static constexpr uint32_t kFileMagic = 0x43534147;  // "GASC"
+// Bump when the layout of the file changes
+static constexpr uint32_t kFileVersion = 3;
+
+void InstrumentedShaderCache::Load(const std::string &path, uint64_t config_hash) {
+    std::lock_guard<std::mutex> guard(lock_);
+    path_ = path;
+    config_hash_ = config_hash;
+    if (!file_.Open(path)) {
+        return;
+    }
+
+    const uint8_t *data = file_.Data();
+    const size_t size = file_.Size();
+    FileHeader header;
+    if (size < sizeof(header)) {
+        file_.Close();
+        return;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != kFileMagic || header.file_version != kFileVersion || header.layer_version != VK_HEADER_VERSION_COMPLETE ||
+        std::strncmp(header.build_id, INST_SHADER_GIT_HASH, sizeof(header.build_id)) != 0 ||
+        std::strncmp(header.pass_id, INST_PASS_GIT_HASH, sizeof(header.pass_id)) != 0 ||
+        header.entry_count > (size - sizeof(header)) / sizeof(FileEntry)) {
+        file_.Close();
+        return;
+    }
+    // The mapping is page aligned and the header size is a multiple of the entry alignment
+    const auto *file_entries = reinterpret_cast<const FileEntry *>(data + sizeof(header));
+    const size_t code_start = sizeof(header) + header.entry_count * sizeof(FileEntry);
+    if (hash_util::CacheDataHash(file_entries, header.entry_count * sizeof(FileEntry)) != header.entries_checksum) {
+        file_.Close();
+        return;
+    }
+
+    for (uint32_t i = 0; i < header.entry_count; ++i) {
+        const FileEntry &file_entry = file_entries[i];
+        const bool in_bounds = file_entry.offset >= code_start && file_entry.offset <= size &&
+                               (file_entry.offset % sizeof(uint32_t)) == 0 && file_entry.word_count != 0 &&
+                               file_entry.word_count <= (size - file_entry.offset) / sizeof(uint32_t);
+        if (!in_bounds) {
+            // The table checksum matched, so this was not written by us
+            entries_.clear();
+            other_config_entries_.clear();
+            file_.Close();
+            return;
+        }
+        if (file_entry.config_hash != config_hash) {
+            other_config_entries_.push_back(i);
+            continue;
+        }
+        Entry entry;
+        entry.code = vvl::make_span(reinterpret_cast<const uint32_t *>(data + file_entry.offset), file_entry.word_count);
+        entry.checksum = file_entry.checksum;
+        entries_.emplace(file_entry.shader_hash, std::move(entry));
+    }
+}
+
+bool InstrumentedShaderCache::Verify(Entry &entry) {
+    if (!entry.verified) {
+        entry.verified =
+            hash_util::CacheDataHash(entry.code.data(), entry.code.size() * sizeof(uint32_t)) == entry.checksum;
+    }
+    return entry.verified;
+}
+
+vvl::span<const uint32_t> InstrumentedShaderCache::Find(uint32_t shader_hash) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = entries_.find(shader_hash);
+    if (it == entries_.end()) {
+        return {};
+    }
+    if (!Verify(it->second)) {
+        entries_.erase(it);
+        modified_ = true;
+        return {};
+    }
+    it->second.used = true;
+    return it->second.code;
+}
+
+void InstrumentedShaderCache::Add(uint32_t shader_hash, const std::vector<uint32_t> &spirv) {
+    std::lock_guard<std::mutex> guard(lock_);
+    Entry entry;
+    entry.owned_code = spirv;
+    // Moving the entry into the map keeps the vector storage
+    entry.code = vvl::span<const uint32_t>(entry.owned_code.data(), entry.owned_code.size());
+    entry.checksum = hash_util::CacheDataHash(spirv.data(), spirv.size() * sizeof(uint32_t));
+    entry.verified = true;
+    entry.used = true;
+    if (entries_.emplace(shader_hash, std::move(entry)).second) {
+        modified_ = true;
+    }
+}
+
+void InstrumentedShaderCache::Save() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (path_.empty() || !modified_) {
+        return;
+    }
+
+    // Pick what goes in the file, the entries used during this run first
+    struct Output {
+        FileEntry file_entry;
+        vvl::span<const uint32_t> code;
+    };
+    std::vector<Output> outputs;
+    size_t file_size = sizeof(FileHeader);
+    auto add_output = [&outputs, &file_size](uint64_t config_hash, uint32_t shader_hash, vvl::span<const uint32_t> code,
+                                             uint64_t checksum) {
+        const size_t entry_size = sizeof(FileEntry) + code.size() * sizeof(uint32_t);
+        if (file_size + entry_size > kMaxFileSize) {
+            return;
+        }
+        file_size += entry_size;
+        outputs.emplace_back(Output{{config_hash, shader_hash, static_cast<uint32_t>(code.size()), 0, checksum}, code});
+    };
+    for (auto &[shader_hash, entry] : entries_) {
+        if (entry.used) {
+            add_output(config_hash_, shader_hash, entry.code, entry.checksum);
+        }
+    }
+    for (auto &[shader_hash, entry] : entries_) {
+        if (!entry.used && Verify(entry)) {
+            add_output(config_hash_, shader_hash, entry.code, entry.checksum);
+        }
+    }
+    if (file_.IsOpen()) {
+        const auto *file_entries = reinterpret_cast<const FileEntry *>(file_.Data() + sizeof(FileHeader));
+        for (uint32_t index : other_config_entries_) {
+            const FileEntry &file_entry = file_entries[index];
+            const auto code = vvl::make_span(reinterpret_cast<const uint32_t *>(file_.Data() + file_entry.offset),
+                                             file_entry.word_count);
+            if (hash_util::CacheDataHash(code.data(), code.size() * sizeof(uint32_t)) == file_entry.checksum) {
+                add_output(file_entry.config_hash, file_entry.shader_hash, code, file_entry.checksum);
+            }
+        }
+    }
+
+    std::vector<FileEntry> file_entries;
+    file_entries.reserve(outputs.size());
+    uint64_t offset = sizeof(FileHeader) + outputs.size() * sizeof(FileEntry);
+    for (auto &output : outputs) {
+        output.file_entry.offset = offset;
+        offset += output.code.size() * sizeof(uint32_t);
+        file_entries.emplace_back(output.file_entry);
+    }
+    FileHeader header = {};
+    static_assert(sizeof(INST_SHADER_GIT_HASH) <= sizeof(header.build_id));
+    static_assert(sizeof(INST_PASS_GIT_HASH) <= sizeof(header.pass_id));
+    header.magic = kFileMagic;
+    header.file_version = kFileVersion;
+    std::strncpy(header.build_id, INST_SHADER_GIT_HASH, sizeof(header.build_id));
+    std::strncpy(header.pass_id, INST_PASS_GIT_HASH, sizeof(header.pass_id));
+    header.layer_version = VK_HEADER_VERSION_COMPLETE;
+    header.entry_count = static_cast<uint32_t>(file_entries.size());
+    header.entries_checksum = hash_util::CacheDataHash(file_entries.data(), file_entries.size() * sizeof(FileEntry));
+
+    // Several processes can share the cache file, each one writes its own temporary file and the last one to finish wins
+    const std::string temp_path = path_ + "." + std::to_string(std::random_device{}()) + ".tmp";
+    bool written = false;
+    {
+        std::ofstream file_stream(temp_path, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+        if (file_stream) {
+            file_stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            file_stream.write(reinterpret_cast<const char *>(file_entries.data()), file_entries.size() * sizeof(FileEntry));
+            for (const auto &output : outputs) {
+                file_stream.write(reinterpret_cast<const char *>(output.code.data()), output.code.size() * sizeof(uint32_t));
+            }
+            written = file_stream.good();
+        }
+    }
+
+    // Entries loaded from the file can't be used once it is unmapped, which has to happen before replacing it on Windows
+    entries_.clear();
+    other_config_entries_.clear();
+    file_.Close();
+    modified_ = false;
+    if (!written || !vvl::CommitTempFile(temp_path, path_)) {
+        std::remove(temp_path.c_str());
+    }
+}
+
+}  // namespace gpu_tracker
@@ -0,0 +1,75 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "utils/file_mapping.h"
+
+namespace gpu_tracker {
+
+// Instrumented shaders, keyed by the hash of the original SPIR-V.
+//
+// The cache can be persisted between runs: Load() maps the cache file at device creation, so only the entries which are
+// actually looked up get read from disk, and Save() rewrites it at device destruction. Entries created with a different
+// instrumentation configuration are kept in the file but never returned, and the whole file is discarded if it was written
+// by a different build of the layer.
+class InstrumentedShaderCache {
+  public:
+    // Bigger files are trimmed on Save(), dropping the entries which were not used during this run first
+    static constexpr size_t kMaxFileSize = 256 * 1024 * 1024;
+
+    // config_hash must cover everything besides the original SPIR-V which changes the instrumented code
+    // (enabled passes, descriptor set index, SPIR-V environment, ...)
+    void Load(const std::string &path, uint64_t config_hash);
+    // Only writes the file if entries were added or found corrupted, the cache is empty afterwards
+    void Save();
+
+    // The returned code stays valid until the cache is destroyed
+    vvl::span<const uint32_t> Find(uint32_t shader_hash);
+    void Add(uint32_t shader_hash, const std::vector<uint32_t> &spirv);
+
+  private:
+    struct Entry {
+        // Entries loaded from the file point into the mapping, the others own their code
+        vvl::span<const uint32_t> code;
+        std::vector<uint32_t> owned_code;
+        uint64_t checksum = 0;
+        // Code from the file is only checked against its checksum the first time it is used
+        bool verified = false;
+        bool used = false;
+    };
+    struct FileHeader;
+    struct FileEntry;
+
+    bool Verify(Entry &entry);
+
+    std::mutex lock_;
+    std::string path_;
+    uint64_t config_hash_ = 0;
+    vvl::MappedFile file_;
+    vvl::unordered_map<uint32_t, Entry> entries_;
+    // Entries of the file made with another configuration, kept as long as there is room for them
+    std::vector<uint32_t> other_config_entries_;
+    bool modified_ = false;
+};
+
+}  // namespace gpu_tracker
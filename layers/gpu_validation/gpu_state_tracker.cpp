@@ -236,9 +236,101 @@ VkResult UtilInitializeVma(VkInstance instance, VkPhysicalDevice physical_device
     return vmaCreateAllocator(&allocator_info, pAllocator);
 }
 
+gpu_tracker::BufferBlockPool::BufferBlockPool(VmaAllocator allocator, VkDeviceSize alignment)
+    : allocator_(allocator), alignment_(alignment) {}
+
+gpu_tracker::BufferBlockPool::~BufferBlockPool() {
+    for (auto &block : free_blocks_) {
+        Destroy(block);
+    }
+}
+
+VkResult gpu_tracker::BufferBlockPool::Acquire(VkDeviceSize min_size, Block &out_block) {
+    if (min_size <= kBlockSize) {
+        auto guard = Lock();
+        if (!free_blocks_.empty()) {
+            out_block = free_blocks_.back();
+            free_blocks_.pop_back();
+            return VK_SUCCESS;
+        }
+    }
+
+    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+    buffer_info.size = std::max(min_size, kBlockSize);
+    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    VmaAllocationCreateInfo alloc_info = {};
+    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    Block block;
+    block.size = buffer_info.size;
+    VkResult result = vmaCreateBuffer(allocator_, &buffer_info, &alloc_info, &block.buffer, &block.allocation, nullptr);
+    if (result != VK_SUCCESS) {
+        return result;
+    }
+    result = vmaMapMemory(allocator_, block.allocation, reinterpret_cast<void **>(&block.host_ptr));
+    if (result != VK_SUCCESS) {
+        vmaDestroyBuffer(allocator_, block.buffer, block.allocation);
+        return result;
+    }
+    out_block = block;
+    return VK_SUCCESS;
+}
+
+void gpu_tracker::BufferBlockPool::Release(std::vector<Block> &blocks) {
+    auto guard = Lock();
+    for (auto &block : blocks) {
+        if (block.size == kBlockSize && free_blocks_.size() < kMaxFreeBlocks) {
+            free_blocks_.emplace_back(block);
+        } else {
+            Destroy(block);
+        }
+    }
+    blocks.clear();
+}
+
+void gpu_tracker::BufferBlockPool::Destroy(Block &block) {
+    vmaUnmapMemory(allocator_, block.allocation);
+    vmaDestroyBuffer(allocator_, block.buffer, block.allocation);
+    block = {};
+}
+
+VkResult gpu_tracker::BufferSubAllocator::Allocate(VkDeviceSize size, gpuav::BufferRange &out_range) {
+    if (!pool_) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    // Each range can be bound as a storage buffer descriptor on its own
+    const VkDeviceSize alignment = pool_->Alignment();
+    VkDeviceSize offset = (used_ + alignment - 1) & ~(alignment - 1);
+    if (blocks_.empty() || offset + size > blocks_.back().size) {
+        BufferBlockPool::Block block;
+        const VkResult result = pool_->Acquire(size, block);
+        if (result != VK_SUCCESS) {
+            return result;
+        }
+        // Oversized blocks are used for one allocation only, keep filling the last regular one
+        if (!blocks_.empty() && block.size > BufferBlockPool::kBlockSize) {
+            blocks_.insert(blocks_.end() - 1, block);
+            out_range = {block.buffer, 0, size, block.host_ptr};
+            return VK_SUCCESS;
+        }
+        blocks_.emplace_back(block);
+        offset = 0;
+    }
+    const auto &block = blocks_.back();
+    out_range = {block.buffer, offset, size, block.host_ptr + offset};
+    used_ = offset + size;
+    return VK_SUCCESS;
+}
+
+void gpu_tracker::BufferSubAllocator::Reset() {
+    if (pool_ && !blocks_.empty()) {
+        pool_->Release(blocks_);
+    }
+    used_ = 0;
+}
+
 gpu_tracker::CommandBuffer::CommandBuffer(gpu_tracker::Validator &gpuav, VkCommandBuffer handle,
                                           const VkCommandBufferAllocateInfo *pCreateInfo, const vvl::CommandPool *pool)
-    : vvl::CommandBuffer(gpuav, handle, pCreateInfo, pool) {}
+    : vvl::CommandBuffer(gpuav, handle, pCreateInfo, pool), buffer_allocator(gpuav.buffer_block_pool.get()) {}
 
 ReadLockGuard gpu_tracker::Validator::ReadLock() const {
     if (fine_grained_locking) {
@@ -425,6 +517,7 @@ void gpu_tracker::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo,
     VkResult result1 = UtilInitializeVma(instance, physical_device, device, force_buffer_device_address, &vmaAllocator);
     assert(result1 == VK_SUCCESS);
     desc_set_manager = std::make_unique<DescriptorSetManager>(device, static_cast<uint32_t>(validation_bindings_.size()));
+    buffer_block_pool = std::make_unique<BufferBlockPool>(vmaAllocator, phys_dev_props.limits.minStorageBufferOffsetAlignment);
 
     const VkDescriptorSetLayoutCreateInfo debug_desc_layout_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, NULL, 0,
                                                                     static_cast<uint32_t>(validation_bindings_.size()),
@@ -467,8 +560,19 @@ void gpu_tracker::Validator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo,
     }
 }
 
+vvl::ThreadPool &gpu_tracker::Validator::GetInstrumentationThreadPool() {
+    std::call_once(instrumentation_thread_pool_once_, [this]() {
+        // The thread creating the pipelines also does its share of the work
+        const uint32_t thread_count = std::thread::hardware_concurrency();
+        const uint32_t worker_count = std::min(thread_count > 1 ? thread_count - 1 : 0u, 7u);
+        instrumentation_thread_pool_ = std::make_unique<vvl::ThreadPool>(worker_count);
+    });
+    return *instrumentation_thread_pool_;
+}
+
 void gpu_tracker::Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
                                                         const RecordObject &record_obj) {
+    instrumentation_thread_pool_.reset();
     indices_buffer.Destroy(vmaAllocator);
 
     if (debug_desc_layout_) {
@@ -483,6 +587,8 @@ void gpu_tracker::Validator::PreCallRecordDestroyDevice(VkDevice device, const V
         DispatchDestroyPipelineLayout(device, debug_pipeline_layout, NULL);
     }
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
+    // The command buffers were destroyed above and gave their blocks back
+    buffer_block_pool.reset();
     // State Tracker can end up making vma calls through callbacks - don't destroy allocator until ST is done
     if (output_buffer_pool) {
         vmaDestroyPool(vmaAllocator, output_buffer_pool);
@@ -964,6 +1070,18 @@ void gpu_tracker::Validator::PreCallRecordPipelineCreations(uint32_t count, cons
                                                             PipelineStates &pipeline_states,
                                                             std::vector<SafeCreateInfo> *new_pipeline_create_infos,
                                                             const RecordObject &record_obj, ChassisState &chassis_state) {
+    // Shaders defined inline in pipeline libraries, they are instrumented once every pipeline has been walked through
+    struct InlineShaderInstrumentation {
+        uint32_t pipeline = 0;
+        VkShaderStageFlagBits stage{};
+        std::shared_ptr<vvl::ShaderModule> module_state;
+        uint32_t unique_shader_id = 0;
+        bool cached = false;
+        bool pass = false;
+        std::vector<uint32_t> instrumented_spirv;
+    };
+    std::vector<InlineShaderInstrumentation> inline_shaders;
+
     // Walk through all the pipelines, make a copy of each and flag each pipeline that contains a shader that uses the debug
     // descriptor set index.
     for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
@@ -1016,50 +1134,61 @@ void gpu_tracker::Validator::PreCallRecordPipelineCreations(uint32_t count, cons
                         // Now find the corresponding VkShaderModuleCreateInfo
                         auto &stage_ci =
                             GetShaderStageCI<SafeCreateInfo, vku::safe_VkPipelineShaderStageCreateInfo>(new_pipeline_ci, stage);
-                        // We're modifying the copied, safe create info, which is ok to be non-const
-                        auto sm_ci = const_cast<vku::safe_VkShaderModuleCreateInfo *>(
-                            reinterpret_cast<const vku::safe_VkShaderModuleCreateInfo *>(
-                                vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
+                        auto sm_ci = vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext);
                         if (gpuav_settings.select_instrumented_shaders && sm_ci && !CheckForGpuAvEnabled(sm_ci->pNext)) continue;
-                        uint32_t unique_shader_id = 0;
-                        bool cached = false;
-                        bool pass = false;
-                        std::vector<uint32_t> instrumented_spirv;
+                        InlineShaderInstrumentation job;
+                        job.pipeline = pipeline;
+                        job.stage = stage;
+                        job.module_state = module_state;
                         if (gpuav_settings.cache_instrumented_shaders) {
-                            unique_shader_id =
+                            job.unique_shader_id =
                                 hash_util::ShaderHash(module_state->spirv->words_.data(), module_state->spirv->words_.size());
-                            auto it = instrumented_shaders.find(unique_shader_id);
-                            if (it != instrumented_shaders.end()) {
-                                instrumented_spirv = it->second.second;
-                                cached = true;
+                            const auto cached_spirv = instrumented_shaders.Find(job.unique_shader_id);
+                            if (!cached_spirv.empty()) {
+                                job.instrumented_spirv.assign(cached_spirv.begin(), cached_spirv.end());
+                                job.cached = true;
                             }
                         } else {
-                            unique_shader_id = unique_shader_module_id++;
+                            job.unique_shader_id = unique_shader_module_id++;
                         }
-                        if (!cached) {
-                            pass = InstrumentShader(module_state->spirv->words_, instrumented_spirv, unique_shader_id,
-                                                    record_obj.location);
-                        }
-                        if (cached || pass) {
-                            module_state->gpu_validation_shader_id = unique_shader_id;
-                            // Now we need to update the shader code in VkShaderModuleCreateInfo
-                            // module_state->Handle() == VK_NULL_HANDLE should imply sm_ci != nullptr, but checking here anyway
-                            if (sm_ci) {
-                                sm_ci->SetCode(instrumented_spirv);
-                            }
-                            if (gpuav_settings.cache_instrumented_shaders && !cached) {
-                                instrumented_shaders.emplace(unique_shader_id,
-                                                             std::make_pair(instrumented_spirv.size(), instrumented_spirv));
-                            }
-                        }
-
-                        chassis_state.shader_unique_id_maps[pipeline][stage] = unique_shader_id;
+                        inline_shaders.emplace_back(std::move(job));
                     }
                 }
             }
         }
         new_pipeline_create_infos->push_back(std::move(new_pipeline_ci));
     }
+
+    // Instrumenting is by far the most expensive part of pipeline creation, and each shader is independent
+    GetInstrumentationThreadPool().ParallelFor(inline_shaders.size(), [this, &inline_shaders, &record_obj](size_t i) {
+        auto &job = inline_shaders[i];
+        if (!job.cached) {
+            job.pass = InstrumentShader(job.module_state->spirv->words_, job.instrumented_spirv, job.unique_shader_id,
+                                        record_obj.location);
+        }
+    });
+
+    for (auto &job : inline_shaders) {
+        if (job.cached || job.pass) {
+            job.module_state->gpu_validation_shader_id = job.unique_shader_id;
+            // Now we need to update the shader code in VkShaderModuleCreateInfo
+            // module_state->Handle() == VK_NULL_HANDLE should imply sm_ci != nullptr, but checking here anyway
+            auto &stage_ci = GetShaderStageCI<SafeCreateInfo, vku::safe_VkPipelineShaderStageCreateInfo>(
+                (*new_pipeline_create_infos)[job.pipeline], job.stage);
+            // We're modifying the copied, safe create info, which is ok to be non-const
+            auto sm_ci = const_cast<vku::safe_VkShaderModuleCreateInfo *>(
+                reinterpret_cast<const vku::safe_VkShaderModuleCreateInfo *>(
+                    vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext)));
+            if (sm_ci) {
+                sm_ci->SetCode(job.instrumented_spirv);
+            }
+            if (gpuav_settings.cache_instrumented_shaders && !job.cached) {
+                instrumented_shaders.Add(job.unique_shader_id, job.instrumented_spirv);
+            }
+        }
+
+        chassis_state.shader_unique_id_maps[job.pipeline][job.stage] = job.unique_shader_id;
+    }
 }
 // For every pipeline:
 // - For every shader in a pipeline:
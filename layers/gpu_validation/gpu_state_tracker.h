@@ -17,6 +17,8 @@
 #pragma once
 #include "generated/chassis.h"
 #include "gpu_validation/gpu_resources.h"
+#include "gpu_validation/gpu_shader_cache.h"
+#include "utils/thread_pool.h"
 #include "state_tracker/cmd_buffer_state.h"
 #include "state_tracker/queue_state.h"
 #include "vma/vma.h"
@@ -44,6 +46,54 @@ class Queue : public vvl::Queue {
     std::deque<std::vector<std::shared_ptr<vvl::CommandBuffer>>> retiring_;
 };
 
+// Large host visible buffers, mapped for their whole lifetime. They are recycled between the command buffers of the device,
+// so that the small buffers needed by each validated command don't each go through VMA.
+class BufferBlockPool {
+  public:
+    struct Block {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VmaAllocation allocation = VK_NULL_HANDLE;
+        VkDeviceSize size = 0;
+        uint8_t *host_ptr = nullptr;
+    };
+
+    BufferBlockPool(VmaAllocator allocator, VkDeviceSize alignment);
+    ~BufferBlockPool();
+
+    VkDeviceSize Alignment() const { return alignment_; }
+    // Blocks bigger than kBlockSize are only created for allocations which would not fit otherwise
+    VkResult Acquire(VkDeviceSize min_size, Block &out_block);
+    void Release(std::vector<Block> &blocks);
+
+    static constexpr VkDeviceSize kBlockSize = 256 * 1024;
+
+  private:
+    std::unique_lock<std::mutex> Lock() const { return std::unique_lock<std::mutex>(lock_); }
+    void Destroy(Block &block);
+
+    static constexpr size_t kMaxFreeBlocks = 64;
+    VmaAllocator allocator_;
+    const VkDeviceSize alignment_;
+    std::vector<Block> free_blocks_;
+    mutable std::mutex lock_;
+};
+
+// Linear allocator over the blocks of a BufferBlockPool. What it handed out is only given back all at once, when the command
+// buffer owning it is reset or destroyed, since until then the command buffer can be submitted again.
+class BufferSubAllocator {
+  public:
+    explicit BufferSubAllocator(BufferBlockPool *pool) : pool_(pool) {}
+    ~BufferSubAllocator() { Reset(); }
+
+    VkResult Allocate(VkDeviceSize size, gpuav::BufferRange &out_range);
+    void Reset();
+
+  private:
+    BufferBlockPool *pool_;
+    std::vector<BufferBlockPool::Block> blocks_;
+    VkDeviceSize used_ = 0;  // In the last block
+};
+
 class CommandBuffer : public vvl::CommandBuffer {
   public:
     CommandBuffer(Validator &gpuav, VkCommandBuffer handle, const VkCommandBufferAllocateInfo *pCreateInfo,
@@ -51,6 +101,9 @@ class CommandBuffer : public vvl::CommandBuffer {
 
     virtual bool PreProcess() = 0;
     virtual void PostProcess(VkQueue queue, const Location &loc) = 0;
+
+    // Per validated command buffers, reset with the command buffer
+    BufferSubAllocator buffer_allocator;
 };
 }  // namespace gpu_tracker
 
@@ -199,10 +252,17 @@ class Validator : public ValidationStateTracker {
     virtual bool InstrumentShader(const vvl::span<const uint32_t> &input, std::vector<uint32_t> &instrumented_spirv,
                                   uint32_t unique_shader_id, const Location &loc) = 0;
 
+    // Used to instrument all the shaders of a batched creation call in parallel, created on first use
+    vvl::ThreadPool &GetInstrumentationThreadPool();
+
+  private:
+    std::once_flag instrumentation_thread_pool_once_;
+    std::unique_ptr<vvl::ThreadPool> instrumentation_thread_pool_;
+
   public:
     mutable bool aborted = false;
     bool force_buffer_device_address;
-    vvl::unordered_map<uint32_t, std::pair<size_t, std::vector<uint32_t>>> instrumented_shaders;
+    InstrumentedShaderCache instrumented_shaders;
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
     const char *setup_vuid;
     VkPhysicalDeviceFeatures supported_features{};
@@ -217,6 +277,7 @@ class Validator : public ValidationStateTracker {
     VmaAllocator vmaAllocator = {};
     VmaPool output_buffer_pool = VK_NULL_HANDLE;
     std::unique_ptr<DescriptorSetManager> desc_set_manager;
+    std::unique_ptr<BufferBlockPool> buffer_block_pool;
     vvl::concurrent_unordered_map<uint32_t, GpuAssistedShaderTracker> shader_map;
     std::vector<VkDescriptorSetLayoutBinding> validation_bindings_;
 
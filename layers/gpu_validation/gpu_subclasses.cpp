@@ -138,8 +138,8 @@ void gpuav::CommandBuffer::AllocateResources() {
                                                 VK_SHADER_STAGE_MESH_BIT_EXT | VK_SHADER_STAGE_TASK_BIT_EXT |
                                                 gpu_tracker::kShaderStageAllRayTracing;
 
-    // Instrumentation descriptor set layout
-    {
+    // Instrumentation descriptor set layout, kept across resets since recycled instrumentation descriptor sets use it
+    if (instrumentation_desc_set_layout_ == VK_NULL_HANDLE) {
         assert(!gpuav->validation_bindings_.empty());
         VkDescriptorSetLayoutCreateInfo instrumentation_desc_set_layout_ci = vku::InitStructHelper();
         instrumentation_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(gpuav->validation_bindings_.size());
@@ -196,16 +196,18 @@ void gpuav::CommandBuffer::AllocateResources() {
             {glsl::kBindingDiagCmdErrorsCount, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, all_stages_flags, nullptr},
         };
 
-        VkDescriptorSetLayoutCreateInfo validation_cmd_desc_set_layout_ci = vku::InitStructHelper();
-        validation_cmd_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(validation_cmd_bindings.size());
-        validation_cmd_desc_set_layout_ci.pBindings = validation_cmd_bindings.data();
-        result = DispatchCreateDescriptorSetLayout(gpuav->device, &validation_cmd_desc_set_layout_ci, nullptr,
-                                                   &validation_cmd_desc_set_layout_);
-        if (result != VK_SUCCESS) {
-            gpuav->ReportSetupProblem(gpuav->device, Location(Func::vkAllocateCommandBuffers),
-                                      "Unable to create descriptor set layout used for validation commands. Aborting GPU-AV");
-            gpuav->aborted = true;
-            return;
+        if (validation_cmd_desc_set_layout_ == VK_NULL_HANDLE) {
+            VkDescriptorSetLayoutCreateInfo validation_cmd_desc_set_layout_ci = vku::InitStructHelper();
+            validation_cmd_desc_set_layout_ci.bindingCount = static_cast<uint32_t>(validation_cmd_bindings.size());
+            validation_cmd_desc_set_layout_ci.pBindings = validation_cmd_bindings.data();
+            result = DispatchCreateDescriptorSetLayout(gpuav->device, &validation_cmd_desc_set_layout_ci, nullptr,
+                                                       &validation_cmd_desc_set_layout_);
+            if (result != VK_SUCCESS) {
+                gpuav->ReportSetupProblem(gpuav->device, Location(Func::vkAllocateCommandBuffers),
+                                          "Unable to create descriptor set layout used for validation commands. Aborting GPU-AV");
+                gpuav->aborted = true;
+                return;
+            }
         }
 
         assert(validation_cmd_desc_pool_ == VK_NULL_HANDLE);
@@ -270,12 +272,56 @@ void gpuav::CommandBuffer::AllocateResources() {
     }
 }
 
+VkDescriptorSet gpuav::CommandBuffer::FindInstrumentationDescriptorSet(const VkDescriptorBufferInfo &bda_table) const {
+    if (instrumentation_desc_sets_.empty()) {
+        return VK_NULL_HANDLE;
+    }
+    const InstrumentationDescriptorSet &last = instrumentation_desc_sets_.back();
+    if (last.bindless_buffer != current_bindless_buffer.buffer || last.bindless_offset != current_bindless_buffer.offset ||
+        last.bda_buffer != bda_table.buffer || last.bda_range != bda_table.range) {
+        return VK_NULL_HANDLE;
+    }
+    return last.desc_set.set;
+}
+
+VkDescriptorSet gpuav::CommandBuffer::AcquireInstrumentationDescriptorSet(const VkDescriptorBufferInfo &bda_table) {
+    if (spare_instrumentation_desc_sets_.empty()) {
+        VkDescriptorPool desc_pool = VK_NULL_HANDLE;
+        std::vector<VkDescriptorSet> desc_sets;
+        const VkResult result = state_.desc_set_manager->GetDescriptorSets(kInstrumentationDescSetBatch, &desc_pool,
+                                                                           GetInstrumentationDescriptorSetLayout(), &desc_sets);
+        if (result != VK_SUCCESS) {
+            return VK_NULL_HANDLE;
+        }
+        for (VkDescriptorSet desc_set : desc_sets) {
+            spare_instrumentation_desc_sets_.emplace_back(PooledDescriptorSet{desc_pool, desc_set});
+        }
+    }
+
+    const PooledDescriptorSet desc_set = spare_instrumentation_desc_sets_.back();
+    spare_instrumentation_desc_sets_.pop_back();
+    instrumentation_desc_sets_.emplace_back(InstrumentationDescriptorSet{
+        desc_set, current_bindless_buffer.buffer, current_bindless_buffer.offset, bda_table.buffer, bda_table.range});
+    return desc_set.set;
+}
+
 gpuav::CommandBuffer::~CommandBuffer() { Destroy(); }
 
 void gpuav::CommandBuffer::Destroy() {
     ResetCBState();
     auto gpuav = static_cast<Validator *>(&dev_data);
 
+    for (const PooledDescriptorSet &spare : spare_instrumentation_desc_sets_) {
+        gpuav->desc_set_manager->PutBackDescriptorSet(spare.pool, spare.set);
+    }
+    spare_instrumentation_desc_sets_.clear();
+
+    if (deferred_checks_pool_ != VK_NULL_HANDLE) {
+        DispatchDestroyCommandPool(gpuav->device, deferred_checks_pool_, nullptr);
+        deferred_checks_pool_ = VK_NULL_HANDLE;
+        deferred_checks_cb_ = VK_NULL_HANDLE;
+    }
+
     if (instrumentation_desc_set_layout_ != VK_NULL_HANDLE) {
         DispatchDestroyDescriptorSetLayout(gpuav->device, instrumentation_desc_set_layout_, nullptr);
         instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
@@ -307,11 +353,21 @@ void gpuav::CommandBuffer::ResetCBState() {
     }
     per_command_resources.clear();
 
-    for (auto &buffer_info : di_input_buffer_list) {
-        vmaDestroyBuffer(gpuav->vmaAllocator, buffer_info.bindless_state_buffer, buffer_info.bindless_state_buffer_allocation);
+    // Instrumentation descriptor sets are kept for the next recording, the error buffers they point to are about to change
+    // so they are all written again on first use
+    for (const InstrumentationDescriptorSet &desc_set : instrumentation_desc_sets_) {
+        spare_instrumentation_desc_sets_.emplace_back(desc_set.desc_set);
     }
+    instrumentation_desc_sets_.clear();
+
+    deferred_dispatch_checks.clear();
+    deferred_checks_recorded_ = false;
+
+    gpuav->ReleaseBDATables(*this);
+
     di_input_buffer_list.clear();
-    current_bindless_buffer = VK_NULL_HANDLE;
+    current_bindless_buffer = {};
+    buffer_allocator.Reset();
 
     error_output_buffer_.Destroy(gpuav->vmaAllocator);
     cmd_errors_counts_buffer_.Destroy(gpuav->vmaAllocator);
@@ -339,6 +395,56 @@ void gpuav::CommandBuffer::ClearCmdErrorsCountsBuffer() const {
     vmaUnmapMemory(gpuav->vmaAllocator, cmd_errors_counts_buffer_.allocation);
 }
 
+VkCommandBuffer gpuav::CommandBuffer::BeginDeferredChecksCommandBuffer(const Location &loc) {
+    auto gpuav = static_cast<Validator *>(&dev_data);
+    VkResult result = VK_SUCCESS;
+
+    if (deferred_checks_pool_ == VK_NULL_HANDLE) {
+        // Submitted to the queues this command buffer is submitted to
+        VkCommandPoolCreateInfo pool_create_info = vku::InitStructHelper();
+        pool_create_info.queueFamilyIndex = command_pool->queueFamilyIndex;
+        result = DispatchCreateCommandPool(gpuav->device, &pool_create_info, nullptr, &deferred_checks_pool_);
+        if (result != VK_SUCCESS) {
+            gpuav->ReportSetupProblem(VkHandle(), loc, "Unable to create command pool for deferred checks.");
+            deferred_checks_pool_ = VK_NULL_HANDLE;
+            return VK_NULL_HANDLE;
+        }
+
+        VkCommandBufferAllocateInfo buffer_alloc_info = vku::InitStructHelper();
+        buffer_alloc_info.commandPool = deferred_checks_pool_;
+        buffer_alloc_info.commandBufferCount = 1;
+        buffer_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        result = DispatchAllocateCommandBuffers(gpuav->device, &buffer_alloc_info, &deferred_checks_cb_);
+        if (result != VK_SUCCESS) {
+            gpuav->ReportSetupProblem(VkHandle(), loc, "Unable to create deferred checks command buffer.");
+            DispatchDestroyCommandPool(gpuav->device, deferred_checks_pool_, nullptr);
+            deferred_checks_pool_ = VK_NULL_HANDLE;
+            deferred_checks_cb_ = VK_NULL_HANDLE;
+            return VK_NULL_HANDLE;
+        }
+
+        // Hook up command buffer dispatch
+        gpuav->vkSetDeviceLoaderData(gpuav->device, deferred_checks_cb_);
+    } else {
+        // Not pending, as this command buffer is not
+        DispatchResetCommandPool(gpuav->device, deferred_checks_pool_, 0);
+    }
+
+    // The application may submit this command buffer to several queues at once
+    VkCommandBufferBeginInfo begin_info = vku::InitStructHelper();
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+    result = DispatchBeginCommandBuffer(deferred_checks_cb_, &begin_info);
+    if (result != VK_SUCCESS) {
+        gpuav->ReportSetupProblem(VkHandle(), loc, "Unable to begin deferred checks command buffer.");
+        return VK_NULL_HANDLE;
+    }
+    return deferred_checks_cb_;
+}
+
+void gpuav::CommandBuffer::EndDeferredChecksCommandBuffer() {
+    deferred_checks_recorded_ = DispatchEndCommandBuffer(deferred_checks_cb_) == VK_SUCCESS;
+}
+
 bool gpuav::CommandBuffer::PreProcess() {
     state_.UpdateInstrumentationBuffer(this);
     return !per_command_resources.empty() || has_build_as_cmd;
@@ -441,6 +547,88 @@ gpuav::Queue::Queue(Validator &state, VkQueue q, uint32_t index, VkDeviceQueueCr
 
 uint64_t gpuav::Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) {
     auto loc = submissions[0].loc.Get();
-    static_cast<gpuav::Validator&>(state_).UpdateBDABuffer(loc);
+    auto &gpuav = static_cast<gpuav::Validator &>(state_);
+    gpuav.UpdateBDABuffer(loc);
+    if (gpuav.gpuav_settings.batch_indirect_dispatch_checks) {
+        SubmitDeferredChecks(submissions, loc);
+    }
     return gpu_tracker::Queue::PreSubmit(std::move(submissions));
 }
+
+// A wait of the application's batch can also be done by the checks submitted ahead of the submission if its signal is
+// already enqueued, by an earlier submission to any queue or by the host. A signal from the same submission or a later one
+// to this queue would have the checks in its first synchronization scope, and never happen.
+static bool CanWaitAheadOfSubmission(const vvl::QueueSubmission::SemaphoreInfo &wait) {
+    const vvl::Semaphore &semaphore = *wait.semaphore;
+    // A binary semaphore can only be waited on once
+    if (semaphore.type != VK_SEMAPHORE_TYPE_TIMELINE) {
+        return false;
+    }
+    if (semaphore.CurrentPayload() >= wait.payload) {
+        return true;
+    }
+    const auto signal = semaphore.LastOp([&wait](vvl::Semaphore::OpType op_type, uint64_t payload, bool is_pending) {
+        return op_type == vvl::Semaphore::kSignal && is_pending && payload >= wait.payload;
+    });
+    return signal.has_value();
+}
+
+// The deferred checks of the command buffers of the submissions are submitted first, in one batch, along with the waits of
+// their batches. Being earlier in submission order, they see what previous submissions to this queue wrote to indirect
+// buffers, but not what the submitted command buffers themselves write. The checks of a batch with a wait which can't be
+// done ahead are put at the start of that batch instead, see Validator::PreCallRecordQueueSubmit().
+void gpuav::Queue::SubmitDeferredChecks(const std::vector<vvl::QueueSubmission> &submissions, const Location &loc) {
+    std::vector<VkCommandBuffer> checks_cbs;
+    std::vector<VkSemaphore> wait_semaphores;
+    std::vector<uint64_t> wait_values;
+    inline_checks_.clear();
+    for (size_t submission_index = 0; submission_index < submissions.size(); ++submission_index) {
+        const auto &submission = submissions[submission_index];
+        std::vector<VkCommandBuffer> batch_checks_cbs;
+        for (auto &cb : submission.cbs) {
+            auto gpu_cb = std::static_pointer_cast<CommandBuffer>(cb);
+            auto guard = gpu_cb->ReadLock();
+            if (VkCommandBuffer checks_cb = gpu_cb->GetDeferredChecksCommandBuffer(); checks_cb != VK_NULL_HANDLE) {
+                batch_checks_cbs.emplace_back(checks_cb);
+            }
+            for (auto *secondary_cb : gpu_cb->linkedCommandBuffers) {
+                auto secondary_guard = secondary_cb->ReadLock();
+                auto *secondary_gpu_cb = static_cast<CommandBuffer *>(secondary_cb);
+                if (VkCommandBuffer checks_cb = secondary_gpu_cb->GetDeferredChecksCommandBuffer(); checks_cb != VK_NULL_HANDLE) {
+                    batch_checks_cbs.emplace_back(checks_cb);
+                }
+            }
+        }
+        if (batch_checks_cbs.empty()) {
+            continue;
+        }
+        if (!std::all_of(submission.wait_semaphores.begin(), submission.wait_semaphores.end(), CanWaitAheadOfSubmission)) {
+            inline_checks_.resize(submissions.size());
+            inline_checks_[submission_index] = std::move(batch_checks_cbs);
+            continue;
+        }
+        checks_cbs.insert(checks_cbs.end(), batch_checks_cbs.begin(), batch_checks_cbs.end());
+        for (const auto &wait : submission.wait_semaphores) {
+            wait_semaphores.emplace_back(wait.semaphore->VkHandle());
+            wait_values.emplace_back(wait.payload);
+        }
+    }
+    if (checks_cbs.empty()) {
+        return;
+    }
+
+    const std::vector<VkPipelineStageFlags> wait_stages(wait_semaphores.size(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    VkTimelineSemaphoreSubmitInfo timeline_info = vku::InitStructHelper();
+    timeline_info.waitSemaphoreValueCount = static_cast<uint32_t>(wait_values.size());
+    timeline_info.pWaitSemaphoreValues = wait_values.data();
+    VkSubmitInfo submit_info = vku::InitStructHelper(wait_semaphores.empty() ? nullptr : &timeline_info);
+    submit_info.waitSemaphoreCount = static_cast<uint32_t>(wait_semaphores.size());
+    submit_info.pWaitSemaphores = wait_semaphores.data();
+    submit_info.pWaitDstStageMask = wait_stages.data();
+    submit_info.commandBufferCount = static_cast<uint32_t>(checks_cbs.size());
+    submit_info.pCommandBuffers = checks_cbs.data();
+    const VkResult result = DispatchQueueSubmit(VkHandle(), 1, &submit_info, VK_NULL_HANDLE);
+    if (result != VK_SUCCESS) {
+        state_.ReportSetupProblem(VkHandle(), loc, "Unable to submit deferred checks command buffers.");
+    }
+}
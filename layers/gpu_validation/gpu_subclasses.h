@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <utility>
 #include <vector>
 #include <mutex>
 
@@ -50,11 +52,22 @@ struct DescSetState {
 };
 
 struct DescBindingInfo {
-    VkBuffer bindless_state_buffer;
-    VmaAllocation bindless_state_buffer_allocation;
+    BufferRange bindless_state;
     std::vector<DescSetState> descriptor_set_buffers;
 };
 
+// Table of buffer device address ranges read by the instrumented shaders, see Validator::UpdateBDABuffer() for its layout
+struct BDATable {
+    DeviceMemoryBlock memory{};
+    uint32_t max_addresses = 0;
+    // Command buffers recorded against the table. An outgrown table is destroyed at the first submission after it drops to 0,
+    // which can only happen once the submissions of those command buffers retired and the command buffers were reset.
+    std::atomic<uint32_t> command_buffer_count{0};
+    // Set once the truncation of this table has been reported, so it isn't reported again on every submission
+    bool truncation_reported = false;
+    VkDeviceSize Size() const;
+};
+
 // Used for draws/dispatch/traceRays indirect
 struct CmdIndirectState {
     VkBuffer buffer;
@@ -72,9 +85,23 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
     std::vector<std::unique_ptr<CommandResources>> per_command_resources;
     // per vkCmdBindDescriptorSet() state
     std::vector<DescBindingInfo> di_input_buffer_list;
-    VkBuffer current_bindless_buffer = VK_NULL_HANDLE;
+    // Buffer device address tables this recording references, and the table generation of the last one, see
+    // Validator::GetBDATable()
+    small_vector<BDATable *, 1> bda_tables;
+    uint32_t bda_table_generation = 0;
+    BufferRange current_bindless_buffer = {};
     uint32_t draw_index = 0, compute_index = 0, trace_rays_index = 0;
 
+    // Indirect dispatch checks that are recorded in the deferred checks command buffer instead of before each dispatch,
+    // when gpuav_batch_indirect_dispatch_checks is enabled
+    struct DeferredDispatchCheck {
+        VkDescriptorSet indirect_buffer_desc_set;
+        uint32_t indirect_x_offset;  // in words
+        uint32_t cmd_index;
+        uint32_t resource_index;
+    };
+    std::vector<DeferredDispatchCheck> deferred_dispatch_checks;
+
     CommandBuffer(Validator &gpuav, VkCommandBuffer handle, const VkCommandBufferAllocateInfo *pCreateInfo,
                   const vvl::CommandPool *pool);
     ~CommandBuffer();
@@ -114,6 +141,21 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
 
     void ClearCmdErrorsCountsBuffer() const;
 
+    // Command buffer submitted ahead of this one, holding its deferred checks. VK_NULL_HANDLE if there are none.
+    VkCommandBuffer GetDeferredChecksCommandBuffer() const {
+        return deferred_checks_recorded_ ? deferred_checks_cb_ : VK_NULL_HANDLE;
+    }
+    // Resets, and creates if needed, the deferred checks command buffer and begins it
+    VkCommandBuffer BeginDeferredChecksCommandBuffer(const Location &loc);
+    void EndDeferredChecksCommandBuffer();
+
+    // Returns the instrumentation descriptor set of the previous validated command if it was written with the same
+    // bindless and buffer device address buffers, VK_NULL_HANDLE otherwise
+    VkDescriptorSet FindInstrumentationDescriptorSet(const VkDescriptorBufferInfo &bda_table) const;
+    // Returns an instrumentation descriptor set for the current bindless and buffer device address buffers, which the caller
+    // has to write. Sets are recycled when the command buffer is reset.
+    VkDescriptorSet AcquireInstrumentationDescriptorSet(const VkDescriptorBufferInfo &bda_table);
+
     void Destroy() final;
     void Reset() final;
 
@@ -125,10 +167,30 @@ class CommandBuffer : public gpu_tracker::CommandBuffer {
 
     VkDescriptorSetLayout instrumentation_desc_set_layout_ = VK_NULL_HANDLE;
 
+    struct PooledDescriptorSet {
+        VkDescriptorPool pool;
+        VkDescriptorSet set;
+    };
+    struct InstrumentationDescriptorSet {
+        PooledDescriptorSet desc_set;
+        VkBuffer bindless_buffer;
+        VkDeviceSize bindless_offset;
+        VkBuffer bda_buffer;
+        VkDeviceSize bda_range;
+    };
+    // Spare sets are taken from the descriptor set manager in batches, so its lock is not taken for every validated command
+    static constexpr uint32_t kInstrumentationDescSetBatch = 16;
+    std::vector<InstrumentationDescriptorSet> instrumentation_desc_sets_;
+    std::vector<PooledDescriptorSet> spare_instrumentation_desc_sets_;
+
     VkDescriptorSetLayout validation_cmd_desc_set_layout_ = VK_NULL_HANDLE;
     VkDescriptorSet validation_cmd_desc_set_ = VK_NULL_HANDLE;
     VkDescriptorPool validation_cmd_desc_pool_ = VK_NULL_HANDLE;
 
+    VkCommandPool deferred_checks_pool_ = VK_NULL_HANDLE;
+    VkCommandBuffer deferred_checks_cb_ = VK_NULL_HANDLE;
+    bool deferred_checks_recorded_ = false;
+
     // Buffer storing GPU-AV errors
     DeviceMemoryBlock error_output_buffer_ = {};
     // Buffer storing an error count per validated commands.
@@ -140,8 +202,16 @@ class Queue : public gpu_tracker::Queue {
   public:
     Queue(Validator &state, VkQueue q, uint32_t index, VkDeviceQueueCreateFlags flags, const VkQueueFamilyProperties &qfp);
 
+    // Deferred checks command buffers of the last submission which go at the start of the application's batches, indexed
+    // by batch. Empty if all the checks were submitted ahead of the submission.
+    std::vector<std::vector<VkCommandBuffer>> TakeInlineChecks() { return std::exchange(inline_checks_, {}); }
+
   protected:
     uint64_t PreSubmit(std::vector<vvl::QueueSubmission> &&submissions) override;
+    void SubmitDeferredChecks(const std::vector<vvl::QueueSubmission> &submissions, const Location &loc);
+
+  private:
+    std::vector<std::vector<VkCommandBuffer>> inline_checks_;
 };
 
 class Buffer : public vvl::Buffer {
@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
@@ -100,25 +101,12 @@ static bool GpuValidateShader(const vvl::span<const uint32_t> &input, bool SetRe
     return (result == SPV_SUCCESS);
 }
 
-// Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
+// Run the instrumentation passes on the shader and link in the functions they call.
 bool gpuav::Validator::InstrumentShader(const vvl::span<const uint32_t> &input, std::vector<uint32_t> &instrumented_spirv,
                                         const uint32_t unique_shader_id, const Location &loc) {
     if (aborted) return false;
     if (input[0] != spv::MagicNumber) return false;
 
-    const spvtools::MessageConsumer gpu_console_message_consumer =
-        [this, loc](spv_message_level_t level, const char *, const spv_position_t &position, const char *message) -> void {
-        switch (level) {
-            case SPV_MSG_FATAL:
-            case SPV_MSG_INTERNAL_ERROR:
-            case SPV_MSG_ERROR:
-                this->LogError("UNASSIGNED-GPU-Assisted", this->device, loc, "Error during shader instrumentation: line %zu: %s",
-                               position.index, message);
-                break;
-            default:
-                break;
-        }
-    };
     std::vector<std::vector<uint32_t>> binaries(2);
 
     // Load original shader SPIR-V
@@ -132,7 +120,6 @@ bool gpuav::Validator::InstrumentShader(const vvl::span<const uint32_t> &input,
                          static_cast<std::streamsize>(binaries[0].size() * sizeof(uint32_t)));
     }
 
-    using namespace spvtools;
     spv_target_env target_env = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
 
     // Use the unique_shader_id as a shader ID so we can look up its handle later in the shader_map.
@@ -156,6 +143,7 @@ bool gpuav::Validator::InstrumentShader(const vvl::span<const uint32_t> &input,
     for (const auto info : module.link_info_) {
         module.LinkFunction(info);
     }
+    module.RemoveDeadLinkedCode();
 
     module.ToBinary(instrumented_spirv);
 
@@ -179,38 +167,16 @@ bool gpuav::Validator::InstrumentShader(const vvl::span<const uint32_t> &input,
             return false;
         }
     }
-    // Run Dead Code elimination
-    {
-        OptimizerOptions opt_options;
-        opt_options.set_run_validator(false);
-        Optimizer dce_pass(target_env);
-        dce_pass.SetMessageConsumer(gpu_console_message_consumer);
-        // Call CreateAggressiveDCEPass with preserve_interface == true
-        dce_pass.RegisterPass(CreateAggressiveDCEPass(true));
-        if (!dce_pass.Run(instrumented_spirv.data(), instrumented_spirv.size(), &instrumented_spirv, opt_options)) {
-            ReportSetupProblem(device, loc,
-                               "Failure to run spirv-opt DCE on instrumented shader.  Proceeding with non-instrumented shader.");
-            assert(false);
-            return false;
-        }
-
-        if (gpuav_settings.gpuav_debug_dump_instrumented_shaders) {
-            std::string file_name = "dump_" + std::to_string(unique_shader_id) + "_opt.spv";
-            std::ofstream debug_file(file_name, std::ios::out | std::ios::binary);
-            debug_file.write(reinterpret_cast<char *>(instrumented_spirv.data()),
-                             static_cast<std::streamsize>(instrumented_spirv.size() * sizeof(uint32_t)));
-        }
-    }
 
     return true;
 }
 
 bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t shader_hash, chassis::CreateShaderModule &chassis_state) {
-    auto it = instrumented_shaders.find(shader_hash);
-    if (it != instrumented_shaders.end()) {
-        chassis_state.instrumented_create_info.codeSize = it->second.first * sizeof(uint32_t);
-        chassis_state.instrumented_create_info.pCode = it->second.second.data();
-        chassis_state.instrumented_spirv = it->second.second;
+    const auto cached_spirv = instrumented_shaders.Find(shader_hash);
+    if (!cached_spirv.empty()) {
+        chassis_state.instrumented_spirv.assign(cached_spirv.begin(), cached_spirv.end());
+        chassis_state.instrumented_create_info.codeSize = chassis_state.instrumented_spirv.size() * sizeof(uint32_t);
+        chassis_state.instrumented_create_info.pCode = chassis_state.instrumented_spirv.data();
         chassis_state.unique_shader_id = shader_hash;
         return true;
     }
@@ -219,10 +185,10 @@ bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t shader_hash, ch
 
 bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t index, uint32_t shader_hash,
                                                         chassis::ShaderObject &chassis_state) {
-    auto it = instrumented_shaders.find(shader_hash);
-    if (it != instrumented_shaders.end()) {
-        chassis_state.instrumented_create_info[index].codeSize = it->second.first * sizeof(uint32_t);
-        chassis_state.instrumented_create_info[index].pCode = it->second.second.data();
+    const auto cached_spirv = instrumented_shaders.Find(shader_hash);
+    if (!cached_spirv.empty()) {
+        chassis_state.instrumented_create_info[index].codeSize = cached_spirv.size() * sizeof(uint32_t);
+        chassis_state.instrumented_create_info[index].pCode = cached_spirv.data();
         return true;
     }
     return false;
@@ -231,10 +197,7 @@ bool gpuav::Validator::CheckForCachedInstrumentedShader(uint32_t index, uint32_t
 // For the given command buffer, map its debug data buffers and update the status of any update after bind descriptors
 void gpuav::Validator::UpdateInstrumentationBuffer(CommandBuffer *cb_node) {
     for (auto &cmd_info : cb_node->di_input_buffer_list) {
-        glsl::BindlessStateBuffer *bindless_state{nullptr};
-        [[maybe_unused]] VkResult result;
-        result = vmaMapMemory(vmaAllocator, cmd_info.bindless_state_buffer_allocation, reinterpret_cast<void **>(&bindless_state));
-        assert(result == VK_SUCCESS);
+        auto *bindless_state = static_cast<glsl::BindlessStateBuffer *>(cmd_info.bindless_state.host_ptr);
         assert(bindless_state->global_state == desc_heap->GetDeviceAddress());
         for (size_t i = 0; i < cmd_info.descriptor_set_buffers.size(); i++) {
             auto &set_buffer = cmd_info.descriptor_set_buffers[i];
@@ -248,62 +211,204 @@ void gpuav::Validator::UpdateInstrumentationBuffer(CommandBuffer *cb_node) {
                 bindless_state->desc_sets[i].out_data = set_buffer.output_state->device_addr;
             }
         }
-        vmaUnmapMemory(vmaAllocator, cmd_info.bindless_state_buffer_allocation);
     }
 }
 
-void gpuav::Validator::UpdateBDABuffer(const Location &loc) {
-    if (!buffer_device_address_enabled || gpuav_bda_buffer_version == buffer_device_address_ranges_version) {
-        return;
+// Example BDA input buffer with room for 3 addresses, assuming 2 buffers using BDA:
+// Word 0 | Index of start of buffer sizes (max_addresses + 3, in this case 6)
+// Word 1 | 0x0000000000000000
+// Word 2 | Device Address of first buffer  (Addresses sorted in ascending order)
+// Word 3 | Device Address of second buffer
+// Word 4 | 0xffffffffffffffff
+// Word 5 | Unused
+// Word 6 | 0 (size of pretend buffer at word 1)
+// Word 7 | Size in bytes of first buffer
+// Word 8 | Size in bytes of second buffer
+// Word 9 | 0 (size of pretend buffer in word 4)
+// Word 10| Unused
+//
+// Since the sizes start at a fixed index, adding or removing an address only moves the entries after it.
+VkDeviceSize gpuav::BDATable::Size() const {
+    // We need 2 words per address (address and size), 1 word for the start of sizes index, 2 words for the address section
+    // bounds, and 2 more words for the size section bounds
+    return (1 + (VkDeviceSize(max_addresses) + 2) + (VkDeviceSize(max_addresses) + 2)) * sizeof(uint64_t);
+}
+
+std::unique_ptr<gpuav::BDATable> gpuav::Validator::CreateBDATable(uint32_t max_addresses, const Location &loc) {
+    auto table_ptr = std::make_unique<BDATable>();
+    BDATable &table = *table_ptr;
+    table.max_addresses = max_addresses;
+    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
+    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    buffer_info.size = table.Size();
+    VmaAllocationCreateInfo alloc_info = {};
+    // This buffer could be very large if an application uses many buffers. Allocating it as HOST_CACHED
+    // and manually flushing the updated words is faster than using HOST_COHERENT.
+    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+    VkResult result =
+        vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &table.memory.buffer, &table.memory.allocation, nullptr);
+    if (result != VK_SUCCESS) {
+        ReportSetupProblem(device, loc,
+                           "Unable to allocate device memory for buffer device address data. Device could become unstable.", true);
+        return nullptr;
     }
-    auto address_ranges = GetBufferAddressRanges();
-    auto address_ranges_num_addresses = address_ranges.size();
-    if (address_ranges_num_addresses == 0) return;
-
-    // Example BDA input buffer assuming 2 buffers using BDA:
-    // Word 0 | Index of start of buffer sizes (in this case 5)
-    // Word 1 | 0x0000000000000000
-    // Word 2 | Device Address of first buffer  (Addresses sorted in ascending order)
-    // Word 3 | Device Address of second buffer
-    // Word 4 | 0xffffffffffffffff
-    // Word 5 | 0 (size of pretend buffer at word 1)
-    // Word 6 | Size in bytes of first buffer
-    // Word 7 | Size in bytes of second buffer
-    // Word 8 | 0 (size of pretend buffer in word 4)
 
     uint64_t *bda_data;
-    // Make sure to limit writes to size of the buffer
+    result = vmaMapMemory(vmaAllocator, table.memory.allocation, reinterpret_cast<void **>(&bda_data));
+    if (result != VK_SUCCESS) {
+        table.memory.Destroy(vmaAllocator);
+        ReportSetupProblem(device, loc, "Unable to map device memory for buffer device address data. Device could become unstable.",
+                           true);
+        return nullptr;
+    }
+    const size_t size_index = size_t(max_addresses) + 3;
+    bda_data[0] = size_index;  // Start of buffer sizes
+    bda_data[1] = 0;           // NULL address
+    bda_data[2] = std::numeric_limits<uintptr_t>::max();
+    bda_data[size_index] = 0;
+    bda_data[size_index + 1] = 0;
+    result = vmaFlushAllocation(vmaAllocator, table.memory.allocation, 0, VK_WHOLE_SIZE);
+    assert(result == VK_SUCCESS);
+    vmaUnmapMemory(vmaAllocator, table.memory.allocation);
+    return table_ptr;
+}
+
+void gpuav::Validator::DestroyBDATable(BDATable &table) { table.memory.Destroy(vmaAllocator); }
+
+// Write bda_ranges[first_changed..] and the end of table marker, truncating the table if it is too small
+void gpuav::Validator::WriteBDATable(const BDATable &table, size_t first_changed) {
+    const size_t num_addresses = std::min(bda_ranges.size(), size_t(table.max_addresses));
+    first_changed = std::min(first_changed, num_addresses);
+
+    uint64_t *bda_data;
     [[maybe_unused]] VkResult result;
-    result = vmaMapMemory(vmaAllocator, app_buffer_device_addresses.allocation, reinterpret_cast<void **>(&bda_data));
+    result = vmaMapMemory(vmaAllocator, table.memory.allocation, reinterpret_cast<void **>(&bda_data));
     assert(result == VK_SUCCESS);
-    uint32_t address_index = 1;
-    size_t size_index = 3 + address_ranges.size();
-    memset(bda_data, 0, static_cast<size_t>(app_bda_buffer_size));
-    bda_data[0] = size_index;       // Start of buffer sizes
-    bda_data[address_index++] = 0;  // NULL address
-    bda_data[size_index++] = 0;
-    if (address_ranges_num_addresses > gpuav_settings.gpuav_max_buffer_device_addresses) {
-        std::ostringstream problem_string;
-        problem_string << "Number of buffer device addresses in use (" << address_ranges_num_addresses
-                       << ") is greater than khronos_validation.gpuav_max_buffer_device_addresses ("
-                       << gpuav_settings.gpuav_max_buffer_device_addresses
-                       << "). Truncating BDA table which could result in invalid validation";
-        ReportSetupProblem(device, loc, problem_string.str().c_str());
-    }
-    size_t num_addresses =
-        std::min(static_cast<uint32_t>(address_ranges_num_addresses), gpuav_settings.gpuav_max_buffer_device_addresses);
-    for (size_t i = 0; i < num_addresses; i++) {
-        bda_data[address_index++] = address_ranges[i].begin;
-        bda_data[size_index++] = address_ranges[i].end - address_ranges[i].begin;
-    }
-    bda_data[address_index] = std::numeric_limits<uintptr_t>::max();
-    bda_data[size_index] = 0;
-    // Flush the BDA buffer before unmapping so that the new state is visible to the GPU
-    result = vmaFlushAllocation(vmaAllocator, app_buffer_device_addresses.allocation, 0, VK_WHOLE_SIZE);
+    if (result != VK_SUCCESS) {
+        return;
+    }
+    const size_t address_index = 2;
+    const size_t size_index = size_t(table.max_addresses) + 4;
+    for (size_t i = first_changed; i < num_addresses; i++) {
+        bda_data[address_index + i] = bda_ranges[i].begin;
+        bda_data[size_index + i] = bda_ranges[i].end - bda_ranges[i].begin;
+    }
+    bda_data[address_index + num_addresses] = std::numeric_limits<uintptr_t>::max();
+    bda_data[size_index + num_addresses] = 0;
+
+    // Flush only the words which were written so that the new state is visible to the GPU
+    const VkDeviceSize word_count = num_addresses + 1 - first_changed;
+    result = vmaFlushAllocation(vmaAllocator, table.memory.allocation, (address_index + first_changed) * sizeof(uint64_t),
+                                word_count * sizeof(uint64_t));
+    assert(result == VK_SUCCESS);
+    result = vmaFlushAllocation(vmaAllocator, table.memory.allocation, (size_index + first_changed) * sizeof(uint64_t),
+                                word_count * sizeof(uint64_t));
     // No good way to handle this error, we should still try to unmap.
     assert(result == VK_SUCCESS);
-    vmaUnmapMemory(vmaAllocator, app_buffer_device_addresses.allocation);
-    gpuav_bda_buffer_version = buffer_device_address_ranges_version;
+    vmaUnmapMemory(vmaAllocator, table.memory.allocation);
+}
+
+void gpuav::Validator::UpdateBDABuffer(const Location &loc) {
+    if (!buffer_device_address_enabled) {
+        return;
+    }
+    // Most submissions neither change the buffer addresses nor have outgrown tables to free
+    const uint32_t ranges_version = buffer_device_address_ranges_version.load(std::memory_order_acquire);
+    if (gpuav_bda_buffer_version.load(std::memory_order_relaxed) == ranges_version &&
+        !has_retired_bda_tables_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(bda_table_lock_);
+
+    // Outgrown tables are freed once no command buffer is recorded against them anymore
+    auto unused = std::remove_if(retired_bda_tables.begin(), retired_bda_tables.end(), [this](std::unique_ptr<BDATable> &table) {
+        if (table->command_buffer_count.load(std::memory_order_acquire) != 0) {
+            return false;
+        }
+        DestroyBDATable(*table);
+        return true;
+    });
+    retired_bda_tables.erase(unused, retired_bda_tables.end());
+    has_retired_bda_tables_.store(!retired_bda_tables.empty(), std::memory_order_relaxed);
+
+    if (gpuav_bda_buffer_version.load(std::memory_order_relaxed) == ranges_version) {
+        return;
+    }
+    // Read the version first, a change made while the ranges are being updated will be picked up by the next submission
+    gpuav_bda_buffer_version.store(ranges_version, std::memory_order_relaxed);
+    const size_t first_changed = UpdateBufferAddressRanges(bda_ranges);
+
+    // Command buffers recorded from now on use a bigger table, the previous one keeps serving the command buffers recorded
+    // against it
+    bool grown = false;
+    if (bda_ranges.size() > app_bda_table->max_addresses) {
+        const uint64_t max_addresses = std::max(uint64_t(bda_ranges.size()), uint64_t(app_bda_table->max_addresses) * 2);
+        auto new_table = CreateBDATable(static_cast<uint32_t>(std::min(max_addresses, uint64_t(vvl::kU32Max - 4))), loc);
+        if (new_table) {
+            if (app_bda_table->command_buffer_count.load(std::memory_order_acquire) != 0) {
+                retired_bda_tables.emplace_back(std::move(app_bda_table));
+                has_retired_bda_tables_.store(true, std::memory_order_relaxed);
+            } else {
+                DestroyBDATable(*app_bda_table);
+            }
+            app_bda_table = std::move(new_table);
+            bda_table_generation_.fetch_add(1, std::memory_order_release);
+            WriteBDATable(*app_bda_table, 0);
+            grown = true;
+        }
+    }
+    if (!grown) {
+        WriteBDATable(*app_bda_table, first_changed);
+        ReportBDATableTruncation(*app_bda_table, loc);
+    }
+    // Command buffers recorded against a retired table are not re-pointed to the current one, once the ranges no longer fit
+    // they can report out of bounds accesses to the addresses which were cut off until they are re-recorded
+    for (auto &table : retired_bda_tables) {
+        WriteBDATable(*table, first_changed);
+        ReportBDATableTruncation(*table, loc);
+    }
+}
+
+const gpuav::BDATable &gpuav::Validator::GetBDATable(CommandBuffer &cb_node) {
+    // Lock free unless the table was replaced since the command buffer last recorded against it
+    const uint32_t generation = bda_table_generation_.load(std::memory_order_acquire);
+    if (cb_node.bda_tables.empty() || cb_node.bda_table_generation != generation) {
+        std::lock_guard<std::mutex> guard(bda_table_lock_);
+        app_bda_table->command_buffer_count.fetch_add(1, std::memory_order_relaxed);
+        cb_node.bda_tables.emplace_back(app_bda_table.get());
+        cb_node.bda_table_generation = bda_table_generation_.load(std::memory_order_relaxed);
+    }
+    return *cb_node.bda_tables.back();
+}
+
+void gpuav::Validator::ReleaseBDATables(CommandBuffer &cb_node) {
+    for (BDATable *table : cb_node.bda_tables) {
+        // Release orders the command buffer's last use of the table before its destruction in UpdateBDABuffer()
+        table->command_buffer_count.fetch_sub(1, std::memory_order_release);
+    }
+    cb_node.bda_tables.clear();
+}
+
+void gpuav::Validator::ReportBDATableTruncation(BDATable &table, const Location &loc) {
+    if (bda_ranges.size() <= table.max_addresses) {
+        table.truncation_reported = false;
+        return;
+    }
+    if (table.truncation_reported) {
+        return;
+    }
+    table.truncation_reported = true;
+    std::ostringstream problem_string;
+    problem_string << "Number of buffer device addresses in use (" << bda_ranges.size()
+                   << ") is greater than the capacity of a BDA table (" << table.max_addresses << ")";
+    if (&table == app_bda_table.get()) {
+        problem_string << " which could not be grown";
+    } else {
+        problem_string << " still used by command buffers recorded before it was outgrown, re-record them to validate all the"
+                          " addresses";
+    }
+    problem_string << ". Truncating BDA table which could result in invalid validation";
+    ReportSetupProblem(device, loc, problem_string.str().c_str());
 }
 
 void gpuav::Validator::UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
@@ -322,34 +427,20 @@ void gpuav::Validator::UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkP
     // Figure out how much memory we need for the input block based on how many sets and bindings there are
     // and how big each of the bindings is
     if (number_of_sets > 0 && gpuav_settings.validate_descriptors && force_buffer_device_address) {
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
         assert(number_of_sets <= glsl::kDebugInputBindlessMaxDescSets);
-        buffer_info.size = sizeof(glsl::BindlessStateBuffer);
-        buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-        alloc_info.pool = VK_NULL_HANDLE;
         DescBindingInfo di_buffers = {};
 
         // Allocate buffer for device addresses of the input buffer for each descriptor set.  This is the buffer written to each
         // draw's descriptor set.
-        VkResult result = vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &di_buffers.bindless_state_buffer,
-                                          &di_buffers.bindless_state_buffer_allocation, nullptr);
+        VkResult result = cb_node->buffer_allocator.Allocate(sizeof(glsl::BindlessStateBuffer), di_buffers.bindless_state);
         if (result != VK_SUCCESS) {
             ReportSetupProblem(commandBuffer, loc, "Unable to allocate device memory. Device could become unstable.", true);
             aborted = true;
             return;
         }
-        glsl::BindlessStateBuffer *bindless_state{nullptr};
-        result =
-            vmaMapMemory(vmaAllocator, di_buffers.bindless_state_buffer_allocation, reinterpret_cast<void **>(&bindless_state));
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(commandBuffer, loc, "Unable to map device memory. Device could become unstable.", true);
-            aborted = true;
-            return;
-        }
-        memset(bindless_state, 0, static_cast<size_t>(buffer_info.size));
-        cb_node->current_bindless_buffer = di_buffers.bindless_state_buffer;
+        auto *bindless_state = static_cast<glsl::BindlessStateBuffer *>(di_buffers.bindless_state.host_ptr);
+        memset(bindless_state, 0, sizeof(glsl::BindlessStateBuffer));
+        cb_node->current_bindless_buffer = di_buffers.bindless_state;
 
         bindless_state->global_state = desc_heap->GetDeviceAddress();
         for (uint32_t i = 0; i < last_bound.per_set.size(); i++) {
@@ -379,7 +470,6 @@ void gpuav::Validator::UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkP
             }
         }
         cb_node->di_input_buffer_list.emplace_back(di_buffers);
-        vmaUnmapMemory(vmaAllocator, di_buffers.bindless_state_buffer_allocation);
     }
 }
 
@@ -425,115 +515,121 @@ gpuav::CommandResources gpuav::Validator::AllocateActionCommandResources(VkComma
         return CommandResources();
     }
 
-    VkDescriptorSet instrumentation_desc_set = VK_NULL_HANDLE;
-    VkDescriptorPool instrumentation_desc_pool = VK_NULL_HANDLE;
-    VkResult result = desc_set_manager->GetDescriptorSet(
-        &instrumentation_desc_pool, cb_node->GetInstrumentationDescriptorSetLayout(), &instrumentation_desc_set);
-    assert(result == VK_SUCCESS);
-    if (result != VK_SUCCESS) {
-        ReportSetupProblem(cmd_buffer, loc, "Unable to allocate instrumentation descriptor sets. Device could become unstable.");
-        aborted = true;
-        return CommandResources();
+    // Buffer device addresses buffer
+    VkDescriptorBufferInfo bda_input_desc_buffer_info = {};
+    if (buffer_device_address_enabled) {
+        // The table is grown and written at submit time, see UpdateBDABuffer()
+        const BDATable &bda_table = GetBDATable(*cb_node);
+        bda_input_desc_buffer_info.range = bda_table.Size();
+        bda_input_desc_buffer_info.buffer = bda_table.memory.buffer;
+        bda_input_desc_buffer_info.offset = 0;
     }
 
-    // Update instrumentation descriptor set
-    {
-        // Pathetic way of trying to make sure we take care of updating all
-        // bindings of the instrumentation descriptor set
-        assert(validation_bindings_.size() == 6);
-        std::vector<VkWriteDescriptorSet> desc_writes = {};
-
-        // Error output buffer
-        VkDescriptorBufferInfo error_output_desc_buffer_info = {};
-        {
-            error_output_desc_buffer_info.range = VK_WHOLE_SIZE;
-            error_output_desc_buffer_info.buffer = cb_node->GetErrorOutputBuffer();
-            error_output_desc_buffer_info.offset = 0;
-
-            VkWriteDescriptorSet wds = vku::InitStructHelper();
-            wds.dstBinding = glsl::kBindingInstErrorBuffer;
-            wds.descriptorCount = 1;
-            wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            wds.pBufferInfo = &error_output_desc_buffer_info;
-            wds.dstSet = instrumentation_desc_set;
-            desc_writes.emplace_back(wds);
+    // Commands recorded with the same bindless state and buffer device address buffers share an instrumentation descriptor set,
+    // the per command indices are dynamic offsets
+    VkDescriptorSet instrumentation_desc_set = cb_node->FindInstrumentationDescriptorSet(bda_input_desc_buffer_info);
+    if (instrumentation_desc_set == VK_NULL_HANDLE) {
+        instrumentation_desc_set = cb_node->AcquireInstrumentationDescriptorSet(bda_input_desc_buffer_info);
+        if (instrumentation_desc_set == VK_NULL_HANDLE) {
+            ReportSetupProblem(cmd_buffer, loc,
+                               "Unable to allocate instrumentation descriptor sets. Device could become unstable.");
+            aborted = true;
+            return CommandResources();
         }
-
-        // Buffer holding action command index in command buffer
-        VkDescriptorBufferInfo indices_desc_buffer_info = {};
+        // Update instrumentation descriptor set
         {
-            indices_desc_buffer_info.range = sizeof(uint32_t);
-            indices_desc_buffer_info.buffer = indices_buffer.buffer;
-            indices_desc_buffer_info.offset = 0;
-
-            VkWriteDescriptorSet wds = vku::InitStructHelper();
-            wds.dstBinding = glsl::kBindingInstActionIndex;
-            wds.descriptorCount = 1;
-            wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
-            wds.pBufferInfo = &indices_desc_buffer_info;
-            wds.dstSet = instrumentation_desc_set;
-            desc_writes.emplace_back(wds);
-        }
+            // Pathetic way of trying to make sure we take care of updating all
+            // bindings of the instrumentation descriptor set
+            assert(validation_bindings_.size() == 6);
+            std::vector<VkWriteDescriptorSet> desc_writes = {};
+
+            // Error output buffer
+            VkDescriptorBufferInfo error_output_desc_buffer_info = {};
+            {
+                error_output_desc_buffer_info.range = VK_WHOLE_SIZE;
+                error_output_desc_buffer_info.buffer = cb_node->GetErrorOutputBuffer();
+                error_output_desc_buffer_info.offset = 0;
+
+                VkWriteDescriptorSet wds = vku::InitStructHelper();
+                wds.dstBinding = glsl::kBindingInstErrorBuffer;
+                wds.descriptorCount = 1;
+                wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                wds.pBufferInfo = &error_output_desc_buffer_info;
+                wds.dstSet = instrumentation_desc_set;
+                desc_writes.emplace_back(wds);
+            }
 
-        // Buffer holding a resource index from the per command buffer command resources list
-        {
-            VkWriteDescriptorSet wds = vku::InitStructHelper();
-            wds.dstBinding = glsl::kBindingInstCmdResourceIndex;
-            wds.descriptorCount = 1;
-            wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
-            wds.pBufferInfo = &indices_desc_buffer_info;
-            wds.dstSet = instrumentation_desc_set;
-            desc_writes.emplace_back(wds);
-        }
+            // Buffer holding action command index in command buffer
+            VkDescriptorBufferInfo indices_desc_buffer_info = {};
+            {
+                indices_desc_buffer_info.range = sizeof(uint32_t);
+                indices_desc_buffer_info.buffer = indices_buffer.buffer;
+                indices_desc_buffer_info.offset = 0;
+
+                VkWriteDescriptorSet wds = vku::InitStructHelper();
+                wds.dstBinding = glsl::kBindingInstActionIndex;
+                wds.descriptorCount = 1;
+                wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+                wds.pBufferInfo = &indices_desc_buffer_info;
+                wds.dstSet = instrumentation_desc_set;
+                desc_writes.emplace_back(wds);
+            }
 
-        VkDescriptorBufferInfo cmd_errors_counts_desc_buffer_info = {};
-        {
-            cmd_errors_counts_desc_buffer_info.range = VK_WHOLE_SIZE;
-            cmd_errors_counts_desc_buffer_info.buffer = cb_node->GetCmdErrorsCountsBuffer();
-            cmd_errors_counts_desc_buffer_info.offset = 0;
-
-            VkWriteDescriptorSet wds = vku::InitStructHelper();
-            wds.dstBinding = glsl::kBindingInstCmdErrorsCount;
-            wds.descriptorCount = 1;
-            wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            wds.pBufferInfo = &cmd_errors_counts_desc_buffer_info;
-            wds.dstSet = instrumentation_desc_set;
-            desc_writes.emplace_back(wds);
-        }
+            // Buffer holding a resource index from the per command buffer command resources list
+            {
+                VkWriteDescriptorSet wds = vku::InitStructHelper();
+                wds.dstBinding = glsl::kBindingInstCmdResourceIndex;
+                wds.descriptorCount = 1;
+                wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+                wds.pBufferInfo = &indices_desc_buffer_info;
+                wds.dstSet = instrumentation_desc_set;
+                desc_writes.emplace_back(wds);
+            }
 
-        // Current bindless buffer
-        VkDescriptorBufferInfo di_input_desc_buffer_info = {};
-        if (cb_node->current_bindless_buffer != VK_NULL_HANDLE) {
-            di_input_desc_buffer_info.range = VK_WHOLE_SIZE;
-            di_input_desc_buffer_info.buffer = cb_node->current_bindless_buffer;
-            di_input_desc_buffer_info.offset = 0;
-
-            VkWriteDescriptorSet wds = vku::InitStructHelper();
-            wds.dstBinding = glsl::kBindingInstBindlessDescriptor;
-            wds.descriptorCount = 1;
-            wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            wds.pBufferInfo = &di_input_desc_buffer_info;
-            wds.dstSet = instrumentation_desc_set;
-            desc_writes.emplace_back(wds);
-        }
+            VkDescriptorBufferInfo cmd_errors_counts_desc_buffer_info = {};
+            {
+                cmd_errors_counts_desc_buffer_info.range = VK_WHOLE_SIZE;
+                cmd_errors_counts_desc_buffer_info.buffer = cb_node->GetCmdErrorsCountsBuffer();
+                cmd_errors_counts_desc_buffer_info.offset = 0;
+
+                VkWriteDescriptorSet wds = vku::InitStructHelper();
+                wds.dstBinding = glsl::kBindingInstCmdErrorsCount;
+                wds.descriptorCount = 1;
+                wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                wds.pBufferInfo = &cmd_errors_counts_desc_buffer_info;
+                wds.dstSet = instrumentation_desc_set;
+                desc_writes.emplace_back(wds);
+            }
 
-        // Buffer device addresses buffer
-        VkDescriptorBufferInfo bda_input_desc_buffer_info = {};
-        if (buffer_device_address_enabled) {
-            bda_input_desc_buffer_info.range = app_bda_buffer_size;
-            bda_input_desc_buffer_info.buffer = app_buffer_device_addresses.buffer;
-            bda_input_desc_buffer_info.offset = 0;
-
-            VkWriteDescriptorSet wds = vku::InitStructHelper();
-            wds.dstBinding = glsl::kBindingInstBufferDeviceAddress;
-            wds.descriptorCount = 1;
-            wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            wds.pBufferInfo = &bda_input_desc_buffer_info;
-            wds.dstSet = instrumentation_desc_set;
-            desc_writes.emplace_back(wds);
-        }
+            // Current bindless buffer
+            VkDescriptorBufferInfo di_input_desc_buffer_info = {};
+            if (cb_node->current_bindless_buffer.buffer != VK_NULL_HANDLE) {
+                di_input_desc_buffer_info.range = cb_node->current_bindless_buffer.size;
+                di_input_desc_buffer_info.buffer = cb_node->current_bindless_buffer.buffer;
+                di_input_desc_buffer_info.offset = cb_node->current_bindless_buffer.offset;
+
+                VkWriteDescriptorSet wds = vku::InitStructHelper();
+                wds.dstBinding = glsl::kBindingInstBindlessDescriptor;
+                wds.descriptorCount = 1;
+                wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                wds.pBufferInfo = &di_input_desc_buffer_info;
+                wds.dstSet = instrumentation_desc_set;
+                desc_writes.emplace_back(wds);
+            }
 
-        DispatchUpdateDescriptorSets(device, static_cast<uint32_t>(desc_writes.size()), desc_writes.data(), 0, nullptr);
+            // Buffer device addresses buffer
+            if (buffer_device_address_enabled) {
+                VkWriteDescriptorSet wds = vku::InitStructHelper();
+                wds.dstBinding = glsl::kBindingInstBufferDeviceAddress;
+                wds.descriptorCount = 1;
+                wds.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                wds.pBufferInfo = &bda_input_desc_buffer_info;
+                wds.dstSet = instrumentation_desc_set;
+                desc_writes.emplace_back(wds);
+            }
+
+            DispatchUpdateDescriptorSets(device, static_cast<uint32_t>(desc_writes.size()), desc_writes.data(), 0, nullptr);
+        }
     }
 
     const auto pipeline_layout =
@@ -589,7 +685,6 @@ gpuav::CommandResources gpuav::Validator::AllocateActionCommandResources(VkComma
                                   (pipeline_state && pipeline_state->uses_pipeline_robustness));
 
     cmd_resources.instrumentation_desc_set = instrumentation_desc_set;
-    cmd_resources.instrumentation_desc_pool = instrumentation_desc_pool;
     cmd_resources.pipeline_bind_point = bind_point;
     cmd_resources.uses_robustness = uses_robustness;
     cmd_resources.uses_shader_object = pipeline_state == nullptr;
@@ -952,8 +1047,9 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDispatchIn
         const auto *pipeline_state = last_bound.pipeline_state;
         const bool use_shader_objects = pipeline_state == nullptr;
 
+        const bool batch_checks = gpuav_settings.batch_indirect_dispatch_checks;
         PreDispatchResources::SharedResources *shared_resources = GetSharedDispatchIndirectValidationResources(
-            cb_node->GetValidationCmdCommonDescriptorSetLayout(), use_shader_objects, loc);
+            cb_node->GetValidationCmdCommonDescriptorSetLayout(), use_shader_objects && !batch_checks, loc);
         if (!shared_resources) {
             return std::make_unique<gpuav::PreDispatchResources>();
         }
@@ -986,6 +1082,16 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDispatchIn
 
         DispatchUpdateDescriptorSets(device, 1, &desc_write, 0, nullptr);
 
+        if (batch_checks) {
+            // Recorded in the command buffer submitted ahead of this one, see RecordDeferredDispatchChecks
+            cb_node->deferred_dispatch_checks.emplace_back(
+                CommandBuffer::DeferredDispatchCheck{dispatch_resources->indirect_buffer_desc_set,
+                                                     static_cast<uint32_t>((indirect_offset / sizeof(uint32_t))),
+                                                     cb_node->compute_index,
+                                                     static_cast<uint32_t>(cb_node->per_command_resources.size())});
+            return dispatch_resources;
+        }
+
         // Save current graphics pipeline state
         RestorablePipelineState restorable_state(*cb_node, VK_PIPELINE_BIND_POINT_COMPUTE);
 
@@ -1016,6 +1122,65 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreDispatchIn
     return dispatch_resources;
 }
 
+// Records all the indirect dispatch checks of a command buffer back to back, in the command buffer which is submitted ahead of
+// it. Between checks only the dynamic offsets, the indirect buffer descriptor set and the offset push constant change.
+void gpuav::Validator::RecordDeferredDispatchChecks(CommandBuffer &cb_node, const Location &loc) {
+    if (cb_node.deferred_dispatch_checks.empty()) {
+        return;
+    }
+    PreDispatchResources::SharedResources *shared_resources =
+        GetSharedDispatchIndirectValidationResources(cb_node.GetValidationCmdCommonDescriptorSetLayout(), false, loc);
+    if (!shared_resources) {
+        return;
+    }
+    const VkCommandBuffer checks_cb = cb_node.BeginDeferredChecksCommandBuffer(loc);
+    if (checks_cb == VK_NULL_HANDLE) {
+        return;
+    }
+
+    // Indirect buffers written by previous submissions to the queue
+    VkMemoryBarrier memory_barrier = vku::InitStructHelper();
+    memory_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    memory_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    DispatchCmdPipelineBarrier(checks_cb, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
+                               &memory_barrier, 0, nullptr, 0, nullptr);
+
+    // The pipeline is not created if the shared resources were first needed by a command buffer using shader objects
+    if (shared_resources->pipeline != VK_NULL_HANDLE) {
+        DispatchCmdBindPipeline(checks_cb, VK_PIPELINE_BIND_POINT_COMPUTE, shared_resources->pipeline);
+    } else {
+        VkShaderStageFlagBits stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        DispatchCmdBindShadersEXT(checks_cb, 1u, &stage, &shared_resources->shader_object);
+    }
+    uint32_t push_constants[PreDispatchResources::push_constant_words] = {};
+    push_constants[0] = phys_dev_props.limits.maxComputeWorkGroupCount[0];
+    push_constants[1] = phys_dev_props.limits.maxComputeWorkGroupCount[1];
+    push_constants[2] = phys_dev_props.limits.maxComputeWorkGroupCount[2];
+    DispatchCmdPushConstants(checks_cb, shared_resources->pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                             sizeof(push_constants), push_constants);
+
+    for (const CommandBuffer::DeferredDispatchCheck &check : cb_node.deferred_dispatch_checks) {
+        assert(check.cmd_index < cst::indices_count);
+        assert(check.resource_index < cst::indices_count);
+        const std::array<VkDescriptorSet, 2> desc_sets = {
+            {cb_node.GetValidationCmdCommonDescriptorSet(), check.indirect_buffer_desc_set}};
+        const std::array<uint32_t, 2> dynamic_offsets = {{check.cmd_index * static_cast<uint32_t>(sizeof(uint32_t)),
+                                                          check.resource_index * static_cast<uint32_t>(sizeof(uint32_t))}};
+        static_assert(glsl::kDiagPerCmdDescriptorSet == glsl::kDiagCommonDescriptorSet + 1, "Sets are bound with one call");
+        DispatchCmdBindDescriptorSets(checks_cb, VK_PIPELINE_BIND_POINT_COMPUTE, shared_resources->pipeline_layout,
+                                      glsl::kDiagCommonDescriptorSet, static_cast<uint32_t>(desc_sets.size()), desc_sets.data(),
+                                      static_cast<uint32_t>(dynamic_offsets.size()), dynamic_offsets.data());
+        DispatchCmdPushConstants(checks_cb, shared_resources->pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT,
+                                 3 * sizeof(uint32_t), sizeof(uint32_t), &check.indirect_x_offset);
+        DispatchCmdDispatch(checks_cb, 1, 1, 1);
+    }
+
+    // No barrier after the checks, so that the following batches don't wait on them. The command buffer's own commands
+    // only reserve error records with atomics, the same as the checks, and the host reads the records after the barrier
+    // command buffer submitted at the end of the submission.
+    cb_node.EndDeferredChecksCommandBuffer();
+}
+
 gpuav::PreDispatchResources::SharedResources *gpuav::Validator::GetSharedDispatchIndirectValidationResources(
     VkDescriptorSetLayout error_output_desc_set, bool use_shader_objects, const Location &loc) {
     if (auto shared_resources = shared_validation_resources_map.find(typeid(PreDispatchResources::SharedResources));
@@ -1411,41 +1576,22 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreCopyBuffer
             uint32_t image_extent[4];
         };
 
-        VkBufferCreateInfo buffer_info = vku::InitStructHelper();
         const VkDeviceSize uniform_block_constants_byte_size = (4 +  // image extent
                                                                 1 +  // block size
                                                                 1 +  // gpu copy regions count
                                                                 2    // pad
                                                                 ) *
                                                                sizeof(uint32_t);
-        buffer_info.size = uniform_block_constants_byte_size + sizeof(BufferImageCopy) * copy_buffer_to_img_info->regionCount;
-        buffer_info.usage = VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-        VmaAllocationCreateInfo alloc_info = {};
-        alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-
-        uint32_t mem_type_index = 0;
-        vmaFindMemoryTypeIndexForBufferInfo(vmaAllocator, &buffer_info, &alloc_info, &mem_type_index);
-
-        alloc_info.pool = shared_resources->copy_regions_pool;
-        VkResult result =
-            vmaCreateBuffer(vmaAllocator, &buffer_info, &alloc_info, &copy_buffer_to_img_resources->copy_src_regions_buffer,
-                            &copy_buffer_to_img_resources->copy_src_regions_allocation, nullptr);
+        const VkDeviceSize regions_byte_size =
+            uniform_block_constants_byte_size + sizeof(BufferImageCopy) * copy_buffer_to_img_info->regionCount;
+        VkResult result = cb_node->buffer_allocator.Allocate(regions_byte_size, copy_buffer_to_img_resources->copy_src_regions);
         if (result != VK_SUCCESS) {
             ReportSetupProblem(cmd_buffer, loc, "Unable to allocate device memory for GPU copy of pRegions. Aborting GPU-AV.",
                                true);
             aborted = true;
             return nullptr;
         }
-
-        uint32_t *gpu_regions_u32_ptr = nullptr;
-        result = vmaMapMemory(vmaAllocator, copy_buffer_to_img_resources->copy_src_regions_allocation,
-                              reinterpret_cast<void **>(&gpu_regions_u32_ptr));
-
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(cmd_buffer, loc, "Unable to map device memory for GPU copy of pRegions. Aborting GPU-AV.", true);
-            aborted = true;
-            return nullptr;
-        }
+        auto *gpu_regions_u32_ptr = static_cast<uint32_t *>(copy_buffer_to_img_resources->copy_src_regions.host_ptr);
 
         const uint32_t block_size = image_state->create_info.format == VK_FORMAT_D32_SFLOAT ? 4 : 5;
         uint32_t gpu_regions_count = 0;
@@ -1490,7 +1636,6 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreCopyBuffer
 
         if (gpu_regions_count == 0) {
             // Nothing to validate
-            vmaUnmapMemory(vmaAllocator, copy_buffer_to_img_resources->copy_src_regions_allocation);
             copy_buffer_to_img_resources->Destroy(*this);
             return nullptr;
         }
@@ -1503,8 +1648,6 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreCopyBuffer
         gpu_regions_u32_ptr[5] = gpu_regions_count;
         gpu_regions_u32_ptr[6] = 0;
         gpu_regions_u32_ptr[7] = 0;
-
-        vmaUnmapMemory(vmaAllocator, copy_buffer_to_img_resources->copy_src_regions_allocation);
     }
 
     // Update descriptor set
@@ -1524,9 +1667,9 @@ std::unique_ptr<gpuav::CommandResources> gpuav::Validator::AllocatePreCopyBuffer
         descriptor_buffer_infos[0].offset = 0;
         descriptor_buffer_infos[0].range = VK_WHOLE_SIZE;
         // Copy regions buffer
-        descriptor_buffer_infos[1].buffer = copy_buffer_to_img_resources->copy_src_regions_buffer;
-        descriptor_buffer_infos[1].offset = 0;
-        descriptor_buffer_infos[1].range = VK_WHOLE_SIZE;
+        descriptor_buffer_infos[1].buffer = copy_buffer_to_img_resources->copy_src_regions.buffer;
+        descriptor_buffer_infos[1].offset = copy_buffer_to_img_resources->copy_src_regions.offset;
+        descriptor_buffer_infos[1].range = copy_buffer_to_img_resources->copy_src_regions.size;
 
         std::array<VkWriteDescriptorSet, descriptor_buffer_infos.size()> desc_writes = {};
         for (const auto [i, desc_buffer_info] : vvl::enumerate(descriptor_buffer_infos.data(), descriptor_buffer_infos.size())) {
@@ -1584,27 +1727,6 @@ gpuav::PreCopyBufferToImageResources::SharedResources *gpuav::Validator::GetShar
         return nullptr;
     }
 
-    // Allocate buffer memory pool that will be used to create the buffers holding copy regions
-    VkBufferCreateInfo buffer_info = vku::InitStructHelper();
-    buffer_info.size = 4096;  // Dummy value
-    buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo alloc_info = {};
-    alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
-
-    uint32_t mem_type_index = 0;
-    vmaFindMemoryTypeIndexForBufferInfo(vmaAllocator, &buffer_info, &alloc_info, &mem_type_index);
-    VmaPoolCreateInfo pool_create_info = {};
-    pool_create_info.memoryTypeIndex = mem_type_index;
-    pool_create_info.blockSize = 0;
-    pool_create_info.maxBlockCount = 0;
-    pool_create_info.flags = VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT;
-    result = vmaCreatePool(vmaAllocator, &pool_create_info, &shared_resources->copy_regions_pool);
-    if (result != VK_SUCCESS) {
-        ReportSetupProblem(device, loc, "Unable to create VMA memory pool for buffer to image copies validation. Aborting GPU-AV");
-        aborted = true;
-        return nullptr;
-    }
-
     std::array<VkDescriptorSetLayout, 2> set_layouts = {{error_output_set_layout, shared_resources->ds_layout}};
     VkPipelineLayoutCreateInfo pipeline_layout_ci = vku::InitStructHelper();
     pipeline_layout_ci.setLayoutCount = static_cast<uint32_t>(set_layouts.size());
@@ -22,9 +22,11 @@
 #include "gpu_validation/gpu_descriptor_set.h"
 #include "gpu_validation/gpu_resources.h"
 
+#include <atomic>
 #include <typeinfo>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 
 typedef vvl::unordered_map<const vvl::Image*, std::optional<GlobalImageLayoutRangeMap>> GlobalImageLayoutMap;
 
@@ -111,7 +113,12 @@ class Validator : public gpu_tracker::Validator {
     bool CheckForCachedInstrumentedShader(const uint32_t shader_hash, chassis::CreateShaderModule& chassis_state);
     bool CheckForCachedInstrumentedShader(const uint32_t index, const uint32_t shader_hash, chassis::ShaderObject& chassis_state);
     void UpdateInstrumentationBuffer(CommandBuffer* cb_node);
+    // Called at submit time, writes the buffer device address ranges to the tables if they changed
     void UpdateBDABuffer(const Location& loc);
+    // Returns the table the command buffer records against, and counts the command buffer as one of its users
+    const BDATable& GetBDATable(CommandBuffer& cb_node);
+    // Called when the command buffer is reset or destroyed
+    void ReleaseBDATables(CommandBuffer& cb_node);
 
     void UpdateBoundDescriptors(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, const Location& loc);
 
@@ -135,6 +142,7 @@ class Validator : public gpu_tracker::Validator {
                                                                                                    VkCommandBuffer cmd_buffer,
                                                                                                    VkBuffer indirect_buffer,
                                                                                                    VkDeviceSize indirect_offset);
+    void RecordDeferredDispatchChecks(CommandBuffer& cb_node, const Location& loc);
     [[nodiscard]] std::unique_ptr<CommandResources> AllocatePreTraceRaysValidationResources(const Location& loc,
                                                                                             VkCommandBuffer cmd_buffer,
                                                                                             VkDeviceAddress indirect_data_address);
@@ -213,6 +221,12 @@ class Validator : public gpu_tracker::Validator {
     void PreCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator,
                                    VkBuffer* pBuffer, const RecordObject& record_obj,
                                    chassis::CreateBuffer& chassis_state) override;
+    void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
+                                  const RecordObject& record_obj, chassis::QueueSubmit& chassis_state) override;
+    void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence,
+                                   const RecordObject& record_obj, chassis::QueueSubmit2& chassis_state) override;
+    void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence,
+                                      const RecordObject& record_obj, chassis::QueueSubmit2& chassis_state) override;
     void PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator,
                                         const RecordObject& record_obj) override;
 
@@ -246,6 +260,8 @@ class Validator : public gpu_tracker::Validator {
     void PostCallRecordCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo,
                                          const RecordObject& record_obj) override;
 
+    void PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, const RecordObject& record_obj) override;
+
     void PostCallRecordCmdBindDescriptorSets2KHR(VkCommandBuffer commandBuffer,
                                                  const VkBindDescriptorSetsInfoKHR* pBindDescriptorSetsInfo,
                                                  const RecordObject& record_obj) override;
@@ -473,6 +489,9 @@ class Validator : public gpu_tracker::Validator {
 
   private:
     VkPipeline GetDrawValidationPipeline(VkRenderPass render_pass);
+    // Puts the deferred checks the queue could not submit ahead of the submission at the start of their batches
+    void AddInlineChecks(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, chassis::QueueSubmit& chassis_state);
+    void AddInlineChecks(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, chassis::QueueSubmit2& chassis_state);
 
     template <typename RangeFactory>
     bool VerifyImageLayoutRange(const vvl::CommandBuffer& cb_state, const vvl::Image& image_state, VkImageAspectFlags aspect_mask,
@@ -482,9 +501,21 @@ class Validator : public gpu_tracker::Validator {
     VkBool32 shaderInt64 = false;
     std::string instrumented_shader_cache_path{};
     AccelerationStructureBuildValidationState acceleration_structure_validation_state{};
-    DeviceMemoryBlock app_buffer_device_addresses{};
-    size_t app_bda_buffer_size{};
-    uint32_t gpuav_bda_buffer_version = 0;
+    [[nodiscard]] std::unique_ptr<BDATable> CreateBDATable(uint32_t max_addresses, const Location& loc);
+    void DestroyBDATable(BDATable& table);
+    void WriteBDATable(const BDATable& table, size_t first_changed);
+    void ReportBDATableTruncation(BDATable& table, const Location& loc);
+    // Guards the members below, the tables are updated at submit time while command buffers are recorded against them
+    std::mutex bda_table_lock_;
+    std::unique_ptr<BDATable> app_bda_table{};
+    // Bumped when app_bda_table is replaced, command buffers recording only take the lock when it changed
+    std::atomic<uint32_t> bda_table_generation_{0};
+    // Tables outgrown by the application, they are still updated since pending command buffers can reference them
+    std::vector<std::unique_ptr<BDATable>> retired_bda_tables{};
+    std::atomic<bool> has_retired_bda_tables_{false};
+    // Sorted address ranges currently written to the tables
+    std::vector<BufferAddressRange> bda_ranges{};
+    std::atomic<uint32_t> gpuav_bda_buffer_version{0};
 
     bool buffer_device_address_enabled = false;
 
@@ -22,15 +22,17 @@
 namespace gpuav {
 namespace spirv {
 
-static LinkInfo link_info = {inst_bindless_descriptor_comp, inst_bindless_descriptor_comp_size,
-                             LinkFunctions::inst_bindless_descriptor, 0, "inst_bindless_descriptor"};
+static const LinkInfo link_info = {inst_bindless_descriptor_comp, inst_bindless_descriptor_comp_size,
+                                   LinkFunctions::inst_bindless_descriptor, 0, "inst_bindless_descriptor"};
 
 // By appending the LinkInfo, it will attempt at linking stage to add the function.
 uint32_t BindlessDescriptorPass::GetLinkFunctionId() {
     if (link_function_id == 0) {
         link_function_id = module_.TakeNextId();
-        link_info.function_id = link_function_id;
-        module_.link_info_.push_back(link_info);
+        // Shaders are instrumented from several threads at once, the shared LinkInfo can't be modified
+        LinkInfo info = link_info;
+        info.function_id = link_function_id;
+        module_.link_info_.push_back(info);
     }
     return link_function_id;
 }
@@ -38,7 +38,7 @@ void Function::ToBinary(std::vector<uint32_t>& out) {
     }
 }
 
-BasicBlock::BasicBlock(std::unique_ptr<Instruction> label, Function& function) : function_(function) {
+BasicBlock::BasicBlock(InstructionPtr label, Function& function) : function_(function) {
     // Used when loading initial SPIR-V
     instructions_.push_back(std::move(label));  // OpLabel
 }
@@ -58,7 +58,7 @@ void BasicBlock::CreateInstruction(spv::Op opcode, const std::vector<uint32_t>&
     }
 
     // Add 1 as we need to reserve the first word for the opcode/length
-    auto new_inst = std::make_unique<Instruction>((uint32_t)(words.size() + 1), opcode);
+    auto new_inst = function_.module_.instruction_arena_.Make((uint32_t)(words.size() + 1), opcode);
     new_inst->Fill(words);
 
     const uint32_t result_id = new_inst->ResultId();
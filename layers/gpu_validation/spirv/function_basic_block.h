@@ -19,24 +19,24 @@
 #include <memory>
 #include <spirv/unified1/spirv.hpp>
 #include "containers/custom_containers.h"
+#include "instruction.h"
 
 namespace gpuav {
 namespace spirv {
 
 class Module;
 struct Function;
-struct Instruction;
 
 // Core data structure of module.
 // The vector acts as our linked list to iterator and make occasional insertions.
-// The unique_ptr allows us to create instructions outside module scope and bring them back.
-using InstructionList = std::vector<std::unique_ptr<Instruction>>;
+// The InstructionPtr allows us to create instructions outside module scope and bring them back.
+using InstructionList = std::vector<InstructionPtr>;
 using InstructionIt = InstructionList::iterator;
 
 // Since CFG analysis/manipulation is not a main focus, Blocks/Funcitons are just simple containers for ordering Instructions
 struct BasicBlock {
     // Used when loading initial SPIR-V
-    BasicBlock(std::unique_ptr<Instruction> label, Function& function);
+    BasicBlock(InstructionPtr label, Function& function);
     BasicBlock(Module& module, Function& function);
 
     void ToBinary(std::vector<uint32_t>& out);
@@ -57,7 +57,7 @@ using BasicBlockList = std::vector<std::unique_ptr<BasicBlock>>;
 using BasicBlockIt = BasicBlockList::iterator;
 
 struct Function {
-    Function(Module& module, std::unique_ptr<Instruction> function_inst) : module_(module) {
+    Function(Module& module, InstructionPtr function_inst) : module_(module) {
         // Used when loading initial SPIR-V
         pre_block_inst_.push_back(std::move(function_inst));  // OpFunction
     }
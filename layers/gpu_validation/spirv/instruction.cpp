@@ -105,6 +105,24 @@ void Instruction::ReplaceResultId(uint32_t new_result_id) {
     UpdateDebugInfo();
 }
 
+static OperandKind GetOperandKind(const Instruction& inst, uint32_t word_index, uint32_t type_index) {
+    const OperandInfo& operand_info = inst.operand_info_;
+    if (type_index < operand_info.types.size()) {
+        return operand_info.types[type_index];
+    }
+
+    // If the last operands are a wildcard use the last kind for the remaining words
+    OperandKind kind = operand_info.types.back();
+    if (kind == OperandKind::BitEnum) {
+        // ImageOperands may be found, their optional parameters will always have an Id
+        const uint32_t image_operand_position = OpcodeImageOperandsPosition(inst.Opcode());
+        if (image_operand_position != 0 && word_index > image_operand_position) {
+            kind = OperandKind::Id;
+        }
+    }
+    return kind;
+}
+
 void Instruction::ReplaceOperandId(uint32_t old_word, uint32_t new_word) {
     const uint32_t length = Length();
     uint32_t type_index = 0;
@@ -114,20 +132,7 @@ void Instruction::ReplaceOperandId(uint32_t old_word, uint32_t new_word) {
             continue;
         }
 
-        OperandKind kind = OperandKind::Invalid;
-        if (type_index < operand_info_.types.size()) {
-            kind = operand_info_.types[type_index];
-        } else {
-            // If the last operands are a wildcard use the last kind for the remaining words
-            kind = operand_info_.types.back();
-            if (kind == OperandKind::BitEnum) {
-                // ImageOperands may be found, their optional parameters will always have an Id
-                const uint32_t image_operand_position = OpcodeImageOperandsPosition(Opcode());
-                if (image_operand_position != 0 && word_index > image_operand_position) {
-                    kind = OperandKind::Id;
-                }
-            }
-        }
+        const OperandKind kind = GetOperandKind(*this, word_index, type_index);
 
         // insructions like OpPhi will be Composite which are just groups of Ids
         // We are not trying to replace/mess with with Control Flow, so all OperandKind::Label are ignored on purpose
@@ -138,6 +143,25 @@ void Instruction::ReplaceOperandId(uint32_t old_word, uint32_t new_word) {
     }
 }
 
+void Instruction::AppendUsedIds(std::vector<uint32_t>& ids) const {
+    if (type_id_index_ != 0) {
+        ids.push_back(words_[type_id_index_]);
+    }
+    if (operand_info_.types.empty()) {
+        return;
+    }
+
+    const uint32_t length = Length();
+    uint32_t type_index = 0;
+    for (uint32_t word_index = operand_index_; word_index < length; word_index++, type_index++) {
+        const OperandKind kind = GetOperandKind(*this, word_index, type_index);
+        // Composite can also hold literals (OpSwitch), keeping an extra ID alive is harmless
+        if (kind == OperandKind::Id || kind == OperandKind::Label || kind == OperandKind::Composite) {
+            ids.push_back(words_[word_index]);
+        }
+    }
+}
+
 // The main challenge with linking to functions from 2 modules is the IDs overlap.
 // TODO - Use the new generated operand to find the IDs.
 void Instruction::ReplaceLinkedId(vvl::unordered_map<uint32_t, uint32_t>& id_swap_map) {
@@ -288,5 +312,13 @@ void Instruction::ReplaceLinkedId(vvl::unordered_map<uint32_t, uint32_t>& id_swa
     UpdateDebugInfo();
 }
 
+void* InstructionArena::Allocate() {
+    if (next_slot_ == kSlotsPerBlock) {
+        blocks_.emplace_back(new Slot[kSlotsPerBlock]);
+        next_slot_ = 0;
+    }
+    return blocks_.back()[next_slot_++].bytes;
+}
+
 }  // namespace spirv
 }  // namespace gpuav
\ No newline at end of file
@@ -17,6 +17,9 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <vector>
+#include <memory>
+#include <new>
+#include <utility>
 #include "containers/custom_containers.h"
 #include <spirv/unified1/spirv.hpp>
 
@@ -58,6 +61,8 @@ struct Instruction {
     void ReplaceResultId(uint32_t new_result_id);
     // searchs all operands to replace ID if found
     void ReplaceOperandId(uint32_t old_word, uint32_t new_word);
+    // Adds the Result Type and every operand that is an ID (including Labels) to |ids|
+    void AppendUsedIds(std::vector<uint32_t>& ids) const;
     void ReplaceLinkedId(vvl::unordered_map<uint32_t, uint32_t>& id_swap_map);
 
     bool IsArray() const { return (Opcode() == spv::OpTypeArray || Opcode() == spv::OpTypeRuntimeArray); }
@@ -94,5 +99,37 @@ struct Instruction {
 #endif
 };
 
+// The memory of every Instruction is owned by the InstructionArena of its Module, so only the destructor is ran when the
+// Instruction is removed from the Module.
+struct InstructionDeleter {
+    void operator()(Instruction* inst) const { inst->~Instruction(); }
+};
+using InstructionPtr = std::unique_ptr<Instruction, InstructionDeleter>;
+
+// A Module can have hundreds of thousands of Instructions, instead of a heap allocation for each one they are placed in large
+// blocks which are all released together with the Module.
+class InstructionArena {
+  public:
+    InstructionArena() = default;
+    InstructionArena(const InstructionArena&) = delete;
+    InstructionArena& operator=(const InstructionArena&) = delete;
+
+    template <typename... Args>
+    InstructionPtr Make(Args&&... args) {
+        return InstructionPtr(new (Allocate()) Instruction(std::forward<Args>(args)...));
+    }
+
+  private:
+    void* Allocate();
+
+    struct alignas(Instruction) Slot {
+        unsigned char bytes[sizeof(Instruction)];
+    };
+    static constexpr uint32_t kSlotsPerBlock = 1024;
+
+    std::vector<std::unique_ptr<Slot[]>> blocks_;
+    uint32_t next_slot_ = kSlotsPerBlock;
+};
+
 }  // namespace spirv
 }  // namespace gpuav
\ No newline at end of file
@@ -14,6 +14,7 @@
  */
 
 #include "module.h"
+#include <algorithm>
 #include <spirv/unified1/spirv.hpp>
 #include "gpu_shaders/gpu_shaders_constants.h"
 
@@ -40,7 +41,7 @@ Module::Module(std::vector<uint32_t> words, uint32_t shader_id, uint32_t output_
         if (opcode == spv::OpFunction) {
             break;
         }
-        auto new_inst = std::make_unique<Instruction>(it, instruction_count++);
+        auto new_inst = instruction_arena_.Make(it, instruction_count++);
 
         switch (opcode) {
             case spv::OpCapability:
@@ -134,7 +135,7 @@ Module::Module(std::vector<uint32_t> words, uint32_t shader_id, uint32_t output_
     while (it != words.cend()) {
         const uint32_t opcode = *it & 0x0ffffu;
         const uint32_t length = *it >> 16;
-        auto new_inst = std::make_unique<Instruction>(it, instruction_count++);
+        auto new_inst = instruction_arena_.Make(it, instruction_count++);
 
         if (opcode == spv::OpFunction) {
             auto new_function = std::make_unique<Function>(*this, std::move(new_inst));
@@ -188,7 +189,7 @@ bool Module::HasCapability(spv::Capability capability) {
 // Will only add if not already added
 void Module::AddCapability(spv::Capability capability) {
     if (!HasCapability(capability)) {
-        auto new_inst = std::make_unique<Instruction>(2, spv::OpCapability);
+        auto new_inst = instruction_arena_.Make(2, spv::OpCapability);
         new_inst->Fill({(uint32_t)capability});
         capabilities_.emplace_back(std::move(new_inst));
     }
@@ -288,6 +289,11 @@ void Module::LinkFunction(const LinkInfo& info) {
     vvl::unordered_map<uint32_t, uint32_t> id_swap_map;
     const uint32_t function_type_id = TakeNextId();
 
+    if (linked_functions_start_ == 0) {
+        linked_types_values_constants_start_ = types_values_constants_.size();
+        linked_functions_start_ = functions_.size();
+    }
+
     // Track all decorations and add after when have full id_swap_map
     InstructionList decorations;
 
@@ -309,7 +315,7 @@ void Module::LinkFunction(const LinkInfo& info) {
             break;
         }
 
-        auto new_inst = std::make_unique<Instruction>(inst_word);
+        auto new_inst = instruction_arena_.Make(inst_word);
         uint32_t old_result_id = new_inst->ResultId();
 
         SpvType spv_type = GetSpvType(opcode);
@@ -482,7 +488,7 @@ void Module::LinkFunction(const LinkInfo& info) {
     {
         std::vector<uint32_t> words = {info.function_id};
         StringToSpirv(info.opname, words);
-        auto new_inst = std::make_unique<Instruction>((uint32_t)(words.size() + 1), spv::OpName);
+        auto new_inst = instruction_arena_.Make((uint32_t)(words.size() + 1), spv::OpName);
         new_inst->Fill(words);
         debug_name_.emplace_back(std::move(new_inst));
     }
@@ -491,7 +497,7 @@ void Module::LinkFunction(const LinkInfo& info) {
     auto& new_function = functions_.emplace_back(std::make_unique<Function>(*this));
     while (offset < info.word_count) {
         const uint32_t* inst_word = &info.words[offset];
-        auto new_inst = std::make_unique<Instruction>(inst_word);
+        auto new_inst = instruction_arena_.Make(inst_word);
         const uint32_t opcode = new_inst->Opcode();
         const uint32_t length = new_inst->Length();
 
@@ -570,11 +576,135 @@ void Module::LinkFunction(const LinkInfo& info) {
         // SPV_KHR_storage_buffer_storage_class is needed, but glslang removes it from linking functions
         std::vector<uint32_t> words;
         StringToSpirv("SPV_KHR_storage_buffer_storage_class", words);
-        auto new_inst = std::make_unique<Instruction>((uint32_t)(words.size() + 1), spv::OpExtension);
+        auto new_inst = instruction_arena_.Make((uint32_t)(words.size() + 1), spv::OpExtension);
         new_inst->Fill(words);
         extensions_.push_back(std::move(new_inst));
     }
 }
 
+template <typename Callback>
+static void ForEachInstruction(const Function& function, Callback&& callback) {
+    for (const auto& inst : function.pre_block_inst_) {
+        callback(*inst);
+    }
+    for (const auto& block : function.blocks_) {
+        for (const auto& inst : block->instructions_) {
+            callback(*inst);
+        }
+    }
+    for (const auto& inst : function.post_block_inst_) {
+        callback(*inst);
+    }
+}
+
+// Instead of running a full dead code elimination over the whole module, only what LinkFunction() added is looked at, as the
+// original shader (and what the passes injected into it) is assumed to already be used.
+void Module::RemoveDeadLinkedCode() {
+    if (linked_functions_start_ == 0) {
+        return;  // nothing was linked
+    }
+
+    vvl::unordered_set<uint32_t> dead_ids;
+
+    vvl::unordered_set<uint32_t> called_functions;
+    for (const auto& function : functions_) {
+        ForEachInstruction(*function, [&called_functions](const Instruction& inst) {
+            if (inst.Opcode() == spv::OpFunctionCall) {
+                called_functions.insert(inst.Word(3));
+            }
+        });
+    }
+    auto uncalled_function = [&called_functions, &dead_ids](const std::unique_ptr<Function>& function) {
+        const uint32_t function_id = function->GetDef().ResultId();
+        if (called_functions.find(function_id) != called_functions.end()) {
+            return false;
+        }
+        dead_ids.insert(function_id);
+        return true;
+    };
+    functions_.erase(std::remove_if(functions_.begin() + linked_functions_start_, functions_.end(), uncalled_function),
+                     functions_.end());
+
+    // Mark all the linked Types/Constants/Variables that can be reached from the functions or the original module.
+    // A OpTypeForwardPointer has no Result ID, it is kept if the OpTypePointer it declares is.
+    vvl::unordered_map<uint32_t, const Instruction*> linked_globals;
+    for (size_t i = linked_types_values_constants_start_; i < types_values_constants_.size(); i++) {
+        const Instruction& inst = *types_values_constants_[i];
+        if (inst.Opcode() != spv::OpTypeForwardPointer) {
+            linked_globals[inst.ResultId()] = &inst;
+        }
+    }
+
+    std::vector<uint32_t> used_ids;
+    for (size_t i = 0; i < linked_types_values_constants_start_; i++) {
+        types_values_constants_[i]->AppendUsedIds(used_ids);
+    }
+    for (const auto& inst : execution_modes_) {
+        inst->AppendUsedIds(used_ids);
+    }
+    for (const auto& function : functions_) {
+        ForEachInstruction(*function, [&used_ids](const Instruction& inst) { inst.AppendUsedIds(used_ids); });
+    }
+
+    vvl::unordered_set<uint32_t> live_ids;
+    while (!used_ids.empty()) {
+        const uint32_t id = used_ids.back();
+        used_ids.pop_back();
+        auto it = linked_globals.find(id);
+        if (it != linked_globals.end() && live_ids.insert(id).second) {
+            it->second->AppendUsedIds(used_ids);
+        }
+    }
+
+    for (const auto& [id, inst] : linked_globals) {
+        if (live_ids.find(id) == live_ids.end()) {
+            dead_ids.insert(id);
+        }
+    }
+    if (dead_ids.empty()) {
+        return;
+    }
+
+    auto is_dead = [&dead_ids](uint32_t id) { return dead_ids.find(id) != dead_ids.end(); };
+    auto dead_global = [&is_dead](const InstructionPtr& inst) {
+        return is_dead(inst->Opcode() == spv::OpTypeForwardPointer ? inst->Word(1) : inst->ResultId());
+    };
+    types_values_constants_.erase(
+        std::remove_if(types_values_constants_.begin() + linked_types_values_constants_start_, types_values_constants_.end(),
+                       dead_global),
+        types_values_constants_.end());
+
+    // OpName, OpMemberName, OpDecorate, OpMemberDecorate, etc all target the ID in the first word
+    auto targets_dead_id = [&is_dead](const InstructionPtr& inst) { return is_dead(inst->Word(1)); };
+    debug_name_.erase(std::remove_if(debug_name_.begin(), debug_name_.end(), targets_dead_id), debug_name_.end());
+    annotations_.erase(std::remove_if(annotations_.begin(), annotations_.end(), targets_dead_id), annotations_.end());
+
+    // For SPIR-V 1.4+ the linked variables were added to the interface of each entry point
+    for (auto& entry_point : entry_points_) {
+        // The interface comes after the name, the last word of a string has its highest byte as null
+        uint32_t interface_start = 3;
+        while ((entry_point->Word(interface_start) >> 24) != 0) {
+            interface_start++;
+        }
+        interface_start++;
+
+        std::vector<uint32_t> words;
+        bool removed_interface = false;
+        for (uint32_t i = 1; i < entry_point->Length(); i++) {
+            const uint32_t word = entry_point->Word(i);
+            if (i >= interface_start && is_dead(word)) {
+                removed_interface = true;
+            } else {
+                words.push_back(word);
+            }
+        }
+        if (removed_interface) {
+            auto new_inst = instruction_arena_.Make((uint32_t)(words.size() + 1), spv::OpEntryPoint);
+            new_inst->Fill(words);
+            entry_point = std::move(new_inst);
+        }
+    }
+}
+
 }  // namespace spirv
 }  // namespace gpuav
\ No newline at end of file
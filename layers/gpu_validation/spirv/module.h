@@ -39,6 +39,9 @@ class Module {
   public:
     Module(std::vector<uint32_t> words, uint32_t shader_id, uint32_t output_buffer_descriptor_set);
 
+    // Owns the memory of every Instruction in the lists below, so it is declared first to be destroyed last
+    InstructionArena instruction_arena_;
+
     // Memory that holds all the actual SPIR-V data, replicate the "Logical Layout of a Module" of SPIR-V.
     // Divided into sections to make easier to modify each part at different times, but still keeps it simple to write out all the
     // instructions to a binary format.
@@ -65,6 +68,10 @@ class Module {
     // Order of functions that will try to be linked in
     std::vector<LinkInfo> link_info_;
     void LinkFunction(const LinkInfo& info);
+    // Linked modules bring all of their Types/Constants/Variables, and the decorations of them, regardless if the linked function
+    // uses them. Removes what ended up unused, and any linked function that was never called. Must be called after all functions
+    // were linked, the TypeManager will not be valid afterwards.
+    void RemoveDeadLinkedCode();
 
     // The class is designed to be written out to a binary file.
     void ToBinary(std::vector<uint32_t>& out);
@@ -84,6 +91,11 @@ class Module {
     // Will replace the "OpDecorate DescriptorSet" for the output buffer in the incoming linked module
     // This allows anything to be set in the GLSL for the set value, as we change it at runtime
     const uint32_t output_buffer_descriptor_set_;
+
+    // Everything in types_values_constants_/functions_ from these indexes on was added by LinkFunction()
+    // (a valid module always has a function, so 0 means nothing was linked yet)
+    size_t linked_types_values_constants_start_ = 0;
+    size_t linked_functions_start_ = 0;
 };
 
 }  // namespace spirv
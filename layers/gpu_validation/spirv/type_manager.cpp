@@ -43,7 +43,7 @@ const Type* Variable::PointerType(TypeManager& type_manager_) const {
     return type_manager_.FindTypeById(type_id);
 }
 
-const Type& TypeManager::AddType(std::unique_ptr<Instruction> new_inst, SpvType spv_type) {
+const Type& TypeManager::AddType(InstructionPtr new_inst, SpvType spv_type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
     id_to_type_[inst->ResultId()] = std::make_unique<Type>(spv_type, *inst);
@@ -119,7 +119,7 @@ const Type& TypeManager::GetTypeVoid() {
     };
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(2, spv::OpTypeVoid);
+    auto new_inst = module_.instruction_arena_.Make(2, spv::OpTypeVoid);
     new_inst->Fill({type_id});
     return AddType(std::move(new_inst), SpvType::kVoid);
 }
@@ -130,7 +130,7 @@ const Type& TypeManager::GetTypeBool() {
     };
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(2, spv::OpTypeBool);
+    auto new_inst = module_.instruction_arena_.Make(2, spv::OpTypeBool);
     new_inst->Fill({type_id});
     return AddType(std::move(new_inst), SpvType::kBool);
 }
@@ -141,7 +141,7 @@ const Type& TypeManager::GetTypeSampler() {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(2, spv::OpTypeSampler);
+    auto new_inst = module_.instruction_arena_.Make(2, spv::OpTypeSampler);
     new_inst->Fill({type_id});
     return AddType(std::move(new_inst), SpvType::kSampler);
 }
@@ -152,7 +152,7 @@ const Type& TypeManager::GetTypeRayQuery() {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(2, spv::OpTypeRayQueryKHR);
+    auto new_inst = module_.instruction_arena_.Make(2, spv::OpTypeRayQueryKHR);
     new_inst->Fill({type_id});
     return AddType(std::move(new_inst), SpvType::kRayQueryKHR);
 }
@@ -163,7 +163,7 @@ const Type& TypeManager::GetTypeAccelerationStructure() {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(2, spv::OpTypeAccelerationStructureKHR);
+    auto new_inst = module_.instruction_arena_.Make(2, spv::OpTypeAccelerationStructureKHR);
     new_inst->Fill({type_id});
     return AddType(std::move(new_inst), SpvType::kAccelerationStructureKHR);
 }
@@ -179,7 +179,7 @@ const Type& TypeManager::GetTypeInt(uint32_t bit_width, bool is_signed) {
 
     const uint32_t type_id = module_.TakeNextId();
     const uint32_t signed_word = is_signed ? 1 : 0;
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpTypeInt);
+    auto new_inst = module_.instruction_arena_.Make(4, spv::OpTypeInt);
     new_inst->Fill({type_id, bit_width, signed_word});
     return AddType(std::move(new_inst), SpvType::kInt);
 }
@@ -193,7 +193,7 @@ const Type& TypeManager::GetTypeFloat(uint32_t bit_width) {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(3, spv::OpTypeFloat);
+    auto new_inst = module_.instruction_arena_.Make(3, spv::OpTypeFloat);
     new_inst->Fill({type_id, bit_width});
     return AddType(std::move(new_inst), SpvType::kFloat);
 }
@@ -209,7 +209,7 @@ const Type& TypeManager::GetTypeArray(const Type& element_type, const Constant&
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpTypeArray);
+    auto new_inst = module_.instruction_arena_.Make(4, spv::OpTypeArray);
     new_inst->Fill({type_id, element_type.Id(), length.Id()});
     return AddType(std::move(new_inst), SpvType::kArray);
 }
@@ -223,7 +223,7 @@ const Type& TypeManager::GetTypeRuntimeArray(const Type& element_type) {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(3, spv::OpTypeRuntimeArray);
+    auto new_inst = module_.instruction_arena_.Make(3, spv::OpTypeRuntimeArray);
     new_inst->Fill({type_id, element_type.Id()});
     return AddType(std::move(new_inst), SpvType::kRuntimeArray);
 }
@@ -242,7 +242,7 @@ const Type& TypeManager::GetTypeVector(const Type& component_type, uint32_t comp
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpTypeVector);
+    auto new_inst = module_.instruction_arena_.Make(4, spv::OpTypeVector);
     new_inst->Fill({type_id, component_type.Id(), component_count});
     return AddType(std::move(new_inst), SpvType::kVector);
 }
@@ -261,7 +261,7 @@ const Type& TypeManager::GetTypeMatrix(const Type& column_type, uint32_t column_
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpTypeMatrix);
+    auto new_inst = module_.instruction_arena_.Make(4, spv::OpTypeMatrix);
     new_inst->Fill({type_id, column_type.Id(), column_count});
     return AddType(std::move(new_inst), SpvType::kMatrix);
 }
@@ -276,7 +276,7 @@ const Type& TypeManager::GetTypeSampledImage(const Type& image_type) {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(3, spv::OpTypeSampledImage);
+    auto new_inst = module_.instruction_arena_.Make(3, spv::OpTypeSampledImage);
     new_inst->Fill({type_id, image_type.Id()});
     return AddType(std::move(new_inst), SpvType::kSampledImage);
 }
@@ -295,7 +295,7 @@ const Type& TypeManager::GetTypePointer(spv::StorageClass storage_class, const T
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpTypePointer);
+    auto new_inst = module_.instruction_arena_.Make(4, spv::OpTypePointer);
     new_inst->Fill({type_id, uint32_t(storage_class), pointer_type.Id()});
     return AddType(std::move(new_inst), SpvType::kPointer);
 }
@@ -368,7 +368,7 @@ uint32_t TypeManager::TypeLength(const Type& type) {
     return 0;
 }
 
-const Constant& TypeManager::AddConstant(std::unique_ptr<Instruction> new_inst, const Type& type) {
+const Constant& TypeManager::AddConstant(InstructionPtr new_inst, const Type& type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
     id_to_constant_[inst->ResultId()] = std::make_unique<Constant>(type, *inst);
@@ -413,7 +413,7 @@ const Constant* TypeManager::FindConstantById(uint32_t id) const {
 const Constant& TypeManager::CreateConstantUInt32(uint32_t value) {
     const Type& type = GetTypeInt(32, 0);
     const uint32_t constant_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpConstant);
+    auto new_inst = module_.instruction_arena_.Make(4, spv::OpConstant);
     new_inst->Fill({type.Id(), constant_id, value});
     return AddConstant(std::move(new_inst), type);
 }
@@ -450,7 +450,7 @@ const Constant& TypeManager::GetConstantZeroFloat32() {
         float_32bit_zero_constants_ = FindConstantFloat32(float_32_type.Id(), 0);
         if (!float_32bit_zero_constants_) {
             const uint32_t constant_id = module_.TakeNextId();
-            auto new_inst = std::make_unique<Instruction>(4, spv::OpConstant);
+            auto new_inst = module_.instruction_arena_.Make(4, spv::OpConstant);
             new_inst->Fill({float_32_type.Id(), constant_id, 0});
             float_32bit_zero_constants_ = &AddConstant(std::move(new_inst), float_32_type);
         }
@@ -464,7 +464,7 @@ const Constant& TypeManager::GetConstantZeroVec3() {
     const uint32_t float32_0_id = module_.type_manager_.GetConstantZeroFloat32().Id();
 
     const uint32_t constant_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(6, spv::OpConstantComposite);
+    auto new_inst = module_.instruction_arena_.Make(6, spv::OpConstantComposite);
     new_inst->Fill({vec3_type.Id(), constant_id, float32_0_id, float32_0_id, float32_0_id});
     return AddConstant(std::move(new_inst), vec3_type);
 }
@@ -477,12 +477,12 @@ const Constant& TypeManager::GetConstantNull(const Type& type) {
     }
 
     const uint32_t constant_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(3, spv::OpConstantNull);
+    auto new_inst = module_.instruction_arena_.Make(3, spv::OpConstantNull);
     new_inst->Fill({type.Id(), constant_id});
     return AddConstant(std::move(new_inst), type);
 }
 
-const Variable& TypeManager::AddVariable(std::unique_ptr<Instruction> new_inst, const Type& type) {
+const Variable& TypeManager::AddVariable(InstructionPtr new_inst, const Type& type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
     id_to_variable_[inst->ResultId()] = std::make_unique<Variable>(type, *inst);
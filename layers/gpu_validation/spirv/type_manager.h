@@ -93,7 +93,7 @@ class TypeManager {
   public:
     TypeManager(Module& module) : module_(module) {}
 
-    const Type& AddType(std::unique_ptr<Instruction> new_inst, SpvType spv_type);
+    const Type& AddType(InstructionPtr new_inst, SpvType spv_type);
     const Type* FindTypeById(uint32_t id) const;
     // There shouldn't be a case where we need to query for a specific type, but then not add it if not found.
     const Type& GetTypeVoid();
@@ -112,7 +112,7 @@ class TypeManager {
     const Type& GetTypePointerBuiltInInput(spv::BuiltIn built_in);
     uint32_t TypeLength(const Type& type);
 
-    const Constant& AddConstant(std::unique_ptr<Instruction> new_inst, const Type& type);
+    const Constant& AddConstant(InstructionPtr new_inst, const Type& type);
     const Constant* FindConstantById(uint32_t id) const;
     const Constant* FindConstantInt32(uint32_t type_id, uint32_t value) const;
     const Constant* FindConstantFloat32(uint32_t type_id, uint32_t value) const;
@@ -124,7 +124,7 @@ class TypeManager {
     const Constant& GetConstantZeroVec3();
     const Constant& GetConstantNull(const Type& type);
 
-    const Variable& AddVariable(std::unique_ptr<Instruction> new_inst, const Type& type);
+    const Variable& AddVariable(InstructionPtr new_inst, const Type& type);
     const Variable* FindVariableById(uint32_t id) const;
 
   private:
@@ -17,6 +17,7 @@
  */
 
 #include "layer_options.h"
+#include "error_message/logging.h"
 #include "utils/hash_util.h"
 #include <vulkan/layer/vk_layer_settings.hpp>
 
@@ -61,6 +62,7 @@ const char *SETTING_PRINTF_BUFFER_SIZE = "printf_buffer_size";
 
 const char *SETTING_GPUAV_VALIDATE_DESCRIPTORS = "gpuav_descriptor_checks";
 const char *SETTING_GPUAV_VALIDATE_INDIRECT_BUFFER = "gpuav_validate_indirect_buffer";
+const char *SETTING_GPUAV_BATCH_INDIRECT_DISPATCH_CHECKS = "gpuav_batch_indirect_dispatch_checks";
 const char *SETTING_GPUAV_VALIDATE_COPIES = "gpuav_validate_copies";
 const char *SETTING_GPUAV_VALIDATE_RAY_QUERY = "gpuav_validate_ray_query";
 const char *SETTING_GPUAV_VMA_LINEAR_OUTPUT = "vma_linear_output";
@@ -71,6 +73,8 @@ const char *SETTING_GPUAV_MAX_BUFFER_DEVICE_ADDRESS_BUFFERS = "gpuav_max_buffer_
 const char *SETTING_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS = "gpuav_debug_validate_instrumented_shaders";
 const char *SETTING_GPUAV_DEBUG_DUMP_INSTRUMENTED_SHADERS = "gpuav_debug_dump_instrumented_shaders";
 
+const char *SETTING_SYNCVAL_SUBMIT_VALIDATION_THREADS = "syncval_submit_validation_threads";
+
 // Set the local disable flag for the appropriate VALIDATION_CHECK_DISABLE enum
 void SetValidationDisable(CHECK_DISABLED &disable_data, const ValidationCheckDisables disable_id) {
     switch (disable_id) {
@@ -290,7 +294,7 @@ uint32_t TokenToUint(std::string &token) {
     return int_id;
 }
 
-void CreateFilterMessageIdList(std::string raw_id_list, const std::string &delimiter, vvl::unordered_set<uint32_t> &filter_list) {
+void CreateFilterMessageIdList(std::string raw_id_list, const std::string &delimiter, MessageIdSet &filter_list) {
     size_t pos = 0;
     std::string token;
     while (raw_id_list.length() != 0) {
@@ -302,7 +306,7 @@ void CreateFilterMessageIdList(std::string raw_id_list, const std::string &delim
                 int_id = id_hash;
             }
         }
-        if ((int_id != 0) && filter_list.find(int_id) == filter_list.end()) {
+        if ((int_id != 0) && !filter_list.contains(int_id)) {
             filter_list.insert(int_id);
         }
     }
@@ -423,6 +427,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, SETTING_GPUAV_VALIDATE_INDIRECT_BUFFER, gpuav_settings.validate_indirect_buffer);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_GPUAV_BATCH_INDIRECT_DISPATCH_CHECKS)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_GPUAV_BATCH_INDIRECT_DISPATCH_CHECKS,
+                                gpuav_settings.batch_indirect_dispatch_checks);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, SETTING_GPUAV_VALIDATE_COPIES)) {
         vkuGetLayerSettingValue(layer_setting_set, SETTING_GPUAV_VALIDATE_COPIES, gpuav_settings.validate_copies);
     }
@@ -469,6 +478,12 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         gpuav_settings.cache_instrumented_shaders = false;
     }
 
+    SyncValSettings &syncval_settings = *settings_data->syncval_settings;
+    if (vkuHasLayerSetting(layer_setting_set, SETTING_SYNCVAL_SUBMIT_VALIDATION_THREADS)) {
+        vkuGetLayerSettingValue(layer_setting_set, SETTING_SYNCVAL_SUBMIT_VALIDATION_THREADS,
+                                syncval_settings.submit_validation_threads);
+    }
+
     const auto *validation_features_ext = vku::FindStructInPNextChain<VkValidationFeaturesEXT>(settings_data->create_info);
     if (validation_features_ext) {
         SetValidationFeatures(settings_data->disables, settings_data->enables, validation_features_ext);
@@ -24,8 +24,11 @@
 #include <vulkan/vulkan.h>
 #include <vulkan/utility/vk_struct_helper.hpp>
 #include "gpu_validation/gpu_settings.h"
+#include "sync/sync_settings.h"
 #include "containers/custom_containers.h"
 
+class MessageIdSet;
+
 #define OBJECT_LAYER_NAME "VK_LAYER_KHRONOS_validation"
 
 extern std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info;
@@ -94,11 +97,12 @@ typedef struct {
     const VkInstanceCreateInfo *create_info;
     CHECK_ENABLED &enables;
     CHECK_DISABLED &disables;
-    vvl::unordered_set<uint32_t> &message_filter_list;
+    MessageIdSet &message_filter_list;
     uint32_t *duplicate_message_limit;
     bool *fine_grained_locking;
     GpuAVSettings *gpuav_settings;
     DebugPrintfSettings *printf_settings;
+    SyncValSettings *syncval_settings;
 } ConfigAndEnvSettings;
 
 static const vvl::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
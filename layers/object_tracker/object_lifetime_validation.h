@@ -39,6 +39,9 @@ typedef vvl::concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>,
 // Used for GPL and we know there are at most only 4 libraries that should be used
 typedef vvl::concurrent_unordered_map<uint64_t, small_vector<std::shared_ptr<ObjTrackState>, 4>, 6> object_list_map_type;
 
+// Wrapped handles tracked by any ObjectLifetimes, see ObjectLifetimes::IsIndexed()
+extern vvl::concurrent_wrapped_handle_map tracked_wrapped_objects;
+
 class ObjectLifetimes : public ValidationObject {
     using Func = vvl::Func;
     using Struct = vvl::Struct;
@@ -67,21 +70,40 @@ class ObjectLifetimes : public ValidationObject {
     bool null_descriptor_enabled;
 
     // Constructor for object lifetime tracking
-    ObjectLifetimes() : num_objects{}, num_total_objects(0), device_createinfo_pnext(nullptr), null_descriptor_enabled(false) {
+    ObjectLifetimes()
+        : num_objects{},
+          num_total_objects(0),
+          device_createinfo_pnext(nullptr),
+          null_descriptor_enabled(false),
+          tracker_id_(next_tracker_id_++) {
         container_type = LayerObjectTypeObjectTracker;
     }
-    ~ObjectLifetimes() {
-        if (device_createinfo_pnext) {
-            vku::FreePnextChain(device_createinfo_pnext);
+    ~ObjectLifetimes();
+
+    // Every object_map and swapchain_image_map entry with a wrapped handle is also indexed in tracked_wrapped_objects, unless
+    // its slot is still held by a handle which was destroyed but not yet removed. Looking up a tracked object then costs a
+    // direct index instead of a locked hash lookup, and the maps are only searched when the index has no answer.
+    bool IsIndexed(uint64_t object_handle, VulkanObjectType object_type) const {
+        const auto iter = tracked_wrapped_objects.find(object_handle);
+        return iter != tracked_wrapped_objects.end() && iter->second == IndexValue(object_type);
+    }
+    void IndexObject(uint64_t object_handle, VulkanObjectType object_type) {
+        if (unique_id_mapping.contains(object_handle)) {
+            tracked_wrapped_objects.insert(object_handle, IndexValue(object_type));
         }
     }
+    void UnindexObject(uint64_t object_handle, VulkanObjectType object_type) {
+        tracked_wrapped_objects.erase(object_handle, IndexValue(object_type));
+    }
 
     template <typename T1>
     void InsertObject(object_map_type &map, T1 object, VulkanObjectType object_type, const Location &loc,
                       std::shared_ptr<ObjTrackState> pNode) {
         uint64_t object_handle = HandleToUint64(object);
         const bool inserted = map.insert(object_handle, pNode);
-        if (!inserted) {
+        if (inserted) {
+            IndexObject(object_handle, object_type);
+        } else {
             // The object should not already exist. If we couldn't add it to the map, there was probably
             // a race condition in the app. Report an error and move on.
             // TODO should this be an error? https://gitlab.khronos.org/vulkan/vulkan/-/issues/3616
@@ -134,7 +156,34 @@ class ObjectLifetimes : public ValidationObject {
         if (null_allowed && (object == VK_NULL_HANDLE)) {
             return false;
         }
-        return CheckObjectValidity(HandleToUint64(object), object_type, invalid_handle_vuid, wrong_parent_vuid, loc, parent_type);
+        const uint64_t object_handle = HandleToUint64(object);
+        // Pipelines also need their linked libraries checked
+        if (object_type != kVulkanObjectTypePipeline && IsIndexed(object_handle, object_type)) {
+            return false;
+        }
+        return CheckObjectValidity(object_handle, object_type, invalid_handle_vuid, wrong_parent_vuid, loc, parent_type);
+    }
+
+    // Same as calling ValidateObject() on each element of an array parameter, but the location of an element is only built
+    // if it is not found in the index
+    template <typename T1>
+    bool ValidateObjectArray(const T1 *objects, uint32_t count, VulkanObjectType object_type, bool null_allowed,
+                             const char *invalid_handle_vuid, const char *wrong_parent_vuid, const Location &loc, Field field,
+                             VulkanObjectType parent_type = kVulkanObjectTypeDevice) const {
+        bool skip = false;
+        const bool use_index = object_type != kVulkanObjectTypePipeline;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (null_allowed && (objects[i] == VK_NULL_HANDLE)) {
+                continue;
+            }
+            const uint64_t object_handle = HandleToUint64(objects[i]);
+            if (use_index && IsIndexed(object_handle, object_type)) {
+                continue;
+            }
+            skip |= CheckObjectValidity(object_handle, object_type, invalid_handle_vuid, wrong_parent_vuid, loc.dot(field, i),
+                                        parent_type);
+        }
+        return skip;
     }
 
     template <typename T1>
@@ -202,4 +251,11 @@ class ObjectLifetimes : public ValidationObject {
     }
 
 #include "generated/object_tracker.h"
+
+  private:
+    uint64_t IndexValue(VulkanObjectType object_type) const { return (uint64_t(tracker_id_) << 32) | object_type; }
+
+    // Identifies the objects of this tracker in tracked_wrapped_objects
+    const uint32_t tracker_id_;
+    static std::atomic<uint32_t> next_tracker_id_;
 };
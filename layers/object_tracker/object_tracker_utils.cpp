@@ -22,6 +22,8 @@
 #include "generated/layer_chassis_dispatch.h"
 
 uint64_t object_track_index = 0;
+vvl::concurrent_wrapped_handle_map tracked_wrapped_objects;
+std::atomic<uint32_t> ObjectLifetimes::next_tracker_id_{0};
 
 VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
     // TODO: Unify Typed Handle representation (i.e. VulkanTypedHandle everywhere there are handle/type pairs)
@@ -31,7 +33,25 @@ VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
     return typed_handle;
 }
 
+ObjectLifetimes::~ObjectLifetimes() {
+    if (device_createinfo_pnext) {
+        vku::FreePnextChain(device_createinfo_pnext);
+    }
+    // Objects still tracked here would keep their index slots from ever being reused
+    for (uint32_t object_type = 0; object_type <= kVulkanObjectTypeMax; ++object_type) {
+        for (const auto &item : object_map[object_type].snapshot()) {
+            UnindexObject(item.first, static_cast<VulkanObjectType>(object_type));
+        }
+    }
+    for (const auto &item : swapchain_image_map.snapshot()) {
+        UnindexObject(item.first, kVulkanObjectTypeImage);
+    }
+}
+
 bool ObjectLifetimes::TracksObject(uint64_t object_handle, VulkanObjectType object_type) const {
+    if (IsIndexed(object_handle, object_type)) {
+        return true;
+    }
     // Look for object in object map
     if (object_map[object_type].contains(object_handle)) {
         return true;
@@ -152,6 +172,7 @@ void ObjectLifetimes::DestroyObjectSilently(uint64_t object, VulkanObjectType ob
 
         return;
     }
+    UnindexObject(object, object_type);
     assert(num_total_objects > 0);
 
     num_total_objects--;
@@ -824,6 +845,7 @@ void ObjectLifetimes::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapch
         [swapchain](const std::shared_ptr<ObjTrackState> &pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
     for (const auto &itr : snapshot) {
         swapchain_image_map.erase(itr.first);
+        UnindexObject(itr.first, kVulkanObjectTypeImage);
     }
 }
 
@@ -24,6 +24,8 @@
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/image_state.h"
 
+#include <algorithm>
+
 static ShaderObjectStage inline ConvertToShaderObjectStage(VkShaderStageFlagBits stage) {
     if (stage == VK_SHADER_STAGE_VERTEX_BIT) return ShaderObjectStage::VERTEX;
     if (stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT) return ShaderObjectStage::TESSELLATION_CONTROL;
@@ -116,26 +118,126 @@ const vvl::ImageView *CommandBuffer::GetActiveAttachmentImageViewState(uint32_t
 
 void CommandBuffer::AddChild(std::shared_ptr<StateObject> &child_node) {
     assert(child_node);
-    if (child_node->AddParent(this)) {
-        object_bindings.insert(child_node);
+    // The same object is often bound by consecutive commands
+    if (!object_bindings.empty() && object_bindings.back().object == child_node) {
+        return;
+    }
+    // Registered before the generation is read, so a change in between is not missed. Only the first bind of an object
+    // takes its lock, the following ones find it in watched_objects_.
+    if (watched_objects_.insert(child_node).second) {
+        child_node->AddGenerationWatcher(*this);
+    }
+    object_bindings.emplace_back(ObjectBinding{child_node, child_node->GetGeneration()});
+    // Keep the duplicates from growing the bindings by more than 2x
+    constexpr size_t kMinCompactCount = 64;
+    if (object_bindings.size() >= std::max(kMinCompactCount, 2 * compacted_binding_count_)) {
+        CompactObjectBindings();
     }
 }
 
 void CommandBuffer::RemoveChild(std::shared_ptr<StateObject> &child_node) {
     assert(child_node);
-    child_node->RemoveParent(this);
-    object_bindings.erase(child_node);
+    // The removed objects were usually bound recently
+    auto it = std::find_if(object_bindings.rbegin(), object_bindings.rend(),
+                           [&child_node](const ObjectBinding &binding) { return binding.object == child_node; });
+    if (it != object_bindings.rend()) {
+        object_bindings.erase(std::next(it).base());
+        compacted_binding_count_ = std::min(compacted_binding_count_, object_bindings.size());
+    }
+    const bool still_bound = std::any_of(object_bindings.begin(), object_bindings.end(),
+                                         [&child_node](const ObjectBinding &binding) { return binding.object == child_node; });
+    if (!still_bound && watched_objects_.erase(child_node) != 0) {
+        child_node->RemoveGenerationWatcher(*this);
+    }
+}
+
+void CommandBuffer::CompactObjectBindings() {
+    // Keep the oldest generation of each object, as the binding is broken if any of its binds is
+    std::sort(object_bindings.begin(), object_bindings.end(), [](const ObjectBinding &a, const ObjectBinding &b) {
+        return a.object != b.object ? a.object < b.object : a.generation < b.generation;
+    });
+    auto last = std::unique(object_bindings.begin(), object_bindings.end(),
+                            [](const ObjectBinding &a, const ObjectBinding &b) { return a.object == b.object; });
+    object_bindings.erase(last, object_bindings.end());
+    compacted_binding_count_ = object_bindings.size();
+}
+
+void CommandBuffer::NotifyGenerationChanged() {
+    bindings_changed_.store(true, std::memory_order_release);
+    // Primary command buffers watch the secondaries they execute, which are broken by the bindings of the secondary
+    NotifyGenerationWatchers();
+}
+
+void CommandBuffer::UpdateBrokenBindings() const {
+    if (!bindings_changed_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(broken_bindings_lock_);
+    // Cleared before the generations are read, a change notified during the scan is picked up by the next check
+    if (!bindings_changed_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    for (const auto &binding : object_bindings) {
+        if (binding.object->GetGeneration() == binding.generation) {
+            if (binding.object->Type() == kVulkanObjectTypeCommandBuffer) {
+                const auto &sub_cb = static_cast<const CommandBuffer &>(*binding.object);
+                for (const auto &[handle, sub_log_list] : sub_cb.GetBrokenBindings()) {
+                    LogObjectList log_list = sub_log_list;
+                    log_list.add(sub_cb.Handle());
+                    broken_bindings_.emplace(handle, log_list);
+                }
+            }
+            continue;
+        }
+        // Save all of the vulkan handles between the command buffer and the invalid object
+        LogObjectList log_list;
+        const auto chain = binding.object->GetInvalidationChain();
+        for (const auto &handle : chain) {
+            log_list.add(handle);
+        }
+        broken_bindings_.emplace(chain.empty() ? binding.object->Handle() : chain.front(), log_list);
+    }
+    has_broken_bindings_.store(!broken_bindings_.empty(), std::memory_order_relaxed);
+}
+
+CbState CommandBuffer::GetState() const {
+    if (state == CbState::Recording || state == CbState::Recorded) {
+        UpdateBrokenBindings();
+        if (has_broken_bindings_.load(std::memory_order_relaxed)) {
+            return state == CbState::Recording ? CbState::InvalidIncomplete : CbState::InvalidComplete;
+        }
+    }
+    return state;
+}
+
+vvl::unordered_map<VulkanTypedHandle, LogObjectList> CommandBuffer::GetBrokenBindings() const {
+    UpdateBrokenBindings();
+    std::lock_guard<std::mutex> guard(broken_bindings_lock_);
+    return broken_bindings_;
 }
 
 // Reset the command buffer state
 // Maintain the createInfo and set state to CB_NEW, but clear all other state
 void CommandBuffer::ResetCBState() {
-    // Remove object bindings
-    for (const auto &obj : object_bindings) {
-        obj->RemoveParent(this);
+    // Release the uses of submissions that were not retired, which is only possible after an error
+    for (; bindings_use_count_ > 0; --bindings_use_count_) {
+        for (const auto &binding : object_bindings) {
+            binding.object->EndCommandBufferUse();
+        }
     }
     object_bindings.clear();
-    broken_bindings.clear();
+    compacted_binding_count_ = 0;
+    // So that updating or destroying the objects of the previous recording doesn't notify this command buffer anymore
+    for (const auto &object : watched_objects_) {
+        object->RemoveGenerationWatcher(*this);
+    }
+    watched_objects_.clear();
+    {
+        std::lock_guard<std::mutex> guard(broken_bindings_lock_);
+        broken_bindings_.clear();
+        has_broken_bindings_.store(false, std::memory_order_relaxed);
+        bindings_changed_.store(false, std::memory_order_relaxed);
+    }
 
     // Reset CB state (note that createInfo is not cleared)
     memset(&beginInfo, 0, sizeof(VkCommandBufferBeginInfo));
@@ -238,6 +340,10 @@ void CommandBuffer::Reset() {
 // Track which resources are in-flight by atomically incrementing their "in_use" count
 void CommandBuffer::IncrementResources() {
     submitCount++;
+    for (const auto &binding : object_bindings) {
+        binding.object->BeginCommandBufferUse(VkHandle());
+    }
+    bindings_use_count_++;
 
     // TODO : We should be able to remove the NULL look-up checks from the code below as long as
     //  all the corresponding cases are verified to cause CB_INVALID state and the CB_INVALID state
@@ -283,52 +389,6 @@ void CommandBuffer::Destroy() {
     StateObject::Destroy();
 }
 
-void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes, bool unlink) {
-    {
-        auto guard = WriteLock();
-        assert(!invalid_nodes.empty());
-        // Save all of the vulkan handles between the command buffer and the now invalid node
-        LogObjectList log_list;
-        for (auto &obj : invalid_nodes) {
-            log_list.add(obj->Handle());
-        }
-
-        bool found_invalid = false;
-        for (auto &obj : invalid_nodes) {
-            // Only record a broken binding if one of the nodes in the invalid chain is still
-            // being tracked by the command buffer. This is to try to avoid race conditions
-            // caused by separate CommandBuffer and StateObject::parent_nodes locking.
-            if (object_bindings.erase(obj)) {
-                obj->RemoveParent(this);
-                found_invalid = true;
-            }
-            switch (obj->Type()) {
-                case kVulkanObjectTypeCommandBuffer:
-                    if (unlink) {
-                        linkedCommandBuffers.erase(static_cast<CommandBuffer *>(obj.get()));
-                    }
-                    break;
-                case kVulkanObjectTypeImage:
-                    if (unlink) {
-                        image_layout_map.erase(obj->Handle().Cast<VkImage>());
-                    }
-                    break;
-                default:
-                    break;
-            }
-        }
-        if (found_invalid) {
-            if (state == CbState::Recording) {
-                state = CbState::InvalidIncomplete;
-            } else if (state == CbState::Recorded) {
-                state = CbState::InvalidComplete;
-            }
-            broken_bindings.emplace(invalid_nodes[0]->Handle(), log_list);
-        }
-    }
-    StateObject::NotifyInvalidate(invalid_nodes, unlink);
-}
-
 const CommandBuffer::ImageLayoutMap &CommandBuffer::GetImageSubresourceLayoutMap() const { return image_layout_map; }
 
 // The const variant only need the image as it is the key for the map
@@ -988,6 +1048,7 @@ void CommandBuffer::Begin(const VkCommandBufferBeginInfo *pBeginInfo) {
 }
 
 void CommandBuffer::End(VkResult result) {
+    CompactObjectBindings();
     if (VK_SUCCESS == result) {
         state = CbState::Recorded;
     }
@@ -1156,23 +1217,30 @@ void CommandBuffer::UpdatePipelineState(Func command, const VkPipelineBindPoint
 
             // For the "bindless" style resource usage with many descriptors, need to optimize command <-> descriptor binding
 
-            // We can skip updating the state if "nothing" has changed since the last validation.
+            // We can skip updating the state if "nothing" has changed since the last validation, and only need to update the
+            // bindings written since then if only the contents of the set changed.
             // See CoreChecks::ValidateActionState for more details.
-            const bool need_update =  // Update if descriptor set (or contents) has changed
-                set_info.validated_set != descriptor_set.get() ||
-                set_info.validated_set_change_count != descriptor_set->GetChangeCount() ||
+            const bool need_full_update =  // Update everything if descriptor set or the pipeline using it have changed
+                set_info.validated_set != descriptor_set.get() || set_info.validated_pipeline != pipe ||
                 (!dev_data.disabled[image_layout_validation] &&
                  set_info.validated_set_image_layout_change_count != image_layout_change_count);
+            const uint64_t change_count = descriptor_set->GetChangeCount();
+            const bool need_update = need_full_update || set_info.validated_set_change_count != change_count;
             if (need_update) {
                 if (!dev_data.disabled[command_buffer_state] && !descriptor_set->IsPushDescriptor()) {
                     AddChild(descriptor_set);
                 }
 
                 // Bind this set and its active descriptor resources to the command buffer
-                descriptor_set->UpdateDrawState(&dev_data, this, command, pipe, set_binding_pair.second);
+                std::optional<uint64_t> changed_since;
+                if (!need_full_update) {
+                    changed_since = set_info.validated_set_change_count;
+                }
+                descriptor_set->UpdateDrawState(&dev_data, this, command, pipe, set_binding_pair.second, changed_since);
 
                 set_info.validated_set = descriptor_set.get();
-                set_info.validated_set_change_count = descriptor_set->GetChangeCount();
+                set_info.validated_pipeline = pipe;
+                set_info.validated_set_change_count = change_count;
                 set_info.validated_set_image_layout_change_count = image_layout_change_count;
                 set_info.validated_set_binding_req_map = BindingVariableMap();
             }
@@ -1583,6 +1651,12 @@ void CommandBuffer::Submit(VkQueue queue, uint32_t perf_submit_pass, const Locat
 
 void CommandBuffer::Retire(uint32_t perf_submit_pass, const std::function<bool(const QueryObject &)> &is_query_updated_after) {
     // First perform decrement on general case bound objects
+    if (bindings_use_count_ > 0) {
+        bindings_use_count_--;
+        for (const auto &binding : object_bindings) {
+            binding.object->EndCommandBufferUse();
+        }
+    }
     for (auto event : writeEventsBeforeWait) {
         auto event_state = dev_data.Get<vvl::Event>(event);
         if (event_state) {
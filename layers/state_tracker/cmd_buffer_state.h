@@ -28,6 +28,8 @@
 #include "containers/custom_containers.h"
 #include "generated/dynamic_state_helper.h"
 
+#include <mutex>
+
 struct SubpassInfo;
 class CoreChecks;
 class ValidationStateTracker;
@@ -148,7 +150,7 @@ class CommandBuffer : public RefcountedStateObject {
     bool has_trace_rays_cmd;
     bool has_build_as_cmd;
 
-    CbState state;           // Track cmd buffer update state
+    CbState state;           // Track cmd buffer update state, see GetState() for the invalid states
     uint64_t command_count;  // Number of commands recorded. Currently only used with VK_KHR_performance_query
     uint64_t submitCount;    // Number of times CB has been submitted
     typedef uint64_t ImageLayoutUpdateCount;
@@ -367,10 +369,14 @@ class CommandBuffer : public RefcountedStateObject {
         active_subpass_sample_count_ = rasterization_sample_count;
     }
     std::shared_ptr<vvl::Framebuffer> activeFramebuffer;
-    // Unified data structs to track objects bound to this command buffer as well as object
-    //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
-    vvl::unordered_set<std::shared_ptr<StateObject>> object_bindings;
-    vvl::unordered_map<VulkanTypedHandle, LogObjectList> broken_bindings;
+    // Objects bound to this command buffer, along with the generation they had when they were bound. An object whose
+    // generation changed since then was destroyed or invalidated (e.g. an updated descriptor set), which breaks the binding.
+    struct ObjectBinding {
+        std::shared_ptr<StateObject> object;
+        uint32_t generation;
+    };
+    // May hold an object more than once while recording, End() removes the duplicates
+    std::vector<ObjectBinding> object_bindings;
 
     QFOTransferBarrierSets<QFOBufferTransferBarrier> qfo_transfer_buffer_barriers;
     QFOTransferBarrierSets<QFOImageTransferBarrier> qfo_transfer_image_barriers;
@@ -487,6 +493,11 @@ class CommandBuffer : public RefcountedStateObject {
 
     virtual void Reset();
 
+    // Returns state, or one of the invalid states if a bound object was destroyed or invalidated since it was bound
+    CbState GetState() const;
+    // The broken bindings, keyed by the object which caused the invalidation
+    vvl::unordered_map<VulkanTypedHandle, LogObjectList> GetBrokenBindings() const;
+
     void IncrementResources();
 
     void ResetPushConstantDataIfIncompatible(const vvl::PipelineLayout *pipeline_layout_state);
@@ -645,10 +656,28 @@ class CommandBuffer : public RefcountedStateObject {
     std::optional<VkSampleCountFlagBits> active_subpass_sample_count_;
 
   protected:
-    void NotifyInvalidate(const StateObject::NodeList &invalid_nodes, bool unlink) override;
     void UpdateAttachmentsView(const VkRenderPassBeginInfo *pRenderPassBegin);
     void EnqueueUpdateVideoInlineQueries(const VkVideoInlineQueryInfoKHR &query_info);
     void UnbindResources();
+    void NotifyGenerationChanged() override;
+
+  private:
+    void CompactObjectBindings();
+    void UpdateBrokenBindings() const;
+
+    // object_bindings.size() after the last CompactObjectBindings()
+    size_t compacted_binding_count_ = 0;
+    // Objects this command buffer is registered as a generation watcher of, see AddChild()
+    vvl::unordered_set<std::shared_ptr<StateObject>> watched_objects_;
+    // IncrementResources() calls not yet matched by Retire(), each one counts this command buffer as a user of the bindings
+    uint32_t bindings_use_count_ = 0;
+
+    // Lazily updated from the generations of object_bindings, see GetState()
+    mutable std::mutex broken_bindings_lock_;
+    // Set when the generation of a bound object changed since the generations were last compared
+    mutable std::atomic<bool> bindings_changed_{false};
+    mutable std::atomic<bool> has_broken_bindings_{false};
+    mutable vvl::unordered_map<VulkanTypedHandle, LogObjectList> broken_bindings_;
 };
 
 // specializations for barriers that cannot do queue family ownership transfers
@@ -107,7 +107,7 @@ void vvl::DescriptorPool::Reset() {
     available_sets_ = maxSets;
 }
 
-const VulkanTypedHandle *vvl::DescriptorPool::InUse() const {
+VulkanTypedHandle vvl::DescriptorPool::InUse() const {
     auto guard = ReadLock();
     for (const auto &entry : sets_) {
         const auto *ds = entry.second;
@@ -115,7 +115,7 @@ const VulkanTypedHandle *vvl::DescriptorPool::InUse() const {
             return ds->InUse();
         }
     }
-    return nullptr;
+    return VulkanTypedHandle();
 }
 
 void vvl::DescriptorPool::Destroy() {
@@ -547,6 +547,9 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
     assert(!iter.AtEnd());
     auto &orig_binding = iter.CurrentBinding();
 
+    // The bindings are marked before the set's count is published with release ordering, so a reader which acquires the new set
+    // count never sees a stale binding. Updates of a set are externally synchronized, only the readers are concurrent.
+    const uint64_t change_count = change_count_.load(std::memory_order_relaxed) + 1;
     // Verify next consecutive binding matches type, stage flags & immutable sampler use and if AtEnd
     for (uint32_t i = 0; i < descriptors_remaining; ++i, ++iter) {
         if (iter.AtEnd() || !orig_binding.IsConsistent(iter.CurrentBinding())) {
@@ -554,10 +557,11 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
         }
         iter->WriteUpdate(*this, *state_data_, update, i, iter.CurrentBinding().IsBindless());
         iter.updated(true);
+        iter.CurrentBinding().change_count.store(change_count, std::memory_order_relaxed);
     }
     if (update.descriptorCount) {
         some_update_ = true;
-        ++change_count_;
+        change_count_.store(change_count, std::memory_order_release);
     }
 
     if (!IsPushDescriptor() && !(orig_binding.binding_flags & (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
@@ -569,6 +573,7 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
 void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, const DescriptorSet &src_set) {
     auto src_iter = src_set.FindDescriptor(update.srcBinding, update.srcArrayElement);
     auto dst_iter = FindDescriptor(update.dstBinding, update.dstArrayElement);
+    const uint64_t change_count = change_count_.load(std::memory_order_relaxed) + 1;
     // Update parameters all look good so perform update
     for (uint32_t i = 0; i < update.descriptorCount; ++i, ++src_iter, ++dst_iter) {
         auto &src = *src_iter;
@@ -581,11 +586,14 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
             }
             dst.CopyUpdate(*this, *state_data_, src, src_iter.CurrentBinding().IsBindless(), type);
             some_update_ = true;
-            ++change_count_;
             dst_iter.updated(true);
         } else {
             dst_iter.updated(false);
         }
+        dst_iter.CurrentBinding().change_count.store(change_count, std::memory_order_relaxed);
+    }
+    if (update.descriptorCount) {
+        change_count_.store(change_count, std::memory_order_release);
     }
 
     if (!(layout_->GetDescriptorBindingFlagsFromBinding(update.dstBinding) &
@@ -602,7 +610,8 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
 // Prereq: This should be called for a set that has been confirmed to be active for the given cb_state, meaning it's going
 //   to be used in a draw by the given cb_state
 void vvl::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, vvl::CommandBuffer *cb_state, vvl::Func command,
-                                         const vvl::Pipeline *pipe, const BindingVariableMap &binding_req_map) {
+                                         const vvl::Pipeline *pipe, const BindingVariableMap &binding_req_map,
+                                         std::optional<uint64_t> changed_since) {
     // Descriptor UpdateDrawState only call image layout validation callbacks. If it is disabled, skip the entire loop.
     if (device_data->disabled[image_layout_validation]) {
         return;
@@ -614,29 +623,27 @@ void vvl::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, vv
         auto *binding = GetBinding(binding_req_pair.first);
         assert(binding);
         // core validation doesn't handle descriptor indexing, that is only done by GPU-AV
-        if (SkipBinding(*binding, binding_req_pair.second.variable->is_dynamic_accessed)) {
+        if (SkipBinding(*binding, binding_req_pair.second.variable->is_dynamic_accessed) ||
+            !IsBindingChangedSince(*binding, changed_since)) {
             continue;
         }
         switch (binding->descriptor_class) {
             case DescriptorClass::Image: {
                 auto *image_binding = static_cast<ImageBinding *>(binding);
-                for (uint32_t i = 0; i < image_binding->count; ++i) {
-                    image_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
-                }
+                image_binding->descriptors.ForEachConstructed(
+                    [&](uint32_t, ImageDescriptor &descriptor) { descriptor.UpdateDrawState(device_data, cb_state); });
                 break;
             }
             case DescriptorClass::ImageSampler: {
                 auto *image_binding = static_cast<ImageSamplerBinding *>(binding);
-                for (uint32_t i = 0; i < image_binding->count; ++i) {
-                    image_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
-                }
+                image_binding->descriptors.ForEachConstructed(
+                    [&](uint32_t, ImageSamplerDescriptor &descriptor) { descriptor.UpdateDrawState(device_data, cb_state); });
                 break;
             }
             case DescriptorClass::Mutable: {
                 auto *mutable_binding = static_cast<MutableBinding *>(binding);
-                for (uint32_t i = 0; i < mutable_binding->count; ++i) {
-                    mutable_binding->descriptors[i].UpdateDrawState(device_data, cb_state);
-                }
+                mutable_binding->descriptors.ForEachConstructed(
+                    [&](uint32_t, MutableDescriptor &descriptor) { descriptor.UpdateDrawState(device_data, cb_state); });
                 break;
             }
             default:
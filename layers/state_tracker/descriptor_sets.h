@@ -24,7 +24,11 @@
 #include "utils/shader_utils.h"
 #include "generated/vk_object_types.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <algorithm>
+#include <atomic>
 #include <map>
+#include <memory>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -58,7 +62,7 @@ class DescriptorPool : public StateObject {
     void Reset();
     void Destroy() override;
 
-    const VulkanTypedHandle *InUse() const override;
+    VulkanTypedHandle InUse() const override;
     uint32_t GetAvailableCount(uint32_t type) const {
         auto guard = ReadLock();
         auto iter = available_counts_.find(type);
@@ -647,6 +651,95 @@ struct AllocateDescriptorSetsData {
 void PerformUpdateDescriptorSets(ValidationStateTracker &, uint32_t, const VkWriteDescriptorSet *, uint32_t,
                                  const VkCopyDescriptorSet *);
 
+// Storage for the descriptors of a binding.
+// Bindless bindings can hold hundreds of thousands of descriptors of which only a part is ever written, so their descriptors are
+// constructed a page at a time, when a descriptor of the page is first accessed through the non-const operator[]. Until then
+// the const operator[] returns a default constructed descriptor.
+template <typename T>
+class DescriptorArray {
+  public:
+    static constexpr uint32_t kPageSize = 64;
+
+    DescriptorArray(uint32_t count, bool paged)
+        : count_(count),
+          dense_(paged && count > kPageSize ? 0 : count),
+          page_count_(paged && count > kPageSize ? (count + kPageSize - 1) / kPageSize : 0),
+          pages_(page_count_ ? new std::atomic<T *>[page_count_]() : nullptr) {}
+    DescriptorArray(const DescriptorArray &) = delete;
+    DescriptorArray &operator=(const DescriptorArray &) = delete;
+    ~DescriptorArray() {
+        for (uint32_t i = 0; i < page_count_; ++i) {
+            delete[] pages_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t size() const { return count_; }
+
+    const T &operator[](uint32_t index) const {
+        assert(index < count_);
+        if (!pages_) {
+            return dense_[index];
+        }
+        const T *page = pages_[index / kPageSize].load(std::memory_order_acquire);
+        return page ? page[index % kPageSize] : DefaultDescriptor();
+    }
+
+    T &operator[](uint32_t index) {
+        assert(index < count_);
+        if (!pages_) {
+            return dense_[index];
+        }
+        return GetOrCreatePage(index / kPageSize)[index % kPageSize];
+    }
+
+    // Calls func(index, descriptor) for every descriptor which may not be default constructed
+    template <typename Fn>
+    void ForEachConstructed(Fn &&func) {
+        if (!pages_) {
+            for (uint32_t i = 0; i < count_; ++i) {
+                func(i, dense_[i]);
+            }
+            return;
+        }
+        for (uint32_t p = 0; p < page_count_; ++p) {
+            T *page = pages_[p].load(std::memory_order_acquire);
+            if (!page) {
+                continue;
+            }
+            const uint32_t first = p * kPageSize;
+            const uint32_t last = std::min(first + kPageSize, count_);
+            for (uint32_t i = first; i < last; ++i) {
+                func(i, page[i - first]);
+            }
+        }
+    }
+
+  private:
+    static const T &DefaultDescriptor() {
+        static const T default_descriptor;
+        return default_descriptor;
+    }
+
+    T *GetOrCreatePage(uint32_t page_index) {
+        T *page = pages_[page_index].load(std::memory_order_acquire);
+        if (!page) {
+            // Accesses can race when a set with update after bind bindings is used while being updated
+            T *new_page = new T[kPageSize];
+            if (pages_[page_index].compare_exchange_strong(page, new_page, std::memory_order_acq_rel)) {
+                page = new_page;
+            } else {
+                delete[] new_page;
+            }
+        }
+        return page;
+    }
+
+    const uint32_t count_;
+    small_vector<T, 1, uint32_t> dense_;
+    uint32_t page_count_ = 0;
+    std::unique_ptr<std::atomic<T *>[]> pages_;
+};
+
 class DescriptorBinding {
   public:
     using NodeList = StateObject::NodeList;
@@ -674,6 +767,12 @@ class DescriptorBinding {
 
     bool IsVariableCount() const { return (binding_flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT) != 0; }
 
+    // Only the written parts of these bindings are expected to be used, see DescriptorArray
+    static bool IsPaged(VkDescriptorBindingFlags flags) {
+        return (flags & (VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+                         VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT)) != 0;
+    }
+
     bool IsConsistent(const DescriptorBinding &other) const {
         // A write update can overlap over following binding but bindings with descriptorCount == 0 must be skipped.
         // Therefore we consider "consistent" a binding that should be skipped
@@ -692,13 +791,15 @@ class DescriptorBinding {
     const uint32_t count;
     const bool has_immutable_samplers;
     small_vector<bool, 1, uint32_t> updated;
+    // Change count of the set after the last update to this binding, see DescriptorSet::GetChangeCount()
+    std::atomic<uint64_t> change_count{0};
 };
 
 template <typename T>
 class DescriptorBindingImpl : public DescriptorBinding {
   public:
     DescriptorBindingImpl(const VkDescriptorSetLayoutBinding &create_info, uint32_t count_, VkDescriptorBindingFlags binding_flags_)
-        : DescriptorBinding(create_info, count_, binding_flags_), descriptors(count_) {}
+        : DescriptorBinding(create_info, count_, binding_flags_), descriptors(count_, IsPaged(binding_flags_)) {}
 
     const Descriptor *GetDescriptor(const uint32_t index) const override { return index < count ? &descriptors[index] : nullptr; }
 
@@ -706,12 +807,11 @@ class DescriptorBindingImpl : public DescriptorBinding {
 
     template <typename Fn>
     void ForAllUpdated(Fn &&op) {
-        auto size = updated.size();
-        for (uint32_t i = 0; i < size; i++) {
+        descriptors.ForEachConstructed([this, &op](uint32_t i, T &descriptor) {
             if (updated[i] != 0) {
-                op(descriptors[i]);
+                op(descriptor);
             }
-        }
+        });
     }
 
     void AddParent(DescriptorSet *ds) override {
@@ -735,7 +835,7 @@ class DescriptorBindingImpl : public DescriptorBinding {
         }
     }
 
-    small_vector<T, 1, uint32_t> descriptors;
+    DescriptorArray<T> descriptors;
 };
 
 using SamplerBinding = DescriptorBindingImpl<SamplerDescriptor>;
@@ -819,8 +919,9 @@ class DescriptorSet : public StateObject {
     VkDescriptorSet VkHandle() const { return handle_.Cast<VkDescriptorSet>(); };
     // Bind given cmd_buffer to this descriptor set and
     // update CB image layout map with image/imagesampler descriptor image layouts
+    // If changed_since is set, only the bindings updated after the set's change count was changed_since are visited
     void UpdateDrawState(ValidationStateTracker *, vvl::CommandBuffer *cb_state, vvl::Func command, const vvl::Pipeline *,
-                         const BindingVariableMap &);
+                         const BindingVariableMap &, std::optional<uint64_t> changed_since);
 
     // For a particular binding, get the global index
     const IndexRange GetGlobalIndexRangeFromBinding(const uint32_t binding, bool actual_length = false) const {
@@ -878,7 +979,11 @@ class DescriptorSet : public StateObject {
         auto pos = dynamic_offset_idx_to_descriptor_list_.at(index);
         return bindings_[pos.first]->GetDescriptor(pos.second);
     }
-    uint64_t GetChangeCount() const { return change_count_; }
+    // Bumped by every update, each binding also records the change count of its last update
+    uint64_t GetChangeCount() const { return change_count_.load(std::memory_order_acquire); }
+    static bool IsBindingChangedSince(const DescriptorBinding &binding, std::optional<uint64_t> changed_since) {
+        return !changed_since || binding.change_count.load(std::memory_order_relaxed) > *changed_since;
+    }
 
     const std::vector<vku::safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
 
@@ -94,6 +94,31 @@ ImageSubresourceLayoutMap::ImageSubresourceLayoutMap(const vvl::Image& image_sta
       layouts_(encoder_.SubresourceCount()),
       initial_layout_states_() {}
 
+const LayoutEntry* ImageSubresourceLayoutMap::GetUniformEntry() const {
+    if (layouts_.size() != 1) return nullptr;
+    const auto it = layouts_.begin();
+    return (it->first == RangeType(0, encoder_.SubresourceCount())) ? &it->second : nullptr;
+}
+
+// Most barriers, render passes and initial layout updates cover the whole image, and as long as every update of an image
+// did, its map holds a single entry spanning all subresources. Such updates don't need the range generator or the lower
+// bound walk of UpdateLayoutStateImpl. Returns false if the map is split and the caller has to update range by range.
+bool ImageSubresourceLayoutMap::SetWholeImageLayout(const vvl::CommandBuffer& cb_state, LayoutEntry& new_entry,
+                                                    const vvl::ImageView* view_state, bool& updated_current) {
+    if (layouts_.empty()) {
+        initial_layout_states_.emplace_back(cb_state, view_state);
+        new_entry.state = &initial_layout_states_.back();
+        layouts_.insert(layouts_.end(), std::make_pair(RangeType(0, encoder_.SubresourceCount()), new_entry));
+        updated_current = true;
+        return true;
+    }
+    if (!GetUniformEntry()) return false;
+    // Same rule as UpdateLayoutStateImpl, an existing entry only changes along with its current layout
+    LayoutEntry& uniform_entry = layouts_.begin()->second;
+    updated_current = uniform_entry.CurrentWillChange(new_entry.current_layout) && uniform_entry.Update(new_entry);
+    return true;
+}
+
 // Use the unwrapped maps from the BothMap in the actual implementation
 template <typename LayoutMap>
 static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states, RangeGenerator& range_gen,
@@ -114,6 +139,11 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const vvl::CommandBuff
     }
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
 
+    if (encoder_.CoversAll(range)) {
+        LayoutEntry entry(expected_layout, layout);
+        bool updated = false;
+        if (SetWholeImageLayout(cb_state, entry, nullptr, updated)) return updated;
+    }
     RangeGenerator range_gen(encoder_, range);
     if (layouts_.SmallMode()) {
         return SetSubresourceRangeLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
@@ -141,6 +171,11 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
                                                                  const VkImageSubresourceRange& range, VkImageLayout layout) {
     if (!InRange(range)) return;  // Don't even try to track bogus subreources
 
+    if (encoder_.CoversAll(range)) {
+        LayoutEntry entry(layout);
+        bool updated = false;
+        if (SetWholeImageLayout(cb_state, entry, nullptr, updated)) return;
+    }
     RangeGenerator range_gen(encoder_, range);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
@@ -153,6 +188,11 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::Comm
 // Unwrap the BothMaps entry here as this is a performance hotspot.
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const vvl::CommandBuffer& cb_state, VkImageLayout layout,
                                                                  const vvl::ImageView& view_state) {
+    if (encoder_.CoversAll(view_state.normalized_subresource_range)) {
+        LayoutEntry entry(layout);
+        bool updated = false;
+        if (SetWholeImageLayout(cb_state, entry, &view_state, updated)) return;
+    }
     RangeGenerator range_gen(view_state.range_generator);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
@@ -123,6 +123,8 @@ class ImageSubresourceLayoutMap {
     bool UpdateFrom(const ImageSubresourceLayoutMap& from);
     uintptr_t CompatibilityKey() const;
     const LayoutMap& GetLayoutMap() const { return layouts_; }
+    // The entry shared by every subresource, or nullptr if the layouts of the image are tracked in several ranges
+    const LayoutEntry* GetUniformEntry() const;
     ImageSubresourceLayoutMap(const vvl::Image& image_state);
     ~ImageSubresourceLayoutMap() {}
     const vvl::Image* GetImageView() const { return &image_state_; };
@@ -166,6 +168,9 @@ class ImageSubresourceLayoutMap {
     bool InRange(const VkImageSubresourceRange& range) const { return encoder_.InRange(range); }
 
   private:
+    bool SetWholeImageLayout(const vvl::CommandBuffer& cb_state, LayoutEntry& new_entry, const vvl::ImageView* view_state,
+                             bool& updated_current);
+
     const vvl::Image& image_state_;
     const Encoder& encoder_;
     LayoutMap layouts_;
@@ -178,12 +183,23 @@ class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkIma
     using RangeGenerator = image_layout_map::RangeGenerator;
     using RangeType = key_type;
 
-    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index) {}
+    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index), whole_range_(0, index) {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
     bool AnyInRange(RangeGenerator& gen, std::function<bool(const key_type& range, const mapped_type& state)>&& func) const;
 
+    // The layout of every subresource, or nullptr if the subresources are not all known to be in the same layout
+    const VkImageLayout* GetUniformLayout() const {
+        if (size() != 1) return nullptr;
+        const auto it = begin();
+        return (it->first == whole_range_) ? &it->second : nullptr;
+    }
+    // Replaces all ranges with a single one holding layout
+    void SetUniformLayout(VkImageLayout layout) { overwrite_range(lower_bound(whole_range_), std::make_pair(whole_range_, layout)); }
+    const key_type& WholeRange() const { return whole_range_; }
+
   private:
+    const key_type whole_range_;
     mutable std::shared_mutex lock_;
 };
\ No newline at end of file
@@ -357,8 +357,14 @@ void Image::SetInitialLayoutMap() {
 void Image::SetImageLayout(const VkImageSubresourceRange &range, VkImageLayout layout) {
     using sparse_container::update_range_value;
     using sparse_container::value_precedence;
-    GlobalImageLayoutRangeMap::RangeGenerator range_gen(subresource_encoder, NormalizeSubresourceRange(range));
+    const VkImageSubresourceRange normalized_range = NormalizeSubresourceRange(range);
     auto guard = layout_range_map->WriteLock();
+    if (subresource_encoder.CoversAll(normalized_range)) {
+        // Collapse the map to a single entry rather than updating each range it was split into
+        layout_range_map->SetUniformLayout(layout);
+        return;
+    }
+    GlobalImageLayoutRangeMap::RangeGenerator range_gen(subresource_encoder, normalized_range);
     for (; range_gen->non_empty(); ++range_gen) {
         update_range_value(*layout_range_map, *range_gen, layout, value_precedence::prefer_source);
     }
@@ -658,6 +658,7 @@ struct LastBound {
 
         // Cache most recently validated descriptor state for ValidateActionState/UpdateDrawState
         const vvl::DescriptorSet *validated_set{nullptr};
+        const vvl::Pipeline *validated_pipeline{nullptr};
         uint64_t validated_set_change_count{~0ULL};
         uint64_t validated_set_image_layout_change_count{~0ULL};
         BindingVariableMap validated_set_binding_req_map;
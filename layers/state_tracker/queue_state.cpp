@@ -19,6 +19,8 @@
 #include "state_tracker/queue_state.h"
 #include "state_tracker/cmd_buffer_state.h"
 
+#include <algorithm>
+
 void vvl::QueueSubmission::BeginUse() {
     for (auto &wait : wait_semaphores) {
         wait.semaphore->BeginUse();
@@ -85,9 +87,6 @@ uint64_t vvl::Queue::PreSubmit(std::vector<vvl::QueueSubmission> &&submissions)
         {
             auto guard = Lock();
             submissions_.emplace_back(std::move(submission));
-            if (!thread_) {
-                thread_ = std::make_unique<std::thread>(&Queue::ThreadFunc, this);
-            }
         }
     }
     return retire_early_seq;
@@ -125,29 +124,25 @@ void vvl::Queue::NotifyAndWait(const Location &loc, uint64_t until_seq) {
 }
 
 uint64_t vvl::Queue::Notify(uint64_t until_seq) {
-    auto guard = Lock();
-    if (until_seq == kU64Max) {
-        until_seq = seq_;
+    bool schedule = false;
+    {
+        auto guard = Lock();
+        if (until_seq == kU64Max) {
+            until_seq = seq_;
+        }
+        if (request_seq_ < until_seq) {
+            request_seq_ = until_seq;
+        }
+        schedule = !submissions_.empty() && submissions_.front().seq <= request_seq_;
     }
-    if (request_seq_ < until_seq) {
-        request_seq_ = until_seq;
+    if (schedule) {
+        dev_data_.queue_retirement_scheduler.Schedule(*this);
     }
-    cond_.notify_one();
     return until_seq;
 }
 
 void vvl::Queue::Destroy() {
-    std::unique_ptr<std::thread> dead_thread;
-    {
-        auto guard = Lock();
-        exit_thread_ = true;
-        cond_.notify_all();
-        dead_thread = std::move(thread_);
-    }
-    if (dead_thread && dead_thread->joinable()) {
-        dead_thread->join();
-        dead_thread.reset();
-    }
+    dev_data_.queue_retirement_scheduler.Remove(*this);
     StateObject::Destroy();
 }
 
@@ -159,20 +154,30 @@ void vvl::Queue::PostSubmit() {
 }
 
 vvl::QueueSubmission *vvl::Queue::NextSubmission() {
-    QueueSubmission *result = nullptr;
-    // Find if the next submission is ready so that the thread function doesn't need to worry
-    // about locking.
+    // Find if the next submission is ready so that the caller doesn't need to worry about locking.
     auto guard = Lock();
-    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front().seq)) {
-        // The queue thread must wait forever if nothing is happening, until we tell it to exit
-        cond_.wait(guard);
+    if (submissions_.empty() || request_seq_ < submissions_.front().seq) {
+        return nullptr;
+    }
+    // NOTE: the submission must remain on the dequeue until we're done processing it so that
+    // anyone waiting for it can find the correct waiter
+    return &submissions_.front();
+}
+
+// A wait can only retire once the signal it waits for has, retiring it earlier would block the scheduler thread. The same
+// goes for a signal of a payload which another queue also signals.
+bool vvl::Queue::CanRetire(const QueueSubmission &submission) {
+    for (const auto &wait : submission.wait_semaphores) {
+        if (!wait.semaphore->CanRetire(this, wait.payload)) {
+            return false;
+        }
     }
-    if (!exit_thread_) {
-        result = &submissions_.front();
-        // NOTE: the submission must remain on the dequeue until we're done processing it so that
-        // anyone waiting for it can find the correct waiter
+    for (const auto &signal : submission.signal_semaphores) {
+        if (!signal.semaphore->CanRetire(this, signal.payload)) {
+            return false;
+        }
     }
-    return result;
+    return true;
 }
 
 void vvl::Queue::Retire(QueueSubmission &submission) {
@@ -216,25 +221,156 @@ void vvl::Queue::Retire(QueueSubmission &submission) {
     }
 }
 
-void vvl::Queue::ThreadFunc() {
-    QueueSubmission *submission = nullptr;
+vvl::Queue::RetireResult vvl::Queue::RetireNext() {
+    QueueSubmission *submission = NextSubmission();
+    if (submission == nullptr) {
+        return RetireResult::kIdle;
+    }
+    if (!CanRetire(*submission)) {
+        return RetireResult::kBlocked;
+    }
+    Retire(*submission);
+    // wake up anyone waiting for this submission to be retired
+    std::promise<void> completed;
+    {
+        auto guard = Lock();
+        completed = std::move(submission->completed);
+        submissions_.pop_front();
+    }
+    completed.set_value();
+    return RetireResult::kRetired;
+}
+
+vvl::QueueRetirementScheduler::~QueueRetirementScheduler() {
+    std::unique_ptr<std::thread> dead_thread;
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        exit_thread_ = true;
+        cond_.notify_all();
+        pass_cond_.notify_all();
+        dead_thread = std::move(thread_);
+    }
+    if (dead_thread && dead_thread->joinable()) {
+        dead_thread->join();
+    }
+}
+
+void vvl::QueueRetirementScheduler::Schedule(Queue &queue) {
+    if (queue.removed_.load() || queue.scheduled_.exchange(true)) {
+        return;
+    }
+    Queue *head = scheduled_.load();
+    do {
+        queue.next_scheduled_ = head;
+    } while (!scheduled_.compare_exchange_weak(head, &queue));
+    WakeThread();
+}
+
+void vvl::QueueRetirementScheduler::TimelineAdvanced() {
+    // The thread compares the epoch against the one it last saw before sleeping, so only wake it if it has parked queues
+    timeline_epoch_.fetch_add(1);
+    if (parked_count_.load() > 0) {
+        WakeThread();
+    }
+}
+
+void vvl::QueueRetirementScheduler::WakeThread() {
+    if (!thread_started_.load()) {
+        std::unique_lock<std::mutex> guard(lock_);
+        if (!thread_ && !exit_thread_) {
+            thread_ = std::make_unique<std::thread>(&QueueRetirementScheduler::ThreadFunc, this);
+        }
+        thread_started_.store(true);
+        return;
+    }
+    if (sleeping_.load()) {
+        std::unique_lock<std::mutex> guard(lock_);
+        cond_.notify_one();
+    }
+}
+
+void vvl::QueueRetirementScheduler::Remove(Queue &queue) {
+    if (queue.removed_.exchange(true)) {
+        return;
+    }
+    std::unique_lock<std::mutex> guard(lock_);
+    if (!thread_ || thread_->get_id() == std::this_thread::get_id()) {
+        return;
+    }
+    // The pass in progress may still be retiring the queue, or have taken the stack before the queue was marked as
+    // removed. The pass after it drops every reference to the queue.
+    const uint64_t until_pass = pass_ + 2;
+    remove_until_pass_ = std::max(remove_until_pass_, until_pass);
+    cond_.notify_one();
+    pass_cond_.wait(guard, [this, until_pass]() { return pass_ >= until_pass || exit_thread_; });
+}
+
+bool vvl::QueueRetirementScheduler::RetireRequested(Queue &queue) {
+    while (true) {
+        switch (queue.RetireNext()) {
+            case Queue::RetireResult::kIdle:
+                return true;
+            case Queue::RetireResult::kBlocked:
+                return false;
+            case Queue::RetireResult::kRetired:
+                break;
+        }
+    }
+}
+
+void vvl::QueueRetirementScheduler::Park(Queue &queue) {
+    if (std::find(parked_.begin(), parked_.end(), &queue) == parked_.end()) {
+        parked_.push_back(&queue);
+        parked_count_.store(static_cast<uint32_t>(parked_.size()));
+    }
+}
 
-    // Roll this queue forward, one submission at a time.
+void vvl::QueueRetirementScheduler::ThreadFunc() {
     while (true) {
-        submission = NextSubmission();
-        if (submission == nullptr) {
-            break;
+        // Anything completing after this load makes the thread look at the parked queues again
+        const uint64_t timeline_epoch = timeline_epoch_.load();
+        if (timeline_epoch != seen_timeline_epoch_) {
+            seen_timeline_epoch_ = timeline_epoch;
+            std::vector<Queue *> parked = std::move(parked_);
+            parked_.clear();
+            for (Queue *queue : parked) {
+                if (!queue->removed_.load() && !RetireRequested(*queue)) {
+                    Park(*queue);
+                }
+            }
+            parked_count_.store(static_cast<uint32_t>(parked_.size()));
         }
-        Retire(*submission);
-        // wake up anyone waiting for this submission to be retired
-        {
-            std::promise<void> completed;
-            {
-                auto guard = Lock();
-                completed = std::move(submission->completed);
-                submissions_.pop_front();
+
+        Queue *queue = scheduled_.exchange(nullptr);
+        while (queue != nullptr) {
+            Queue *next = queue->next_scheduled_;
+            // Clear before retiring, so a Notify() which comes in meanwhile schedules the queue again
+            queue->scheduled_.store(false);
+            if (!queue->removed_.load() && !RetireRequested(*queue)) {
+                Park(*queue);
             }
-            completed.set_value();
+            queue = next;
+        }
+
+        std::unique_lock<std::mutex> guard(lock_);
+        parked_.erase(std::remove_if(parked_.begin(), parked_.end(), [](Queue *parked) { return parked->removed_.load(); }),
+                      parked_.end());
+        parked_count_.store(static_cast<uint32_t>(parked_.size()));
+        ++pass_;
+        pass_cond_.notify_all();
+        if (exit_thread_) {
+            break;
+        }
+        // Both sides of each wake up use sequentially consistent atomics: either the thread sees the new work here, or the
+        // waker sees sleeping_ and notifies while holding lock_, which the thread only releases inside wait().
+        sleeping_.store(true);
+        cond_.wait(guard, [this]() {
+            return exit_thread_ || pass_ < remove_until_pass_ || scheduled_.load() != nullptr ||
+                   (!parked_.empty() && timeline_epoch_.load() != seen_timeline_epoch_);
+        });
+        sleeping_.store(false);
+        if (exit_thread_) {
+            break;
         }
     }
 }
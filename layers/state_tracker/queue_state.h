@@ -20,9 +20,12 @@
 #include "state_tracker/state_object.h"
 #include "state_tracker/fence_state.h"
 #include "state_tracker/semaphore_state.h"
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 #include "error_message/error_location.h"
@@ -76,6 +79,54 @@ static inline std::chrono::time_point<std::chrono::steady_clock> GetCondWaitTime
     return std::chrono::steady_clock::now() + std::chrono::seconds(10);
 }
 
+// Retires the submissions of all the queues of a device from a single thread, which is started by the first Notify().
+//
+// A queue with submissions to retire pushes itself on a lock-free stack (Schedule()), which the thread takes in one
+// exchange. A submission waiting on a semaphore signal which another queue or the host has not retired yet cannot be
+// retired either. Instead of blocking the thread, that queue is parked until a semaphore timepoint completes
+// (TimelineAdvanced()), so the thread is free to retire the queue which will signal it.
+class QueueRetirementScheduler {
+  public:
+    QueueRetirementScheduler() = default;
+    QueueRetirementScheduler(const QueueRetirementScheduler &) = delete;
+    QueueRetirementScheduler &operator=(const QueueRetirementScheduler &) = delete;
+    ~QueueRetirementScheduler();
+
+    // Queue has submissions which were requested to retire
+    void Schedule(Queue &queue);
+    // Called whenever a semaphore timepoint completes, parked queues may be able to continue
+    void TimelineAdvanced();
+    // Called when queue is destroyed, returns once the thread holds no reference to it
+    void Remove(Queue &queue);
+
+  private:
+    void ThreadFunc();
+    void WakeThread();
+    // Returns false if the queue is blocked on a semaphore wait
+    bool RetireRequested(Queue &queue);
+    void Park(Queue &queue);
+
+    std::atomic<Queue *> scheduled_{nullptr};
+    std::atomic<uint64_t> timeline_epoch_{0};
+    std::atomic<uint32_t> parked_count_{0};
+    std::atomic<bool> sleeping_{false};
+    std::atomic<bool> thread_started_{false};
+
+    // Only accessed by the thread
+    std::vector<Queue *> parked_;
+    uint64_t seen_timeline_epoch_{0};
+
+    std::mutex lock_;
+    // wakes up the thread
+    std::condition_variable cond_;
+    // wakes up Remove() when the thread finished a pass over its queues
+    std::condition_variable pass_cond_;
+    uint64_t pass_{0};
+    uint64_t remove_until_pass_{0};
+    bool exit_thread_{false};
+    std::unique_ptr<std::thread> thread_;
+};
+
 class Queue: public StateObject {
   public:
     Queue(ValidationStateTracker &dev_data, VkQueue handle, uint32_t index, VkDeviceQueueCreateFlags flags,
@@ -96,7 +147,7 @@ class Queue: public StateObject {
     // called from the various PostCallRecordQueueSubmit() methods
     void PostSubmit();
 
-    // Tell the queue thread that submissions up to the submission with sequence number until_seq have finished
+    // Tell the retirement scheduler that submissions up to the submission with sequence number until_seq have finished
     uint64_t Notify(uint64_t until_seq = kU64Max);
 
     // Tell the queue and then wait for it to finish updating its state.
@@ -122,26 +173,32 @@ class Queue: public StateObject {
   protected:
     // called from the various PostCallRecordQueueSubmit() methods
     virtual void PostSubmit(QueueSubmission &submission) {}
-    // called when the worker thread decides a submissions has finished executing
+    // called when the retirement scheduler decides a submissions has finished executing
     virtual void Retire(QueueSubmission &submission);
 
   private:
+    friend class QueueRetirementScheduler;
+    enum class RetireResult { kIdle, kRetired, kBlocked };
+
     using LockGuard = std::unique_lock<std::mutex>;
-    void ThreadFunc();
+    // called by the retirement scheduler thread
+    RetireResult RetireNext();
     QueueSubmission *NextSubmission();
+    bool CanRetire(const QueueSubmission &submission);
     LockGuard Lock() const { return LockGuard(lock_); }
 
     ValidationStateTracker &dev_data_;
 
     // state related to submitting to the queue, all data members must
     // be accessed with lock_ held
-    std::unique_ptr<std::thread> thread_;
     std::deque<QueueSubmission> submissions_;
     std::atomic<uint64_t> seq_{0};
     uint64_t request_seq_{0};
-    bool exit_thread_{false};
     mutable std::mutex lock_;
-    // condition to wake up the queue's thread
-    std::condition_variable cond_;
+
+    // Owned by QueueRetirementScheduler
+    std::atomic<bool> scheduled_{false};
+    Queue *next_scheduled_{nullptr};
+    std::atomic<bool> removed_{false};
 };
 } // namespace vvl
@@ -193,6 +193,41 @@ void vvl::Semaphore::Notify(uint64_t payload) {
     }
 }
 
+bool vvl::Semaphore::RetiresHere(const TimePoint &timepoint, const vvl::Queue *current_queue) const {
+    // Retire the operation if it occured on the current queue. Usually this means it is a signal.
+    // Note that host operations occur on the null queue. Acquire operations are a special case because
+    // the happen asynchronously but there isn't a queue associated with signalling them.
+    if (timepoint.signal_submit) {
+        return timepoint.signal_submit->queue == current_queue;
+    }
+    if (timepoint.acquire_command) {
+        return true;
+    }
+    // For external semaphores we might not have visibility to the signal op
+    return scope_ != kInternal;
+}
+
+bool vvl::Semaphore::CanRetire(const vvl::Queue *current_queue, uint64_t payload) const {
+    auto guard = ReadLock();
+    if (payload <= completed_.payload) {
+        return true;
+    }
+    auto pos = timeline_.find(payload);
+    if (pos == timeline_.end()) {
+        return true;
+    }
+    const auto &timepoint = pos->second;
+    if (RetiresHere(timepoint, current_queue) ||
+        timepoint.waiter.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        return true;
+    }
+    // Make sure the queue which signals the payload gets to retire it. Waiting queues are not notified, the caller is one.
+    if (timepoint.signal_submit && timepoint.signal_submit->queue) {
+        timepoint.signal_submit->queue->Notify(timepoint.signal_submit->seq);
+    }
+    return false;
+}
+
 void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint64_t payload) {
     auto guard = WriteLock();
     if (payload <= completed_.payload) {
@@ -203,25 +238,7 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
     auto &timepoint = pos->second;
     timepoint.Notify();
 
-    bool retire_here = false;
-
-    // Retire the operation if it occured on the current queue. Usually this means it is a signal.
-    // Note that host operations occur on the null queue. Acquire operations are a special case because
-    // the happen asynchronously but there isn't a queue associated with signalling them.
-    if (timepoint.signal_submit) {
-        if (timepoint.signal_submit->queue == current_queue) {
-            retire_here = true;
-        }
-    } else if (timepoint.acquire_command) {
-        retire_here = true;
-    } else {
-        // For external semaphores we might not have visibility to the signal op
-        if (scope_ != kInternal) {
-            retire_here = true;
-        }
-    }
-
-    if (retire_here) {
+    if (RetiresHere(timepoint, current_queue)) {
         if (timepoint.signal_submit) {
             completed_ = SemOp(kSignal, *timepoint.signal_submit, payload);
         }
@@ -233,12 +250,19 @@ void vvl::Semaphore::Retire(vvl::Queue *current_queue, const Location &loc, uint
         }
         timepoint.completed.set_value();
         timeline_.erase(timeline_.begin());
+        // Queues parked on a wait for this timepoint can retire now
+        dev_data_.queue_retirement_scheduler.TimelineAdvanced();
         if (scope_ == kExternalTemporary) {
             scope_ = kInternal;
             imported_handle_type_.reset();
         }
+    } else if (current_queue) {
+        // The scheduler thread checked CanRetire() before retiring the submission, so this is only reached if another queue
+        // added an operation for this payload since then. Waiting here would block the thread which has to retire that
+        // queue, so the timepoint is left for it to complete.
     } else {
-        // Wait for some other queue or a host operation to retire
+        // Wait for some other queue to retire. Only host operations get here, on the thread of the API call, and the wait
+        // is bounded by GetCondWaitTimeout().
         assert(timepoint.waiter.valid());
         // the current timepoint should get destroyed while we're waiting, so copy out the waiter.
         auto waiter = timepoint.waiter;
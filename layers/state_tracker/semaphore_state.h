@@ -87,9 +87,13 @@ class Semaphore : public RefcountedStateObject {
     // Helper for retiring timeline semaphores and then retiring all queues using the semaphore
     void NotifyAndWait(const Location &loc, uint64_t payload);
 
-    // Remove completed operations and signal any waiters. This should only be called by Queue
+    // Remove completed operations and signal any waiters. This should only be called by Queue, or with a null queue for host
+    // operations. Only the latter may block, waiting for another queue to retire the payload.
     void Retire(Queue *current_queue, const Location &loc, uint64_t payload);
 
+    // Returns true if Retire() would not have to wait for another queue or the host to retire the operation first
+    bool CanRetire(const Queue *current_queue, uint64_t payload) const;
+
     // Look for most recent / highest payload operation that matches
     std::optional<SemOp> LastOp(
         const std::function<bool(OpType op_type, uint64_t payload, bool is_pending)> &filter = nullptr) const;
@@ -129,6 +133,9 @@ class Semaphore : public RefcountedStateObject {
     // Signal queue(s) that need to retire because a wait on this payload has finished
     void Notify(uint64_t payload);
 
+    // Returns true if the operations of timepoint are retired by current_queue rather than waited for
+    bool RetiresHere(const TimePoint &timepoint, const Queue *current_queue) const;
+
     std::shared_future<void> Wait(uint64_t payload);
 
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
@@ -25,7 +25,10 @@ void vvl::StateObject::Destroy() {
     destroyed_ = true;
 }
 
-const VulkanTypedHandle* vvl::StateObject::InUse() const {
+VulkanTypedHandle vvl::StateObject::InUse() const {
+    if (cb_use_count_.load() > 0) {
+        return VulkanTypedHandle(CastFromUint64<VkCommandBuffer>(cb_user_.load()), kVulkanObjectTypeCommandBuffer);
+    }
     // NOTE: for performance reasons, this method calls up the tree
     // with the read lock held.
     auto guard = ReadLockTree();
@@ -35,10 +38,45 @@ const VulkanTypedHandle* vvl::StateObject::InUse() const {
             continue;
         }
         if (node->InUse()) {
-            return &node->Handle();
+            return node->Handle();
+        }
+    }
+    return VulkanTypedHandle();
+}
+
+void vvl::StateObject::BeginCommandBufferUse(VkCommandBuffer command_buffer) {
+    cb_user_.store(CastToUint64(command_buffer));
+    cb_use_count_.fetch_add(1);
+}
+
+std::vector<VulkanTypedHandle> vvl::StateObject::GetInvalidationChain() const {
+    auto guard = ReadLockTree();
+    return invalidation_chain_;
+}
+
+void vvl::StateObject::AddGenerationWatcher(StateObject& watcher) {
+    auto guard = WriteLockTree();
+    generation_watchers_.emplace(watcher.Handle(), std::weak_ptr<StateObject>(watcher.shared_from_this()));
+}
+
+void vvl::StateObject::RemoveGenerationWatcher(const StateObject& watcher) {
+    auto guard = WriteLockTree();
+    generation_watchers_.erase(watcher.Handle());
+}
+
+void vvl::StateObject::NotifyGenerationWatchers() {
+    NodeList watchers;
+    {
+        auto guard = ReadLockTree();
+        for (const auto& item : generation_watchers_) {
+            if (auto watcher = item.second.lock()) {
+                watchers.emplace_back(std::move(watcher));
+            }
         }
     }
-    return nullptr;
+    for (auto& watcher : watchers) {
+        watcher->NotifyGenerationChanged();
+    }
 }
 
 bool vvl::StateObject::AddParent(StateObject* parent_node) {
@@ -83,6 +121,18 @@ void vvl::StateObject::Invalidate(bool unlink) {
 }
 
 void vvl::StateObject::NotifyInvalidate(const NodeList& invalid_nodes, bool unlink) {
+    {
+        auto guard = WriteLockTree();
+        invalidation_chain_.clear();
+        for (const auto& node : invalid_nodes) {
+            invalidation_chain_.emplace_back(node->Handle());
+        }
+        invalidation_chain_.emplace_back(Handle());
+    }
+    // Command buffers which recorded this object see the new generation on their next check, see CommandBuffer::GetState()
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+    NotifyGenerationWatchers();
+
     auto current_parents = GetParentsForInvalidate(unlink);
     if (current_parents.size() == 0) {
         return;
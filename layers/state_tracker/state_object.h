@@ -23,6 +23,7 @@
 #include "utils/vk_layer_utils.h"
 
 #include <atomic>
+#include <vector>
 
 // Intentionally ignore VulkanTypedHandle::node, it is optional
 inline bool operator==(const VulkanTypedHandle &a, const VulkanTypedHandle &b) noexcept {
@@ -84,7 +85,24 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     static VulkanTypedHandle Handle(const StateObject *node) { return (node) ? node->Handle() : VulkanTypedHandle(); }
     static VulkanTypedHandle Handle(const std::shared_ptr<const StateObject> &node) { return Handle(node.get()); }
 
-    virtual const VulkanTypedHandle* InUse() const;
+    // Returns the handle of the in flight object using this one, or a null handle
+    virtual VulkanTypedHandle InUse() const;
+
+    // Command buffers do not link themselves as parents of the objects they use, as that would cost a locked map insertion
+    // for every bind. Instead they record the generation each object had when it was bound (see CommandBuffer::AddChild())
+    // and compare it later. The generation is bumped whenever the object is destroyed or invalidated.
+    uint32_t GetGeneration() const { return generation_.load(std::memory_order_acquire); }
+    // Handles of the objects involved in the latest invalidation of this object, starting with the one which caused it
+    std::vector<VulkanTypedHandle> GetInvalidationChain() const;
+    // Command buffers register as watchers of the objects they bind, and are told when the generation of one of them changes
+    // so that only they compare the generations of their bindings again. A watcher registers once per object and removes
+    // itself when it is reset or destroyed.
+    void AddGenerationWatcher(StateObject &watcher);
+    void RemoveGenerationWatcher(const StateObject &watcher);
+
+    // Submitted command buffers count themselves as users of the objects they recorded, so that InUse() finds them
+    void BeginCommandBufferUse(VkCommandBuffer command_buffer);
+    void EndCommandBufferUse() { cb_use_count_.fetch_sub(1); }
 
     virtual bool AddParent(StateObject *parent_node);
     virtual void RemoveParent(StateObject *parent_node);
@@ -106,6 +124,10 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
 
     // Called recursively for every parent object of something that has become invalid
     virtual void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink);
+    // Called on the watchers of an object after its generation changed, see AddGenerationWatcher()
+    virtual void NotifyGenerationChanged() {}
+    // Calls NotifyGenerationChanged() on the watchers, without the tree lock held
+    void NotifyGenerationWatchers();
 
     // returns a copy of the current set of parents so that they can be walked
     // without the tree lock held. If unlink == true, parent_nodes_ is also cleared.
@@ -120,10 +142,18 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     WriteLockGuard WriteLockTree() { return WriteLockGuard(tree_lock_); }
 
     // Set of immediate parent nodes for this object. For an in-use object, the
-    // parent nodes should form a tree with the root being a command buffer.
+    // parent nodes should form a tree with the root being used by a command buffer.
     NodeMap parent_nodes_;
-    // Lock guarding parent_nodes_, this lock MUST NOT be used for other purposes.
+    // Lock guarding parent_nodes_ and invalidation_chain_, this lock MUST NOT be used for other purposes.
     mutable std::shared_mutex tree_lock_;
+    std::vector<VulkanTypedHandle> invalidation_chain_;
+    // Also guarded by tree_lock_
+    NodeMap generation_watchers_;
+
+    std::atomic<uint32_t> generation_{0};
+    std::atomic<uint32_t> cb_use_count_{0};
+    // Handle of the last command buffer which began using this object
+    std::atomic<uint64_t> cb_user_{0};
 };
 
 class RefcountedStateObject : public StateObject {
@@ -139,6 +169,8 @@ class RefcountedStateObject : public StateObject {
 
     void EndUse() { in_use_.fetch_sub(1); }
 
-    const VulkanTypedHandle* InUse() const override { return ((in_use_.load() > 0) || StateObject::InUse()) ? &Handle() : nullptr; }
+    VulkanTypedHandle InUse() const override {
+        return ((in_use_.load() > 0) || StateObject::InUse()) ? Handle() : VulkanTypedHandle();
+    }
 };
 } // namespace vvl
@@ -388,6 +388,7 @@ void ValidationStateTracker::PostCallRecordCreateBuffer(VkDevice device, const V
 
             BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
             sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
+            RecordBufferAddressChange(address_range);
         }
 
         const VkBufferUsageFlags descriptor_buffer_usages =
@@ -551,6 +552,7 @@ void ValidationStateTracker::PreCallRecordDestroyBuffer(VkDevice device, VkBuffe
 
                 return false;
             });
+            RecordBufferAddressChange(address_range);
         }
     }
     Destroy<vvl::Buffer>(buffer);
@@ -5582,10 +5584,87 @@ void ValidationStateTracker::PostCallRecordGetBufferDeviceAddress(VkDevice devic
 
         BufferAddressInfillUpdateOps ops{{buffer_state.get()}};
         sparse_container::infill_update_range(buffer_address_map_, address_range, ops);
-        buffer_device_address_ranges_version++;
+        RecordBufferAddressChange(address_range);
     }
 }
 
+void ValidationStateTracker::EnableBufferAddressChangeTracking() {
+    WriteLockGuard guard(buffer_address_lock_);
+    track_buffer_address_changes_ = true;
+    // Whatever is already in the map has not been journaled
+    buffer_address_changes_overflow_ = true;
+}
+
+void ValidationStateTracker::RecordBufferAddressChange(const BufferAddressRange &range) {
+    buffer_device_address_ranges_version++;
+    if (!track_buffer_address_changes_ || buffer_address_changes_overflow_) {
+        return;
+    }
+    // Past this point patching the ranges one change at a time costs more than copying the whole map
+    constexpr size_t kMaxBufferAddressChanges = 4096;
+    if (buffer_address_changes_.size() >= kMaxBufferAddressChanges) {
+        buffer_address_changes_.clear();
+        buffer_address_changes_overflow_ = true;
+        return;
+    }
+    buffer_address_changes_.push_back(range);
+}
+
+size_t ValidationStateTracker::UpdateBufferAddressRanges(std::vector<BufferAddressRange> &ranges) {
+    WriteLockGuard guard(buffer_address_lock_);
+    if (buffer_address_changes_overflow_) {
+        buffer_address_changes_overflow_ = false;
+        buffer_address_changes_.clear();
+        ranges.clear();
+        ranges.reserve(buffer_address_map_.size());
+        for (const auto &entry : buffer_address_map_) {
+            ranges.push_back(entry.first);
+        }
+        return 0;
+    }
+
+    const auto ends_before = [](const BufferAddressRange &entry, const BufferAddressRange &key) { return entry.end <= key.begin; };
+    const auto begins_before = [](const BufferAddressRange &entry, const BufferAddressRange &key) { return entry.begin < key.end; };
+    size_t first_changed = std::numeric_limits<size_t>::max();
+    std::vector<BufferAddressRange> new_ranges;
+    for (const BufferAddressRange &change : buffer_address_changes_) {
+        // Entries crossing the edges of the change may have been split or merged, so grow the range until it only contains
+        // whole entries, both in the old ranges and in the map. Everything inside it is then replaced by the map contents.
+        BufferAddressRange hull = change;
+        auto first = ranges.begin();
+        auto last = ranges.begin();
+        while (true) {
+            first = std::lower_bound(ranges.begin(), ranges.end(), hull, ends_before);
+            last = std::lower_bound(first, ranges.end(), hull, begins_before);
+            BufferAddressRange grown = hull;
+            if (first != last) {
+                grown.begin = std::min(grown.begin, first->begin);
+                grown.end = std::max(grown.end, std::prev(last)->end);
+            }
+            new_ranges.clear();
+            const auto map_end = buffer_address_map_.upper_bound(grown);
+            for (auto it = buffer_address_map_.lower_bound(grown); it != map_end; ++it) {
+                new_ranges.push_back(it->first);
+            }
+            if (!new_ranges.empty()) {
+                grown.begin = std::min(grown.begin, new_ranges.front().begin);
+                grown.end = std::max(grown.end, new_ranges.back().end);
+            }
+            if (grown == hull) {
+                break;
+            }
+            hull = grown;
+        }
+
+        const size_t index = static_cast<size_t>(std::distance(ranges.begin(), first));
+        const auto insert_at = ranges.erase(first, last);
+        ranges.insert(insert_at, new_ranges.begin(), new_ranges.end());
+        first_changed = std::min(first_changed, index);
+    }
+    buffer_address_changes_.clear();
+    return std::min(first_changed, ranges.size());
+}
+
 void ValidationStateTracker::PostCallRecordGetBufferDeviceAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo *pInfo,
                                                                      const RecordObject &record_obj) {
     PostCallRecordGetBufferDeviceAddress(device, pInfo, record_obj);
@@ -22,6 +22,7 @@
 #include "generated/chassis.h"
 #include "utils/hash_vk_types.h"
 #include "state_tracker/video_session_state.h"
+#include "state_tracker/queue_state.h"
 #include "generated/layer_chassis_dispatch.h"
 #include "generated/state_tracker_helper.h"
 #include "error_message/logging.h"
@@ -437,6 +438,12 @@ class ValidationStateTracker : public ValidationObject {
         return result;
     }
 
+    // Lets a validation object keep its own sorted copy of GetBufferAddressRanges() in sync without copying the whole map
+    // every time it changes. Once enabled, the address ranges touched by every change are journaled until the next
+    // UpdateBufferAddressRanges() call, which patches the given copy and returns the index of its first modified entry.
+    void EnableBufferAddressChangeTracking();
+    size_t UpdateBufferAddressRanges(std::vector<BufferAddressRange>& ranges);
+
     using SetImageViewInitialLayoutCallback = std::function<void(vvl::CommandBuffer*, const vvl::ImageView&, VkImageLayout)>;
     template <typename Fn>
     void SetSetImageViewInitialLayoutCallback(Fn&& fn) {
@@ -1852,13 +1859,17 @@ class ValidationStateTracker : public ValidationObject {
     std::vector<QueueFamilyExtensionProperties> queue_family_ext_props;
 
     bool performance_lock_acquired = false;
-    uint32_t buffer_device_address_ranges_version = 0;
+    // Bumped under buffer_address_lock_, read without it to skip UpdateBufferAddressRanges() when nothing changed
+    std::atomic<uint32_t> buffer_device_address_ranges_version{0};
 
     mutable vvl::VideoProfileDesc::Cache video_profile_cache_;
 
     using BufferAddressMapStore = small_vector<vvl::Buffer*, 1, size_t>;
     using BufferAddressRangeMap = sparse_container::range_map<VkDeviceAddress, BufferAddressMapStore>;
 
+    // Retires the submissions of every queue of the device. Declared before queue_map_ so that it outlives the queues.
+    vvl::QueueRetirementScheduler queue_retirement_scheduler;
+
   protected:
     // tracks which queue family index were used when creating the device for quick lookup
     vvl::unordered_set<uint32_t> queue_family_index_set;
@@ -1873,6 +1884,13 @@ class ValidationStateTracker : public ValidationObject {
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
     BufferAddressRangeMap buffer_address_map_;
     mutable std::shared_mutex buffer_address_lock_;
+    // Ranges of buffer_address_map_ changed since the last UpdateBufferAddressRanges(), see EnableBufferAddressChangeTracking()
+    std::vector<BufferAddressRange> buffer_address_changes_;
+    bool track_buffer_address_changes_ = false;
+    // Too many changes were journaled, the next UpdateBufferAddressRanges() copies the whole map instead
+    bool buffer_address_changes_overflow_ = false;
+    // Must be called with buffer_address_lock_ held for writing
+    void RecordBufferAddressChange(const BufferAddressRange& range);
 
     // < external format, features >
     vvl::concurrent_unordered_map<uint64_t, VkFormatFeatureFlags2KHR> ahb_ext_formats_map;
@@ -295,6 +295,7 @@ class AccessContext {
         src_external_ = nullptr;
         dst_external_ = TrackBack();
         start_tag_ = ResourceUsageTag();
+        // Rewinds the node arena of the map, the memory is kept for the next recording
         access_state_map_.clear();
     }
 
@@ -17,6 +17,42 @@
 #include "sync/sync_utils.h"
 #include "sync/sync_access_state.h"
 
+std::mutex SyncAccessFlagsPool::reference_lock_;
+uint32_t SyncAccessFlagsPool::reference_count_ = 0;
+SyncAccessFlagsPool::Pool *SyncAccessFlagsPool::pool_ = nullptr;
+std::atomic<bool> SyncAccessFlagsPool::overflowed_{false};
+
+SyncAccessFlagsPool::Index SyncAccessFlagsPool::Intern(const SyncStageAccessFlags &flags) {
+    if (flags.none()) {
+        return kEmpty;
+    }
+    const Index index = pool_->Intern(flags);
+    if (index == Pool::kOverflow) {
+        overflowed_.store(true, std::memory_order_relaxed);
+        return kEmpty;
+    }
+    return index;
+}
+
+size_t SyncAccessFlagsPool::Size() { return pool_ ? pool_->Size() : 0; }
+
+void SyncAccessFlagsPool::AddReference() {
+    std::lock_guard<std::mutex> guard(reference_lock_);
+    if (reference_count_++ == 0) {
+        pool_ = new Pool(kMaxChunks);
+        overflowed_.store(false, std::memory_order_relaxed);
+    }
+}
+
+void SyncAccessFlagsPool::RemoveReference() {
+    std::lock_guard<std::mutex> guard(reference_lock_);
+    assert(reference_count_ > 0);
+    if (--reference_count_ == 0) {
+        delete pool_;
+        pool_ = nullptr;
+    }
+}
+
 ResourceAccessState::OrderingBarriers ResourceAccessState::kOrderingRules = {
     {{VK_PIPELINE_STAGE_2_NONE_KHR, SyncStageAccessFlags()},
      {kColorAttachmentExecScope, kColorAttachmentAccessScope},
@@ -62,7 +98,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
         if (last_reads.size()) {
             for (const auto &read_access : last_reads) {
                 if (IsReadHazard(usage_stage, read_access)) {
-                    hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                    hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.Access(), read_access.tag);
                     break;
                 }
             }
@@ -127,7 +163,7 @@ HazardResult ResourceAccessState::DetectHazard(const SyncStageAccessInfoType &us
                 for (const auto &read_access : last_reads) {
                     if (read_access.stage & ordered_stages) continue;  // but we can skip the ordered ones
                     if (IsReadHazard(usage_stage, read_access)) {
-                        hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                        hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.Access(), read_access.tag);
                         break;
                     }
                 }
@@ -227,7 +263,7 @@ HazardResult ResourceAccessState::DetectAsyncHazard(const SyncStageAccessInfoTyp
             // Any reads during the other subpass will conflict with this write, so we need to check them all.
             for (const auto &read_access : last_reads) {
                 if (read_access.queue == queue_id && read_access.tag >= start_tag) {
-                    hazard.Set(this, usage_info, WRITE_RACING_READ, read_access.access, read_access.tag);
+                    hazard.Set(this, usage_info, WRITE_RACING_READ, read_access.Access(), read_access.tag);
                     break;
                 }
             }
@@ -265,7 +301,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(const SyncStageAccessInfoT
         // Look at the reads if any
         for (const auto &read_access : last_reads) {
             if (read_access.IsReadBarrierHazard(queue_id, src_exec_scope, src_access_scope)) {
-                hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                hazard.Set(this, usage_info, WRITE_AFTER_READ, read_access.Access(), read_access.tag);
                 break;
             }
         }
@@ -306,21 +342,21 @@ HazardResult ResourceAccessState::DetectBarrierHazard(const SyncStageAccessInfoT
                 assert(scope_read.stage == current_read.stage);
                 if (current_read.tag > event_tag) {
                     // The read is more recent than the set event scope, thus no barrier from the wait/ILT.
-                    hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.access, current_read.tag);
+                    hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.Access(), current_read.tag);
                 } else {
                     // The read is in the events first synchronization scope, so we use a barrier hazard check
                     // If the read stage is not in the src sync scope
                     // *AND* not execution chained with an existing sync barrier (that's the or)
                     // then the barrier access is unsafe (R/W after R)
                     if (scope_read.IsReadBarrierHazard(event_queue, src_exec_scope, src_access_scope)) {
-                        hazard.Set(this, usage_info, WRITE_AFTER_READ, scope_read.access, scope_read.tag);
+                        hazard.Set(this, usage_info, WRITE_AFTER_READ, scope_read.Access(), scope_read.tag);
                         break;
                     }
                 }
             }
             if (!hazard.IsHazard() && (last_reads.size() > scope_read_count)) {
                 const ReadState &current_read = last_reads[scope_read_count];
-                hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.access, current_read.tag);
+                hazard.Set(this, usage_info, WRITE_AFTER_READ, current_read.Access(), current_read.tag);
             }
         } else if (last_write.has_value()) {
             // if there are no reads, the write is either the reason the access is in the event scope... they are a hazard
@@ -342,6 +378,23 @@ void ResourceAccessState::MergeReads(const ResourceAccessState &other) {
     // Merge the read states
     const auto pre_merge_count = last_reads.size();
     const auto pre_merge_stages = last_read_stages;
+    if (other.last_reads.empty()) {
+        read_execution_barriers |= other.read_execution_barriers;
+        return;
+    }
+    if ((pre_merge_count == 0) && (pre_merge_stages == VK_PIPELINE_STAGE_2_NONE)) {
+        // All of the other reads would be appended, share the list instead
+        last_reads = other.last_reads;
+        for (const auto &other_read : other.last_reads) {
+            last_read_stages |= other_read.stage;
+            if (other_read.stage == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR) {
+                input_attachment_read = other.input_attachment_read;
+            }
+        }
+        read_execution_barriers |= other.read_execution_barriers;
+        return;
+    }
+    auto &reads = last_reads.Mutable();
     for (uint32_t other_read_index = 0; other_read_index < other.last_reads.size(); other_read_index++) {
         auto &other_read = other.last_reads[other_read_index];
         if (pre_merge_stages & other_read.stage) {
@@ -349,11 +402,11 @@ void ResourceAccessState::MergeReads(const ResourceAccessState &other) {
             // TODO: This is N^2 with stages... perhaps the ReadStates should be sorted by stage index.
             //       but we should wait on profiling data for that.
             for (uint32_t my_read_index = 0; my_read_index < pre_merge_count; my_read_index++) {
-                auto &my_read = last_reads[my_read_index];
+                auto &my_read = reads[my_read_index];
                 if (other_read.stage == my_read.stage) {
                     if (my_read.tag < other_read.tag) {
                         // Other is more recent, copy in the state
-                        my_read.access = other_read.access;
+                        my_read.access_index = other_read.access_index;
                         my_read.tag = other_read.tag;
                         my_read.queue = other_read.queue;
                         my_read.pending_dep_chain = other_read.pending_dep_chain;
@@ -378,7 +431,7 @@ void ResourceAccessState::MergeReads(const ResourceAccessState &other) {
             }
         } else {
             // The other read stage doesn't exist in this, so add it.
-            last_reads.emplace_back(other_read);
+            reads.emplace_back(other_read);
             last_read_stages |= other_read.stage;
             if (other_read.stage == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR) {
                 input_attachment_read = other.input_attachment_read;
@@ -456,16 +509,17 @@ void ResourceAccessState::Resolve(const ResourceAccessState &other) {
 void ResourceAccessState::Update(const SyncStageAccessInfoType &usage_info, SyncOrdering ordering_rule,
                                  const ResourceUsageTag tag) {
     // Move this logic in the ResourceStateTracker as methods, thereof (or we'll repeat it for every flavor of resource...
-    const auto &usage_bit = usage_info.stage_access_bit;
+    const auto usage_index = usage_info.stage_access_index;
     const auto &usage_stage = usage_info.stage_mask;
     if (IsRead(usage_info)) {
         // Mulitple outstanding reads may be of interest and do dependency chains independently
         // However, for purposes of barrier tracking, only one read per pipeline stage matters
+        auto &reads = last_reads.Mutable();
         if (usage_stage & last_read_stages) {
             const auto not_usage_stage = ~usage_stage;
-            for (auto &read_access : last_reads) {
+            for (auto &read_access : reads) {
                 if (read_access.stage == usage_stage) {
-                    read_access.Set(usage_stage, usage_bit, 0, tag);
+                    read_access.Set(usage_stage, usage_index, 0, tag);
                 } else if (read_access.barriers & usage_stage) {
                     // If the current access is barriered to this stage, mark it as "known to happen after"
                     read_access.sync_stages |= usage_stage;
@@ -477,12 +531,12 @@ void ResourceAccessState::Update(const SyncStageAccessInfoType &usage_info, Sync
                 }
             }
         } else {
-            for (auto &read_access : last_reads) {
+            for (auto &read_access : reads) {
                 if (read_access.barriers & usage_stage) {
                     read_access.sync_stages |= usage_stage;
                 }
             }
-            last_reads.emplace_back(usage_stage, usage_bit, 0, tag);
+            reads.emplace_back(usage_stage, usage_index, 0, tag);
             last_read_stages |= usage_stage;
         }
 
@@ -549,7 +603,7 @@ void ResourceAccessState::ClearPending() {
 void ResourceAccessState::ClearFirstUse() {
     first_accesses_.clear();
     first_read_stages_ = VK_PIPELINE_STAGE_2_NONE;
-    first_write_layout_ordering_ = OrderingBarrier();
+    first_write_layout_ordering_ = InternedOrderingBarrier();
     first_access_closed_ = false;
 }
 
@@ -567,8 +621,17 @@ void ResourceAccessState::ApplyPendingBarriers(const ResourceUsageTag tag) {
     } else {
         // Apply the accumulate execution barriers (and thus update chaining information)
         // for layout transition, last_reads is reset by SetWrite, so this will be skipped.
-        for (auto &read_access : last_reads) {
-            read_execution_barriers |= read_access.ApplyPendingBarriers();
+        const bool has_pending_reads = std::any_of(last_reads.begin(), last_reads.end(), [](const ReadState &read_access) {
+            return read_access.pending_dep_chain != VK_PIPELINE_STAGE_2_NONE;
+        });
+        if (has_pending_reads) {
+            for (auto &read_access : last_reads.Mutable()) {
+                read_execution_barriers |= read_access.ApplyPendingBarriers();
+            }
+        } else {
+            for (const auto &read_access : last_reads) {
+                read_execution_barriers |= read_access.barriers;
+            }
         }
 
         // We OR in the accumulated write chain and barriers even in the case of a layout transition as SetWrite zeros them.
@@ -584,13 +647,15 @@ void ResourceAccessState::ApplySemaphore(const SemaphoreScope &signal, const Sem
     // Semaphores only guarantee the first scope of the signal is before the second scope of the wait.
     // If any access isn't in the first scope, there are no guarantees, thus those barriers are cleared
     assert(signal.queue != wait.queue);
-    for (auto &read_access : last_reads) {
-        if (read_access.ReadInQueueScopeOrChain(signal.queue, signal.exec_scope)) {
-            // Deflects WAR on wait queue
-            read_access.barriers = wait.exec_scope;
-        } else {
-            // Leave sync stages alone. Update method will clear unsynchronized stages on subsequent reads as needed.
-            read_access.barriers = VK_PIPELINE_STAGE_2_NONE;
+    if (!last_reads.empty()) {
+        for (auto &read_access : last_reads.Mutable()) {
+            if (read_access.ReadInQueueScopeOrChain(signal.queue, signal.exec_scope)) {
+                // Deflects WAR on wait queue
+                read_access.barriers = wait.exec_scope;
+            } else {
+                // Leave sync stages alone. Update method will clear unsynchronized stages on subsequent reads as needed.
+                read_access.barriers = VK_PIPELINE_STAGE_2_NONE;
+            }
         }
     }
     if (WriteInQueueSourceScopeOrChain(signal.queue, signal.exec_scope, signal.valid_accesses)) {
@@ -645,8 +710,10 @@ bool ResourceAccessState::FirstAccessInTagRange(const ResourceUsageRange &tag_ra
 
 void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
     if (last_write.has_value()) last_write->OffsetTag(offset);
-    for (auto &read_access : last_reads) {
-        read_access.tag += offset;
+    if (!last_reads.empty()) {
+        for (auto &read_access : last_reads.Mutable()) {
+            read_access.tag += offset;
+        }
     }
     for (auto &first : first_accesses_) {
         first.tag += offset;
@@ -671,7 +738,7 @@ VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAcc
     VkPipelineStageFlags2KHR barriers = VK_PIPELINE_STAGE_2_NONE;
 
     for (const auto &read_access : last_reads) {
-        if ((read_access.access & usage_bit).any()) {
+        if (usage_bit[read_access.access_index]) {
             barriers = read_access.barriers;
             break;
         }
@@ -681,9 +748,13 @@ VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAcc
 }
 
 void ResourceAccessState::SetQueueId(QueueId id) {
-    for (auto &read_access : last_reads) {
-        if (read_access.queue == kQueueIdInvalid) {
-            read_access.queue = id;
+    const bool has_unset_queue = std::any_of(last_reads.begin(), last_reads.end(),
+                                             [](const ReadState &read_access) { return read_access.queue == kQueueIdInvalid; });
+    if (has_unset_queue) {
+        for (auto &read_access : last_reads.Mutable()) {
+            if (read_access.queue == kQueueIdInvalid) {
+                read_access.queue = id;
+            }
         }
     }
     if (last_write.has_value()) last_write->SetQueueId(id);
@@ -715,7 +786,10 @@ bool operator<(const ResourceAccessState::ReadState &lhs, const ResourceAccessSt
 }
 
 void ResourceAccessState::Normalize() {
-    std::sort(last_reads.begin(), last_reads.end());
+    if (!std::is_sorted(last_reads.begin(), last_reads.end())) {
+        auto &reads = last_reads.Mutable();
+        std::sort(reads.begin(), reads.end());
+    }
     ClearFirstUse();
 }
 
@@ -792,20 +866,20 @@ void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag,
     }
 }
 
-ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_,
+ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_,
                                           VkPipelineStageFlags2KHR barriers_, ResourceUsageTag tag_)
     : stage(stage_),
-      access(access_),
+      access_index(access_index_),
       barriers(barriers_),
       sync_stages(VK_PIPELINE_STAGE_2_NONE),
       tag(tag_),
       queue(kQueueIdInvalid),
       pending_dep_chain(VK_PIPELINE_STAGE_2_NONE) {}
 
-void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_,
+void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_,
                                          VkPipelineStageFlags2KHR barriers_, ResourceUsageTag tag_) {
     stage = stage_;
-    access = access_;
+    access_index = access_index_;
     barriers = barriers_;
     sync_stages = VK_PIPELINE_STAGE_2_NONE;
     tag = tag_;
@@ -914,7 +988,7 @@ void ResourceAccessWriteState::UpdatePendingLayoutOrdering(const SyncBarrier &ba
 void ResourceAccessWriteState::ClearPending() {
     pending_dep_chain_ = VK_PIPELINE_STAGE_2_NONE;
     pending_barriers_.reset();
-    pending_layout_ordering_ = OrderingBarrier();
+    pending_layout_ordering_ = InternedOrderingBarrier();
 }
 
 void ResourceAccessWriteState::SetQueueId(QueueId id) {
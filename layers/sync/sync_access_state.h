@@ -16,7 +16,13 @@
  */
 
 #pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+
 #include "sync/sync_common.h"
+#include "containers/intern_pool.h"
 
 class ResourceAccessState;
 class ResourceAccessWriteState;
@@ -180,6 +186,74 @@ struct ResourceFirstAccess {
     }
 };
 
+// Process wide set of the SyncStageAccessFlags values stored in access states. Only a few distinct sets are in use at a time
+// (mostly unions of barrier access scopes), so the states store a 32-bit index into the pool instead of the 192-bit mask.
+// Interned sets are never released while a device uses sync validation, which makes Get() lock free. The pool is freed
+// along with the last SyncValidator device.
+class SyncAccessFlagsPool {
+  public:
+    using Pool = vvl::intern_pool<SyncStageAccessFlags>;
+    using Index = Pool::Index;
+    static constexpr Index kEmpty = Pool::kDefault;
+
+    // Returns kEmpty and sets Overflowed() when the pool is full, which SyncValidator reports as an error
+    static Index Intern(const SyncStageAccessFlags &flags);
+    static const SyncStageAccessFlags &Get(Index index) { return pool_->Get(index); }
+    static size_t Size();
+    static bool Overflowed() { return overflowed_.load(std::memory_order_relaxed); }
+
+    // Held by every SyncValidator device
+    static void AddReference();
+    static void RemoveReference();
+    struct Reference {
+        Reference() { AddReference(); }
+        ~Reference() { RemoveReference(); }
+        Reference(const Reference &) = delete;
+        Reference &operator=(const Reference &) = delete;
+    };
+
+  private:
+    // Millions of distinct sets are never seen in practice
+    static constexpr uint32_t kMaxChunks = 4096;
+
+    static std::mutex reference_lock_;
+    static uint32_t reference_count_;
+    static Pool *pool_;
+    static std::atomic<bool> overflowed_;
+};
+
+// A SyncStageAccessFlags value stored as its SyncAccessFlagsPool index. Equal sets have equal indices.
+class InternedAccessFlags {
+  public:
+    InternedAccessFlags() = default;
+    InternedAccessFlags(const SyncStageAccessFlags &flags) : index_(SyncAccessFlagsPool::Intern(flags)) {}
+
+    const SyncStageAccessFlags &Get() const { return SyncAccessFlagsPool::Get(index_); }
+    bool operator[](size_t bit) const { return Get()[bit]; }
+    bool any() const { return index_ != SyncAccessFlagsPool::kEmpty; }
+    bool none() const { return index_ == SyncAccessFlagsPool::kEmpty; }
+    void reset() { index_ = SyncAccessFlagsPool::kEmpty; }
+
+    InternedAccessFlags &operator|=(const SyncStageAccessFlags &rhs) {
+        const SyncStageAccessFlags &current = Get();
+        if ((rhs & ~current).any()) {
+            index_ = SyncAccessFlagsPool::Intern(current | rhs);
+        }
+        return *this;
+    }
+    InternedAccessFlags &operator|=(const InternedAccessFlags &rhs) {
+        if (index_ != rhs.index_) {
+            *this |= rhs.Get();
+        }
+        return *this;
+    }
+    bool operator==(const InternedAccessFlags &rhs) const { return index_ == rhs.index_; }
+    bool operator!=(const InternedAccessFlags &rhs) const { return index_ != rhs.index_; }
+
+  private:
+    SyncAccessFlagsPool::Index index_ = SyncAccessFlagsPool::kEmpty;
+};
+
 using QueueId = uint32_t;
 struct OrderingBarrier {
     VkPipelineStageFlags2KHR exec_scope;
@@ -198,6 +272,28 @@ struct OrderingBarrier {
     }
 };
 
+// OrderingBarrier as stored in the access states
+struct InternedOrderingBarrier {
+    VkPipelineStageFlags2KHR exec_scope = VK_PIPELINE_STAGE_2_NONE;
+    InternedAccessFlags access_scope;
+    InternedOrderingBarrier() = default;
+    InternedOrderingBarrier(const OrderingBarrier &barrier) : exec_scope(barrier.exec_scope), access_scope(barrier.access_scope) {}
+    operator OrderingBarrier() const { return OrderingBarrier(exec_scope, access_scope.Get()); }
+    InternedOrderingBarrier &operator|=(const OrderingBarrier &rhs) {
+        exec_scope |= rhs.exec_scope;
+        access_scope |= rhs.access_scope;
+        return *this;
+    }
+    InternedOrderingBarrier &operator|=(const InternedOrderingBarrier &rhs) {
+        exec_scope |= rhs.exec_scope;
+        access_scope |= rhs.access_scope;
+        return *this;
+    }
+    bool operator==(const InternedOrderingBarrier &rhs) const {
+        return (exec_scope == rhs.exec_scope) && (access_scope == rhs.access_scope);
+    }
+};
+
 using ResourceUsageTagSet = CachedInsertSet<ResourceUsageTag, 4>;
 
 class ResourceAccessWriteState {
@@ -222,7 +318,7 @@ class ResourceAccessWriteState {
     bool IsIndex(SyncStageAccessIndex usage_index) const { return Index() == usage_index; }
     bool IsQueue(QueueId other_queue) const { return queue_ == other_queue; }
     const SyncStageAccessInfoType &Access() const { return *access_; }
-    const SyncStageAccessFlags &Barriers() const { return barriers_; }
+    const SyncStageAccessFlags &Barriers() const { return barriers_.Get(); }
     ResourceUsageTag Tag() const { return tag_; }
     bool IsWriteHazard(const SyncStageAccessInfoType &usage_info) const;
     bool IsOrdered(const OrderingBarrier &ordering, QueueId queue_id) const;
@@ -240,24 +336,139 @@ class ResourceAccessWriteState {
     void UpdatePendingBarriers(const SyncBarrier &barrier);
     void ApplyPendingBarriers();
     void UpdatePendingLayoutOrdering(const SyncBarrier &barrier);
-    const OrderingBarrier &GetPendingLayoutOrdering() const { return pending_layout_ordering_; }
+    OrderingBarrier GetPendingLayoutOrdering() const { return pending_layout_ordering_; }
 
   private:
     const SyncStageAccessInfoType *access_;
-    SyncStageAccessFlags barriers_;  // union of applicable barrier masks since last write
+    InternedAccessFlags barriers_;  // union of applicable barrier masks since last write
     ResourceUsageTag tag_;
     QueueId queue_;
     // intially zero, but accumulating the dstStages of barriers if they chain.
     VkPipelineStageFlags2KHR dependency_chain_;
 
     // Write specific layout state
-    OrderingBarrier pending_layout_ordering_;
+    InternedOrderingBarrier pending_layout_ordering_;
     VkPipelineStageFlags2KHR pending_dep_chain_;
-    SyncStageAccessFlags pending_barriers_;
+    InternedAccessFlags pending_barriers_;
 
     friend ResourceAccessState;
 };
 
+// Counters reported when VK_SYNCVAL_DEBUG_MEMORY_REPORT is set, they are left untouched unless a device enabled them
+struct SyncAccessMemoryStats {
+    inline static std::atomic<bool> enabled{false};
+    inline static std::atomic<int64_t> read_lists{0};        // read state lists currently allocated
+    inline static std::atomic<int64_t> read_list_copies{0};  // shared read state lists cloned on write
+
+    static bool Enabled() { return enabled.load(std::memory_order_relaxed); }
+};
+
+// Read state list shared between copies of an access state. Access states are copied on every range split, context
+// import and replay of recorded first accesses, while their reads are rarely changed afterwards, so the copies point to
+// the same list until one of them is written through Mutable(). An empty list holds no allocation.
+//
+// Copies may be released by other threads (parallel submit validation), so the list is only written in place once the
+// reference count read with acquire ordering is 1, which orders the write after the reads of the released copies.
+template <typename ReadState>
+class SharedReadStates {
+  public:
+    using Storage = small_vector<ReadState, 3, uint32_t>;
+    using const_iterator = typename Storage::const_iterator;
+
+    SharedReadStates() = default;
+    SharedReadStates(const SharedReadStates &other) : list_(other.list_) { AddReference(); }
+    SharedReadStates(SharedReadStates &&other) noexcept : list_(std::exchange(other.list_, nullptr)) {}
+    ~SharedReadStates() { RemoveReference(); }
+    SharedReadStates &operator=(const SharedReadStates &rhs) {
+        if (list_ != rhs.list_) {
+            RemoveReference();
+            list_ = rhs.list_;
+            AddReference();
+        }
+        return *this;
+    }
+    SharedReadStates &operator=(SharedReadStates &&rhs) noexcept {
+        if (this != &rhs) {
+            RemoveReference();
+            list_ = std::exchange(rhs.list_, nullptr);
+        }
+        return *this;
+    }
+    SharedReadStates &operator=(Storage &&reads) {
+        RemoveReference();
+        list_ = reads.empty() ? nullptr : new List(std::move(reads));
+        return *this;
+    }
+
+    const_iterator begin() const { return list_ ? list_->reads.begin() : nullptr; }
+    const_iterator end() const { return list_ ? list_->reads.end() : nullptr; }
+    uint32_t size() const { return list_ ? list_->reads.size() : 0; }
+    bool empty() const { return size() == 0; }
+    const ReadState &operator[](uint32_t index) const { return list_->reads[index]; }
+    void clear() {
+        RemoveReference();
+        list_ = nullptr;
+    }
+    // Whether other copies point to the same list
+    bool IsShared() const { return list_ && list_->references.load(std::memory_order_acquire) > 1; }
+
+    // Returns the list for modification, cloning it first if it is shared
+    Storage &Mutable() {
+        if (!list_) {
+            list_ = new List();
+        } else if (IsShared()) {
+            List *copy = new List(list_->reads);
+            RemoveReference();
+            list_ = copy;
+            if (SyncAccessMemoryStats::Enabled()) {
+                SyncAccessMemoryStats::read_list_copies.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        return list_->reads;
+    }
+
+    bool operator==(const SharedReadStates &rhs) const {
+        if (list_ == rhs.list_) {
+            return true;
+        }
+        return (size() == rhs.size()) && std::equal(begin(), end(), rhs.begin());
+    }
+    bool operator!=(const SharedReadStates &rhs) const { return !(*this == rhs); }
+
+  private:
+    struct List {
+        Storage reads;
+        std::atomic<uint32_t> references{1};
+        // Remembered so that a list allocated before the counters were enabled is not subtracted from them
+        const bool counted = SyncAccessMemoryStats::Enabled();
+
+        List() { Count(1); }
+        explicit List(Storage &&reads_) : reads(std::move(reads_)) { Count(1); }
+        explicit List(const Storage &reads_) : reads(reads_) { Count(1); }
+        ~List() { Count(-1); }
+
+        void Count(int64_t delta) const {
+            if (counted) {
+                SyncAccessMemoryStats::read_lists.fetch_add(delta, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    void AddReference() {
+        if (list_) {
+            list_->references.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    void RemoveReference() {
+        // The release half publishes this copy's reads of the list to the owner which later sees a count of 1
+        if (list_ && list_->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete list_;
+        }
+    }
+
+    List *list_ = nullptr;
+};
+
 class ResourceAccessState : public SyncStageAccess {
   protected:
     using OrderingBarriers = std::array<OrderingBarrier, static_cast<size_t>(SyncOrdering::kNumOrderings)>;
@@ -270,8 +481,7 @@ class ResourceAccessState : public SyncStageAccess {
     // and applicable one for hazard detection
     struct ReadState {
         VkPipelineStageFlags2KHR stage;        // The stage of this read
-        SyncStageAccessFlags access;           // TODO: Change to FlagBits when we have a None bit enum
-                                               // TODO: Revisit whether this needs to support multiple reads per stage
+        SyncStageAccessIndex access_index;     // TODO: Revisit whether this needs to support multiple reads per stage
         VkPipelineStageFlags2KHR barriers;     // all applicable barriered stages
         VkPipelineStageFlags2KHR sync_stages;  // reads known to have happened after this
         ResourceUsageTag tag;
@@ -279,10 +489,10 @@ class ResourceAccessState : public SyncStageAccess {
         VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
                                                      // Excluded from comparison
         ReadState() = default;
-        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_, VkPipelineStageFlags2KHR barriers_,
+        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_, VkPipelineStageFlags2KHR barriers_,
                   ResourceUsageTag tag_);
         bool operator==(const ReadState &rhs) const {
-            return (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) &&
+            return (stage == rhs.stage) && (access_index == rhs.access_index) && (barriers == rhs.barriers) &&
                    (sync_stages == rhs.sync_stages) && (tag == rhs.tag) && (queue == rhs.queue) &&
                    (pending_dep_chain == rhs.pending_dep_chain);
         }
@@ -317,8 +527,9 @@ class ResourceAccessState : public SyncStageAccess {
         }
 
         bool operator!=(const ReadState &rhs) const { return !(*this == rhs); }
-        void Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_, VkPipelineStageFlags2KHR barriers_,
+        void Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_, VkPipelineStageFlags2KHR barriers_,
                  ResourceUsageTag tag_);
+        SyncStageAccessFlags Access() const { return FlagBit(access_index); }
         bool ReadInScopeOrChain(VkPipelineStageFlags2 exec_scope) const { return (exec_scope & (stage | barriers)) != 0; }
         bool ReadInQueueScopeOrChain(QueueId queue, VkPipelineStageFlags2 exec_scope) const;
         bool ReadInEventScope(VkPipelineStageFlags2 exec_scope, QueueId scope_queue, ResourceUsageTag scope_tag) const {
@@ -503,7 +714,7 @@ class ResourceAccessState : public SyncStageAccess {
 
     VkPipelineStageFlags2KHR last_read_stages;
     VkPipelineStageFlags2KHR read_execution_barriers;
-    using ReadStates = small_vector<ReadState, 3, uint32_t>;
+    using ReadStates = SharedReadStates<ReadState>;
     ReadStates last_reads;
 
     // TODO Input Attachment cleanup for multiple reads in a given stage
@@ -516,13 +727,16 @@ class ResourceAccessState : public SyncStageAccess {
 
     FirstAccesses first_accesses_;
     VkPipelineStageFlags2KHR first_read_stages_;
-    OrderingBarrier first_write_layout_ordering_;
+    InternedOrderingBarrier first_write_layout_ordering_;
     bool first_access_closed_;
 
     static OrderingBarriers kOrderingRules;
 };
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
-using ResourceAccessRangeMap = sparse_container::range_map<ResourceAddress, ResourceAccessState>;
+// Access maps are split and infilled on nearly every recorded command, so their nodes come from a per map arena
+using ResourceAccessRangeMap =
+    sparse_container::range_map<ResourceAddress, ResourceAccessState, ResourceAccessRange,
+                                sparse_container::arena_map<ResourceAddress, ResourceAccessState>>;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
 
 // Apply the memory barrier without updating the existing barriers.  The execution barrier
@@ -554,7 +768,7 @@ void ResourceAccessState::ApplyBarrier(ScopeOps &&scope, const SyncBarrier &barr
             // don't need to be tracked as we're just going to clear them.
             VkPipelineStageFlags2 stages_in_scope = VK_PIPELINE_STAGE_2_NONE;
 
-            for (auto &read_access : last_reads) {
+            for (const auto &read_access : last_reads) {
                 // The | implements the "dependency chain" logic for this access, as the barriers field stores the second sync
                 // scope
                 if (scope.ReadInScope(barrier, read_access)) {
@@ -563,13 +777,16 @@ void ResourceAccessState::ApplyBarrier(ScopeOps &&scope, const SyncBarrier &barr
                 }
             }
 
-            for (auto &read_access : last_reads) {
-                if (0 != ((read_access.stage | read_access.sync_stages) & stages_in_scope)) {
-                    // If this stage, or any stage known to be synchronized after it are in scope, apply the barrier to this
-                    // read NOTE: Forwarding barriers to known prior stages changes the sync_stages from shallow to deep,
-                    // because the
-                    //       barriers used to determine sync_stages have been propagated to all known earlier stages
-                    read_access.ApplyReadBarrier(barrier.dst_exec_scope.exec_scope);
+            // Only unshare the read states when the barrier applies to any of them
+            if (stages_in_scope != VK_PIPELINE_STAGE_2_NONE) {
+                for (auto &read_access : last_reads.Mutable()) {
+                    if (0 != ((read_access.stage | read_access.sync_stages) & stages_in_scope)) {
+                        // If this stage, or any stage known to be synchronized after it are in scope, apply the barrier to this
+                        // read NOTE: Forwarding barriers to known prior stages changes the sync_stages from shallow to deep,
+                        // because the
+                        //       barriers used to determine sync_stages have been propagated to all known earlier stages
+                        read_access.ApplyReadBarrier(barrier.dst_exec_scope.exec_scope);
+                    }
                 }
             }
         }
@@ -583,7 +800,7 @@ bool ResourceAccessState::ApplyPredicatedWait(Predicate &predicate) {
 
     // Use the predicate to build a mask of the read stages we are synchronizing
     // Use the sync_stages to also detect reads known to be before any synchronized reads (first pass)
-    for (auto &read_access : last_reads) {
+    for (const auto &read_access : last_reads) {
         if (predicate(read_access)) {
             // If we know this stage is before any stage we syncing, or if the predicate tells us that we are waited for..
             sync_reads |= read_access.stage;
@@ -593,7 +810,7 @@ bool ResourceAccessState::ApplyPredicatedWait(Predicate &predicate) {
     // Now that we know the reads directly in scopejust need to go over the list again to pick up the "known earlier" stages.
     // NOTE: sync_stages is "deep" catching all stages synchronized after it because we forward barriers
     uint32_t unsync_count = 0;
-    for (auto &read_access : last_reads) {
+    for (const auto &read_access : last_reads) {
         if (0 != ((read_access.stage | read_access.sync_stages) & sync_reads)) {
             // This is redundant in the "stage" case, but avoids a second branch to get an accurate count
             sync_reads |= read_access.stage;
@@ -605,10 +822,10 @@ bool ResourceAccessState::ApplyPredicatedWait(Predicate &predicate) {
     if (unsync_count) {
         if (sync_reads) {
             // When have some remaining unsynchronized reads, we have to rewrite the last_reads array.
-            ReadStates unsync_reads;
+            ReadStates::Storage unsync_reads;
             unsync_reads.reserve(unsync_count);
             VkPipelineStageFlags2KHR unsync_read_stages = VK_PIPELINE_STAGE_2_NONE;
-            for (auto &read_access : last_reads) {
+            for (const auto &read_access : last_reads) {
                 if (0 == (read_access.stage & sync_reads)) {
                     unsync_reads.emplace_back(read_access);
                     unsync_read_stages |= read_access.stage;
@@ -830,8 +830,6 @@ ResourceUsageTag CommandBufferAccessContext::RecordEndRenderPass(vvl::Func comma
     return barrier_tag;
 }
 
-void CommandBufferAccessContext::RecordDestroyEvent(vvl::Event *event_state) { GetCurrentEventsContext()->Destroy(event_state); }
-
 void CommandBufferAccessContext::RecordExecutedCommandBuffer(const CommandBufferAccessContext &recorded_cb_context) {
     const AccessContext *recorded_context = recorded_cb_context.GetCurrentAccessContext();
     assert(recorded_context);
@@ -1201,16 +1199,3 @@ void syncval_state::CommandBuffer::Reset() {
     vvl::CommandBuffer::Reset();
     access_context.Reset();
 }
-
-void syncval_state::CommandBuffer::NotifyInvalidate(const vvl::StateObject::NodeList &invalid_nodes, bool unlink) {
-    for (auto &obj : invalid_nodes) {
-        switch (obj->Type()) {
-            case kVulkanObjectTypeEvent:
-                access_context.RecordDestroyEvent(static_cast<vvl::Event *>(obj.get()));
-                break;
-            default:
-                break;
-        }
-        vvl::CommandBuffer::NotifyInvalidate(invalid_nodes, unlink);
-    }
-}
@@ -317,7 +317,6 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
 
     ResourceUsageTag RecordNextSubpass(vvl::Func command);
     ResourceUsageTag RecordEndRenderPass(vvl::Func command);
-    void RecordDestroyEvent(vvl::Event *event_state);
 
     void RecordExecutedCommandBuffer(const CommandBufferAccessContext &recorded_context);
     void ResolveExecutedCommandBuffer(const AccessContext &recorded_context, ResourceUsageTag offset);
@@ -423,8 +422,6 @@ class CommandBuffer : public vvl::CommandBuffer {
                   const vvl::CommandPool *pool);
     ~CommandBuffer() { Destroy(); }
 
-    void NotifyInvalidate(const vvl::StateObject::NodeList &invalid_nodes, bool unlink) override;
-
     void Destroy() override;
     void Reset() override;
 };
@@ -1231,18 +1231,23 @@ bool ReplayState::DetectFirstUseHazard(const ResourceUsageRange &first_use_range
         // we need to fetch the current access context each time
         hazard = GetRecordedAccessContext()->DetectFirstUseHazard(exec_context_.GetQueueId(), first_use_range,
                                                                   *exec_context_.GetCurrentAccessContext());
+        skip |= ReportFirstUseHazard(hazard);
+    }
+    return skip;
+}
 
-        if (hazard.IsHazard()) {
-            const SyncValidator &sync_state = exec_context_.GetSyncState();
-            const auto handle = exec_context_.Handle();
-            const VkCommandBuffer recorded_handle = recorded_context_.GetCBState().VkHandle();
-            skip |= sync_state.LogError(
-                string_SyncHazardVUID(hazard.Hazard()), handle, error_obj_.location,
-                "Hazard %s for entry %" PRIu32 ", %s, %s access info %s. Access info %s.", string_SyncHazard(hazard.Hazard()),
-                index_, sync_state.FormatHandle(recorded_handle).c_str(), exec_context_.ExecutionTypeString(),
-                recorded_context_.FormatUsage(exec_context_.ExecutionUsageString(), *hazard.RecordedAccess()).c_str(),
-                exec_context_.FormatHazard(hazard).c_str());
-        }
+bool ReplayState::ReportFirstUseHazard(const HazardResult &hazard) const {
+    bool skip = false;
+    if (hazard.IsHazard()) {
+        const SyncValidator &sync_state = exec_context_.GetSyncState();
+        const auto handle = exec_context_.Handle();
+        const VkCommandBuffer recorded_handle = recorded_context_.GetCBState().VkHandle();
+        skip |= sync_state.LogError(
+            string_SyncHazardVUID(hazard.Hazard()), handle, error_obj_.location,
+            "Hazard %s for entry %" PRIu32 ", %s, %s access info %s. Access info %s.", string_SyncHazard(hazard.Hazard()), index_,
+            sync_state.FormatHandle(recorded_handle).c_str(), exec_context_.ExecutionTypeString(),
+            recorded_context_.FormatUsage(exec_context_.ExecutionUsageString(), *hazard.RecordedAccess()).c_str(),
+            exec_context_.FormatHazard(hazard).c_str());
     }
     return skip;
 }
@@ -427,6 +427,7 @@ class ReplayState {
 
     bool ValidateFirstUse();
     bool DetectFirstUseHazard(const ResourceUsageRange &first_use_range) const;
+    bool ReportFirstUseHazard(const HazardResult &hazard) const;
 
     ReplayState(CommandExecutionContext &exec_context, const CommandBufferAccessContext &recorded_context,
                 const ErrorObject &error_object, uint32_t index);
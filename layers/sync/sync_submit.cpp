@@ -650,30 +650,140 @@ void QueueBatchContext::SetTagBias(ResourceUsageTag bias) {
     }
 }
 
+namespace {
+// Sorted and coalesced address ranges imported into a batch context
+class ImportedRanges {
+  public:
+    bool Intersects(const ResourceAccessRangeMap& map) const {
+        auto range_it = ranges_.cbegin();
+        auto map_it = map.cbegin();
+        while (range_it != ranges_.cend() && map_it != map.cend()) {
+            if (range_it->intersects(map_it->first)) return true;
+            if (range_it->end <= map_it->first.begin) {
+                ++range_it;
+            } else {
+                ++map_it;
+            }
+        }
+        return false;
+    }
+    void Add(const ResourceAccessRangeMap& map) {
+        std::vector<ResourceAccessRange> merged;
+        merged.reserve(ranges_.size() + map.size());
+        auto append = [&merged](const ResourceAccessRange& range) {
+            if (!merged.empty() && merged.back().end >= range.begin) {
+                merged.back().end = std::max(merged.back().end, range.end);
+            } else {
+                merged.emplace_back(range);
+            }
+        };
+        auto range_it = ranges_.cbegin();
+        auto map_it = map.cbegin();
+        while (range_it != ranges_.cend() || map_it != map.cend()) {
+            if (map_it == map.cend() || (range_it != ranges_.cend() && range_it->begin < map_it->first.begin)) {
+                append(*range_it++);
+            } else {
+                append((map_it++)->first);
+            }
+        }
+        ranges_ = std::move(merged);
+    }
+
+  private:
+    std::vector<ResourceAccessRange> ranges_;
+};
+}  // namespace
+
+// Without sync ops the whole command buffer is validated by a single first use hazard check
+static bool IsParallelFirstUseCandidate(const QueueBatchContext::CmdBufferEntry& cb) {
+    const auto& cb_access_context = cb.cb->access_context;
+    return (cb_access_context.GetTagLimit() != 0) && cb_access_context.GetSyncOps().empty();
+}
+
+// Fewer command buffers than this are not worth the thread startup
+static constexpr size_t kMinParallelFirstUseCommandBuffers = 4;
+
 bool QueueBatchContext::DoQueueSubmitValidate(const SyncValidator& sync_state, QueueSubmitCmdState& cmd_state,
                                               const VkSubmitInfo2& batch_info) {
     bool skip = false;
 
     //  For each submit in the batch...
-    for (const auto& cb : command_buffers_) {
-        const auto& cb_access_context = cb.cb->access_context;
-        if (cb_access_context.GetTagLimit() == 0) {  // skip CBs without tagged commands
-            // Command buffer might still contain label commands
-            vvl::CommandBuffer::ReplayLabelCommands(cb.cb->GetLabelCommands(), *current_label_stack_);
-            // Skip index for correct reporting
-            batch_.cb_index++;
-            continue;
+    const bool allow_parallel = sync_state.submit_validation_thread_pool && ValidForSyncOps();
+    size_t cb_index = 0;
+    while (cb_index < command_buffers_.size()) {
+        size_t run_end = cb_index;
+        if (allow_parallel) {
+            while (run_end < command_buffers_.size() && IsParallelFirstUseCandidate(command_buffers_[run_end])) {
+                ++run_end;
+            }
+        }
+        if (run_end - cb_index >= kMinParallelFirstUseCommandBuffers) {
+            skip |= ValidateSubmittedCommandBuffersParallel(sync_state, cmd_state.error_obj, cb_index, run_end);
+            cb_index = run_end;
+        } else {
+            skip |= ValidateSubmittedCommandBuffer(command_buffers_[cb_index], cmd_state.error_obj);
+            ++cb_index;
         }
-        skip |= ReplayState(*this, cb_access_context, cmd_state.error_obj, cb.index).ValidateFirstUse();
+    }
+    return skip;
+}
 
-        // The barriers have already been applied in ValidatFirstUse
-        ResourceUsageRange tag_range = ImportRecordedAccessLog(cb_access_context);
-        ResolveSubmittedCommandBuffer(*cb_access_context.GetCurrentAccessContext(), tag_range.begin);
+bool QueueBatchContext::ValidateSubmittedCommandBuffer(const CmdBufferEntry& cb, const ErrorObject& error_obj) {
+    const auto& cb_access_context = cb.cb->access_context;
+    if (cb_access_context.GetTagLimit() == 0) {  // skip CBs without tagged commands
+        // Command buffer might still contain label commands
         vvl::CommandBuffer::ReplayLabelCommands(cb.cb->GetLabelCommands(), *current_label_stack_);
+        // Skip index for correct reporting
+        batch_.cb_index++;
+        return false;
     }
+    const bool skip = ReplayState(*this, cb_access_context, error_obj, cb.index).ValidateFirstUse();
+
+    // The barriers have already been applied in ValidatFirstUse
+    ImportSubmittedCommandBuffer(cb);
     return skip;
 }
 
+// Detects the first use hazards of command buffers without sync ops concurrently against the batch state from before
+// the run. Results are reported and the command buffers imported in submission order, so the output matches the serial
+// path. A command buffer touching memory imported from an earlier one of the run is checked again against the updated
+// state.
+bool QueueBatchContext::ValidateSubmittedCommandBuffersParallel(const SyncValidator& sync_state, const ErrorObject& error_obj,
+                                                                size_t begin, size_t end) {
+    const AccessContext& snapshot = *GetCurrentAccessContext();
+    const QueueId queue_id = GetQueueId();
+    const ResourceUsageRange all_tags(0, ResourceUsageRecord::kMaxIndex);
+    std::vector<HazardResult> hazards(end - begin);
+    sync_state.submit_validation_thread_pool->ParallelFor(hazards.size(), [&](size_t index) {
+        const auto& recorded_context = *command_buffers_[begin + index].cb->access_context.GetCurrentAccessContext();
+        hazards[index] = recorded_context.DetectFirstUseHazard(queue_id, all_tags, snapshot);
+    });
+
+    bool skip = false;
+    ImportedRanges imported;
+    for (size_t index = 0; index < hazards.size(); ++index) {
+        const CmdBufferEntry& cb = command_buffers_[begin + index];
+        const auto& cb_access_context = cb.cb->access_context;
+        const auto& recorded_map = cb_access_context.GetCurrentAccessContext()->GetAccessStateMap();
+        ReplayState replay(*this, cb_access_context, error_obj, cb.index);
+        if (imported.Intersects(recorded_map)) {
+            skip |= replay.ValidateFirstUse();
+        } else {
+            skip |= replay.ReportFirstUseHazard(hazards[index]);
+        }
+        imported.Add(recorded_map);
+        ImportSubmittedCommandBuffer(cb);
+    }
+    return skip;
+}
+
+void QueueBatchContext::ImportSubmittedCommandBuffer(const CmdBufferEntry& cb) {
+    const auto& cb_access_context = cb.cb->access_context;
+    ResourceUsageRange tag_range = ImportRecordedAccessLog(cb_access_context);
+    ResolveSubmittedCommandBuffer(*cb_access_context.GetCurrentAccessContext(), tag_range.begin);
+    vvl::CommandBuffer::ReplayLabelCommands(cb.cb->GetLabelCommands(), *current_label_stack_);
+}
+
 QueueBatchContext::PresentResourceRecord::Base_::Record QueueBatchContext::PresentResourceRecord::MakeRecord() const {
     return std::make_unique<PresentResourceRecord>(presented_);
 }
@@ -316,6 +316,10 @@ class QueueBatchContext : public CommandExecutionContext {
                                                                SignaledSemaphores &signaled);
 
     void ImportSyncTags(const QueueBatchContext &from);
+    bool ValidateSubmittedCommandBuffer(const CmdBufferEntry &cb, const ErrorObject &error_obj);
+    bool ValidateSubmittedCommandBuffersParallel(const SyncValidator &sync_state, const ErrorObject &error_obj, size_t begin,
+                                                 size_t end);
+    void ImportSubmittedCommandBuffer(const CmdBufferEntry &cb);
     const QueueSyncState *queue_state_ = nullptr;
     ResourceUsageRange tag_range_ = ResourceUsageRange(0, 0);  // Range of tags referenced by cbs_referenced
 
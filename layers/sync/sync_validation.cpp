@@ -25,6 +25,22 @@
 #include "state_tracker/device_state.h"
 #include "state_tracker/buffer_state.h"
 
+ReadLockGuard SyncValidator::ReadLock() const {
+    if (fine_grained_locking) {
+        return ReadLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return ReadLockGuard(validation_object_mutex);
+    }
+}
+
+WriteLockGuard SyncValidator::WriteLock() {
+    if (fine_grained_locking) {
+        return WriteLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return WriteLockGuard(validation_object_mutex);
+    }
+}
+
 ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const {
     ResourceUsageRange reserve;
     reserve.begin = tag_limit_.fetch_add(tag_count);
@@ -86,23 +102,29 @@ void SyncValidator::UpdateFenceWaitInfo(VkFence fence, const PresentedImage &ima
 
 void SyncValidator::UpdateFenceWaitInfo(std::shared_ptr<const vvl::Fence> &fence_state, FenceSyncState &&wait_info) {
     if (vvl::StateObject::Invalid(fence_state)) return;
+    WriteLockGuard guard(waitable_fences_lock_);
     waitable_fences_[fence_state->VkHandle()] = std::move(wait_info);
 }
 
 void SyncValidator::WaitForFence(VkFence fence) {
-    auto fence_it = waitable_fences_.find(fence);
-    if (fence_it != waitable_fences_.end()) {
-        // The fence may no longer be waitable for several valid reasons.
-        FenceSyncState &wait_for = fence_it->second;
-        if (wait_for.acquired.Invalid()) {
-            // This is just a normal fence wait
-            ApplyTaggedWait(wait_for.queue_id, wait_for.tag);
-        } else {
-            // This a fence wait for a present operation
-            ApplyAcquireWait(wait_for.acquired);
-        }
+    FenceSyncState wait_for;
+    {
+        WriteLockGuard fences_guard(waitable_fences_lock_);
+        auto fence_it = waitable_fences_.find(fence);
+        if (fence_it == waitable_fences_.end()) return;
+        wait_for = std::move(fence_it->second);
         waitable_fences_.erase(fence_it);
     }
+
+    // The fence may no longer be waitable for several valid reasons.
+    WriteLockGuard queue_guard(queue_sync_lock_);
+    if (wait_for.acquired.Invalid()) {
+        // This is just a normal fence wait
+        ApplyTaggedWait(wait_for.queue_id, wait_for.tag);
+    } else {
+        // This a fence wait for a present operation
+        ApplyAcquireWait(wait_for.acquired);
+    }
 }
 
 void SyncValidator::UpdateSyncImageMemoryBindState(uint32_t count, const VkBindImageMemoryInfo *infos) {
@@ -166,7 +188,7 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer,
                                                  uint32_t regionCount, const VkBufferCopy *pRegions,
                                                  const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -207,7 +229,7 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer(VkCommandBuffer commandBuffer,
 
 void SyncValidator::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                                uint32_t regionCount, const VkBufferCopy *pRegions, const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -233,7 +255,7 @@ void SyncValidator::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, Vk
 bool SyncValidator::PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfo,
                                                   const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -279,7 +301,7 @@ bool SyncValidator::PreCallValidateCmdCopyBuffer2KHR(VkCommandBuffer commandBuff
 }
 
 void SyncValidator::RecordCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR *pCopyBufferInfo, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -316,7 +338,7 @@ bool SyncValidator::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, V
                                                 VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                                 const VkImageCopy *pRegions, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -361,7 +383,7 @@ bool SyncValidator::PreCallValidateCmdCopyImage(VkCommandBuffer commandBuffer, V
 void SyncValidator::PreCallRecordCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
                                               VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                               const VkImageCopy *pRegions, const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -388,7 +410,7 @@ void SyncValidator::PreCallRecordCmdCopyImage(VkCommandBuffer commandBuffer, VkI
 bool SyncValidator::PreCallValidateCmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2 *pCopyImageInfo,
                                                  const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -437,7 +459,7 @@ bool SyncValidator::PreCallValidateCmdCopyImage2KHR(VkCommandBuffer commandBuffe
 }
 
 void SyncValidator::RecordCmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2KHR *pCopyImageInfo, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -477,7 +499,7 @@ bool SyncValidator::PreCallValidateCmdPipelineBarrier(
     uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
     const VkImageMemoryBarrier *pImageMemoryBarriers, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -495,7 +517,7 @@ void SyncValidator::PreCallRecordCmdPipelineBarrier(
     VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers,
     uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount,
     const VkImageMemoryBarrier *pImageMemoryBarriers, const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -514,7 +536,7 @@ bool SyncValidator::PreCallValidateCmdPipelineBarrier2KHR(VkCommandBuffer comman
 bool SyncValidator::PreCallValidateCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo,
                                                        const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -527,7 +549,7 @@ bool SyncValidator::PreCallValidateCmdPipelineBarrier2(VkCommandBuffer commandBu
 
 void SyncValidator::PreCallRecordCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR *pDependencyInfo,
                                                         const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -538,7 +560,7 @@ void SyncValidator::PreCallRecordCmdPipelineBarrier2KHR(VkCommandBuffer commandB
 
 void SyncValidator::PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo,
                                                      const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -550,6 +572,7 @@ void SyncValidator::PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuff
 void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) {
     // The state tracker sets up the device state
     StateTracker::CreateDevice(pCreateInfo, loc);
+    access_flags_pool_reference_.emplace();
 
     ForEachShared<vvl::Queue>([this](const std::shared_ptr<vvl::Queue> &queue_state) {
         auto queue_flags = physical_device_state->queue_family_properties[queue_state->queueFamilyIndex].queueFlags;
@@ -568,12 +591,37 @@ void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Lo
     }
     debug_cmdbuf_pattern = GetEnvironment("VK_SYNCVAL_DEBUG_CMDBUF_PATTERN");
     vvl::ToLower(debug_cmdbuf_pattern);
+    debug_memory_report = !GetEnvironment("VK_SYNCVAL_DEBUG_MEMORY_REPORT").empty();
+    if (debug_memory_report) {
+        SyncAccessMemoryStats::enabled.store(true, std::memory_order_relaxed);
+    }
+
+    // Zero and values past the limit are clamped instead of failing device creation
+    const uint32_t max_submit_validation_threads = 64;
+    const uint32_t submit_validation_threads =
+        std::clamp(syncval_settings.submit_validation_threads, 1u, max_submit_validation_threads);
+    if (submit_validation_threads > 1) {
+        submit_validation_thread_pool = std::make_unique<vvl::ThreadPool>(submit_validation_threads - 1);
+    }
+}
+
+// VK_SYNCVAL_DEBUG_MEMORY_REPORT: report the access state storage counters when the device is destroyed
+void SyncValidator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
+                                               const RecordObject &record_obj) {
+    if (debug_memory_report) {
+        LogInfo("SYNCVAL_DEBUG_MEMORY", LogObjectList(device), record_obj.location,
+                "Interned access flag sets: %zu, live read state lists: %" PRId64 ", read state lists copied on write: %" PRId64,
+                SyncAccessFlagsPool::Size(), SyncAccessMemoryStats::read_lists.load(),
+                SyncAccessMemoryStats::read_list_copies.load());
+    }
+    StateTracker::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
+    submit_validation_thread_pool.reset();
 }
 
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                             const VkSubpassBeginInfo *pSubpassBeginInfo, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     if (cb_state) {
         SyncOpBeginRenderPass sync_op(error_obj.location.function, *this, pRenderPassBegin, pSubpassBeginInfo);
         skip |= sync_op.Validate(cb_state->access_context);
@@ -611,14 +659,14 @@ void SyncValidator::PostCallRecordBeginCommandBuffer(VkCommandBuffer commandBuff
     StateTracker::PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
 
     // Create/initialize the structure that trackers accesses at the command buffer scope.
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     cb_state->access_context.Reset();
 }
 
 void SyncValidator::RecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                              const VkSubpassBeginInfo *pSubpassBeginInfo, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     if (cb_state) {
         cb_state->access_context.RecordSyncOp<SyncOpBeginRenderPass>(command, *this, pRenderPassBegin, pSubpassBeginInfo);
     }
@@ -649,7 +697,7 @@ bool SyncValidator::ValidateCmdNextSubpass(VkCommandBuffer commandBuffer, const
                                            const VkSubpassEndInfo *pSubpassEndInfo, const ErrorObject &error_obj) const {
     bool skip = false;
 
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -682,7 +730,7 @@ bool SyncValidator::PreCallValidateCmdNextSubpass2(VkCommandBuffer commandBuffer
 
 void SyncValidator::RecordCmdNextSubpass(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo *pSubpassBeginInfo,
                                          const VkSubpassEndInfo *pSubpassEndInfo, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -713,7 +761,7 @@ bool SyncValidator::ValidateCmdEndRenderPass(VkCommandBuffer commandBuffer, cons
                                              const ErrorObject &error_obj) const {
     bool skip = false;
 
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     auto *cb_context = &cb_state->access_context;
@@ -743,7 +791,7 @@ bool SyncValidator::PreCallValidateCmdEndRenderPass2KHR(VkCommandBuffer commandB
 
 void SyncValidator::RecordCmdEndRenderPass(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo, Func command) {
     // Resolve the all subpass contexts to the command buffer contexts
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -784,7 +832,7 @@ bool SyncValidator::PreCallValidateCmdBeginRenderingKHR(VkCommandBuffer commandB
 bool SyncValidator::PreCallValidateCmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo,
                                                      const ErrorObject &error_obj) const {
     bool skip = false;
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state || !pRenderingInfo) return skip;
 
@@ -818,7 +866,7 @@ bool SyncValidator::PreCallValidateCmdEndRenderingKHR(VkCommandBuffer commandBuf
 
 bool SyncValidator::PreCallValidateCmdEndRendering(VkCommandBuffer commandBuffer, const ErrorObject &error_obj) const {
     bool skip = false;
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
 
@@ -832,7 +880,7 @@ void SyncValidator::PreCallRecordCmdEndRenderingKHR(VkCommandBuffer commandBuffe
 
 void SyncValidator::PreCallRecordCmdEndRendering(VkCommandBuffer commandBuffer, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdEndRendering(commandBuffer, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
 
@@ -844,7 +892,7 @@ bool SyncValidator::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer,
                                                  VkImageLayout dstImageLayout, uint32_t regionCount, const RegionType *pRegions,
                                                  const Location &loc) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -916,7 +964,7 @@ template <typename RegionType>
 void SyncValidator::RecordCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage,
                                                VkImageLayout dstImageLayout, uint32_t regionCount, const RegionType *pRegions,
                                                Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -973,7 +1021,7 @@ bool SyncValidator::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer,
                                                  VkBuffer dstBuffer, uint32_t regionCount, const RegionType *pRegions,
                                                  const Location &loc) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1040,7 +1088,7 @@ bool SyncValidator::PreCallValidateCmdCopyImageToBuffer2(VkCommandBuffer command
 template <typename RegionType>
 void SyncValidator::RecordCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
                                                VkBuffer dstBuffer, uint32_t regionCount, const RegionType *pRegions, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1099,7 +1147,7 @@ bool SyncValidator::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage
                                          VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                          const RegionType *pRegions, VkFilter filter, const Location &loc) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1177,7 +1225,7 @@ template <typename RegionType>
 void SyncValidator::RecordCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
                                        VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                        const RegionType *pRegions, VkFilter filter, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     const auto tag = cb_state->access_context.NextCommandTag(command);
     auto *context = cb_state->access_context.GetCurrentAccessContext();
@@ -1312,7 +1360,7 @@ void SyncValidator::RecordCountBuffer(AccessContext &context, const ResourceUsag
 bool SyncValidator::PreCallValidateCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z,
                                                const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
 
@@ -1323,7 +1371,7 @@ bool SyncValidator::PreCallValidateCmdDispatch(VkCommandBuffer commandBuffer, ui
 void SyncValidator::PreCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uint32_t x, uint32_t y, uint32_t z,
                                              const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDispatch(commandBuffer, x, y, z, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     auto *cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
@@ -1334,7 +1382,7 @@ void SyncValidator::PreCallRecordCmdDispatch(VkCommandBuffer commandBuffer, uint
 bool SyncValidator::PreCallValidateCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                        const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
 
@@ -1351,7 +1399,7 @@ bool SyncValidator::PreCallValidateCmdDispatchIndirect(VkCommandBuffer commandBu
 void SyncValidator::PreCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                      const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDispatchIndirect(commandBuffer, buffer, offset, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     auto *cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
@@ -1365,7 +1413,7 @@ void SyncValidator::PreCallRecordCmdDispatchIndirect(VkCommandBuffer commandBuff
 bool SyncValidator::PreCallValidateCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                            uint32_t firstVertex, uint32_t firstInstance, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1379,7 +1427,7 @@ bool SyncValidator::PreCallValidateCmdDraw(VkCommandBuffer commandBuffer, uint32
 void SyncValidator::PreCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                          uint32_t firstVertex, uint32_t firstInstance, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     auto *cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
@@ -1393,7 +1441,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexed(VkCommandBuffer commandBuffer,
                                                   uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance,
                                                   const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1409,7 +1457,7 @@ void SyncValidator::PreCallRecordCmdDrawIndexed(VkCommandBuffer commandBuffer, u
                                                 const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance,
                                               record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     auto *cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
@@ -1424,7 +1472,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer
     bool skip = false;
     if (drawCount == 0) return skip;
 
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1449,7 +1497,7 @@ void SyncValidator::PreCallRecordCmdDrawIndirect(VkCommandBuffer commandBuffer,
                                                  uint32_t drawCount, uint32_t stride, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
     if (drawCount == 0) return;
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     auto *cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
@@ -1470,7 +1518,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer comman
                                                           uint32_t drawCount, uint32_t stride, const ErrorObject &error_obj) const {
     bool skip = false;
     if (drawCount == 0) return skip;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1494,7 +1542,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer comman
 void SyncValidator::PreCallRecordCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                         uint32_t drawCount, uint32_t stride, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1516,7 +1564,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer commandB
                                                         VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                         uint32_t stride, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1541,7 +1589,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer commandB
 void SyncValidator::RecordCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                uint32_t stride, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1603,7 +1651,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer c
                                                                uint32_t maxDrawCount, uint32_t stride,
                                                                const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1628,7 +1676,7 @@ bool SyncValidator::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer c
 void SyncValidator::RecordCmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                       VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                       uint32_t stride, Func command) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1693,7 +1741,7 @@ bool SyncValidator::PreCallValidateCmdClearColorImage(VkCommandBuffer commandBuf
                                                       const VkClearColorValue *pColor, uint32_t rangeCount,
                                                       const VkImageSubresourceRange *pRanges, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1723,7 +1771,7 @@ void SyncValidator::PreCallRecordCmdClearColorImage(VkCommandBuffer commandBuffe
                                                     const VkClearColorValue *pColor, uint32_t rangeCount,
                                                     const VkImageSubresourceRange *pRanges, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1747,7 +1795,7 @@ bool SyncValidator::PreCallValidateCmdClearDepthStencilImage(VkCommandBuffer com
                                                              const VkImageSubresourceRange *pRanges,
                                                              const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1778,7 +1826,7 @@ void SyncValidator::PreCallRecordCmdClearDepthStencilImage(VkCommandBuffer comma
                                                            const VkImageSubresourceRange *pRanges, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges,
                                                          record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1801,7 +1849,7 @@ bool SyncValidator::PreCallValidateCmdClearAttachments(VkCommandBuffer commandBu
                                                        const VkClearRect *pRects, const ErrorObject &error_obj) const {
     bool skip = false;
 
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
 
@@ -1818,7 +1866,7 @@ bool SyncValidator::PreCallValidateCmdClearAttachments(VkCommandBuffer commandBu
 void SyncValidator::PreCallRecordCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
                                                      const VkClearAttachment *pAttachments, uint32_t rectCount,
                                                      const VkClearRect *pRects, const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     auto cb_access_context = &cb_state->access_context;
     const auto tag = cb_access_context->NextCommandTag(record_obj.location.function);
 
@@ -1834,7 +1882,7 @@ bool SyncValidator::PreCallValidateCmdCopyQueryPoolResults(VkCommandBuffer comma
                                                            VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags,
                                                            const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1866,7 +1914,7 @@ void SyncValidator::PreCallRecordCmdCopyQueryPoolResults(VkCommandBuffer command
                                                          const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset,
                                                        stride, flags, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1887,7 +1935,7 @@ void SyncValidator::PreCallRecordCmdCopyQueryPoolResults(VkCommandBuffer command
 bool SyncValidator::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                  VkDeviceSize size, uint32_t data, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1914,7 +1962,7 @@ bool SyncValidator::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer,
 void SyncValidator::PreCallRecordCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                VkDeviceSize size, uint32_t data, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -1934,7 +1982,7 @@ bool SyncValidator::PreCallValidateCmdResolveImage(VkCommandBuffer commandBuffer
                                                    VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                                    const VkImageResolve *pRegions, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -1983,7 +2031,7 @@ void SyncValidator::PreCallRecordCmdResolveImage(VkCommandBuffer commandBuffer,
                                                  const VkImageResolve *pRegions, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount,
                                                pRegions, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2012,7 +2060,7 @@ void SyncValidator::PreCallRecordCmdResolveImage(VkCommandBuffer commandBuffer,
 bool SyncValidator::PreCallValidateCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR *pResolveImageInfo,
                                                     const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2067,7 +2115,7 @@ bool SyncValidator::PreCallValidateCmdResolveImage2KHR(VkCommandBuffer commandBu
 void SyncValidator::PreCallRecordCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR *pResolveImageInfo,
                                                   const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdResolveImage2(commandBuffer, pResolveImageInfo, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2101,7 +2149,7 @@ void SyncValidator::PreCallRecordCmdResolveImage2KHR(VkCommandBuffer commandBuff
 bool SyncValidator::PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                    VkDeviceSize dataSize, const void *pData, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2129,7 +2177,7 @@ bool SyncValidator::PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer
 void SyncValidator::PreCallRecordCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                  VkDeviceSize dataSize, const void *pData, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2150,7 +2198,7 @@ bool SyncValidator::PreCallValidateCmdWriteBufferMarkerAMD(VkCommandBuffer comma
                                                            VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker,
                                                            const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2177,7 +2225,7 @@ void SyncValidator::PreCallRecordCmdWriteBufferMarkerAMD(VkCommandBuffer command
                                                          VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker,
                                                          const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2196,7 +2244,7 @@ void SyncValidator::PreCallRecordCmdWriteBufferMarkerAMD(VkCommandBuffer command
 bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR *pDecodeInfo,
                                                      const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2265,7 +2313,7 @@ bool SyncValidator::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuff
 
 void SyncValidator::PreCallRecordCmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR *pDecodeInfo,
                                                    const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2308,7 +2356,7 @@ void SyncValidator::PreCallRecordCmdDecodeVideoKHR(VkCommandBuffer commandBuffer
 bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR *pEncodeInfo,
                                                      const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2377,7 +2425,7 @@ bool SyncValidator::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuff
 
 void SyncValidator::PreCallRecordCmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR *pEncodeInfo,
                                                    const RecordObject &record_obj) {
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2420,7 +2468,7 @@ void SyncValidator::PreCallRecordCmdEncodeVideoKHR(VkCommandBuffer commandBuffer
 bool SyncValidator::PreCallValidateCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask,
                                                const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2435,7 +2483,7 @@ bool SyncValidator::PreCallValidateCmdSetEvent(VkCommandBuffer commandBuffer, Vk
 void SyncValidator::PostCallRecordCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask,
                                               const RecordObject &record_obj) {
     StateTracker::PostCallRecordCmdSetEvent(commandBuffer, event, stageMask, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2452,7 +2500,7 @@ bool SyncValidator::PreCallValidateCmdSetEvent2KHR(VkCommandBuffer commandBuffer
 bool SyncValidator::PreCallValidateCmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event,
                                                 const VkDependencyInfo *pDependencyInfo, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2474,7 +2522,7 @@ void SyncValidator::PostCallRecordCmdSetEvent2KHR(VkCommandBuffer commandBuffer,
 void SyncValidator::PostCallRecordCmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event,
                                                const VkDependencyInfo *pDependencyInfo, const RecordObject &record_obj) {
     StateTracker::PostCallRecordCmdSetEvent2(commandBuffer, event, pDependencyInfo, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2487,7 +2535,7 @@ void SyncValidator::PostCallRecordCmdSetEvent2(VkCommandBuffer commandBuffer, Vk
 bool SyncValidator::PreCallValidateCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask,
                                                  const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2499,7 +2547,7 @@ bool SyncValidator::PreCallValidateCmdResetEvent(VkCommandBuffer commandBuffer,
 void SyncValidator::PostCallRecordCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask,
                                                 const RecordObject &record_obj) {
     StateTracker::PostCallRecordCmdResetEvent(commandBuffer, event, stageMask, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2510,7 +2558,7 @@ void SyncValidator::PostCallRecordCmdResetEvent(VkCommandBuffer commandBuffer, V
 bool SyncValidator::PreCallValidateCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask,
                                                   const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2533,7 +2581,7 @@ void SyncValidator::PostCallRecordCmdResetEvent2KHR(VkCommandBuffer commandBuffe
 void SyncValidator::PostCallRecordCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask,
                                                  const RecordObject &record_obj) {
     StateTracker::PostCallRecordCmdResetEvent2(commandBuffer, event, stageMask, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2549,7 +2597,7 @@ bool SyncValidator::PreCallValidateCmdWaitEvents(VkCommandBuffer commandBuffer,
                                                  uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers,
                                                  const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2571,7 +2619,7 @@ void SyncValidator::PostCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, u
                                               pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers,
                                               imageMemoryBarrierCount, pImageMemoryBarriers, record_obj);
 
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2596,7 +2644,7 @@ void SyncValidator::PostCallRecordCmdWaitEvents2KHR(VkCommandBuffer commandBuffe
 bool SyncValidator::PreCallValidateCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
                                                   const VkDependencyInfo *pDependencyInfos, const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2611,7 +2659,7 @@ void SyncValidator::PostCallRecordCmdWaitEvents2(VkCommandBuffer commandBuffer,
                                                  const VkDependencyInfo *pDependencyInfos, const RecordObject &record_obj) {
     StateTracker::PostCallRecordCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos, record_obj);
 
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2624,7 +2672,7 @@ bool SyncValidator::PreCallValidateCmdWriteBufferMarker2AMD(VkCommandBuffer comm
                                                             VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker,
                                                             const ErrorObject &error_obj) const {
     bool skip = false;
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_access_context = &cb_state->access_context;
@@ -2651,7 +2699,7 @@ void SyncValidator::PreCallRecordCmdWriteBufferMarker2AMD(VkCommandBuffer comman
                                                           VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker,
                                                           const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdWriteBufferMarker2AMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_access_context = &cb_state->access_context;
@@ -2670,7 +2718,7 @@ void SyncValidator::PreCallRecordCmdWriteBufferMarker2AMD(VkCommandBuffer comman
 bool SyncValidator::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers, const ErrorObject &error_obj) const {
     bool skip = StateTracker::PreCallValidateCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, error_obj);
-    const auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    const auto cb_state = GetRead<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return skip;
     const auto *cb_context = &cb_state->access_context;
@@ -2708,7 +2756,7 @@ bool SyncValidator::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuf
 void SyncValidator::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                                     const VkCommandBuffer *pCommandBuffers, const RecordObject &record_obj) {
     StateTracker::PreCallRecordCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers, record_obj);
-    auto cb_state = Get<syncval_state::CommandBuffer>(commandBuffer);
+    auto cb_state = GetWrite<syncval_state::CommandBuffer>(commandBuffer);
     assert(cb_state);
     if (!cb_state) return;
     auto *cb_context = &cb_state->access_context;
@@ -2749,9 +2797,11 @@ void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObjec
     const auto queue_state = GetQueueSyncStateShared(queue);
     if (!queue_state) return;  // Invalid queue
     QueueId waited_queue = queue_state->GetQueueId();
+    WriteLockGuard queue_guard(queue_sync_lock_);
     ApplyTaggedWait(waited_queue, ResourceUsageRecord::kMaxIndex);
 
     // Eliminate waitable fences from the current queue.
+    WriteLockGuard fences_guard(waitable_fences_lock_);
     vvl::EraseIf(waitable_fences_, [waited_queue](const SignaledFence &sf) { return sf.second.queue_id == waited_queue; });
 }
 
@@ -2759,10 +2809,12 @@ void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordOb
     StateTracker::PostCallRecordDeviceWaitIdle(device, record_obj);
 
     // We need to treat this a fence waits for all queues... noting that present engine ops will be preserved.
+    WriteLockGuard queue_guard(queue_sync_lock_);
     ForAllQueueBatchContexts(
         [](const std::shared_ptr<QueueBatchContext> &batch) { batch->ApplyTaggedWait(kQueueAny, ResourceUsageRecord::kMaxIndex); });
 
     // As we we've waited for everything on device, any waits are mooted. (except for acquires)
+    WriteLockGuard fences_guard(waitable_fences_lock_);
     vvl::EraseIf(waitable_fences_, [](SignaledFences::value_type &waitable) { return waitable.second.acquired.Invalid(); });
 }
 
@@ -2780,6 +2832,7 @@ bool SyncValidator::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresen
     // Since this early return is above the TlsGuard, the Record phase must also be.
     if (disabled[sync_validation_queue_submit]) return skip;
 
+    ReadLockGuard queue_guard(queue_sync_lock_);
     vvl::TlsGuard<QueuePresentCmdState> cmd_state(&skip, signaled_semaphores_);
     cmd_state->queue = GetQueueSyncStateShared(queue);
     if (!cmd_state->queue) return skip;  // Invalid Queue
@@ -2837,6 +2890,7 @@ void SyncValidator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresent
 
     // The earliest return (when enabled), must be *after* the TlsGuard, as it is the TlsGuard that cleans up the cmd_state
     // static payload
+    WriteLockGuard queue_guard(queue_sync_lock_);
     vvl::TlsGuard<QueuePresentCmdState> cmd_state;
 
     // See ValidationStateTracker::PostCallRecordQueuePresentKHR for spec excerpt supporting
@@ -2874,6 +2928,9 @@ void SyncValidator::RecordAcquireNextImageState(VkDevice device, VkSwapchainKHR
                                                 VkFence fence, uint32_t *pImageIndex, const RecordObject &record_obj) {
     if ((VK_SUCCESS != record_obj.result) && (VK_SUBOPTIMAL_KHR != record_obj.result)) return;
 
+    // The presented images are exported to the swapchain in the QueuePresent record phase under the same lock
+    WriteLockGuard queue_guard(queue_sync_lock_);
+
     // Get the image out of the presented list and create apppropriate fences/semaphores.
     auto swapchain_state = Get<syncval_state::Swapchain>(swapchain);
     if (vvl::StateObject::Invalid(swapchain_state)) return;  // Invalid acquire calls to be caught in CoreCheck/Parameter validation
@@ -2928,6 +2985,7 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
     // Since this early return is above the TlsGuard, the Record phase must also be.
     if (disabled[sync_validation_queue_submit]) return skip;
 
+    ReadLockGuard queue_guard(queue_sync_lock_);
     vvl::TlsGuard<QueueSubmitCmdState> cmd_state(&skip, error_obj, signaled_semaphores_);
     cmd_state->queue = GetQueueSyncStateShared(queue);
     if (!cmd_state->queue) return skip;  // Invalid Queue
@@ -2993,6 +3051,7 @@ void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, const Record
 
     // The earliest return (when enabled), must be *after* the TlsGuard, as it is the TlsGuard that cleans up the cmd_state
     // static payload
+    WriteLockGuard queue_guard(queue_sync_lock_);
     vvl::TlsGuard<QueueSubmitCmdState> cmd_state;
 
     if (VK_SUCCESS != record_obj.result) return;  // dispatched QueueSubmit failed
@@ -3006,6 +3065,15 @@ void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, const Record
 
     ResourceUsageRange fence_tag_range = ReserveGlobalTagRange(1U);
     UpdateFenceWaitInfo(fence, queue_state->GetQueueId(), fence_tag_range.begin);
+
+    // Access flag sets that didn't fit were dropped from the access states, hazards may be missing from here on
+    if (SyncAccessFlagsPool::Overflowed() && !access_flags_overflow_reported_) {
+        access_flags_overflow_reported_ = true;
+        LogError("UNASSIGNED-SyncValidation-AccessFlagsPoolOverflow", LogObjectList(queue), record_obj.location,
+                 "More than %zu distinct access flag sets were used, synchronization validation results are no longer "
+                 "reliable.",
+                 SyncAccessFlagsPool::Size());
+    }
 }
 
 bool SyncValidator::PreCallValidateQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
@@ -19,7 +19,9 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <set>
+#include <shared_mutex>
 #include <vulkan/vulkan.h>
 
 #include "sync/sync_common.h"
@@ -27,6 +29,7 @@
 #include "sync/sync_renderpass.h"
 #include "sync/sync_commandbuffer.h"
 #include "sync/sync_submit.h"
+#include "utils/thread_pool.h"
 
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImage, syncval_state::ImageState, vvl::Image)
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkImageView, syncval_state::ImageViewState, vvl::ImageView)
@@ -44,11 +47,26 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
 
     SyncValidator() { container_type = LayerObjectTypeSyncValidation; }
 
+    ReadLockGuard ReadLock() const override;
+    WriteLockGuard WriteLock() override;
+
     // Global tag range for submitted command buffers resource usage logs
     // Started the global tag count at 1 s.t. zero are invalid and ResourceUsageTag normalization can just zero them.
     mutable std::atomic<ResourceUsageTag> tag_limit_{1};  // This is reserved in Validation phase, thus mutable and atomic
     ResourceUsageRange ReserveGlobalTagRange(size_t tag_count) const;  // Note that the tag_limit_ is mutable this has side effects
 
+    // With fine_grained_locking the object-wide lock is not held, so the command buffer hooks rely on the command buffer's own
+    // lock and the queue level state below is protected by these narrower locks. When both are needed, queue_sync_lock_ is
+    // always acquired first.
+    //
+    // queue_sync_lock_ covers the batches referenced from queue_sync_states_ and signaled_semaphores_. The validate phase of
+    // QueueSubmit/QueuePresent takes it shared (as it would the object-wide lock), while the record phase and all waits take
+    // it exclusive.
+    mutable std::shared_mutex queue_sync_lock_;
+    // waitable_fences_lock_ covers waitable_fences_
+    mutable std::shared_mutex waitable_fences_lock_;
+
+    // The map itself is only modified at CreateDevice, the QueueSyncState contents are protected by queue_sync_lock_
     vvl::unordered_map<VkQueue, std::shared_ptr<QueueSyncState>> queue_sync_states_;
     QueueId queue_id_limit_ = kQueueIdBase;
     SignaledSemaphores signaled_semaphores_;
@@ -60,6 +78,12 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     uint32_t debug_command_number = vvl::kU32Max;
     uint32_t debug_reset_count = 1;
     std::string debug_cmdbuf_pattern;
+    bool debug_memory_report = false;
+    // Created at CreateDevice when syncval_submit_validation_threads is more than 1, the submitting thread is one of the threads
+    std::unique_ptr<vvl::ThreadPool> submit_validation_thread_pool;
+    // Keeps the interned access flag sets alive while the device exists
+    std::optional<SyncAccessFlagsPool::Reference> access_flags_pool_reference_;
+    bool access_flags_overflow_reported_ = false;
 
     void ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag);
     void ApplyAcquireWait(const AcquiredImage &acquired);
@@ -113,6 +137,8 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     bool SupressedBoundDescriptorWAW(const HazardResult &hazard) const;
 
     void CreateDevice(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) override;
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator,
+                                    const RecordObject &record_obj) override;
 
     bool ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                  const VkSubpassBeginInfo *pSubpassBeginInfo, const ErrorObject &error_obj) const;
@@ -0,0 +1,216 @@
+/* Copyright (c) 2015-2024 The Khronos Group Inc.
+ * Copyright (c) 2015-2024 Valve Corporation
+ * Copyright (c) 2015-2024 LunarG, Inc.
+ * Copyright (c) 2015-2024 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "utils/vk_layer_utils.h"
+
+// Modern CPUs have 64 or 128-byte cache line sizes (Apple M1 has 128-byte cache line size).
+// Use alignment of 64 bytes (instead of 128) to prioritize using less memory and decrease
+// cache pressure.
+inline constexpr size_t kObjectUserDataAlignment = 64;
+static_assert(vku::concurrent::get_hardware_destructive_interference_size() % kObjectUserDataAlignment ==
+              0);  // sanity check on the build machine
+
+class alignas(kObjectUserDataAlignment) ObjectUseData {
+  public:
+    class WriteReadCount {
+      public:
+        explicit WriteReadCount(int64_t v) : count(v) {}
+
+        int32_t GetReadCount() const { return static_cast<int32_t>(count & 0xFFFFFFFF); }
+        int32_t GetWriteCount() const { return static_cast<int32_t>(count >> 32); }
+
+      private:
+        int64_t count{};
+    };
+
+    WriteReadCount AddWriter() {
+        int64_t prev = writer_reader_count.fetch_add(1ULL << 32);
+        return WriteReadCount(prev);
+    }
+    WriteReadCount AddReader() {
+        int64_t prev = writer_reader_count.fetch_add(1ULL);
+        return WriteReadCount(prev);
+    }
+    WriteReadCount RemoveWriter() {
+        int64_t prev = writer_reader_count.fetch_add(-(1LL << 32));
+        assert(prev > 0);
+        return WriteReadCount(prev);
+    }
+    WriteReadCount RemoveReader() {
+        int64_t prev = writer_reader_count.fetch_add(-1LL);
+        assert(prev > 0);
+        return WriteReadCount(prev);
+    }
+    WriteReadCount GetCount() { return WriteReadCount(writer_reader_count); }
+
+    void WaitForObjectIdle(bool is_writer) {
+        // Wait for thread-safe access to object instead of skipping call.
+        while (GetCount().GetReadCount() > (int)(!is_writer) || GetCount().GetWriteCount() > (int)is_writer) {
+            std::this_thread::sleep_for(std::chrono::microseconds(1));
+        }
+    }
+
+    std::atomic<std::thread::id> thread{};
+
+  private:
+    friend class ObjectUseTable;
+
+    // Need to update write and read counts atomically. Writer in high 32 bits, reader in low 32 bits.
+    std::atomic<int64_t> writer_reader_count{};
+    // Handle of the object currently using this slot of an ObjectUseTable, 0 while the slot is free
+    std::atomic<uint64_t> handle{};
+};
+
+// Stable storage for the ObjectUseData of every object tracked by thread safety validation, addressed by a 32-bit slot
+// index.
+//
+// Wrapped handles store the slot index of their unique_id_mapping entry in their low 32 bits (see
+// concurrent_handle_table). A live index belongs to a single object, so a table indexed by that same index finds the use
+// data of a wrapped handle with one array index and a compare against the handle held by the slot, leaving a single
+// atomic add for StartRead/StartWrite. Handles which do not carry an index (dispatchable handles, or every handle when
+// handle wrapping is disabled) get a slot from Allocate() instead, and the caller maps the handle to the returned index.
+// A table is used either with Insert()/Erase() or with Allocate()/Release(), never both.
+//
+// Slots live in segments of doubling size which are only released by the destructor. A slot never moves, so lookups
+// take no lock and an ObjectUseData stays valid even if another thread destroys its object while it is being used,
+// which is the kind of application error this storage exists to report. Insert(), Erase(), Allocate() and Release()
+// share a mutex which guards the free list and segment allocation.
+class ObjectUseTable {
+  public:
+    ObjectUseTable() = default;
+    ObjectUseTable(const ObjectUseTable &) = delete;
+    ObjectUseTable &operator=(const ObjectUseTable &) = delete;
+    ~ObjectUseTable() {
+        for (auto &segment : segments_) {
+            delete[] segment.load(std::memory_order_relaxed);
+        }
+    }
+
+    // Use data of handle if it holds slot index, nullptr otherwise
+    ObjectUseData *Find(uint32_t index, uint64_t handle) const {
+        ObjectUseData *slot = GetSlot(index);
+        if (!slot || slot->handle.load(std::memory_order_acquire) != handle) {
+            return nullptr;
+        }
+        return slot;
+    }
+
+    // Use data of a slot returned by Allocate()
+    ObjectUseData *Get(uint32_t index) const {
+        ObjectUseData *slot = GetSlot(index);
+        assert(slot);
+        return slot;
+    }
+
+    // Make handle the holder of slot index. Fails if the slot is still held by another handle, which happens when the
+    // index was reused by handle wrapping before the previous holder was erased.
+    bool Insert(uint32_t index, uint64_t handle) {
+        assert(handle != 0);
+        std::lock_guard<std::mutex> guard(lock_);
+        AllocateSegmentFor(index);
+        ObjectUseData &slot = *GetSlot(index);
+        const uint64_t holder = slot.handle.load(std::memory_order_relaxed);
+        if (holder != 0) {
+            return holder == handle;
+        }
+        Publish(slot, handle);
+        return true;
+    }
+
+    bool Erase(uint32_t index, uint64_t handle) {
+        std::lock_guard<std::mutex> guard(lock_);
+        ObjectUseData *slot = GetSlot(index);
+        if (!slot || slot->handle.load(std::memory_order_relaxed) != handle) {
+            return false;
+        }
+        slot->handle.store(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Claim a free slot for handle and return its index
+    uint32_t Allocate(uint64_t handle) {
+        assert(handle != 0);
+        std::lock_guard<std::mutex> guard(lock_);
+        uint32_t index;
+        if (!free_list_.empty()) {
+            index = free_list_.back();
+            free_list_.pop_back();
+        } else {
+            index = next_index_++;
+            assert(next_index_ != 0);  // ran out of 32-bit slot indices
+            AllocateSegmentFor(index);
+        }
+        Publish(*GetSlot(index), handle);
+        return index;
+    }
+
+    void Release(uint32_t index) {
+        std::lock_guard<std::mutex> guard(lock_);
+        ObjectUseData *slot = GetSlot(index);
+        assert(slot && slot->handle.load(std::memory_order_relaxed) != 0);
+        slot->handle.store(0, std::memory_order_relaxed);
+        free_list_.push_back(index);
+    }
+
+  private:
+    static constexpr uint32_t kMinSegmentBits = 10;
+    static constexpr uint32_t kMinSegmentSize = 1u << kMinSegmentBits;
+    // Enough doubling segments to address every 32-bit index
+    static constexpr uint32_t kMaxSegments = 32 - kMinSegmentBits + 1;
+
+    // Segment s holds kMinSegmentSize << s slots, starting at index kMinSegmentSize * ((1 << s) - 1)
+    static uint32_t SegmentIndex(uint32_t index) {
+        return static_cast<uint32_t>(MostSignificantBit((index >> kMinSegmentBits) + 1));
+    }
+    static uint32_t SegmentBase(uint32_t segment) { return kMinSegmentSize * ((1u << segment) - 1); }
+
+    ObjectUseData *GetSlot(uint32_t index) const {
+        const uint32_t segment = SegmentIndex(index);
+        ObjectUseData *slots = segments_[segment].load(std::memory_order_acquire);
+        return slots ? &slots[index - SegmentBase(segment)] : nullptr;
+    }
+
+    void AllocateSegmentFor(uint32_t index) {
+        const uint32_t segment = SegmentIndex(index);
+        if (!segments_[segment].load(std::memory_order_relaxed)) {
+            segments_[segment].store(new ObjectUseData[size_t(kMinSegmentSize) << segment], std::memory_order_release);
+        }
+    }
+
+    // A previous holder may have been destroyed while in use, so the new one must not inherit its counts
+    static void Publish(ObjectUseData &slot, uint64_t handle) {
+        slot.writer_reader_count.store(0, std::memory_order_relaxed);
+        slot.thread.store(std::thread::id(), std::memory_order_relaxed);
+        slot.handle.store(handle, std::memory_order_release);
+    }
+
+    std::atomic<ObjectUseData *> segments_[kMaxSegments]{};
+    std::mutex lock_;
+    std::vector<uint32_t> free_list_;
+    uint32_t next_index_{0};
+};
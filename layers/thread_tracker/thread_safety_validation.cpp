@@ -19,6 +19,9 @@
 #include "generated/layer_chassis_dispatch.h"  // wrap_handles declaration
 #include "thread_tracker/thread_safety_validation.h"
 
+ObjectUseTable wrapped_object_use_data;
+ObjectUseTable unindexed_object_use_data;
+
 ReadLockGuard ThreadSafety::ReadLock() const { return ReadLockGuard(validation_object_mutex, std::defer_lock); }
 
 WriteLockGuard ThreadSafety::WriteLock() { return WriteLockGuard(validation_object_mutex, std::defer_lock); }
@@ -25,6 +25,7 @@
 #include <thread>
 #include <vector>
 #include "utils/vk_layer_utils.h"
+#include "thread_tracker/object_use_table.h"
 
 VK_DEFINE_NON_DISPATCHABLE_HANDLE(DISTINCT_NONDISPATCHABLE_PHONY_HANDLE)
 // The following line must match the vulkan_core.h condition guarding VK_DEFINE_NON_DISPATCHABLE_HANDLE
@@ -42,59 +43,10 @@ static_assert(std::is_same<uint64_t, DISTINCT_NONDISPATCHABLE_PHONY_HANDLE>::val
               "Mismatched non-dispatchable handle handle, expected uint64_t.");
 #endif
 
-// Modern CPUs have 64 or 128-byte cache line sizes (Apple M1 has 128-byte cache line size).
-// Use alignment of 64 bytes (instead of 128) to prioritize using less memory and decrease
-// cache pressure.
-inline constexpr size_t kObjectUserDataAlignment = 64;
-static_assert(vku::concurrent::get_hardware_destructive_interference_size() % kObjectUserDataAlignment ==
-              0);  // sanity check on the build machine
-
-class alignas(kObjectUserDataAlignment) ObjectUseData {
-  public:
-    class WriteReadCount {
-      public:
-        explicit WriteReadCount(int64_t v) : count(v) {}
-
-        int32_t GetReadCount() const { return static_cast<int32_t>(count & 0xFFFFFFFF); }
-        int32_t GetWriteCount() const { return static_cast<int32_t>(count >> 32); }
-
-      private:
-        int64_t count{};
-    };
-
-    WriteReadCount AddWriter() {
-        int64_t prev = writer_reader_count.fetch_add(1ULL << 32);
-        return WriteReadCount(prev);
-    }
-    WriteReadCount AddReader() {
-        int64_t prev = writer_reader_count.fetch_add(1ULL);
-        return WriteReadCount(prev);
-    }
-    WriteReadCount RemoveWriter() {
-        int64_t prev = writer_reader_count.fetch_add(-(1LL << 32));
-        assert(prev > 0);
-        return WriteReadCount(prev);
-    }
-    WriteReadCount RemoveReader() {
-        int64_t prev = writer_reader_count.fetch_add(-1LL);
-        assert(prev > 0);
-        return WriteReadCount(prev);
-    }
-    WriteReadCount GetCount() { return WriteReadCount(writer_reader_count); }
-
-    void WaitForObjectIdle(bool is_writer) {
-        // Wait for thread-safe access to object instead of skipping call.
-        while (GetCount().GetReadCount() > (int)(!is_writer) || GetCount().GetWriteCount() > (int)is_writer) {
-            std::this_thread::sleep_for(std::chrono::microseconds(1));
-        }
-    }
-
-    std::atomic<std::thread::id> thread{};
-
-  private:
-    // Need to update write and read counts atomically. Writer in high 32 bits, reader in low 32 bits.
-    std::atomic<int64_t> writer_reader_count{};
-};
+// Use data of the objects whose handles carry a handle wrapping slot index, indexed by that slot index
+extern ObjectUseTable wrapped_object_use_data;
+// Use data of all other objects, see counter::object_table
+extern ObjectUseTable unindexed_object_use_data;
 
 template <typename T>
 class counter {
@@ -102,21 +54,50 @@ class counter {
     VulkanObjectType object_type;
     ValidationObject *object_data;
 
-    vvl::concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    // Objects which are not in wrapped_object_use_data, mapped to their slot in unindexed_object_use_data
+    vvl::concurrent_unordered_map<T, uint32_t, 6> object_table;
 
-    void CreateObject(T object) { object_table.insert(object, std::make_shared<ObjectUseData>()); }
+    void CreateObject(T object) {
+        const uint64_t handle = CastToUint64(object);
+        // Only wrapped handles are known to carry a slot index. The slot can still be held by a recently destroyed
+        // object whose destroy call has not been recorded yet, that object is then tracked through object_table.
+        if (indexed_ && unique_id_mapping.contains(handle) &&
+            wrapped_object_use_data.Insert(static_cast<uint32_t>(handle), handle)) {
+            return;
+        }
+        const uint32_t index = unindexed_object_use_data.Allocate(handle);
+        if (!object_table.insert(object, index)) {
+            // Already tracked, as when the same queue is retrieved more than once
+            unindexed_object_use_data.Release(index);
+        }
+    }
 
     void DestroyObject(T object) {
         if (object) {
-            object_table.erase(object);
+            const uint64_t handle = CastToUint64(object);
+            if (indexed_ && wrapped_object_use_data.Erase(static_cast<uint32_t>(handle), handle)) {
+                return;
+            }
+            auto iter = object_table.pop(object);
+            if (iter != object_table.end()) {
+                unindexed_object_use_data.Release(iter->second);
+            }
         }
     }
 
-    std::shared_ptr<ObjectUseData> FindObject(T object, const Location& loc) {
-        assert(object_table.contains(object));
+    // The returned use data is never freed, it stays valid even if the object is destroyed concurrently
+    ObjectUseData *FindObject(T object, const Location& loc) {
+        if (indexed_) {
+            const uint64_t handle = CastToUint64(object);
+            ObjectUseData *use_data = wrapped_object_use_data.Find(static_cast<uint32_t>(handle), handle);
+            if (use_data) {
+                return use_data;
+            }
+        }
         auto iter = object_table.find(object);
+        assert(iter != object_table.end());
         if (iter != object_table.end()) {
-            return iter->second;
+            return unindexed_object_use_data.Get(iter->second);
         } else {
             object_data->LogError("UNASSIGNED-Threading-Info", object, loc,
                                   "Couldn't find %s Object 0x%" PRIxLEAST64
@@ -210,12 +191,23 @@ class counter {
         use_data->RemoveReader();
     }
 
-    counter(VulkanObjectType type = kVulkanObjectTypeUnknown, ValidationObject *val_obj = nullptr) {
+    // indexed is false for counters which track the same handles as another counter, as the slot of a wrapped handle can
+    // only hold one use data
+    counter(VulkanObjectType type = kVulkanObjectTypeUnknown, ValidationObject *val_obj = nullptr, bool indexed = true) {
         object_type = type;
         object_data = val_obj;
+        indexed_ = indexed && !IsDispatchable(type);
     }
 
   private:
+    static bool IsDispatchable(VulkanObjectType type) {
+        return type == kVulkanObjectTypeInstance || type == kVulkanObjectTypePhysicalDevice || type == kVulkanObjectTypeDevice ||
+               type == kVulkanObjectTypeQueue || type == kVulkanObjectTypeCommandBuffer;
+    }
+
+    // Whether wrapped handles of this counter are tracked in wrapped_object_use_data
+    bool indexed_{true};
+
     std::string GetErrorMessage(std::thread::id tid, std::thread::id other_tid) const {
         std::stringstream err_str;
         err_str << "THREADING ERROR : object of type " << string_VulkanObjectType(object_type)
@@ -223,7 +215,7 @@ class counter {
         return err_str.str();
     }
 
-    void HandleErrorOnWrite(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnWrite(ObjectUseData *use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         const std::string error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
         const bool skip =
@@ -239,7 +231,7 @@ class counter {
         }
     }
 
-    void HandleErrorOnRead(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnRead(ObjectUseData *use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         // There is a writer of the object.
         const auto error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
@@ -310,7 +302,7 @@ class ThreadSafety : public ValidationObject {
           c_VkDevice(kVulkanObjectTypeDevice, this),
           c_VkInstance(kVulkanObjectTypeInstance, this),
           c_VkQueue(kVulkanObjectTypeQueue, this),
-          c_VkCommandPoolContents(kVulkanObjectTypeCommandPool, this),
+          c_VkCommandPoolContents(kVulkanObjectTypeCommandPool, this, false),
 #ifdef DISTINCT_NONDISPATCHABLE_HANDLES
 #include "generated/thread_safety_counter_instances.h"
 #else   // DISTINCT_NONDISPATCHABLE_HANDLES
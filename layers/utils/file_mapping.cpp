@@ -0,0 +1,119 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/file_mapping.h"
+
+#include <cstdio>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vvl {
+
+#if defined(_WIN32)
+
+bool MappedFile::Open(const std::string &path) {
+    Close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0 || uint64_t(file_size.QuadPart) > SIZE_MAX) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+    void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    file_handle_ = file;
+    mapping_handle_ = mapping;
+    data_ = static_cast<const uint8_t *>(data);
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_handle_);
+        CloseHandle(file_handle_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    file_handle_ = nullptr;
+    mapping_handle_ = nullptr;
+}
+
+bool CommitTempFile(const std::string &temp_path, const std::string &path) {
+    return MoveFileExA(temp_path.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+}
+
+#else
+
+bool MappedFile::Open(const std::string &path) {
+    Close();
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    void *data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    data_ = static_cast<const uint8_t *>(data);
+    size_ = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (data_) {
+        munmap(const_cast<uint8_t *>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+}
+
+bool CommitTempFile(const std::string &temp_path, const std::string &path) {
+    // rename() replaces the destination atomically, a reader still holding the old file keeps its (unlinked) mapping
+    return std::rename(temp_path.c_str(), path.c_str()) == 0;
+}
+
+#endif
+
+}  // namespace vvl
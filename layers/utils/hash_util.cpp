@@ -47,4 +47,9 @@ uint64_t DescriptorVariableHash(const void *info, const size_t info_size) {
     return XXH64(info, info_size, seed);
 }
 
+uint64_t CacheDataHash(const void *data, const size_t data_size) {
+    constexpr uint64_t seed = 0;
+    return XXH64(data, data_size, seed);
+}
+
 }  // namespace hash_util
\ No newline at end of file
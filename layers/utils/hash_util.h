@@ -164,4 +164,7 @@ uint32_t ShaderHash(const void *pCode, const size_t codeSize);
 
 uint64_t DescriptorVariableHash(const void *info, const size_t info_size);
 
+// Used to detect corrupted entries of the on-disk caches
+uint64_t CacheDataHash(const void *data, const size_t data_size);
+
 }  // namespace hash_util
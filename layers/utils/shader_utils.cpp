@@ -19,11 +19,14 @@
 
 #include "shader_utils.h"
 
+#include <algorithm>
+
 #include "state_tracker/device_state.h"
 #include "generated/state_tracker_helper.h"
 #include "generated/vk_extension_helper.h"
 #include "state_tracker/shader_module.h"
 #include "state_tracker/shader_instruction.h"
+#include "utils/hash_util.h"
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4) {
     if (api_version >= VK_API_VERSION_1_3) {
@@ -74,6 +77,28 @@ void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const Dev
     options.SetFriendlyNames(false);
 }
 
+uint32_t GetSpirvValidationConfigId(spv_target_env spirv_environment, const DeviceExtensions &device_extensions,
+                                    const DeviceFeatures &enabled_features) {
+    // Must match the inputs of AdjustValidatorOptions
+    hash_util::HashCombiner hc;
+    hc << spirv_environment << IsExtEnabled(device_extensions.vk_khr_relaxed_block_layout)
+       << enabled_features.uniformBufferStandardLayout << enabled_features.scalarBlockLayout
+       << enabled_features.workgroupMemoryExplicitLayoutScalarBlockLayout << enabled_features.maintenance4;
+    const uint64_t value = hc.Value();
+    return static_cast<uint32_t>(value ^ (value >> 32));
+}
+
+bool ValidationCache::LoadFile(const std::string &path, uint32_t config_id) {
+    auto guard = WriteLock();
+    return file_.Load(path, config_id);
+}
+
+bool ValidationCache::SaveFile() {
+    auto guard = WriteLock();
+    // Insert() never adds what is already in the file, so there are no duplicates
+    return file_.Save(good_shader_hashes_);
+}
+
 void GetActiveSlots(ActiveSlotMap &active_slots, const std::shared_ptr<const spirv::EntryPoint> &entrypoint) {
     if (!entrypoint) {
         return;
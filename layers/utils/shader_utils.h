@@ -22,6 +22,8 @@
 
 #include "vulkan/vulkan.h"
 #include "utils/vk_layer_utils.h"
+#include "containers/custom_containers.h"
+#include "utils/validation_cache_file.h"
 #include "generated/spirv_tools_commit_id.h"
 
 #include <spirv/unified1/spirv.hpp>
@@ -167,7 +169,8 @@ class ValidationCache {
     void Write(size_t *pDataSize, void *pData) {
         const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
         if (!pData) {
-            *pDataSize = headerSize + good_shader_hashes_.size() * sizeof(uint32_t);
+            auto guard = ReadLock();
+            *pDataSize = headerSize + (good_shader_hashes_.size() + FileConfigKeys().size()) * sizeof(uint32_t);
             return;
         }
 
@@ -191,6 +194,11 @@ class ValidationCache {
                  it++, out++, actualSize += sizeof(uint32_t)) {
                 *out = *it;
             }
+            const auto file_keys = FileConfigKeys();
+            for (auto it = file_keys.begin(); it != file_keys.end() && actualSize < *pDataSize;
+                 it++, out++, actualSize += sizeof(uint32_t)) {
+                *out = static_cast<uint32_t>(*it);
+            }
         }
 
         *pDataSize = actualSize;
@@ -203,20 +211,34 @@ class ValidationCache {
         }
         auto other_guard = other->ReadLock();
         auto guard = WriteLock();
-        good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size());
-        for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
+        const auto other_file_keys = other->FileConfigKeys();
+        good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size() + other_file_keys.size());
+        for (auto h : other->good_shader_hashes_) {
+            if (!FileContains(h)) good_shader_hashes_.insert(h);
+        }
+        for (auto key : other_file_keys) {
+            if (!FileContains(static_cast<uint32_t>(key))) good_shader_hashes_.insert(static_cast<uint32_t>(key));
+        }
     }
 
     bool Contains(uint32_t hash) {
         auto guard = ReadLock();
-        return good_shader_hashes_.count(hash) != 0;
+        return good_shader_hashes_.count(hash) != 0 || FileContains(hash);
     }
 
     void Insert(uint32_t hash) {
         auto guard = WriteLock();
-        good_shader_hashes_.insert(hash);
+        if (!FileContains(hash)) {
+            good_shader_hashes_.insert(hash);
+        }
     }
 
+    // Used for the cache CoreChecks keeps between runs, see vvl::ValidationCacheFile
+    bool LoadFile(const std::string &path, uint32_t config_id);
+    // Writes the hashes from the file and the ones inserted since LoadFile back to it. Unmaps the file, so only what was
+    // inserted is still known to the cache afterwards.
+    bool SaveFile();
+
   private:
     ValidationCache() {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
@@ -241,18 +263,27 @@ class ValidationCache {
         }
     }
 
+    vvl::span<const uint64_t> FileConfigKeys() const { return file_.ConfigKeys(); }
+    bool FileContains(uint32_t hash) const { return file_.Contains(hash); }
+
     // hashes of shaders that have passed validation before, and can be skipped.
     // we don't store negative results, as we would have to also store what was
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
     vvl::unordered_set<uint32_t> good_shader_hashes_;
     mutable std::shared_mutex lock_;
+
+    // Only modified by LoadFile and SaveFile
+    vvl::ValidationCacheFile file_;
 };
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4);
 
 void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
                             spvtools::ValidatorOptions &options);
+// Identifies the environment and the options AdjustValidatorOptions() would set, see ValidationCache::LoadFile()
+uint32_t GetSpirvValidationConfigId(spv_target_env spirv_environment, const DeviceExtensions &device_extensions,
+                                    const DeviceFeatures &enabled_features);
 
 void GetActiveSlots(ActiveSlotMap &active_slots, const std::shared_ptr<const spirv::EntryPoint> &entrypoint);
 ActiveSlotMap GetActiveSlots(const StageStateVec &stage_states);
@@ -0,0 +1,100 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Fixed set of worker threads owned by a validation object, for expensive work which can be split in independent pieces
+// (ex: instrumenting every shader of a vkCreateGraphicsPipelines call).
+class ThreadPool {
+  public:
+    // With 0 workers everything runs on the calling thread
+    explicit ThreadPool(uint32_t worker_count);
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    ~ThreadPool();
+
+    uint32_t WorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+    // Calls func(i) for every i in [0, count) and returns once all calls returned. The calling thread takes part in the work,
+    // so this makes progress even if every worker is busy, and can be called from a worker.
+    template <typename Func>
+    void ParallelFor(size_t count, const Func &func);
+
+  private:
+    void Enqueue(std::function<void()> &&task);
+    void WorkerLoop();
+
+    std::mutex lock_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+
+template <typename Func>
+void ThreadPool::ParallelFor(size_t count, const Func &func) {
+    if (count == 1 || workers_.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    struct State {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::mutex lock;
+        std::condition_variable cv;
+    };
+    auto state = std::make_shared<State>();
+    // A worker may only pick this up after all the work is done, it must not touch func then since it can be out of scope
+    auto run = [state, &func, count]() {
+        size_t finished = 0;
+        for (size_t i = state->next.fetch_add(1); i < count; i = state->next.fetch_add(1)) {
+            func(i);
+            ++finished;
+        }
+        if (finished != 0 && state->done.fetch_add(finished) + finished == count) {
+            std::lock_guard<std::mutex> guard(state->lock);
+            state->cv.notify_all();
+        }
+    };
+    const size_t helper_count = std::min(workers_.size(), count - 1);
+    for (size_t i = 0; i < helper_count; ++i) {
+        Enqueue(run);
+    }
+    run();
+    std::unique_lock<std::mutex> guard(state->lock);
+    state->cv.wait(guard, [&state, count]() { return state->done.load() == count; });
+}
+
+}  // namespace vvl
@@ -0,0 +1,148 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/validation_cache_file.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include <vulkan/vulkan_core.h>
+#include "utils/hash_util.h"
+#include "generated/spirv_tools_commit_id.h"
+
+namespace vvl {
+
+// Cache file layout:
+//   ValidationCacheFileHeader
+//   uint64_t keys[key_count], sorted, see ValidationCacheFile::Key()
+struct ValidationCacheFileHeader {
+    uint32_t magic;
+    uint32_t file_version;
+    // SPIRV_TOOLS_COMMIT_ID of the layer which wrote the file
+    char build_id[48];
+    // VK_HEADER_VERSION_COMPLETE of the layer which wrote the file
+    uint32_t layer_version;
+    uint32_t key_count;
+    // Hash of the keys
+    uint64_t keys_checksum;
+};
+
+static constexpr uint32_t kFileMagic = 0x43565656;  // "VVVC"
+// Bump when the layout of the file changes
+static constexpr uint32_t kFileVersion = 1;
+
+bool ValidationCacheFile::Load(const std::string &path, uint32_t config_id) {
+    path_ = path;
+    config_id_ = config_id;
+    if (!file_.Open(path)) {
+        return false;
+    }
+
+    ValidationCacheFileHeader header;
+    if (file_.Size() < sizeof(header)) {
+        file_.Close();
+        return false;
+    }
+    std::memcpy(&header, file_.Data(), sizeof(header));
+    // The whole file is dropped when the layer changes, the new spirv-val might not agree with the old one
+    if (header.magic != kFileMagic || header.file_version != kFileVersion || header.layer_version != VK_HEADER_VERSION_COMPLETE ||
+        std::strncmp(header.build_id, SPIRV_TOOLS_COMMIT_ID, sizeof(header.build_id)) != 0 ||
+        header.key_count > (file_.Size() - sizeof(header)) / sizeof(uint64_t)) {
+        file_.Close();
+        return false;
+    }
+    // The mapping is page aligned and the header size is a multiple of the key alignment
+    const auto *keys = reinterpret_cast<const uint64_t *>(file_.Data() + sizeof(header));
+    if (hash_util::CacheDataHash(keys, header.key_count * sizeof(uint64_t)) != header.keys_checksum) {
+        file_.Close();
+        return false;
+    }
+    keys_ = vvl::span<const uint64_t>(keys, header.key_count);
+    return true;
+}
+
+vvl::span<const uint64_t> ValidationCacheFile::ConfigKeys() const {
+    const auto first = std::lower_bound(keys_.begin(), keys_.end(), Key(config_id_, 0));
+    const auto last = std::upper_bound(first, keys_.end(), Key(config_id_, UINT32_MAX));
+    return vvl::span<const uint64_t>(first, static_cast<size_t>(last - first));
+}
+
+bool ValidationCacheFile::Contains(uint32_t hash) const {
+    return std::binary_search(keys_.begin(), keys_.end(), Key(config_id_, hash));
+}
+
+bool ValidationCacheFile::Save(const vvl::unordered_set<uint32_t> &new_hashes) {
+    if (path_.empty()) {
+        return false;
+    }
+    if (new_hashes.empty() && file_.IsOpen()) {
+        return true;  // Nothing new since Load
+    }
+
+    std::vector<uint64_t> new_keys;
+    new_keys.reserve(new_hashes.size());
+    for (const uint32_t hash : new_hashes) {
+        new_keys.emplace_back(Key(config_id_, hash));
+    }
+    std::sort(new_keys.begin(), new_keys.end());
+    std::vector<uint64_t> keys(keys_.size() + new_keys.size());
+    std::merge(keys_.begin(), keys_.end(), new_keys.begin(), new_keys.end(), keys.begin());
+    if (keys.size() > kMaxKeys) {
+        // Only keep the current config
+        const auto first = std::lower_bound(keys.begin(), keys.end(), Key(config_id_, 0));
+        const auto last = std::upper_bound(first, keys.end(), Key(config_id_, UINT32_MAX));
+        keys.erase(last, keys.end());
+        keys.erase(keys.begin(), first);
+        keys.resize(std::min<size_t>(keys.size(), kMaxKeys));
+    }
+
+    ValidationCacheFileHeader header = {};
+    static_assert(sizeof(SPIRV_TOOLS_COMMIT_ID) <= sizeof(header.build_id));
+    static_assert(sizeof(ValidationCacheFileHeader) % sizeof(uint64_t) == 0);
+    header.magic = kFileMagic;
+    header.file_version = kFileVersion;
+    std::strncpy(header.build_id, SPIRV_TOOLS_COMMIT_ID, sizeof(header.build_id));
+    header.layer_version = VK_HEADER_VERSION_COMPLETE;
+    header.key_count = static_cast<uint32_t>(keys.size());
+    header.keys_checksum = hash_util::CacheDataHash(keys.data(), keys.size() * sizeof(uint64_t));
+
+    // Several processes can share the cache file, each one writes its own temporary file and the last one to finish wins
+    const std::string temp_path = path_ + "." + std::to_string(std::random_device{}()) + ".tmp";
+    bool written = false;
+    {
+        std::ofstream file_stream(temp_path, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+        if (file_stream) {
+            file_stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            file_stream.write(reinterpret_cast<const char *>(keys.data()), keys.size() * sizeof(uint64_t));
+            written = file_stream.good();
+        }
+    }
+    // Windows can't replace a file which is still mapped
+    keys_ = {};
+    file_.Close();
+    if (!written || !vvl::CommitTempFile(temp_path, path_)) {
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace vvl
@@ -0,0 +1,56 @@
+/* Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "containers/custom_containers.h"
+#include "utils/file_mapping.h"
+
+namespace vvl {
+
+// Hashes of the shaders which passed spirv-val, kept by CoreChecks between runs (see ValidationCache::LoadFile()).
+// The file is memory mapped and searched in place, so starting with a large cache costs neither reading it up front nor a
+// copy of it in memory.
+class ValidationCacheFile {
+  public:
+    // Keeps a file shared by many configs and applications from growing forever
+    static constexpr uint32_t kMaxKeys = 1u << 22;
+
+    // config_id identifies everything besides the SPIR-V which can change the result of spirv-val, the file keeps the
+    // results of every config it has seen. The path and config_id are kept for Save() even if the file can't be read.
+    bool Load(const std::string &path, uint32_t config_id);
+    // Writes the hashes from the file and new_hashes, which must not be in the file already, back to it. Unmaps the file.
+    bool Save(const vvl::unordered_set<uint32_t> &new_hashes);
+
+    bool IsOpen() const { return file_.IsOpen(); }
+    // Hashes of the current config in the file, as file keys
+    vvl::span<const uint64_t> ConfigKeys() const;
+    bool Contains(uint32_t hash) const;
+
+    // File keys are (config_id << 32 | shader hash), sorted, so all the hashes of a config are next to each other
+    static uint64_t Key(uint32_t config_id, uint32_t hash) { return (uint64_t(config_id) << 32) | hash; }
+
+  private:
+    std::string path_;
+    uint32_t config_id_ = 0;
+    vvl::MappedFile file_;
+    vvl::span<const uint64_t> keys_;
+};
+
+}  // namespace vvl
@@ -40,9 +40,11 @@ void LayerDebugMessengerActions(DebugReport *debug_report, const char *layer_ide
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
     std::string log_filename_key = layer_identifier;
+    std::string log_async_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
+    log_async_key.append(".log_async");
 
     const vvl::unordered_map<std::string, VkFlags> debug_actions_option_definitions = {
         {std::string("VK_DBG_LAYER_ACTION_IGNORE"), VK_DBG_LAYER_ACTION_IGNORE},
@@ -86,8 +88,15 @@ void LayerDebugMessengerActions(DebugReport *debug_report, const char *layer_ide
     if (debug_action & VK_DBG_LAYER_ACTION_LOG_MSG) {
         const char *log_filename = getLayerOption(log_filename_key.c_str());
         FILE *log_output = getLayerLogOutput(log_filename, layer_identifier);
-        dbg_create_info.pfnUserCallback = MessengerLogCallback;
-        dbg_create_info.pUserData = (void *)log_output;
+        const std::string log_async = getLayerOption(log_async_key.c_str());
+        if (log_async == "true") {
+            debug_report->async_log_sink = std::make_unique<AsyncLogSink>(log_output);
+            dbg_create_info.pfnUserCallback = MessengerAsyncLogCallback;
+            dbg_create_info.pUserData = debug_report->async_log_sink.get();
+        } else {
+            dbg_create_info.pfnUserCallback = MessengerLogCallback;
+            dbg_create_info.pUserData = (void *)log_output;
+        }
         LayerCreateMessengerCallback(debug_report, default_layer_callback, &dbg_create_info, &messenger);
     }
 
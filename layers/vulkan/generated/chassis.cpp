@@ -37,11 +37,9 @@ thread_local WriteLockGuard* ValidationObject::record_guard{};
 
 small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 
-// Global unique object identifier.
-std::atomic<uint64_t> global_unique_id(1ULL);
-// Map uniqueID to actual object handle. Accesses to the map itself are
-// internally synchronized.
-vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+// Map uniqueID to actual object handle. The unique IDs are handed out by the table itself and accesses
+// to the table are internally synchronized.
+vvl::concurrent_handle_table unique_id_mapping;
 
 bool wrap_handles = true;
 
@@ -381,6 +379,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
     bool lock_setting;
     GpuAVSettings local_gpuav_settings = {};
     DebugPrintfSettings local_printf_settings = {};
+    SyncValSettings local_syncval_settings = {};
     ConfigAndEnvSettings config_and_env_settings_data{OBJECT_LAYER_DESCRIPTION,
                                                       pCreateInfo,
                                                       local_enables,
@@ -389,7 +388,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
                                                       &debug_report->duplicate_message_limit,
                                                       &lock_setting,
                                                       &local_gpuav_settings,
-                                                      &local_printf_settings};
+                                                      &local_printf_settings,
+                                                      &local_syncval_settings};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
     LayerDebugMessengerActions(debug_report, OBJECT_LAYER_DESCRIPTION);
 
@@ -450,6 +450,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
     framework->fine_grained_locking = lock_setting;
     framework->gpuav_settings = local_gpuav_settings;
     framework->printf_settings = local_printf_settings;
+    framework->syncval_settings = local_syncval_settings;
 
     framework->instance = *pInstance;
     layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -470,6 +471,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
         intercept->fine_grained_locking = framework->fine_grained_locking;
         intercept->gpuav_settings = framework->gpuav_settings;
         intercept->printf_settings = framework->printf_settings;
+        intercept->syncval_settings = framework->syncval_settings;
         intercept->instance = *pInstance;
     }
 
@@ -599,6 +601,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         object->fine_grained_locking = instance_interceptor->fine_grained_locking;
         object->gpuav_settings = instance_interceptor->gpuav_settings;
         object->printf_settings = instance_interceptor->printf_settings;
+        object->syncval_settings = instance_interceptor->syncval_settings;
         object->instance_dispatch_table = instance_interceptor->instance_dispatch_table;
         object->instance_extensions = instance_interceptor->instance_extensions;
         object->device_extensions = device_interceptor->device_extensions;
@@ -649,6 +652,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         delete *item;
     }
     FreeLayerDataPtr(key, layer_data_map);
+
+    // Everything reported about the device is in the log output by the time vkDestroyDevice returns
+    instance_interceptor->debug_report->FlushLogOutput();
 }
 
 // Special-case APIs for which core_validation needs custom parameter lists and/or modifies parameters
@@ -986,6 +992,109 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
     return result;
 }
 
+// These APIs let a layer add command buffers to the batches
+VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
+    auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    bool skip = false;
+    ErrorObject error_obj(vvl::Func::vkQueueSubmit, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
+
+    chassis::QueueSubmit chassis_state{};
+    chassis_state.pSubmits = pSubmits;
+
+    for (const ValidationObject* intercept : layer_data->object_dispatch) {
+        auto lock = intercept->ReadLock();
+        skip |= intercept->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence, error_obj);
+        if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+    }
+
+    RecordObject record_obj(vvl::Func::vkQueueSubmit);
+    for (ValidationObject* intercept : layer_data->object_dispatch) {
+        auto lock = intercept->WriteLock();
+        intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj, chassis_state);
+    }
+
+    VkResult result = DispatchQueueSubmit(queue, submitCount, chassis_state.pSubmits, fence);
+    record_obj.result = result;
+
+    for (ValidationObject* intercept : layer_data->object_dispatch) {
+        auto lock = intercept->WriteLock();
+
+        if (result == VK_ERROR_DEVICE_LOST) {
+            intercept->is_device_lost = true;
+        }
+        intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+    }
+    return result;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+    auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    bool skip = false;
+    ErrorObject error_obj(vvl::Func::vkQueueSubmit2, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
+
+    chassis::QueueSubmit2 chassis_state{};
+    chassis_state.pSubmits = pSubmits;
+
+    for (const ValidationObject* intercept : layer_data->object_dispatch) {
+        auto lock = intercept->ReadLock();
+        skip |= intercept->PreCallValidateQueueSubmit2(queue, submitCount, pSubmits, fence, error_obj);
+        if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+    }
+
+    RecordObject record_obj(vvl::Func::vkQueueSubmit2);
+    for (ValidationObject* intercept : layer_data->object_dispatch) {
+        auto lock = intercept->WriteLock();
+        intercept->PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj, chassis_state);
+    }
+
+    VkResult result = DispatchQueueSubmit2(queue, submitCount, chassis_state.pSubmits, fence);
+    record_obj.result = result;
+
+    for (ValidationObject* intercept : layer_data->object_dispatch) {
+        auto lock = intercept->WriteLock();
+
+        if (result == VK_ERROR_DEVICE_LOST) {
+            intercept->is_device_lost = true;
+        }
+        intercept->PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+    }
+    return result;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+    auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    bool skip = false;
+    ErrorObject error_obj(vvl::Func::vkQueueSubmit2KHR, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
+
+    chassis::QueueSubmit2 chassis_state{};
+    chassis_state.pSubmits = pSubmits;
+
+    for (const ValidationObject* intercept : layer_data->object_dispatch) {
+        auto lock = intercept->ReadLock();
+        skip |= intercept->PreCallValidateQueueSubmit2KHR(queue, submitCount, pSubmits, fence, error_obj);
+        if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+    }
+
+    RecordObject record_obj(vvl::Func::vkQueueSubmit2KHR);
+    for (ValidationObject* intercept : layer_data->object_dispatch) {
+        auto lock = intercept->WriteLock();
+        intercept->PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj, chassis_state);
+    }
+
+    VkResult result = DispatchQueueSubmit2KHR(queue, submitCount, chassis_state.pSubmits, fence);
+    record_obj.result = result;
+
+    for (ValidationObject* intercept : layer_data->object_dispatch) {
+        auto lock = intercept->WriteLock();
+
+        if (result == VK_ERROR_DEVICE_LOST) {
+            intercept->is_device_lost = true;
+        }
+        intercept->PostCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj);
+    }
+    return result;
+}
+
 // Handle tooling queries manually as this is a request for layer information
 static const VkPhysicalDeviceToolPropertiesEXT khronos_layer_tool_props = {
     VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES_EXT,
@@ -1299,6 +1408,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMemoryProperties(VkPhysicalDevice ph
 
 VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceQueue]) {
+        return DispatchGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceQueue, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue]) {
@@ -1318,35 +1430,11 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyI
     }
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
-    auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
-    bool skip = false;
-    ErrorObject error_obj(vvl::Func::vkQueueSubmit, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
-    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit]) {
-        auto lock = intercept->ReadLock();
-        skip |= intercept->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence, error_obj);
-        if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
-    }
-    RecordObject record_obj(vvl::Func::vkQueueSubmit);
-    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit]) {
-        auto lock = intercept->WriteLock();
-        intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
-    }
-    VkResult result = DispatchQueueSubmit(queue, submitCount, pSubmits, fence);
-    record_obj.result = result;
-    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit]) {
-        auto lock = intercept->WriteLock();
-
-        if (result == VK_ERROR_DEVICE_LOST) {
-            intercept->is_device_lost = true;
-        }
-        intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
-    }
-    return result;
-}
-
 VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdQueueWaitIdle]) {
+        return DispatchQueueWaitIdle(queue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueWaitIdle, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueWaitIdle]) {
@@ -1374,6 +1462,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
 
 VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDeviceWaitIdle]) {
+        return DispatchDeviceWaitIdle(device);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDeviceWaitIdle, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeviceWaitIdle]) {
@@ -1402,6 +1493,9 @@ VKAPI_ATTR VkResult VKAPI_CALL DeviceWaitIdle(VkDevice device) {
 VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
                                               const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdAllocateMemory]) {
+        return DispatchAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAllocateMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateMemory]) {
@@ -1425,6 +1519,9 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMemoryAll
 
 VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdFreeMemory]) {
+        return DispatchFreeMemory(device, memory, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkFreeMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeMemory]) {
@@ -1447,6 +1544,9 @@ VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory memory, co
 VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
                                          VkMemoryMapFlags flags, void** ppData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdMapMemory]) {
+        return DispatchMapMemory(device, memory, offset, size, flags, ppData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkMapMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMapMemory]) {
@@ -1470,6 +1570,9 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice device, VkDeviceMemory memory,
 
 VKAPI_ATTR void VKAPI_CALL UnmapMemory(VkDevice device, VkDeviceMemory memory) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdUnmapMemory]) {
+        return DispatchUnmapMemory(device, memory);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUnmapMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUnmapMemory]) {
@@ -1492,6 +1595,9 @@ VKAPI_ATTR void VKAPI_CALL UnmapMemory(VkDevice device, VkDeviceMemory memory) {
 VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
                                                        const VkMappedMemoryRange* pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdFlushMappedMemoryRanges]) {
+        return DispatchFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkFlushMappedMemoryRanges, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFlushMappedMemoryRanges]) {
@@ -1516,6 +1622,9 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(VkDevice device, uint32_t
 VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
                                                             const VkMappedMemoryRange* pMemoryRanges) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdInvalidateMappedMemoryRanges]) {
+        return DispatchInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkInvalidateMappedMemoryRanges, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -1541,6 +1650,9 @@ VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(VkDevice device, uin
 VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory,
                                                      VkDeviceSize* pCommittedMemoryInBytes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceMemoryCommitment]) {
+        return DispatchGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceMemoryCommitment, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceMemoryCommitment]) {
@@ -1563,6 +1675,9 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceMemoryCommitment(VkDevice device, VkDeviceMe
 VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory,
                                                 VkDeviceSize memoryOffset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBindBufferMemory]) {
+        return DispatchBindBufferMemory(device, buffer, memory, memoryOffset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindBufferMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory]) {
@@ -1586,6 +1701,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory(VkDevice device, VkBuffer buffer
 
 VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBindImageMemory]) {
+        return DispatchBindImageMemory(device, image, memory, memoryOffset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindImageMemory, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory]) {
@@ -1610,6 +1728,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory(VkDevice device, VkImage image, V
 VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(VkDevice device, VkBuffer buffer,
                                                        VkMemoryRequirements* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetBufferMemoryRequirements]) {
+        return DispatchGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferMemoryRequirements]) {
@@ -1631,6 +1752,9 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(VkDevice device, VkBuffer
 
 VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageMemoryRequirements]) {
+        return DispatchGetImageMemoryRequirements(device, image, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements]) {
@@ -1653,6 +1777,9 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(VkDevice device, VkImage i
 VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount,
                                                             VkSparseImageMemoryRequirements* pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageSparseMemoryRequirements]) {
+        return DispatchGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSparseMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -1709,6 +1836,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(VkPhysic
 VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo,
                                                VkFence fence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdQueueBindSparse]) {
+        return DispatchQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueBindSparse, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueBindSparse]) {
@@ -1737,6 +1867,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t bindInfoC
 VKAPI_ATTR VkResult VKAPI_CALL CreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateFence]) {
+        return DispatchCreateFence(device, pCreateInfo, pAllocator, pFence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateFence, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFence]) {
@@ -1760,6 +1893,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(VkDevice device, const VkFenceCreateI
 
 VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyFence]) {
+        return DispatchDestroyFence(device, fence, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyFence, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFence]) {
@@ -1781,6 +1917,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice device, VkFence fence, const Vk
 
 VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdResetFences]) {
+        return DispatchResetFences(device, fenceCount, pFences);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetFences, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetFences]) {
@@ -1804,6 +1943,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount,
 
 VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(VkDevice device, VkFence fence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetFenceStatus]) {
+        return DispatchGetFenceStatus(device, fence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetFenceStatus, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceStatus]) {
@@ -1832,6 +1974,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceStatus(VkDevice device, VkFence fence) {
 VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll,
                                              uint64_t timeout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdWaitForFences]) {
+        return DispatchWaitForFences(device, fenceCount, pFences, waitAll, timeout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWaitForFences, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForFences]) {
@@ -1860,6 +2005,9 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice device, uint32_t fenceCoun
 VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo,
                                                const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateSemaphore]) {
+        return DispatchCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSemaphore, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSemaphore]) {
@@ -1883,6 +2031,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphor
 
 VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroySemaphore]) {
+        return DispatchDestroySemaphore(device, semaphore, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroySemaphore, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySemaphore]) {
@@ -1905,6 +2056,9 @@ VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice device, VkSemaphore semapho
 VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateEvent]) {
+        return DispatchCreateEvent(device, pCreateInfo, pAllocator, pEvent);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateEvent, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateEvent]) {
@@ -1928,6 +2082,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice device, const VkEventCreateI
 
 VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyEvent]) {
+        return DispatchDestroyEvent(device, event, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyEvent, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyEvent]) {
@@ -1949,6 +2106,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const Vk
 
 VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(VkDevice device, VkEvent event) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetEventStatus]) {
+        return DispatchGetEventStatus(device, event);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetEventStatus, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetEventStatus]) {
@@ -1976,6 +2136,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(VkDevice device, VkEvent event) {
 
 VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice device, VkEvent event) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetEvent]) {
+        return DispatchSetEvent(device, event);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetEvent, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetEvent]) {
@@ -1999,6 +2162,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice device, VkEvent event) {
 
 VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(VkDevice device, VkEvent event) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdResetEvent]) {
+        return DispatchResetEvent(device, event);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetEvent, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetEvent]) {
@@ -2023,6 +2189,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(VkDevice device, VkEvent event) {
 VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo,
                                                const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateQueryPool]) {
+        return DispatchCreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateQueryPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateQueryPool]) {
@@ -2046,6 +2215,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoo
 
 VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyQueryPool]) {
+        return DispatchDestroyQueryPool(device, queryPool, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyQueryPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyQueryPool]) {
@@ -2068,6 +2240,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(VkDevice device, VkQueryPool queryPo
 VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
                                                    size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetQueryPoolResults]) {
+        return DispatchGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetQueryPoolResults, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueryPoolResults]) {
@@ -2098,6 +2273,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool
 
 VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyBuffer]) {
+        return DispatchDestroyBuffer(device, buffer, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyBuffer, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBuffer]) {
@@ -2120,6 +2298,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer, const
 VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo,
                                                 const VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateBufferView]) {
+        return DispatchCreateBufferView(device, pCreateInfo, pAllocator, pView);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateBufferView, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateBufferView]) {
@@ -2143,6 +2324,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferV
 
 VKAPI_ATTR void VKAPI_CALL DestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyBufferView]) {
+        return DispatchDestroyBufferView(device, bufferView, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyBufferView, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyBufferView]) {
@@ -2165,6 +2349,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferView(VkDevice device, VkBufferView buffe
 VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkImage* pImage) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateImage]) {
+        return DispatchCreateImage(device, pCreateInfo, pAllocator, pImage);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateImage, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImage]) {
@@ -2188,6 +2375,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateI
 
 VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyImage]) {
+        return DispatchDestroyImage(device, image, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyImage, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImage]) {
@@ -2210,6 +2400,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const Vk
 VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource,
                                                      VkSubresourceLayout* pLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageSubresourceLayout]) {
+        return DispatchGetImageSubresourceLayout(device, image, pSubresource, pLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSubresourceLayout, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageSubresourceLayout]) {
@@ -2232,6 +2425,9 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(VkDevice device, VkImage im
 VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo,
                                                const VkAllocationCallbacks* pAllocator, VkImageView* pView) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateImageView]) {
+        return DispatchCreateImageView(device, pCreateInfo, pAllocator, pView);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateImageView, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateImageView]) {
@@ -2255,6 +2451,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageVie
 
 VKAPI_ATTR void VKAPI_CALL DestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyImageView]) {
+        return DispatchDestroyImageView(device, imageView, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyImageView, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyImageView]) {
@@ -2277,6 +2476,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyImageView(VkDevice device, VkImageView imageVi
 VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
                                                const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyShaderModule]) {
+        return DispatchDestroyShaderModule(device, shaderModule, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyShaderModule, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyShaderModule]) {
@@ -2299,6 +2501,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice device, VkShaderModule s
 VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo,
                                                    const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreatePipelineCache]) {
+        return DispatchCreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreatePipelineCache, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineCache]) {
@@ -2323,6 +2528,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(VkDevice device, const VkPipe
 VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache,
                                                 const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyPipelineCache]) {
+        return DispatchDestroyPipelineCache(device, pipelineCache, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyPipelineCache, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineCache]) {
@@ -2345,6 +2553,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(VkDevice device, VkPipelineCache
 VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize,
                                                     void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPipelineCacheData]) {
+        return DispatchGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineCacheData, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelineCacheData]) {
@@ -2369,6 +2580,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice device, VkPipelineC
 VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount,
                                                    const VkPipelineCache* pSrcCaches) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdMergePipelineCaches]) {
+        return DispatchMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkMergePipelineCaches, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMergePipelineCaches]) {
@@ -2392,6 +2606,9 @@ VKAPI_ATTR VkResult VKAPI_CALL MergePipelineCaches(VkDevice device, VkPipelineCa
 
 VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyPipeline]) {
+        return DispatchDestroyPipeline(device, pipeline, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyPipeline, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipeline]) {
@@ -2414,6 +2631,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pipeline,
 VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout,
                                                  const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyPipelineLayout]) {
+        return DispatchDestroyPipelineLayout(device, pipelineLayout, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyPipelineLayout, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPipelineLayout]) {
@@ -2436,6 +2656,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipelineLayo
 VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo,
                                              const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateSampler]) {
+        return DispatchCreateSampler(device, pCreateInfo, pAllocator, pSampler);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSampler, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSampler]) {
@@ -2459,6 +2682,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCre
 
 VKAPI_ATTR void VKAPI_CALL DestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroySampler]) {
+        return DispatchDestroySampler(device, sampler, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroySampler, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySampler]) {
@@ -2482,6 +2708,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(VkDevice device, const
                                                          const VkAllocationCallbacks* pAllocator,
                                                          VkDescriptorSetLayout* pSetLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateDescriptorSetLayout]) {
+        return DispatchCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateDescriptorSetLayout, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorSetLayout]) {
@@ -2506,6 +2735,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(VkDevice device, const
 VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout,
                                                       const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyDescriptorSetLayout]) {
+        return DispatchDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyDescriptorSetLayout, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorSetLayout]) {
@@ -2528,6 +2760,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice device, VkDescrip
 VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo,
                                                     const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateDescriptorPool]) {
+        return DispatchCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateDescriptorPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDescriptorPool]) {
@@ -2552,6 +2787,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(VkDevice device, const VkDes
 VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                  const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyDescriptorPool]) {
+        return DispatchDestroyDescriptorPool(device, descriptorPool, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyDescriptorPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDescriptorPool]) {
@@ -2574,6 +2812,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(VkDevice device, VkDescriptorPo
 VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                    VkDescriptorPoolResetFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdResetDescriptorPool]) {
+        return DispatchResetDescriptorPool(device, descriptorPool, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetDescriptorPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetDescriptorPool]) {
@@ -2598,6 +2839,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice device, VkDescriptor
 VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                                   const VkDescriptorSet* pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdFreeDescriptorSets]) {
+        return DispatchFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkFreeDescriptorSets, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeDescriptorSets]) {
@@ -2624,6 +2868,10 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(VkDevice device, uint32_t descri
                                                 const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount,
                                                 const VkCopyDescriptorSet* pDescriptorCopies) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdUpdateDescriptorSets]) {
+        return DispatchUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
+                                            pDescriptorCopies);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUpdateDescriptorSets, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUpdateDescriptorSets]) {
@@ -2649,6 +2897,9 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(VkDevice device, uint32_t descri
 VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo,
                                                  const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateFramebuffer]) {
+        return DispatchCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateFramebuffer, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateFramebuffer]) {
@@ -2672,6 +2923,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFrameb
 
 VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyFramebuffer]) {
+        return DispatchDestroyFramebuffer(device, framebuffer, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyFramebuffer, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyFramebuffer]) {
@@ -2694,6 +2948,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice device, VkFramebuffer fra
 VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo,
                                                 const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateRenderPass]) {
+        return DispatchCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateRenderPass, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass]) {
@@ -2717,6 +2974,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderP
 
 VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyRenderPass]) {
+        return DispatchDestroyRenderPass(device, renderPass, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyRenderPass, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyRenderPass]) {
@@ -2738,6 +2998,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice device, VkRenderPass rende
 
 VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetRenderAreaGranularity]) {
+        return DispatchGetRenderAreaGranularity(device, renderPass, pGranularity);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRenderAreaGranularity, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetRenderAreaGranularity]) {
@@ -2760,6 +3023,9 @@ VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice device, VkRenderPas
 VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo,
                                                  const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateCommandPool]) {
+        return DispatchCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateCommandPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCommandPool]) {
@@ -2783,6 +3049,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkComman
 
 VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyCommandPool]) {
+        return DispatchDestroyCommandPool(device, commandPool, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyCommandPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCommandPool]) {
@@ -2804,6 +3073,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool com
 
 VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdResetCommandPool]) {
+        return DispatchResetCommandPool(device, commandPool, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetCommandPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandPool]) {
@@ -2828,6 +3100,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice device, VkCommandPool c
 VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
                                                       VkCommandBuffer* pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdAllocateCommandBuffers]) {
+        return DispatchAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAllocateCommandBuffers, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAllocateCommandBuffers]) {
@@ -2852,6 +3127,9 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkC
 VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                               const VkCommandBuffer* pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdFreeCommandBuffers]) {
+        return DispatchFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkFreeCommandBuffers, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateFreeCommandBuffers]) {
@@ -2873,6 +3151,9 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool com
 
 VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBeginCommandBuffer]) {
+        return DispatchBeginCommandBuffer(commandBuffer, pBeginInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBeginCommandBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
@@ -2896,6 +3177,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdEndCommandBuffer]) {
+        return DispatchEndCommandBuffer(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkEndCommandBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateEndCommandBuffer]) {
@@ -2919,6 +3203,9 @@ VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
 
 VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdResetCommandBuffer]) {
+        return DispatchResetCommandBuffer(commandBuffer, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetCommandBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetCommandBuffer]) {
@@ -2943,6 +3230,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                            VkPipeline pipeline) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindPipeline]) {
+        return DispatchCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindPipeline, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindPipeline]) {
@@ -2965,6 +3255,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipe
 VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
                                           const VkViewport* pViewports) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetViewport]) {
+        return DispatchCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewport, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewport]) {
@@ -2987,6 +3280,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(VkCommandBuffer commandBuffer, uint32_
 VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
                                          const VkRect2D* pScissors) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetScissor]) {
+        return DispatchCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetScissor, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissor]) {
@@ -3008,6 +3304,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t
 
 VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetLineWidth]) {
+        return DispatchCmdSetLineWidth(commandBuffer, lineWidth);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLineWidth, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineWidth]) {
@@ -3030,6 +3329,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineWidth(VkCommandBuffer commandBuffer, float
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp,
                                            float depthBiasSlopeFactor) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthBias]) {
+        return DispatchCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBias, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias]) {
@@ -3054,6 +3356,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias(VkCommandBuffer commandBuffer, float
 
 VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetBlendConstants]) {
+        return DispatchCmdSetBlendConstants(commandBuffer, blendConstants);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetBlendConstants, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetBlendConstants]) {
@@ -3075,6 +3380,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetBlendConstants(VkCommandBuffer commandBuffer, c
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthBounds]) {
+        return DispatchCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBounds, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBounds]) {
@@ -3097,6 +3405,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBounds(VkCommandBuffer commandBuffer, floa
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
                                                     uint32_t compareMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetStencilCompareMask]) {
+        return DispatchCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilCompareMask, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilCompareMask]) {
@@ -3118,6 +3429,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilCompareMask(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetStencilWriteMask]) {
+        return DispatchCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilWriteMask, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilWriteMask]) {
@@ -3139,6 +3453,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilWriteMask(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetStencilReference]) {
+        return DispatchCmdSetStencilReference(commandBuffer, faceMask, reference);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilReference, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilReference]) {
@@ -3163,6 +3480,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
                                                  const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount,
                                                  const uint32_t* pDynamicOffsets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindDescriptorSets]) {
+        return DispatchCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount,
+                                             pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindDescriptorSets, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets]) {
@@ -3190,6 +3511,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                               VkIndexType indexType) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindIndexBuffer]) {
+        return DispatchCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindIndexBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer]) {
@@ -3212,6 +3536,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkB
 VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
                                                 const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindVertexBuffers]) {
+        return DispatchCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindVertexBuffers, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers]) {
@@ -3235,6 +3562,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers(VkCommandBuffer commandBuffer, u
 VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
                                    uint32_t firstVertex, uint32_t firstInstance) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDraw]) {
+        return DispatchCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDraw, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDraw]) {
@@ -3257,6 +3587,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDraw(VkCommandBuffer commandBuffer, uint32_t verte
 VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
                                           uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawIndexed]) {
+        return DispatchCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndexed, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexed]) {
@@ -3282,6 +3615,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_
 VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount,
                                            uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawIndirect]) {
+        return DispatchCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirect, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirect]) {
@@ -3304,6 +3640,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuff
 VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                   uint32_t drawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawIndexedIndirect]) {
+        return DispatchCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndexedIndirect, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirect]) {
@@ -3326,6 +3665,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
                                        uint32_t groupCountZ) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDispatch]) {
+        return DispatchCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatch, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatch]) {
@@ -3347,6 +3689,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatch(VkCommandBuffer commandBuffer, uint32_t g
 
 VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDispatchIndirect]) {
+        return DispatchCmdDispatchIndirect(commandBuffer, buffer, offset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchIndirect, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchIndirect]) {
@@ -3369,6 +3714,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuffer, Vk
 VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
                                          uint32_t regionCount, const VkBufferCopy* pRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyBuffer]) {
+        return DispatchCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer]) {
@@ -3392,6 +3740,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(VkCommandBuffer commandBuffer, VkImage s
                                         VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                         const VkImageCopy* pRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyImage]) {
+        return DispatchCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage]) {
@@ -3418,6 +3769,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(VkCommandBuffer commandBuffer, VkImage s
                                         VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                         const VkImageBlit* pRegions, VkFilter filter) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBlitImage]) {
+        return DispatchCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions,
+                                    filter);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBlitImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage]) {
@@ -3444,6 +3799,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
                                                 VkImageLayout dstImageLayout, uint32_t regionCount,
                                                 const VkBufferImageCopy* pRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyBufferToImage]) {
+        return DispatchCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBufferToImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage]) {
@@ -3469,6 +3827,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(VkCommandBuffer commandBuffer, V
 VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
                                                 VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyImageToBuffer]) {
+        return DispatchCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImageToBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer]) {
@@ -3494,6 +3855,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, V
 VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                            VkDeviceSize dataSize, const void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdUpdateBuffer]) {
+        return DispatchCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdUpdateBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdUpdateBuffer]) {
@@ -3516,6 +3880,9 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuff
 VKAPI_ATTR void VKAPI_CALL CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                          VkDeviceSize size, uint32_t data) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdFillBuffer]) {
+        return DispatchCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdFillBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdFillBuffer]) {
@@ -3539,6 +3906,9 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(VkCommandBuffer commandBuffer, VkI
                                               const VkClearColorValue* pColor, uint32_t rangeCount,
                                               const VkImageSubresourceRange* pRanges) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdClearColorImage]) {
+        return DispatchCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdClearColorImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearColorImage]) {
@@ -3563,6 +3933,9 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(VkCommandBuffer commandBuff
                                                      const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount,
                                                      const VkImageSubresourceRange* pRanges) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdClearDepthStencilImage]) {
+        return DispatchCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdClearDepthStencilImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearDepthStencilImage]) {
@@ -3589,6 +3962,9 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(VkCommandBuffer commandBuffer, ui
                                                const VkClearAttachment* pAttachments, uint32_t rectCount,
                                                const VkClearRect* pRects) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdClearAttachments]) {
+        return DispatchCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdClearAttachments, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdClearAttachments]) {
@@ -3613,6 +3989,9 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(VkCommandBuffer commandBuffer, VkImag
                                            VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
                                            const VkImageResolve* pRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdResolveImage]) {
+        return DispatchCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResolveImage, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage]) {
@@ -3637,6 +4016,9 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(VkCommandBuffer commandBuffer, VkImag
 
 VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetEvent]) {
+        return DispatchCmdSetEvent(commandBuffer, event, stageMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetEvent, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent]) {
@@ -3658,6 +4040,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent ev
 
 VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdResetEvent]) {
+        return DispatchCmdResetEvent(commandBuffer, event, stageMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResetEvent, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent]) {
@@ -3683,6 +4068,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t
                                          uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
                                          uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWaitEvents]) {
+        return DispatchCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount,
+                                     pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount,
+                                     pImageMemoryBarriers);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWaitEvents, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents]) {
@@ -3715,6 +4105,11 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
                                               uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
                                               uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdPipelineBarrier]) {
+        return DispatchCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount,
+                                          pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount,
+                                          pImageMemoryBarriers);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPipelineBarrier, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier]) {
@@ -3744,6 +4139,9 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
 VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
                                          VkQueryControlFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginQuery]) {
+        return DispatchCmdBeginQuery(commandBuffer, queryPool, query, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginQuery, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQuery]) {
@@ -3765,6 +4163,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryP
 
 VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndQuery]) {
+        return DispatchCmdEndQuery(commandBuffer, queryPool, query);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndQuery, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQuery]) {
@@ -3787,6 +4188,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPoo
 VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
                                              uint32_t queryCount) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdResetQueryPool]) {
+        return DispatchCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResetQueryPool, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetQueryPool]) {
@@ -3809,6 +4213,9 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQu
 VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
                                              VkQueryPool queryPool, uint32_t query) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWriteTimestamp]) {
+        return DispatchCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteTimestamp, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp]) {
@@ -3832,6 +4239,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
                                                    uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                    VkDeviceSize stride, VkQueryResultFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyQueryPoolResults]) {
+        return DispatchCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride,
+                                               flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyQueryPoolResults, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyQueryPoolResults]) {
@@ -3857,6 +4268,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
                                             uint32_t offset, uint32_t size, const void* pValues) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdPushConstants]) {
+        return DispatchCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushConstants, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants]) {
@@ -3879,6 +4293,9 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants(VkCommandBuffer commandBuffer, VkPip
 VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
                                               VkSubpassContents contents) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginRenderPass]) {
+        return DispatchCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginRenderPass, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass]) {
@@ -3900,6 +4317,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
 
 VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdNextSubpass]) {
+        return DispatchCmdNextSubpass(commandBuffer, contents);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdNextSubpass, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass]) {
@@ -3921,6 +4341,9 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpa
 
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndRenderPass]) {
+        return DispatchCmdEndRenderPass(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndRenderPass, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass]) {
@@ -3943,6 +4366,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
 VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                               const VkCommandBuffer* pCommandBuffers) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdExecuteCommands]) {
+        return DispatchCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdExecuteCommands, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdExecuteCommands]) {
@@ -3965,6 +4391,9 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
 VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(VkDevice device, uint32_t bindInfoCount,
                                                  const VkBindBufferMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBindBufferMemory2]) {
+        return DispatchBindBufferMemory2(device, bindInfoCount, pBindInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindBufferMemory2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2]) {
@@ -3988,6 +4417,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(VkDevice device, uint32_t bindI
 
 VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBindImageMemory2]) {
+        return DispatchBindImageMemory2(device, bindInfoCount, pBindInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindImageMemory2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2]) {
@@ -4013,6 +4445,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(VkDevice device, uin
                                                             uint32_t remoteDeviceIndex,
                                                             VkPeerMemoryFeatureFlags* pPeerMemoryFeatures) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceGroupPeerMemoryFeatures]) {
+        return DispatchGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex,
+                                                        pPeerMemoryFeatures);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceGroupPeerMemoryFeatures, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4038,6 +4474,9 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeatures(VkDevice device, uin
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDeviceMask]) {
+        return DispatchCmdSetDeviceMask(commandBuffer, deviceMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDeviceMask, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMask]) {
@@ -4060,6 +4499,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMask(VkCommandBuffer commandBuffer, uint3
 VKAPI_ATTR void VKAPI_CALL CmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY,
                                            uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDispatchBase]) {
+        return DispatchCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchBase, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBase]) {
@@ -4112,6 +4554,9 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDeviceGroups(VkInstance instance
 VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo,
                                                        VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageMemoryRequirements2]) {
+        return DispatchGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageMemoryRequirements2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageMemoryRequirements2]) {
@@ -4134,6 +4579,9 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(VkDevice device, const Vk
 VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo,
                                                         VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetBufferMemoryRequirements2]) {
+        return DispatchGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferMemoryRequirements2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4158,6 +4606,9 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(VkDevice device, co
                                                              uint32_t* pSparseMemoryRequirementCount,
                                                              VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageSparseMemoryRequirements2]) {
+        return DispatchGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSparseMemoryRequirements2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4357,6 +4808,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2(VkPhysi
 
 VKAPI_ATTR void VKAPI_CALL TrimCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdTrimCommandPool]) {
+        return DispatchTrimCommandPool(device, commandPool, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkTrimCommandPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPool]) {
@@ -4378,6 +4832,9 @@ VKAPI_ATTR void VKAPI_CALL TrimCommandPool(VkDevice device, VkCommandPool comman
 
 VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceQueue2]) {
+        return DispatchGetDeviceQueue2(device, pQueueInfo, pQueue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceQueue2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceQueue2]) {
@@ -4401,6 +4858,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(VkDevice device, con
                                                             const VkAllocationCallbacks* pAllocator,
                                                             VkSamplerYcbcrConversion* pYcbcrConversion) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateSamplerYcbcrConversion]) {
+        return DispatchCreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSamplerYcbcrConversion, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4427,6 +4887,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(VkDevice device, con
 VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion,
                                                          const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroySamplerYcbcrConversion]) {
+        return DispatchDestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroySamplerYcbcrConversion, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4452,6 +4915,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(VkDevice device,
                                                               const VkAllocationCallbacks* pAllocator,
                                                               VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateDescriptorUpdateTemplate]) {
+        return DispatchCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateDescriptorUpdateTemplate, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4480,6 +4946,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                            const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyDescriptorUpdateTemplate]) {
+        return DispatchDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyDescriptorUpdateTemplate, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4503,6 +4972,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(VkDevice device, VkDe
 VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet,
                                                            VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdUpdateDescriptorSetWithTemplate]) {
+        return DispatchUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUpdateDescriptorSetWithTemplate, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4609,6 +5081,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphoreProperties(
 VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
                                                          VkDescriptorSetLayoutSupport* pSupport) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDescriptorSetLayoutSupport]) {
+        return DispatchGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetLayoutSupport, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4633,6 +5108,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount(VkCommandBuffer commandBuffer, V
                                                 VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                 uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawIndirectCount]) {
+        return DispatchCmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirectCount, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCount]) {
@@ -4659,6 +5137,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(VkCommandBuffer commandBu
                                                        VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                        uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawIndexedIndirectCount]) {
+        return DispatchCmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                   stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndexedIndirectCount,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -4685,6 +5167,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount(VkCommandBuffer commandBu
 VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo,
                                                  const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateRenderPass2]) {
+        return DispatchCreateRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateRenderPass2, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2]) {
@@ -4709,6 +5194,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(VkDevice device, const VkRender
 VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
                                                const VkSubpassBeginInfo* pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginRenderPass2]) {
+        return DispatchCmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginRenderPass2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2]) {
@@ -4731,6 +5219,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(VkCommandBuffer commandBuffer, co
 VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo,
                                            const VkSubpassEndInfo* pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdNextSubpass2]) {
+        return DispatchCmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdNextSubpass2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2]) {
@@ -4752,6 +5243,9 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(VkCommandBuffer commandBuffer, const
 
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndRenderPass2]) {
+        return DispatchCmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndRenderPass2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2]) {
@@ -4773,6 +5267,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(VkCommandBuffer commandBuffer, cons
 
 VKAPI_ATTR void VKAPI_CALL ResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdResetQueryPool]) {
+        return DispatchResetQueryPool(device, queryPool, firstQuery, queryCount);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetQueryPool, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPool]) {
@@ -4794,6 +5291,9 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPool(VkDevice device, VkQueryPool queryPool
 
 VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetSemaphoreCounterValue]) {
+        return DispatchGetSemaphoreCounterValue(device, semaphore, pValue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSemaphoreCounterValue, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValue]) {
@@ -4821,6 +5321,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(VkDevice device, VkSemap
 
 VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdWaitSemaphores]) {
+        return DispatchWaitSemaphores(device, pWaitInfo, timeout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWaitSemaphores, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphores]) {
@@ -4848,6 +5351,9 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(VkDevice device, const VkSemaphore
 
 VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSignalSemaphore]) {
+        return DispatchSignalSemaphore(device, pSignalInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSignalSemaphore, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphore]) {
@@ -4871,6 +5377,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(VkDevice device, const VkSemaphor
 
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetBufferDeviceAddress]) {
+        return DispatchGetBufferDeviceAddress(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferDeviceAddress, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddress]) {
@@ -4894,6 +5403,9 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(VkDevice device, co
 
 VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetBufferOpaqueCaptureAddress]) {
+        return DispatchGetBufferOpaqueCaptureAddress(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferOpaqueCaptureAddress, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4918,6 +5430,9 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(VkDevice device, co
 VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(VkDevice device,
                                                                    const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceMemoryOpaqueCaptureAddress]) {
+        return DispatchGetDeviceMemoryOpaqueCaptureAddress(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceMemoryOpaqueCaptureAddress, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -4943,6 +5458,9 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(VkDevice devi
 VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlot(VkDevice device, const VkPrivateDataSlotCreateInfo* pCreateInfo,
                                                      const VkAllocationCallbacks* pAllocator, VkPrivateDataSlot* pPrivateDataSlot) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreatePrivateDataSlot]) {
+        return DispatchCreatePrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreatePrivateDataSlot, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlot]) {
@@ -4967,6 +5485,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlot(VkDevice device, const VkPr
 VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlot(VkDevice device, VkPrivateDataSlot privateDataSlot,
                                                   const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyPrivateDataSlot]) {
+        return DispatchDestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyPrivateDataSlot, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlot]) {
@@ -4989,6 +5510,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlot(VkDevice device, VkPrivateData
 VKAPI_ATTR VkResult VKAPI_CALL SetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
                                               VkPrivateDataSlot privateDataSlot, uint64_t data) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetPrivateData]) {
+        return DispatchSetPrivateData(device, objectType, objectHandle, privateDataSlot, data);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetPrivateData, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateData]) {
@@ -5013,6 +5537,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateData(VkDevice device, VkObjectType obje
 VKAPI_ATTR void VKAPI_CALL GetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
                                           VkPrivateDataSlot privateDataSlot, uint64_t* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPrivateData]) {
+        return DispatchGetPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPrivateData, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateData]) {
@@ -5034,6 +5561,9 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateData(VkDevice device, VkObjectType objectTy
 
 VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo* pDependencyInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetEvent2]) {
+        return DispatchCmdSetEvent2(commandBuffer, event, pDependencyInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetEvent2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent2]) {
@@ -5055,6 +5585,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent e
 
 VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdResetEvent2]) {
+        return DispatchCmdResetEvent2(commandBuffer, event, stageMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResetEvent2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent2]) {
@@ -5077,6 +5610,9 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent
 VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                           const VkDependencyInfo* pDependencyInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWaitEvents2]) {
+        return DispatchCmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWaitEvents2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents2]) {
@@ -5098,6 +5634,9 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_
 
 VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdPipelineBarrier2]) {
+        return DispatchCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPipelineBarrier2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier2]) {
@@ -5120,6 +5659,9 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2(VkCommandBuffer commandBuffer, co
 VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool,
                                               uint32_t query) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWriteTimestamp2]) {
+        return DispatchCmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteTimestamp2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp2]) {
@@ -5139,35 +5681,11 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkP
     }
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
-    auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
-    bool skip = false;
-    ErrorObject error_obj(vvl::Func::vkQueueSubmit2, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
-    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit2]) {
-        auto lock = intercept->ReadLock();
-        skip |= intercept->PreCallValidateQueueSubmit2(queue, submitCount, pSubmits, fence, error_obj);
-        if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
-    }
-    RecordObject record_obj(vvl::Func::vkQueueSubmit2);
-    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit2]) {
-        auto lock = intercept->WriteLock();
-        intercept->PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
-    }
-    VkResult result = DispatchQueueSubmit2(queue, submitCount, pSubmits, fence);
-    record_obj.result = result;
-    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit2]) {
-        auto lock = intercept->WriteLock();
-
-        if (result == VK_ERROR_DEVICE_LOST) {
-            intercept->is_device_lost = true;
-        }
-        intercept->PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
-    }
-    return result;
-}
-
 VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyBuffer2]) {
+        return DispatchCmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBuffer2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2]) {
@@ -5189,6 +5707,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2(VkCommandBuffer commandBuffer, const V
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2* pCopyImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyImage2]) {
+        return DispatchCmdCopyImage2(commandBuffer, pCopyImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImage2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2]) {
@@ -5211,6 +5732,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2(VkCommandBuffer commandBuffer, const Vk
 VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2(VkCommandBuffer commandBuffer,
                                                  const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyBufferToImage2]) {
+        return DispatchCmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBufferToImage2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2]) {
@@ -5233,6 +5757,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2(VkCommandBuffer commandBuffer,
                                                  const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyImageToBuffer2]) {
+        return DispatchCmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImageToBuffer2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2]) {
@@ -5254,6 +5781,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2* pBlitImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBlitImage2]) {
+        return DispatchCmdBlitImage2(commandBuffer, pBlitImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBlitImage2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2]) {
@@ -5275,6 +5805,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2(VkCommandBuffer commandBuffer, const Vk
 
 VKAPI_ATTR void VKAPI_CALL CmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdResolveImage2]) {
+        return DispatchCmdResolveImage2(commandBuffer, pResolveImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResolveImage2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2]) {
@@ -5296,6 +5829,9 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2(VkCommandBuffer commandBuffer, const
 
 VKAPI_ATTR void VKAPI_CALL CmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginRendering]) {
+        return DispatchCmdBeginRendering(commandBuffer, pRenderingInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginRendering, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRendering]) {
@@ -5317,6 +5853,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRendering(VkCommandBuffer commandBuffer, cons
 
 VKAPI_ATTR void VKAPI_CALL CmdEndRendering(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndRendering]) {
+        return DispatchCmdEndRendering(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndRendering, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRendering]) {
@@ -5338,6 +5877,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRendering(VkCommandBuffer commandBuffer) {
 
 VKAPI_ATTR void VKAPI_CALL CmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetCullMode]) {
+        return DispatchCmdSetCullMode(commandBuffer, cullMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCullMode, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullMode]) {
@@ -5359,6 +5901,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullMode(VkCommandBuffer commandBuffer, VkCullM
 
 VKAPI_ATTR void VKAPI_CALL CmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetFrontFace]) {
+        return DispatchCmdSetFrontFace(commandBuffer, frontFace);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetFrontFace, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFace]) {
@@ -5380,6 +5925,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFace(VkCommandBuffer commandBuffer, VkFron
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopology(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetPrimitiveTopology]) {
+        return DispatchCmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPrimitiveTopology, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPrimitiveTopology]) {
@@ -5402,6 +5950,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopology(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount,
                                                    const VkViewport* pViewports) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetViewportWithCount]) {
+        return DispatchCmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportWithCount, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWithCount]) {
@@ -5423,6 +5974,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCount(VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetScissorWithCount]) {
+        return DispatchCmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetScissorWithCount, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCount]) {
@@ -5446,6 +6000,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2(VkCommandBuffer commandBuffer,
                                                  const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes,
                                                  const VkDeviceSize* pStrides) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindVertexBuffers2]) {
+        return DispatchCmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindVertexBuffers2, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2]) {
@@ -5470,6 +6027,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthTestEnable]) {
+        return DispatchCmdSetDepthTestEnable(commandBuffer, depthTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthTestEnable, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnable]) {
@@ -5491,6 +6051,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnable(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthWriteEnable]) {
+        return DispatchCmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthWriteEnable, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnable]) {
@@ -5512,6 +6075,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnable(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthCompareOp]) {
+        return DispatchCmdSetDepthCompareOp(commandBuffer, depthCompareOp);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthCompareOp, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOp]) {
@@ -5533,6 +6099,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOp(VkCommandBuffer commandBuffer, V
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthBoundsTestEnable]) {
+        return DispatchCmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBoundsTestEnable,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -5555,6 +6124,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnable(VkCommandBuffer commandBu
 
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnable(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetStencilTestEnable]) {
+        return DispatchCmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilTestEnable, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilTestEnable]) {
@@ -5577,6 +6149,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnable(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp,
                                            VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetStencilOp]) {
+        return DispatchCmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilOp, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOp]) {
@@ -5599,6 +6174,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOp(VkCommandBuffer commandBuffer, VkSten
 
 VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetRasterizerDiscardEnable]) {
+        return DispatchCmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRasterizerDiscardEnable,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -5622,6 +6200,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnable(VkCommandBuffer command
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthBiasEnable]) {
+        return DispatchCmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBiasEnable, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBiasEnable]) {
@@ -5643,6 +6224,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnable(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetPrimitiveRestartEnable]) {
+        return DispatchCmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPrimitiveRestartEnable,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -5667,6 +6251,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnable(VkCommandBuffer commandB
 VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirements(VkDevice device, const VkDeviceBufferMemoryRequirements* pInfo,
                                                              VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceBufferMemoryRequirements]) {
+        return DispatchGetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceBufferMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -5690,6 +6277,9 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirements(VkDevice device, co
 VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirements(VkDevice device, const VkDeviceImageMemoryRequirements* pInfo,
                                                             VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceImageMemoryRequirements]) {
+        return DispatchGetDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceImageMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -5714,6 +6304,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirements(VkDevice devic
                                                                   uint32_t* pSparseMemoryRequirementCount,
                                                                   VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceImageSparseMemoryRequirements]) {
+        return DispatchGetDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount,
+                                                              pSparseMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceImageSparseMemoryRequirements, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -5875,6 +6469,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModesKHR(VkPhysica
 VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateSwapchainKHR]) {
+        return DispatchCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSwapchainKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSwapchainKHR]) {
@@ -5902,6 +6499,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const VkSwapc
 
 VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroySwapchainKHR]) {
+        return DispatchDestroySwapchainKHR(device, swapchain, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroySwapchainKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroySwapchainKHR]) {
@@ -5924,6 +6524,9 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR s
 VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount,
                                                      VkImage* pSwapchainImages) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetSwapchainImagesKHR]) {
+        return DispatchGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSwapchainImagesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainImagesKHR]) {
@@ -5949,6 +6552,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchai
 VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
                                                    VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdAcquireNextImageKHR]) {
+        return DispatchAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAcquireNextImageKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImageKHR]) {
@@ -5976,6 +6582,9 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(VkDevice device, VkSwapchainK
 
 VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdQueuePresentKHR]) {
+        return DispatchQueuePresentKHR(queue, pPresentInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueuePresentKHR, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueuePresentKHR]) {
@@ -6004,6 +6613,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
 VKAPI_ATTR VkResult VKAPI_CALL
 GetDeviceGroupPresentCapabilitiesKHR(VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceGroupPresentCapabilitiesKHR]) {
+        return DispatchGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceGroupPresentCapabilitiesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6031,6 +6643,9 @@ GetDeviceGroupPresentCapabilitiesKHR(VkDevice device, VkDeviceGroupPresentCapabi
 VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModesKHR(VkDevice device, VkSurfaceKHR surface,
                                                                     VkDeviceGroupPresentModeFlagsKHR* pModes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceGroupSurfacePresentModesKHR]) {
+        return DispatchGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceGroupSurfacePresentModesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6084,6 +6699,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDevicePresentRectanglesKHR(VkPhysicalD
 VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo,
                                                     uint32_t* pImageIndex) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdAcquireNextImage2KHR]) {
+        return DispatchAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAcquireNextImage2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireNextImage2KHR]) {
@@ -6295,6 +6913,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(VkDevice device, uint32
                                                          const VkSwapchainCreateInfoKHR* pCreateInfos,
                                                          const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateSharedSwapchainsKHR]) {
+        return DispatchCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSharedSwapchainsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateSharedSwapchainsKHR]) {
@@ -6622,6 +7243,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceVideoFormatPropertiesKHR(VkPhysi
 VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionKHR(VkDevice device, const VkVideoSessionCreateInfoKHR* pCreateInfo,
                                                      const VkAllocationCallbacks* pAllocator, VkVideoSessionKHR* pVideoSession) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateVideoSessionKHR]) {
+        return DispatchCreateVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateVideoSessionKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateVideoSessionKHR]) {
@@ -6646,6 +7270,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionKHR(VkDevice device, const VkVi
 VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionKHR(VkDevice device, VkVideoSessionKHR videoSession,
                                                   const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyVideoSessionKHR]) {
+        return DispatchDestroyVideoSessionKHR(device, videoSession, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyVideoSessionKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyVideoSessionKHR]) {
@@ -6669,6 +7296,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetVideoSessionMemoryRequirementsKHR(VkDevice dev
                                                                     uint32_t* pMemoryRequirementsCount,
                                                                     VkVideoSessionMemoryRequirementsKHR* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetVideoSessionMemoryRequirementsKHR]) {
+        return DispatchGetVideoSessionMemoryRequirementsKHR(device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetVideoSessionMemoryRequirementsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6701,6 +7331,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BindVideoSessionMemoryKHR(VkDevice device, VkVide
                                                          uint32_t bindSessionMemoryInfoCount,
                                                          const VkBindVideoSessionMemoryInfoKHR* pBindSessionMemoryInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBindVideoSessionMemoryKHR]) {
+        return DispatchBindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindVideoSessionMemoryKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindVideoSessionMemoryKHR]) {
@@ -6730,6 +7363,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionParametersKHR(VkDevice device,
                                                                const VkAllocationCallbacks* pAllocator,
                                                                VkVideoSessionParametersKHR* pVideoSessionParameters) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateVideoSessionParametersKHR]) {
+        return DispatchCreateVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateVideoSessionParametersKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6758,6 +7394,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionParametersKHR(VkDevice device,
 VKAPI_ATTR VkResult VKAPI_CALL UpdateVideoSessionParametersKHR(VkDevice device, VkVideoSessionParametersKHR videoSessionParameters,
                                                                const VkVideoSessionParametersUpdateInfoKHR* pUpdateInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdUpdateVideoSessionParametersKHR]) {
+        return DispatchUpdateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUpdateVideoSessionParametersKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6783,6 +7422,9 @@ VKAPI_ATTR VkResult VKAPI_CALL UpdateVideoSessionParametersKHR(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionParametersKHR(VkDevice device, VkVideoSessionParametersKHR videoSessionParameters,
                                                             const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyVideoSessionParametersKHR]) {
+        return DispatchDestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyVideoSessionParametersKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -6805,6 +7447,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionParametersKHR(VkDevice device, VkV
 
 VKAPI_ATTR void VKAPI_CALL CmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoBeginCodingInfoKHR* pBeginInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginVideoCodingKHR]) {
+        return DispatchCmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginVideoCodingKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginVideoCodingKHR]) {
@@ -6826,6 +7471,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoEndCodingInfoKHR* pEndCodingInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndVideoCodingKHR]) {
+        return DispatchCmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndVideoCodingKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndVideoCodingKHR]) {
@@ -6848,6 +7496,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, c
 VKAPI_ATTR void VKAPI_CALL CmdControlVideoCodingKHR(VkCommandBuffer commandBuffer,
                                                     const VkVideoCodingControlInfoKHR* pCodingControlInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdControlVideoCodingKHR]) {
+        return DispatchCmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdControlVideoCodingKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdControlVideoCodingKHR]) {
@@ -6869,6 +7520,9 @@ VKAPI_ATTR void VKAPI_CALL CmdControlVideoCodingKHR(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR* pDecodeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDecodeVideoKHR]) {
+        return DispatchCmdDecodeVideoKHR(commandBuffer, pDecodeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDecodeVideoKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecodeVideoKHR]) {
@@ -6890,6 +7544,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDecodeVideoKHR(VkCommandBuffer commandBuffer, cons
 
 VKAPI_ATTR void VKAPI_CALL CmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginRenderingKHR]) {
+        return DispatchCmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginRenderingKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderingKHR]) {
@@ -6911,6 +7568,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderingKHR(VkCommandBuffer commandBuffer, c
 
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderingKHR(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndRenderingKHR]) {
+        return DispatchCmdEndRenderingKHR(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndRenderingKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderingKHR]) {
@@ -7109,6 +7769,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(VkDevice device,
                                                                uint32_t remoteDeviceIndex,
                                                                VkPeerMemoryFeatureFlags* pPeerMemoryFeatures) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceGroupPeerMemoryFeaturesKHR]) {
+        return DispatchGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex,
+                                                           pPeerMemoryFeatures);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceGroupPeerMemoryFeaturesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7135,6 +7799,9 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceGroupPeerMemoryFeaturesKHR(VkDevice device,
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDeviceMaskKHR]) {
+        return DispatchCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDeviceMaskKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDeviceMaskKHR]) {
@@ -7158,6 +7825,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uin
                                               uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY,
                                               uint32_t groupCountZ) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDispatchBaseKHR]) {
+        return DispatchCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchBaseKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchBaseKHR]) {
@@ -7182,6 +7852,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uin
 
 VKAPI_ATTR void VKAPI_CALL TrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdTrimCommandPoolKHR]) {
+        return DispatchTrimCommandPoolKHR(device, commandPool, flags);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkTrimCommandPoolKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTrimCommandPoolKHR]) {
@@ -7259,6 +7932,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferPropertiesKHR(
 VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleKHR(VkDevice device, const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo,
                                                        HANDLE* pHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMemoryWin32HandleKHR]) {
+        return DispatchGetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryWin32HandleKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleKHR]) {
@@ -7284,6 +7960,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(VkDevice device
                                                                  HANDLE handle,
                                                                  VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMemoryWin32HandlePropertiesKHR]) {
+        return DispatchGetMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryWin32HandlePropertiesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7312,6 +7991,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandlePropertiesKHR(VkDevice device
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMemoryFdKHR]) {
+        return DispatchGetMemoryFdKHR(device, pGetFdInfo, pFd);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryFdKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdKHR]) {
@@ -7336,6 +8018,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(VkDevice device, const VkMemoryGet
 VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd,
                                                         VkMemoryFdPropertiesKHR* pMemoryFdProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMemoryFdPropertiesKHR]) {
+        return DispatchGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryFdPropertiesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryFdPropertiesKHR]) {
@@ -7388,6 +8073,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphorePropertiesKHR(
 VKAPI_ATTR VkResult VKAPI_CALL
 ImportSemaphoreWin32HandleKHR(VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdImportSemaphoreWin32HandleKHR]) {
+        return DispatchImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkImportSemaphoreWin32HandleKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7414,6 +8102,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(VkDevice device,
                                                           const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo,
                                                           HANDLE* pHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetSemaphoreWin32HandleKHR]) {
+        return DispatchGetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSemaphoreWin32HandleKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR]) {
@@ -7438,6 +8129,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(VkDevice device,
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdImportSemaphoreFdKHR]) {
+        return DispatchImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkImportSemaphoreFdKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportSemaphoreFdKHR]) {
@@ -7461,6 +8155,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(VkDevice device, const VkImp
 
 VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetSemaphoreFdKHR]) {
+        return DispatchGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSemaphoreFdKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreFdKHR]) {
@@ -7486,6 +8183,10 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer
                                                    VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount,
                                                    const VkWriteDescriptorSet* pDescriptorWrites) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdPushDescriptorSetKHR]) {
+        return DispatchCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount,
+                                               pDescriptorWrites);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushDescriptorSetKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSetKHR]) {
@@ -7512,6 +8213,9 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer c
                                                                VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                                VkPipelineLayout layout, uint32_t set, const void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdPushDescriptorSetWithTemplateKHR]) {
+        return DispatchCmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushDescriptorSetWithTemplateKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -7542,6 +8246,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(VkDevice device
                                                                  const VkAllocationCallbacks* pAllocator,
                                                                  VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateDescriptorUpdateTemplateKHR]) {
+        return DispatchCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateDescriptorUpdateTemplateKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7570,6 +8277,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(VkDevice device
 VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                               const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyDescriptorUpdateTemplateKHR]) {
+        return DispatchDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyDescriptorUpdateTemplateKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7595,6 +8305,9 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(VkDevice device, V
                                                               VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                               const void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdUpdateDescriptorSetWithTemplateKHR]) {
+        return DispatchUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUpdateDescriptorSetWithTemplateKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -7621,6 +8334,9 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(VkDevice device, V
 VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo,
                                                     const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateRenderPass2KHR]) {
+        return DispatchCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateRenderPass2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateRenderPass2KHR]) {
@@ -7645,6 +8361,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(VkDevice device, const VkRen
 VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
                                                   const VkSubpassBeginInfo* pSubpassBeginInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginRenderPass2KHR]) {
+        return DispatchCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginRenderPass2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginRenderPass2KHR]) {
@@ -7667,6 +8386,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo,
                                               const VkSubpassEndInfo* pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdNextSubpass2KHR]) {
+        return DispatchCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdNextSubpass2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdNextSubpass2KHR]) {
@@ -7688,6 +8410,9 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(VkCommandBuffer commandBuffer, con
 
 VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndRenderPass2KHR]) {
+        return DispatchCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndRenderPass2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndRenderPass2KHR]) {
@@ -7709,6 +8434,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, c
 
 VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainStatusKHR(VkDevice device, VkSwapchainKHR swapchain) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetSwapchainStatusKHR]) {
+        return DispatchGetSwapchainStatusKHR(device, swapchain);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSwapchainStatusKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainStatusKHR]) {
@@ -7765,6 +8493,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFencePropertiesKHR(VkPhysica
 VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(VkDevice device,
                                                          const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdImportFenceWin32HandleKHR]) {
+        return DispatchImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkImportFenceWin32HandleKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceWin32HandleKHR]) {
@@ -7789,6 +8520,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(VkDevice device,
 VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(VkDevice device, const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo,
                                                       HANDLE* pHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetFenceWin32HandleKHR]) {
+        return DispatchGetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetFenceWin32HandleKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceWin32HandleKHR]) {
@@ -7813,6 +8547,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(VkDevice device, const VkF
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdImportFenceFdKHR]) {
+        return DispatchImportFenceFdKHR(device, pImportFenceFdInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkImportFenceFdKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateImportFenceFdKHR]) {
@@ -7836,6 +8573,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(VkDevice device, const VkImportF
 
 VKAPI_ATTR VkResult VKAPI_CALL GetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetFenceFdKHR]) {
+        return DispatchGetFenceFdKHR(device, pGetFdInfo, pFd);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetFenceFdKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetFenceFdKHR]) {
@@ -7915,6 +8655,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR
 
 VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(VkDevice device, const VkAcquireProfilingLockInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdAcquireProfilingLockKHR]) {
+        return DispatchAcquireProfilingLockKHR(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAcquireProfilingLockKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateAcquireProfilingLockKHR]) {
@@ -7938,6 +8681,9 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(VkDevice device, const Vk
 
 VKAPI_ATTR void VKAPI_CALL ReleaseProfilingLockKHR(VkDevice device) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdReleaseProfilingLockKHR]) {
+        return DispatchReleaseProfilingLockKHR(device);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkReleaseProfilingLockKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseProfilingLockKHR]) {
@@ -8128,6 +8874,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilities2KHR(VkPhysicalDevice
 VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo,
                                                           VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageMemoryRequirements2KHR]) {
+        return DispatchGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageMemoryRequirements2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8151,6 +8900,9 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(VkDevice device, const
 VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo,
                                                            VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetBufferMemoryRequirements2KHR]) {
+        return DispatchGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferMemoryRequirements2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8175,6 +8927,10 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2KHR(VkDevice device,
                                                                 uint32_t* pSparseMemoryRequirementCount,
                                                                 VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageSparseMemoryRequirements2KHR]) {
+        return DispatchGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount,
+                                                            pSparseMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSparseMemoryRequirements2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8205,6 +8961,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(VkDevice device,
                                                                const VkAllocationCallbacks* pAllocator,
                                                                VkSamplerYcbcrConversion* pYcbcrConversion) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateSamplerYcbcrConversionKHR]) {
+        return DispatchCreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateSamplerYcbcrConversionKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8231,6 +8990,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion,
                                                             const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroySamplerYcbcrConversionKHR]) {
+        return DispatchDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroySamplerYcbcrConversionKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8254,6 +9016,9 @@ VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(VkDevice device, VkS
 VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount,
                                                     const VkBindBufferMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBindBufferMemory2KHR]) {
+        return DispatchBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindBufferMemory2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindBufferMemory2KHR]) {
@@ -8278,6 +9043,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(VkDevice device, uint32_t bi
 VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount,
                                                    const VkBindImageMemoryInfo* pBindInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBindImageMemory2KHR]) {
+        return DispatchBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindImageMemory2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBindImageMemory2KHR]) {
@@ -8302,6 +9070,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(VkDevice device, uint32_t bin
 VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupportKHR(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
                                                             VkDescriptorSetLayoutSupport* pSupport) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDescriptorSetLayoutSupportKHR]) {
+        return DispatchGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetLayoutSupportKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8326,6 +9097,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer
                                                    VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                    uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawIndirectCountKHR]) {
+        return DispatchCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirectCountKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountKHR]) {
@@ -8352,6 +9126,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(VkCommandBuffer comman
                                                           VkBuffer countBuffer, VkDeviceSize countBufferOffset,
                                                           uint32_t maxDrawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawIndexedIndirectCountKHR]) {
+        return DispatchCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                      stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndexedIndirectCountKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -8378,6 +9156,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(VkCommandBuffer comman
 
 VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetSemaphoreCounterValueKHR]) {
+        return DispatchGetSemaphoreCounterValueKHR(device, semaphore, pValue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSemaphoreCounterValueKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSemaphoreCounterValueKHR]) {
@@ -8405,6 +9186,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(VkDevice device, VkSe
 
 VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdWaitSemaphoresKHR]) {
+        return DispatchWaitSemaphoresKHR(device, pWaitInfo, timeout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWaitSemaphoresKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitSemaphoresKHR]) {
@@ -8432,6 +9216,9 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(VkDevice device, const VkSemaph
 
 VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSignalSemaphoreKHR]) {
+        return DispatchSignalSemaphoreKHR(device, pSignalInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSignalSemaphoreKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSignalSemaphoreKHR]) {
@@ -8486,6 +9273,9 @@ GetPhysicalDeviceFragmentShadingRatesKHR(VkPhysicalDevice physicalDevice, uint32
 VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(VkCommandBuffer commandBuffer, const VkExtent2D* pFragmentSize,
                                                         const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetFragmentShadingRateKHR]) {
+        return DispatchCmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetFragmentShadingRateKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -8510,6 +9300,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(VkCommandBuffer commandB
 VKAPI_ATTR void VKAPI_CALL CmdSetRenderingAttachmentLocationsKHR(VkCommandBuffer commandBuffer,
                                                                  const VkRenderingAttachmentLocationInfoKHR* pLocationInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetRenderingAttachmentLocationsKHR]) {
+        return DispatchCmdSetRenderingAttachmentLocationsKHR(commandBuffer, pLocationInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRenderingAttachmentLocationsKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -8536,6 +9329,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRenderingAttachmentLocationsKHR(VkCommandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdSetRenderingInputAttachmentIndicesKHR(VkCommandBuffer commandBuffer,
                                                                     const VkRenderingInputAttachmentIndexInfoKHR* pLocationInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetRenderingInputAttachmentIndicesKHR]) {
+        return DispatchCmdSetRenderingInputAttachmentIndicesKHR(commandBuffer, pLocationInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRenderingInputAttachmentIndicesKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -8561,6 +9357,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRenderingInputAttachmentIndicesKHR(VkCommandBuf
 
 VKAPI_ATTR VkResult VKAPI_CALL WaitForPresentKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdWaitForPresentKHR]) {
+        return DispatchWaitForPresentKHR(device, swapchain, presentId, timeout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWaitForPresentKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWaitForPresentKHR]) {
@@ -8588,6 +9387,9 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitForPresentKHR(VkDevice device, VkSwapchainKHR
 
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetBufferDeviceAddressKHR]) {
+        return DispatchGetBufferDeviceAddressKHR(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferDeviceAddressKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressKHR]) {
@@ -8611,6 +9413,9 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(VkDevice device,
 
 VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetBufferOpaqueCaptureAddressKHR]) {
+        return DispatchGetBufferOpaqueCaptureAddressKHR(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferOpaqueCaptureAddressKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8635,6 +9440,9 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(VkDevice device,
 VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(VkDevice device,
                                                                       const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceMemoryOpaqueCaptureAddressKHR]) {
+        return DispatchGetDeviceMemoryOpaqueCaptureAddressKHR(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceMemoryOpaqueCaptureAddressKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8661,6 +9469,9 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(VkDevice d
 VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                                           VkDeferredOperationKHR* pDeferredOperation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateDeferredOperationKHR]) {
+        return DispatchCreateDeferredOperationKHR(device, pAllocator, pDeferredOperation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateDeferredOperationKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateDeferredOperationKHR]) {
@@ -8685,6 +9496,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(VkDevice device, const
 VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(VkDevice device, VkDeferredOperationKHR operation,
                                                        const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyDeferredOperationKHR]) {
+        return DispatchDestroyDeferredOperationKHR(device, operation, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyDeferredOperationKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyDeferredOperationKHR]) {
@@ -8706,6 +9520,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(VkDevice device, VkDeferr
 
 VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrencyKHR(VkDevice device, VkDeferredOperationKHR operation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeferredOperationMaxConcurrencyKHR]) {
+        return DispatchGetDeferredOperationMaxConcurrencyKHR(device, operation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeferredOperationMaxConcurrencyKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8731,6 +9548,9 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrencyKHR(VkDevice de
 
 VKAPI_ATTR VkResult VKAPI_CALL GetDeferredOperationResultKHR(VkDevice device, VkDeferredOperationKHR operation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeferredOperationResultKHR]) {
+        return DispatchGetDeferredOperationResultKHR(device, operation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeferredOperationResultKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8755,6 +9575,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeferredOperationResultKHR(VkDevice device, Vk
 
 VKAPI_ATTR VkResult VKAPI_CALL DeferredOperationJoinKHR(VkDevice device, VkDeferredOperationKHR operation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDeferredOperationJoinKHR]) {
+        return DispatchDeferredOperationJoinKHR(device, operation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDeferredOperationJoinKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDeferredOperationJoinKHR]) {
@@ -8780,6 +9603,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutablePropertiesKHR(VkDevice devic
                                                                   uint32_t* pExecutableCount,
                                                                   VkPipelineExecutablePropertiesKHR* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPipelineExecutablePropertiesKHR]) {
+        return DispatchGetPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineExecutablePropertiesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8810,6 +9636,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableStatisticsKHR(VkDevice devic
                                                                   uint32_t* pStatisticCount,
                                                                   VkPipelineExecutableStatisticKHR* pStatistics) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPipelineExecutableStatisticsKHR]) {
+        return DispatchGetPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineExecutableStatisticsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8839,6 +9668,10 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
     VkDevice device, const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pInternalRepresentationCount,
     VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPipelineExecutableInternalRepresentationsKHR]) {
+        return DispatchGetPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount,
+                                                                       pInternalRepresentations);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineExecutableInternalRepresentationsKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -8870,6 +9703,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
 
 VKAPI_ATTR VkResult VKAPI_CALL MapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR* pMemoryMapInfo, void** ppData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdMapMemory2KHR]) {
+        return DispatchMapMemory2KHR(device, pMemoryMapInfo, ppData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkMapMemory2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateMapMemory2KHR]) {
@@ -8893,6 +9729,9 @@ VKAPI_ATTR VkResult VKAPI_CALL MapMemory2KHR(VkDevice device, const VkMemoryMapI
 
 VKAPI_ATTR VkResult VKAPI_CALL UnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoKHR* pMemoryUnmapInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdUnmapMemory2KHR]) {
+        return DispatchUnmapMemory2KHR(device, pMemoryUnmapInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUnmapMemory2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateUnmapMemory2KHR]) {
@@ -8948,6 +9787,9 @@ VKAPI_ATTR VkResult VKAPI_CALL
 GetEncodedVideoSessionParametersKHR(VkDevice device, const VkVideoEncodeSessionParametersGetInfoKHR* pVideoSessionParametersInfo,
                                     VkVideoEncodeSessionParametersFeedbackInfoKHR* pFeedbackInfo, size_t* pDataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetEncodedVideoSessionParametersKHR]) {
+        return DispatchGetEncodedVideoSessionParametersKHR(device, pVideoSessionParametersInfo, pFeedbackInfo, pDataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetEncodedVideoSessionParametersKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -8977,6 +9819,9 @@ GetEncodedVideoSessionParametersKHR(VkDevice device, const VkVideoEncodeSessionP
 
 VKAPI_ATTR void VKAPI_CALL CmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR* pEncodeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEncodeVideoKHR]) {
+        return DispatchCmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEncodeVideoKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEncodeVideoKHR]) {
@@ -8998,6 +9843,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEncodeVideoKHR(VkCommandBuffer commandBuffer, cons
 
 VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo* pDependencyInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetEvent2KHR]) {
+        return DispatchCmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetEvent2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetEvent2KHR]) {
@@ -9019,6 +9867,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEven
 
 VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdResetEvent2KHR]) {
+        return DispatchCmdResetEvent2KHR(commandBuffer, event, stageMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResetEvent2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResetEvent2KHR]) {
@@ -9041,6 +9892,9 @@ VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEv
 VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                              const VkDependencyInfo* pDependencyInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWaitEvents2KHR]) {
+        return DispatchCmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWaitEvents2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWaitEvents2KHR]) {
@@ -9062,6 +9916,9 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint
 
 VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdPipelineBarrier2KHR]) {
+        return DispatchCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPipelineBarrier2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPipelineBarrier2KHR]) {
@@ -9084,6 +9941,9 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool,
                                                  uint32_t query) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWriteTimestamp2KHR]) {
+        return DispatchCmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteTimestamp2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteTimestamp2KHR]) {
@@ -9103,36 +9963,12 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer,
     }
 }
 
-VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
-    auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
-    bool skip = false;
-    ErrorObject error_obj(vvl::Func::vkQueueSubmit2KHR, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
-    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueSubmit2KHR]) {
-        auto lock = intercept->ReadLock();
-        skip |= intercept->PreCallValidateQueueSubmit2KHR(queue, submitCount, pSubmits, fence, error_obj);
-        if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
-    }
-    RecordObject record_obj(vvl::Func::vkQueueSubmit2KHR);
-    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordQueueSubmit2KHR]) {
-        auto lock = intercept->WriteLock();
-        intercept->PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj);
-    }
-    VkResult result = DispatchQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
-    record_obj.result = result;
-    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordQueueSubmit2KHR]) {
-        auto lock = intercept->WriteLock();
-
-        if (result == VK_ERROR_DEVICE_LOST) {
-            intercept->is_device_lost = true;
-        }
-        intercept->PostCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj);
-    }
-    return result;
-}
-
 VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkBuffer dstBuffer,
                                                     VkDeviceSize dstOffset, uint32_t marker) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWriteBufferMarker2AMD]) {
+        return DispatchCmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteBufferMarker2AMD, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarker2AMD]) {
@@ -9155,6 +9991,9 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointData2NV(VkQueue queue, uint32_t* pCheckpointDataCount,
                                                      VkCheckpointData2NV* pCheckpointData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetQueueCheckpointData2NV]) {
+        return DispatchGetQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetQueueCheckpointData2NV, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointData2NV]) {
@@ -9176,6 +10015,9 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointData2NV(VkQueue queue, uint32_t* pC
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyBuffer2KHR]) {
+        return DispatchCmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBuffer2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBuffer2KHR]) {
@@ -9197,6 +10039,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, cons
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(VkCommandBuffer commandBuffer, const VkCopyImageInfo2* pCopyImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyImage2KHR]) {
+        return DispatchCmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImage2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImage2KHR]) {
@@ -9219,6 +10064,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(VkCommandBuffer commandBuffer, const
 VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffer,
                                                     const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyBufferToImage2KHR]) {
+        return DispatchCmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyBufferToImage2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyBufferToImage2KHR]) {
@@ -9241,6 +10089,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffer,
                                                     const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyImageToBuffer2KHR]) {
+        return DispatchCmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyImageToBuffer2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyImageToBuffer2KHR]) {
@@ -9262,6 +10113,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(VkCommandBuffer commandBuffer, const VkBlitImageInfo2* pBlitImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBlitImage2KHR]) {
+        return DispatchCmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBlitImage2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBlitImage2KHR]) {
@@ -9283,6 +10137,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(VkCommandBuffer commandBuffer, const
 
 VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdResolveImage2KHR]) {
+        return DispatchCmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdResolveImage2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdResolveImage2KHR]) {
@@ -9304,6 +10161,9 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(VkCommandBuffer commandBuffer, co
 
 VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer, VkDeviceAddress indirectDeviceAddress) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdTraceRaysIndirect2KHR]) {
+        return DispatchCmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdTraceRaysIndirect2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirect2KHR]) {
@@ -9326,6 +10186,9 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirementsKHR(VkDevice device, const VkDeviceBufferMemoryRequirements* pInfo,
                                                                 VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceBufferMemoryRequirementsKHR]) {
+        return DispatchGetDeviceBufferMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceBufferMemoryRequirementsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9351,6 +10214,9 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirementsKHR(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirementsKHR(VkDevice device, const VkDeviceImageMemoryRequirements* pInfo,
                                                                VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceImageMemoryRequirementsKHR]) {
+        return DispatchGetDeviceImageMemoryRequirementsKHR(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceImageMemoryRequirementsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9376,6 +10242,10 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirementsKHR(VkDevice de
                                                                      uint32_t* pSparseMemoryRequirementCount,
                                                                      VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceImageSparseMemoryRequirementsKHR]) {
+        return DispatchGetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount,
+                                                                 pSparseMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceImageSparseMemoryRequirementsKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -9405,6 +10275,9 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirementsKHR(VkDevice de
 VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                   VkDeviceSize size, VkIndexType indexType) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindIndexBuffer2KHR]) {
+        return DispatchCmdBindIndexBuffer2KHR(commandBuffer, buffer, offset, size, indexType);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindIndexBuffer2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer2KHR]) {
@@ -9427,6 +10300,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL GetRenderingAreaGranularityKHR(VkDevice device, const VkRenderingAreaInfoKHR* pRenderingAreaInfo,
                                                           VkExtent2D* pGranularity) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetRenderingAreaGranularityKHR]) {
+        return DispatchGetRenderingAreaGranularityKHR(device, pRenderingAreaInfo, pGranularity);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRenderingAreaGranularityKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9450,6 +10326,9 @@ VKAPI_ATTR void VKAPI_CALL GetRenderingAreaGranularityKHR(VkDevice device, const
 VKAPI_ATTR void VKAPI_CALL GetDeviceImageSubresourceLayoutKHR(VkDevice device, const VkDeviceImageSubresourceInfoKHR* pInfo,
                                                               VkSubresourceLayout2KHR* pLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceImageSubresourceLayoutKHR]) {
+        return DispatchGetDeviceImageSubresourceLayoutKHR(device, pInfo, pLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceImageSubresourceLayoutKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9473,6 +10352,9 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceImageSubresourceLayoutKHR(VkDevice device, c
 VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2KHR(VkDevice device, VkImage image, const VkImageSubresource2KHR* pSubresource,
                                                          VkSubresourceLayout2KHR* pLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageSubresourceLayout2KHR]) {
+        return DispatchGetImageSubresourceLayout2KHR(device, image, pSubresource, pLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSubresourceLayout2KHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -9525,6 +10407,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceCooperativeMatrixPropertiesKHR(V
 VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleKHR(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
                                                 uint16_t lineStipplePattern) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetLineStippleKHR]) {
+        return DispatchCmdSetLineStippleKHR(commandBuffer, lineStippleFactor, lineStipplePattern);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLineStippleKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleKHR]) {
@@ -9577,6 +10462,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsKHR(VkDevice device, uint3
                                                           const VkCalibratedTimestampInfoKHR* pTimestampInfos,
                                                           uint64_t* pTimestamps, uint64_t* pMaxDeviation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetCalibratedTimestampsKHR]) {
+        return DispatchGetCalibratedTimestampsKHR(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetCalibratedTimestampsKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCalibratedTimestampsKHR]) {
@@ -9604,6 +10492,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsKHR(VkDevice device, uint3
 VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets2KHR(VkCommandBuffer commandBuffer,
                                                      const VkBindDescriptorSetsInfoKHR* pBindDescriptorSetsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindDescriptorSets2KHR]) {
+        return DispatchCmdBindDescriptorSets2KHR(commandBuffer, pBindDescriptorSetsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindDescriptorSets2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorSets2KHR]) {
@@ -9625,6 +10516,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets2KHR(VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL CmdPushConstants2KHR(VkCommandBuffer commandBuffer, const VkPushConstantsInfoKHR* pPushConstantsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdPushConstants2KHR]) {
+        return DispatchCmdPushConstants2KHR(commandBuffer, pPushConstantsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushConstants2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushConstants2KHR]) {
@@ -9647,6 +10541,9 @@ VKAPI_ATTR void VKAPI_CALL CmdPushConstants2KHR(VkCommandBuffer commandBuffer, c
 VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSet2KHR(VkCommandBuffer commandBuffer,
                                                     const VkPushDescriptorSetInfoKHR* pPushDescriptorSetInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdPushDescriptorSet2KHR]) {
+        return DispatchCmdPushDescriptorSet2KHR(commandBuffer, pPushDescriptorSetInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushDescriptorSet2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdPushDescriptorSet2KHR]) {
@@ -9669,6 +10566,9 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSet2KHR(VkCommandBuffer commandBuffe
 VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplate2KHR(
     VkCommandBuffer commandBuffer, const VkPushDescriptorSetWithTemplateInfoKHR* pPushDescriptorSetWithTemplateInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdPushDescriptorSetWithTemplate2KHR]) {
+        return DispatchCmdPushDescriptorSetWithTemplate2KHR(commandBuffer, pPushDescriptorSetWithTemplateInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPushDescriptorSetWithTemplate2KHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -9697,6 +10597,9 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetWithTemplate2KHR(
 VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsets2EXT(
     VkCommandBuffer commandBuffer, const VkSetDescriptorBufferOffsetsInfoEXT* pSetDescriptorBufferOffsetsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDescriptorBufferOffsets2EXT]) {
+        return DispatchCmdSetDescriptorBufferOffsets2EXT(commandBuffer, pSetDescriptorBufferOffsetsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDescriptorBufferOffsets2EXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -9722,6 +10625,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsets2EXT(
 VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplers2EXT(
     VkCommandBuffer commandBuffer, const VkBindDescriptorBufferEmbeddedSamplersInfoEXT* pBindDescriptorBufferEmbeddedSamplersInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindDescriptorBufferEmbeddedSamplers2EXT]) {
+        return DispatchCmdBindDescriptorBufferEmbeddedSamplers2EXT(commandBuffer, pBindDescriptorBufferEmbeddedSamplersInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindDescriptorBufferEmbeddedSamplers2EXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -9826,6 +10732,9 @@ VKAPI_ATTR void VKAPI_CALL DebugReportMessageEXT(VkInstance instance, VkDebugRep
 
 VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarkerObjectTagInfoEXT* pTagInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDebugMarkerSetObjectTagEXT]) {
+        return DispatchDebugMarkerSetObjectTagEXT(device, pTagInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDebugMarkerSetObjectTagEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT]) {
@@ -9873,6 +10782,9 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(VkDevice device, cons
 
 VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDebugMarkerBeginEXT]) {
+        return DispatchCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDebugMarkerBeginEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerBeginEXT]) {
@@ -9894,6 +10806,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer,
 
 VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDebugMarkerEndEXT]) {
+        return DispatchCmdDebugMarkerEndEXT(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDebugMarkerEndEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerEndEXT]) {
@@ -9915,6 +10830,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
 
 VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDebugMarkerInsertEXT]) {
+        return DispatchCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDebugMarkerInsertEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDebugMarkerInsertEXT]) {
@@ -9938,6 +10856,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindTransformFeedbackBuffersEXT(VkCommandBuffer co
                                                               uint32_t bindingCount, const VkBuffer* pBuffers,
                                                               const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindTransformFeedbackBuffersEXT]) {
+        return DispatchCmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindTransformFeedbackBuffersEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -9966,6 +10887,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginTransformFeedbackEXT(VkCommandBuffer commandB
                                                         uint32_t counterBufferCount, const VkBuffer* pCounterBuffers,
                                                         const VkDeviceSize* pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginTransformFeedbackEXT]) {
+        return DispatchCmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers,
+                                                    pCounterBufferOffsets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginTransformFeedbackEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -9995,6 +10920,10 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(VkCommandBuffer commandBuf
                                                       uint32_t counterBufferCount, const VkBuffer* pCounterBuffers,
                                                       const VkDeviceSize* pCounterBufferOffsets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndTransformFeedbackEXT]) {
+        return DispatchCmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers,
+                                                  pCounterBufferOffsets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndTransformFeedbackEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10022,6 +10951,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndTransformFeedbackEXT(VkCommandBuffer commandBuf
 VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
                                                    VkQueryControlFlags flags, uint32_t index) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginQueryIndexedEXT]) {
+        return DispatchCmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginQueryIndexedEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBeginQueryIndexedEXT]) {
@@ -10044,6 +10976,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
                                                  uint32_t index) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndQueryIndexedEXT]) {
+        return DispatchCmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndQueryIndexedEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndQueryIndexedEXT]) {
@@ -10068,6 +11003,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(VkCommandBuffer commandBu
                                                        VkDeviceSize counterBufferOffset, uint32_t counterOffset,
                                                        uint32_t vertexStride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawIndirectByteCountEXT]) {
+        return DispatchCmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset,
+                                                   counterOffset, vertexStride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirectByteCountEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10095,6 +11034,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectByteCountEXT(VkCommandBuffer commandBu
 VKAPI_ATTR VkResult VKAPI_CALL CreateCuModuleNVX(VkDevice device, const VkCuModuleCreateInfoNVX* pCreateInfo,
                                                  const VkAllocationCallbacks* pAllocator, VkCuModuleNVX* pModule) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateCuModuleNVX]) {
+        return DispatchCreateCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateCuModuleNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCuModuleNVX]) {
@@ -10119,6 +11061,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCuModuleNVX(VkDevice device, const VkCuModu
 VKAPI_ATTR VkResult VKAPI_CALL CreateCuFunctionNVX(VkDevice device, const VkCuFunctionCreateInfoNVX* pCreateInfo,
                                                    const VkAllocationCallbacks* pAllocator, VkCuFunctionNVX* pFunction) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateCuFunctionNVX]) {
+        return DispatchCreateCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateCuFunctionNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCuFunctionNVX]) {
@@ -10142,6 +11087,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCuFunctionNVX(VkDevice device, const VkCuFu
 
 VKAPI_ATTR void VKAPI_CALL DestroyCuModuleNVX(VkDevice device, VkCuModuleNVX module, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyCuModuleNVX]) {
+        return DispatchDestroyCuModuleNVX(device, module, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyCuModuleNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCuModuleNVX]) {
@@ -10164,6 +11112,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyCuModuleNVX(VkDevice device, VkCuModuleNVX mod
 VKAPI_ATTR void VKAPI_CALL DestroyCuFunctionNVX(VkDevice device, VkCuFunctionNVX function,
                                                 const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyCuFunctionNVX]) {
+        return DispatchDestroyCuFunctionNVX(device, function, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyCuFunctionNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCuFunctionNVX]) {
@@ -10185,6 +11136,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyCuFunctionNVX(VkDevice device, VkCuFunctionNVX
 
 VKAPI_ATTR void VKAPI_CALL CmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, const VkCuLaunchInfoNVX* pLaunchInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCuLaunchKernelNVX]) {
+        return DispatchCmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCuLaunchKernelNVX, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCuLaunchKernelNVX]) {
@@ -10206,6 +11160,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, c
 
 VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(VkDevice device, const VkImageViewHandleInfoNVX* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageViewHandleNVX]) {
+        return DispatchGetImageViewHandleNVX(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageViewHandleNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewHandleNVX]) {
@@ -10229,6 +11186,9 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(VkDevice device, const VkIm
 VKAPI_ATTR VkResult VKAPI_CALL GetImageViewAddressNVX(VkDevice device, VkImageView imageView,
                                                       VkImageViewAddressPropertiesNVX* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageViewAddressNVX]) {
+        return DispatchGetImageViewAddressNVX(device, imageView, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageViewAddressNVX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetImageViewAddressNVX]) {
@@ -10254,6 +11214,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer
                                                    VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
                                                    uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawIndirectCountAMD]) {
+        return DispatchCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirectCountAMD, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCountAMD]) {
@@ -10280,6 +11243,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(VkCommandBuffer comman
                                                           VkBuffer countBuffer, VkDeviceSize countBufferOffset,
                                                           uint32_t maxDrawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawIndexedIndirectCountAMD]) {
+        return DispatchCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                      stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndexedIndirectCountAMD,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10307,6 +11274,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountAMD(VkCommandBuffer comman
 VKAPI_ATTR VkResult VKAPI_CALL GetShaderInfoAMD(VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage,
                                                 VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetShaderInfoAMD]) {
+        return DispatchGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetShaderInfoAMD, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderInfoAMD]) {
@@ -10390,6 +11360,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceExternalImageFormatPropertiesNV(
 VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleNV(VkDevice device, VkDeviceMemory memory,
                                                       VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE* pHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMemoryWin32HandleNV]) {
+        return DispatchGetMemoryWin32HandleNV(device, memory, handleType, pHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryWin32HandleNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryWin32HandleNV]) {
@@ -10441,6 +11414,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateViSurfaceNN(VkInstance instance, const VkVi
 VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(VkCommandBuffer commandBuffer,
                                                            const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginConditionalRenderingEXT]) {
+        return DispatchCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginConditionalRenderingEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10464,6 +11440,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(VkCommandBuffer comma
 
 VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndConditionalRenderingEXT]) {
+        return DispatchCmdEndConditionalRenderingEXT(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndConditionalRenderingEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10488,6 +11467,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndConditionalRenderingEXT(VkCommandBuffer command
 VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
                                                     const VkViewportWScalingNV* pViewportWScalings) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetViewportWScalingNV]) {
+        return DispatchCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportWScalingNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportWScalingNV]) {
@@ -10613,6 +11595,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2EXT(VkPhysic
 VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(VkDevice device, VkDisplayKHR display,
                                                       const VkDisplayPowerInfoEXT* pDisplayPowerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDisplayPowerControlEXT]) {
+        return DispatchDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDisplayPowerControlEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDisplayPowerControlEXT]) {
@@ -10637,6 +11622,9 @@ VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(VkDevice device, VkDisplay
 VKAPI_ATTR VkResult VKAPI_CALL RegisterDeviceEventEXT(VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdRegisterDeviceEventEXT]) {
+        return DispatchRegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkRegisterDeviceEventEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDeviceEventEXT]) {
@@ -10662,6 +11650,9 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(VkDevice device, VkDispla
                                                        const VkDisplayEventInfoEXT* pDisplayEventInfo,
                                                        const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdRegisterDisplayEventEXT]) {
+        return DispatchRegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkRegisterDisplayEventEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateRegisterDisplayEventEXT]) {
@@ -10687,6 +11678,9 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(VkDevice device, VkDispla
 VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain,
                                                       VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetSwapchainCounterEXT]) {
+        return DispatchGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSwapchainCounterEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetSwapchainCounterEXT]) {
@@ -10715,6 +11709,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(VkDevice device, VkSwapcha
 VKAPI_ATTR VkResult VKAPI_CALL GetRefreshCycleDurationGOOGLE(VkDevice device, VkSwapchainKHR swapchain,
                                                              VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetRefreshCycleDurationGOOGLE]) {
+        return DispatchGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRefreshCycleDurationGOOGLE, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -10745,6 +11742,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(VkDevice device,
                                                                uint32_t* pPresentationTimingCount,
                                                                VkPastPresentationTimingGOOGLE* pPresentationTimings) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPastPresentationTimingGOOGLE]) {
+        return DispatchGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPastPresentationTimingGOOGLE, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -10777,6 +11777,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPastPresentationTimingGOOGLE(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle,
                                                      uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDiscardRectangleEXT]) {
+        return DispatchCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDiscardRectangleEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDiscardRectangleEXT]) {
@@ -10801,6 +11804,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 discardRectangleEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDiscardRectangleEnableEXT]) {
+        return DispatchCmdSetDiscardRectangleEnableEXT(commandBuffer, discardRectangleEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDiscardRectangleEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10825,6 +11831,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEnableEXT(VkCommandBuffer comma
 VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleModeEXT(VkCommandBuffer commandBuffer,
                                                          VkDiscardRectangleModeEXT discardRectangleMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDiscardRectangleModeEXT]) {
+        return DispatchCmdSetDiscardRectangleModeEXT(commandBuffer, discardRectangleMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDiscardRectangleModeEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -10849,6 +11858,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleModeEXT(VkCommandBuffer command
 VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains,
                                              const VkHdrMetadataEXT* pMetadata) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetHdrMetadataEXT]) {
+        return DispatchSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetHdrMetadataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetHdrMetadataEXT]) {
@@ -10946,6 +11958,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectNameEXT(VkDevice device, const
 
 VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(VkDevice device, const VkDebugUtilsObjectTagInfoEXT* pTagInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetDebugUtilsObjectTagEXT]) {
+        return DispatchSetDebugUtilsObjectTagEXT(device, pTagInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetDebugUtilsObjectTagEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT]) {
@@ -11037,6 +12052,9 @@ VKAPI_ATTR void VKAPI_CALL QueueInsertDebugUtilsLabelEXT(VkQueue queue, const Vk
 
 VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBeginDebugUtilsLabelEXT]) {
+        return DispatchCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBeginDebugUtilsLabelEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11059,6 +12077,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuf
 
 VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdEndDebugUtilsLabelEXT]) {
+        return DispatchCmdEndDebugUtilsLabelEXT(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdEndDebugUtilsLabelEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT]) {
@@ -11080,6 +12101,9 @@ VKAPI_ATTR void VKAPI_CALL CmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdInsertDebugUtilsLabelEXT]) {
+        return DispatchCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdInsertDebugUtilsLabelEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11178,6 +12202,9 @@ VKAPI_ATTR void VKAPI_CALL SubmitDebugUtilsMessageEXT(VkInstance instance, VkDeb
 VKAPI_ATTR VkResult VKAPI_CALL GetAndroidHardwareBufferPropertiesANDROID(VkDevice device, const struct AHardwareBuffer* buffer,
                                                                          VkAndroidHardwareBufferPropertiesANDROID* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetAndroidHardwareBufferPropertiesANDROID]) {
+        return DispatchGetAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAndroidHardwareBufferPropertiesANDROID,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -11207,6 +12234,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryAndroidHardwareBufferANDROID(VkDevice de
                                                                      const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo,
                                                                      struct AHardwareBuffer** pBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMemoryAndroidHardwareBufferANDROID]) {
+        return DispatchGetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryAndroidHardwareBufferANDROID, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11238,6 +12268,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateExecutionGraphPipelinesAMDX(VkDevice device
                                                                  const VkExecutionGraphPipelineCreateInfoAMDX* pCreateInfos,
                                                                  const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateExecutionGraphPipelinesAMDX]) {
+        return DispatchCreateExecutionGraphPipelinesAMDX(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+                                                         pPipelines);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateExecutionGraphPipelinesAMDX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11267,6 +12301,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateExecutionGraphPipelinesAMDX(VkDevice device
 VKAPI_ATTR VkResult VKAPI_CALL GetExecutionGraphPipelineScratchSizeAMDX(VkDevice device, VkPipeline executionGraph,
                                                                         VkExecutionGraphPipelineScratchSizeAMDX* pSizeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetExecutionGraphPipelineScratchSizeAMDX]) {
+        return DispatchGetExecutionGraphPipelineScratchSizeAMDX(device, executionGraph, pSizeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetExecutionGraphPipelineScratchSizeAMDX,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -11296,6 +12333,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetExecutionGraphPipelineNodeIndexAMDX(VkDevice d
                                                                       const VkPipelineShaderStageNodeCreateInfoAMDX* pNodeInfo,
                                                                       uint32_t* pNodeIndex) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetExecutionGraphPipelineNodeIndexAMDX]) {
+        return DispatchGetExecutionGraphPipelineNodeIndexAMDX(device, executionGraph, pNodeInfo, pNodeIndex);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetExecutionGraphPipelineNodeIndexAMDX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11323,6 +12363,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetExecutionGraphPipelineNodeIndexAMDX(VkDevice d
 
 VKAPI_ATTR void VKAPI_CALL CmdInitializeGraphScratchMemoryAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdInitializeGraphScratchMemoryAMDX]) {
+        return DispatchCmdInitializeGraphScratchMemoryAMDX(commandBuffer, scratch);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdInitializeGraphScratchMemoryAMDX,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11348,6 +12391,9 @@ VKAPI_ATTR void VKAPI_CALL CmdInitializeGraphScratchMemoryAMDX(VkCommandBuffer c
 VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch,
                                                 const VkDispatchGraphCountInfoAMDX* pCountInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDispatchGraphAMDX]) {
+        return DispatchCmdDispatchGraphAMDX(commandBuffer, scratch, pCountInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchGraphAMDX, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDispatchGraphAMDX]) {
@@ -11370,6 +12416,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphAMDX(VkCommandBuffer commandBuffer, V
 VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch,
                                                         const VkDispatchGraphCountInfoAMDX* pCountInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDispatchGraphIndirectAMDX]) {
+        return DispatchCmdDispatchGraphIndirectAMDX(commandBuffer, scratch, pCountInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchGraphIndirectAMDX,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11394,6 +12443,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectAMDX(VkCommandBuffer commandB
 VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectCountAMDX(VkCommandBuffer commandBuffer, VkDeviceAddress scratch,
                                                              VkDeviceAddress countInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDispatchGraphIndirectCountAMDX]) {
+        return DispatchCmdDispatchGraphIndirectCountAMDX(commandBuffer, scratch, countInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDispatchGraphIndirectCountAMDX,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11419,6 +12471,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchGraphIndirectCountAMDX(VkCommandBuffer com
 VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer,
                                                     const VkSampleLocationsInfoEXT* pSampleLocationsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetSampleLocationsEXT]) {
+        return DispatchCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetSampleLocationsEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleLocationsEXT]) {
@@ -11467,6 +12522,9 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceMultisamplePropertiesEXT(VkPhysicalD
 VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(VkDevice device, VkImage image,
                                                                       VkImageDrmFormatModifierPropertiesEXT* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageDrmFormatModifierPropertiesEXT]) {
+        return DispatchGetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageDrmFormatModifierPropertiesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11494,6 +12552,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageDrmFormatModifierPropertiesEXT(VkDevice d
 VKAPI_ATTR void VKAPI_CALL CmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView,
                                                      VkImageLayout imageLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindShadingRateImageNV]) {
+        return DispatchCmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindShadingRateImageNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadingRateImageNV]) {
@@ -11517,6 +12578,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(VkCommandBuffer co
                                                               uint32_t viewportCount,
                                                               const VkShadingRatePaletteNV* pShadingRatePalettes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetViewportShadingRatePaletteNV]) {
+        return DispatchCmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportShadingRatePaletteNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11545,6 +12609,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuff
                                                      uint32_t customSampleOrderCount,
                                                      const VkCoarseSampleOrderCustomNV* pCustomSampleOrders) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetCoarseSampleOrderNV]) {
+        return DispatchCmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoarseSampleOrderNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV]) {
@@ -11572,6 +12639,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(VkDevice device,
                                                              const VkAllocationCallbacks* pAllocator,
                                                              VkAccelerationStructureNV* pAccelerationStructure) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateAccelerationStructureNV]) {
+        return DispatchCreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateAccelerationStructureNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11598,6 +12668,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(VkDevice device, VkAccelerationStructureNV accelerationStructure,
                                                           const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyAccelerationStructureNV]) {
+        return DispatchDestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyAccelerationStructureNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11621,6 +12694,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(VkDevice device, VkAcc
 VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     VkDevice device, const VkAccelerationStructureMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetAccelerationStructureMemoryRequirementsNV]) {
+        return DispatchGetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAccelerationStructureMemoryRequirementsNV,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -11648,6 +12724,9 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
 VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryNV(VkDevice device, uint32_t bindInfoCount,
                                                                  const VkBindAccelerationStructureMemoryInfoNV* pBindInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBindAccelerationStructureMemoryNV]) {
+        return DispatchBindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindAccelerationStructureMemoryNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11676,6 +12755,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(VkCommandBuffer comma
                                                            VkAccelerationStructureNV dst, VkAccelerationStructureNV src,
                                                            VkBuffer scratch, VkDeviceSize scratchOffset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBuildAccelerationStructureNV]) {
+        return DispatchCmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src,
+                                                       scratch, scratchOffset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBuildAccelerationStructureNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11704,6 +12787,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(VkCommandBuffer comma
 VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst,
                                                           VkAccelerationStructureNV src, VkCopyAccelerationStructureModeKHR mode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyAccelerationStructureNV]) {
+        return DispatchCmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyAccelerationStructureNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11733,6 +12819,13 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffe
                                           VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride,
                                           uint32_t width, uint32_t height, uint32_t depth) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdTraceRaysNV]) {
+        return DispatchCmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset,
+                                      missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride,
+                                      hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride,
+                                      callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride,
+                                      width, height, depth);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdTraceRaysNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysNV]) {
@@ -11770,6 +12863,9 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffe
 VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline, uint32_t firstGroup,
                                                                   uint32_t groupCount, size_t dataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetRayTracingShaderGroupHandlesKHR]) {
+        return DispatchGetRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRayTracingShaderGroupHandlesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11798,6 +12894,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesKHR(VkDevice devic
 VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(VkDevice device, VkPipeline pipeline, uint32_t firstGroup,
                                                                  uint32_t groupCount, size_t dataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetRayTracingShaderGroupHandlesNV]) {
+        return DispatchGetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRayTracingShaderGroupHandlesNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11826,6 +12925,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesNV(VkDevice device
 VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureHandleNV(VkDevice device, VkAccelerationStructureNV accelerationStructure,
                                                                 size_t dataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetAccelerationStructureHandleNV]) {
+        return DispatchGetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAccelerationStructureHandleNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11855,6 +12957,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(VkCommandB
                                                                       VkQueryType queryType, VkQueryPool queryPool,
                                                                       uint32_t firstQuery) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWriteAccelerationStructuresPropertiesNV]) {
+        return DispatchCmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount,
+                                                                  pAccelerationStructures, queryType, queryPool, firstQuery);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteAccelerationStructuresPropertiesNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -11884,6 +12990,9 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesNV(VkCommandB
 
 VKAPI_ATTR VkResult VKAPI_CALL CompileDeferredNV(VkDevice device, VkPipeline pipeline, uint32_t shader) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCompileDeferredNV]) {
+        return DispatchCompileDeferredNV(device, pipeline, shader);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCompileDeferredNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCompileDeferredNV]) {
@@ -11909,6 +13018,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(VkDevice device
                                                                  const void* pHostPointer,
                                                                  VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMemoryHostPointerPropertiesEXT]) {
+        return DispatchGetMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryHostPointerPropertiesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -11937,6 +13049,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryHostPointerPropertiesEXT(VkDevice device
 VKAPI_ATTR void VKAPI_CALL CmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
                                                    VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWriteBufferMarkerAMD]) {
+        return DispatchCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteBufferMarkerAMD, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdWriteBufferMarkerAMD]) {
@@ -11990,6 +13105,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(VkDevice device, uint3
                                                           const VkCalibratedTimestampInfoKHR* pTimestampInfos,
                                                           uint64_t* pTimestamps, uint64_t* pMaxDeviation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetCalibratedTimestampsEXT]) {
+        return DispatchGetCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetCalibratedTimestampsEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCalibratedTimestampsEXT]) {
@@ -12016,6 +13134,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(VkDevice device, uint3
 
 VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount, uint32_t firstTask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawMeshTasksNV]) {
+        return DispatchCmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksNV]) {
@@ -12038,6 +13159,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uin
 VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                       uint32_t drawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawMeshTasksIndirectNV]) {
+        return DispatchCmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksIndirectNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12062,6 +13186,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountNV(VkCommandBuffer comma
                                                            VkBuffer countBuffer, VkDeviceSize countBufferOffset,
                                                            uint32_t maxDrawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawMeshTasksIndirectCountNV]) {
+        return DispatchCmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                       stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksIndirectCountNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12090,6 +13218,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorEnableNV(VkCommandBuffer comman
                                                           uint32_t exclusiveScissorCount,
                                                           const VkBool32* pExclusiveScissorEnables) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetExclusiveScissorEnableNV]) {
+        return DispatchCmdSetExclusiveScissorEnableNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount,
+                                                      pExclusiveScissorEnables);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetExclusiveScissorEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12117,6 +13249,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorEnableNV(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor,
                                                     uint32_t exclusiveScissorCount, const VkRect2D* pExclusiveScissors) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetExclusiveScissorNV]) {
+        return DispatchCmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetExclusiveScissorNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetExclusiveScissorNV]) {
@@ -12141,6 +13276,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void* pCheckpointMarker) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetCheckpointNV]) {
+        return DispatchCmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCheckpointNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCheckpointNV]) {
@@ -12163,6 +13301,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCheckpointNV(VkCommandBuffer commandBuffer, con
 VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(VkQueue queue, uint32_t* pCheckpointDataCount,
                                                     VkCheckpointDataNV* pCheckpointData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetQueueCheckpointDataNV]) {
+        return DispatchGetQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetQueueCheckpointDataNV, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetQueueCheckpointDataNV]) {
@@ -12185,6 +13326,9 @@ VKAPI_ATTR void VKAPI_CALL GetQueueCheckpointDataNV(VkQueue queue, uint32_t* pCh
 VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(VkDevice device,
                                                              const VkInitializePerformanceApiInfoINTEL* pInitializeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdInitializePerformanceApiINTEL]) {
+        return DispatchInitializePerformanceApiINTEL(device, pInitializeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkInitializePerformanceApiINTEL, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12209,6 +13353,9 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(VkDevice device,
 
 VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(VkDevice device) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdUninitializePerformanceApiINTEL]) {
+        return DispatchUninitializePerformanceApiINTEL(device);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkUninitializePerformanceApiINTEL, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12232,6 +13379,9 @@ VKAPI_ATTR void VKAPI_CALL UninitializePerformanceApiINTEL(VkDevice device) {
 VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(VkCommandBuffer commandBuffer,
                                                             const VkPerformanceMarkerInfoINTEL* pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetPerformanceMarkerINTEL]) {
+        return DispatchCmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPerformanceMarkerINTEL,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12258,6 +13408,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(VkCommandBuffer comm
 VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(VkCommandBuffer commandBuffer,
                                                                   const VkPerformanceStreamMarkerInfoINTEL* pMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetPerformanceStreamMarkerINTEL]) {
+        return DispatchCmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPerformanceStreamMarkerINTEL,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12284,6 +13437,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(VkCommandBuffe
 VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(VkCommandBuffer commandBuffer,
                                                               const VkPerformanceOverrideInfoINTEL* pOverrideInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetPerformanceOverrideINTEL]) {
+        return DispatchCmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPerformanceOverrideINTEL,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12311,6 +13467,9 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(VkDevice dev
                                                                     const VkPerformanceConfigurationAcquireInfoINTEL* pAcquireInfo,
                                                                     VkPerformanceConfigurationINTEL* pConfiguration) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdAcquirePerformanceConfigurationINTEL]) {
+        return DispatchAcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAcquirePerformanceConfigurationINTEL, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12338,6 +13497,9 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(VkDevice dev
 VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(VkDevice device,
                                                                     VkPerformanceConfigurationINTEL configuration) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdReleasePerformanceConfigurationINTEL]) {
+        return DispatchReleasePerformanceConfigurationINTEL(device, configuration);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkReleasePerformanceConfigurationINTEL, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12364,6 +13526,9 @@ VKAPI_ATTR VkResult VKAPI_CALL ReleasePerformanceConfigurationINTEL(VkDevice dev
 
 VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(VkQueue queue, VkPerformanceConfigurationINTEL configuration) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdQueueSetPerformanceConfigurationINTEL]) {
+        return DispatchQueueSetPerformanceConfigurationINTEL(queue, configuration);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueSetPerformanceConfigurationINTEL, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept :
@@ -12391,6 +13556,9 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSetPerformanceConfigurationINTEL(VkQueue que
 VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(VkDevice device, VkPerformanceParameterTypeINTEL parameter,
                                                             VkPerformanceValueINTEL* pValue) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPerformanceParameterINTEL]) {
+        return DispatchGetPerformanceParameterINTEL(device, parameter, pValue);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPerformanceParameterINTEL, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12415,6 +13583,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPerformanceParameterINTEL(VkDevice device, VkP
 
 VKAPI_ATTR void VKAPI_CALL SetLocalDimmingAMD(VkDevice device, VkSwapchainKHR swapChain, VkBool32 localDimmingEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetLocalDimmingAMD]) {
+        return DispatchSetLocalDimmingAMD(device, swapChain, localDimmingEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetLocalDimmingAMD, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLocalDimmingAMD]) {
@@ -12489,6 +13660,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMetalSurfaceEXT(VkInstance instance, const
 #endif  // VK_USE_PLATFORM_METAL_EXT
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressEXT(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetBufferDeviceAddressEXT]) {
+        return DispatchGetBufferDeviceAddressEXT(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferDeviceAddressEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetBufferDeviceAddressEXT]) {
@@ -12602,6 +13776,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModes2EXT(VkPhysic
 
 VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdAcquireFullScreenExclusiveModeEXT]) {
+        return DispatchAcquireFullScreenExclusiveModeEXT(device, swapchain);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkAcquireFullScreenExclusiveModeEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12626,6 +13803,9 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireFullScreenExclusiveModeEXT(VkDevice device
 
 VKAPI_ATTR VkResult VKAPI_CALL ReleaseFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdReleaseFullScreenExclusiveModeEXT]) {
+        return DispatchReleaseFullScreenExclusiveModeEXT(device, swapchain);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkReleaseFullScreenExclusiveModeEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12652,6 +13832,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(VkDevice de
                                                                      const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo,
                                                                      VkDeviceGroupPresentModeFlagsKHR* pModes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceGroupSurfacePresentModes2EXT]) {
+        return DispatchGetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceGroupSurfacePresentModes2EXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -12704,6 +13887,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateHeadlessSurfaceEXT(VkInstance instance, con
 VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
                                                 uint16_t lineStipplePattern) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetLineStippleEXT]) {
+        return DispatchCmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLineStippleEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLineStippleEXT]) {
@@ -12725,6 +13911,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(VkCommandBuffer commandBuffer, u
 
 VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdResetQueryPoolEXT]) {
+        return DispatchResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkResetQueryPoolEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateResetQueryPoolEXT]) {
@@ -12746,6 +13935,9 @@ VKAPI_ATTR void VKAPI_CALL ResetQueryPoolEXT(VkDevice device, VkQueryPool queryP
 
 VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetCullModeEXT]) {
+        return DispatchCmdSetCullModeEXT(commandBuffer, cullMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCullModeEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetCullModeEXT]) {
@@ -12767,6 +13959,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCu
 
 VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetFrontFaceEXT]) {
+        return DispatchCmdSetFrontFaceEXT(commandBuffer, frontFace);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetFrontFaceEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetFrontFaceEXT]) {
@@ -12788,6 +13983,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkF
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetPrimitiveTopologyEXT]) {
+        return DispatchCmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPrimitiveTopologyEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12811,6 +14009,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuf
 VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t viewportCount,
                                                       const VkViewport* pViewports) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetViewportWithCountEXT]) {
+        return DispatchCmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportWithCountEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12834,6 +14035,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(VkCommandBuffer commandBuf
 VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount,
                                                      const VkRect2D* pScissors) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetScissorWithCountEXT]) {
+        return DispatchCmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetScissorWithCountEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetScissorWithCountEXT]) {
@@ -12857,6 +14061,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffe
                                                     const VkBuffer* pBuffers, const VkDeviceSize* pOffsets,
                                                     const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindVertexBuffers2EXT]) {
+        return DispatchCmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindVertexBuffers2EXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindVertexBuffers2EXT]) {
@@ -12881,6 +14088,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthTestEnableEXT]) {
+        return DispatchCmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthTestEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthTestEnableEXT]) {
@@ -12902,6 +14112,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthWriteEnableEXT]) {
+        return DispatchCmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthWriteEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthWriteEnableEXT]) {
@@ -12923,6 +14136,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthCompareOpEXT]) {
+        return DispatchCmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthCompareOpEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthCompareOpEXT]) {
@@ -12944,6 +14160,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthBoundsTestEnableEXT]) {
+        return DispatchCmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBoundsTestEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12967,6 +14186,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBoundsTestEnableEXT(VkCommandBuffer comman
 
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetStencilTestEnableEXT]) {
+        return DispatchCmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilTestEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -12990,6 +14212,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilTestEnableEXT(VkCommandBuffer commandBuf
 VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp,
                                               VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetStencilOpEXT]) {
+        return DispatchCmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetStencilOpEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetStencilOpEXT]) {
@@ -13012,6 +14237,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkS
 
 VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToImageEXT(VkDevice device, const VkCopyMemoryToImageInfoEXT* pCopyMemoryToImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCopyMemoryToImageEXT]) {
+        return DispatchCopyMemoryToImageEXT(device, pCopyMemoryToImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyMemoryToImageEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMemoryToImageEXT]) {
@@ -13035,6 +14263,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToImageEXT(VkDevice device, const VkCop
 
 VKAPI_ATTR VkResult VKAPI_CALL CopyImageToMemoryEXT(VkDevice device, const VkCopyImageToMemoryInfoEXT* pCopyImageToMemoryInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCopyImageToMemoryEXT]) {
+        return DispatchCopyImageToMemoryEXT(device, pCopyImageToMemoryInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyImageToMemoryEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyImageToMemoryEXT]) {
@@ -13058,6 +14289,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyImageToMemoryEXT(VkDevice device, const VkCop
 
 VKAPI_ATTR VkResult VKAPI_CALL CopyImageToImageEXT(VkDevice device, const VkCopyImageToImageInfoEXT* pCopyImageToImageInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCopyImageToImageEXT]) {
+        return DispatchCopyImageToImageEXT(device, pCopyImageToImageInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyImageToImageEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyImageToImageEXT]) {
@@ -13082,6 +14316,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyImageToImageEXT(VkDevice device, const VkCopy
 VKAPI_ATTR VkResult VKAPI_CALL TransitionImageLayoutEXT(VkDevice device, uint32_t transitionCount,
                                                         const VkHostImageLayoutTransitionInfoEXT* pTransitions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdTransitionImageLayoutEXT]) {
+        return DispatchTransitionImageLayoutEXT(device, transitionCount, pTransitions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkTransitionImageLayoutEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateTransitionImageLayoutEXT]) {
@@ -13106,6 +14343,9 @@ VKAPI_ATTR VkResult VKAPI_CALL TransitionImageLayoutEXT(VkDevice device, uint32_
 VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2EXT(VkDevice device, VkImage image, const VkImageSubresource2KHR* pSubresource,
                                                          VkSubresourceLayout2KHR* pLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageSubresourceLayout2EXT]) {
+        return DispatchGetImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageSubresourceLayout2EXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13128,6 +14368,9 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2EXT(VkDevice device, VkImag
 
 VKAPI_ATTR VkResult VKAPI_CALL ReleaseSwapchainImagesEXT(VkDevice device, const VkReleaseSwapchainImagesInfoEXT* pReleaseInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdReleaseSwapchainImagesEXT]) {
+        return DispatchReleaseSwapchainImagesEXT(device, pReleaseInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkReleaseSwapchainImagesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateReleaseSwapchainImagesEXT]) {
@@ -13153,6 +14396,9 @@ VKAPI_ATTR void VKAPI_CALL GetGeneratedCommandsMemoryRequirementsNV(VkDevice dev
                                                                     const VkGeneratedCommandsMemoryRequirementsInfoNV* pInfo,
                                                                     VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetGeneratedCommandsMemoryRequirementsNV]) {
+        return DispatchGetGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetGeneratedCommandsMemoryRequirementsNV,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -13179,6 +14425,9 @@ VKAPI_ATTR void VKAPI_CALL GetGeneratedCommandsMemoryRequirementsNV(VkDevice dev
 VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(VkCommandBuffer commandBuffer,
                                                             const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdPreprocessGeneratedCommandsNV]) {
+        return DispatchCmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdPreprocessGeneratedCommandsNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13203,6 +14452,9 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(VkCommandBuffer comm
 VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed,
                                                          const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdExecuteGeneratedCommandsNV]) {
+        return DispatchCmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdExecuteGeneratedCommandsNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13228,6 +14480,9 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(VkCommandBuffer command
 VKAPI_ATTR void VKAPI_CALL CmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                                         VkPipeline pipeline, uint32_t groupIndex) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindPipelineShaderGroupNV]) {
+        return DispatchCmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindPipelineShaderGroupNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13255,6 +14510,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(VkDevice device,
                                                               const VkAllocationCallbacks* pAllocator,
                                                               VkIndirectCommandsLayoutNV* pIndirectCommandsLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateIndirectCommandsLayoutNV]) {
+        return DispatchCreateIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateIndirectCommandsLayoutNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13283,6 +14541,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(VkDevice device, VkIndirectCommandsLayoutNV indirectCommandsLayout,
                                                            const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyIndirectCommandsLayoutNV]) {
+        return DispatchDestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyIndirectCommandsLayoutNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13305,6 +14566,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(VkDevice device, VkIn
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias2EXT(VkCommandBuffer commandBuffer, const VkDepthBiasInfoEXT* pDepthBiasInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthBias2EXT]) {
+        return DispatchCmdSetDepthBias2EXT(commandBuffer, pDepthBiasInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBias2EXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBias2EXT]) {
@@ -13375,6 +14639,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(VkDevice device, const V
                                                         const VkAllocationCallbacks* pAllocator,
                                                         VkPrivateDataSlot* pPrivateDataSlot) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreatePrivateDataSlotEXT]) {
+        return DispatchCreatePrivateDataSlotEXT(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreatePrivateDataSlotEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePrivateDataSlotEXT]) {
@@ -13399,6 +14666,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(VkDevice device, const V
 VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(VkDevice device, VkPrivateDataSlot privateDataSlot,
                                                      const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyPrivateDataSlotEXT]) {
+        return DispatchDestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyPrivateDataSlotEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyPrivateDataSlotEXT]) {
@@ -13421,6 +14691,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(VkDevice device, VkPrivateD
 VKAPI_ATTR VkResult VKAPI_CALL SetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
                                                  VkPrivateDataSlot privateDataSlot, uint64_t data) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetPrivateDataEXT]) {
+        return DispatchSetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, data);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetPrivateDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetPrivateDataEXT]) {
@@ -13445,6 +14718,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SetPrivateDataEXT(VkDevice device, VkObjectType o
 VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
                                              VkPrivateDataSlot privateDataSlot, uint64_t* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPrivateDataEXT]) {
+        return DispatchGetPrivateDataEXT(device, objectType, objectHandle, privateDataSlot, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPrivateDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPrivateDataEXT]) {
@@ -13467,6 +14743,9 @@ VKAPI_ATTR void VKAPI_CALL GetPrivateDataEXT(VkDevice device, VkObjectType objec
 VKAPI_ATTR VkResult VKAPI_CALL CreateCudaModuleNV(VkDevice device, const VkCudaModuleCreateInfoNV* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkCudaModuleNV* pModule) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateCudaModuleNV]) {
+        return DispatchCreateCudaModuleNV(device, pCreateInfo, pAllocator, pModule);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateCudaModuleNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCudaModuleNV]) {
@@ -13490,6 +14769,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCudaModuleNV(VkDevice device, const VkCudaM
 
 VKAPI_ATTR VkResult VKAPI_CALL GetCudaModuleCacheNV(VkDevice device, VkCudaModuleNV module, size_t* pCacheSize, void* pCacheData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetCudaModuleCacheNV]) {
+        return DispatchGetCudaModuleCacheNV(device, module, pCacheSize, pCacheData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetCudaModuleCacheNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetCudaModuleCacheNV]) {
@@ -13514,6 +14796,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCudaModuleCacheNV(VkDevice device, VkCudaModul
 VKAPI_ATTR VkResult VKAPI_CALL CreateCudaFunctionNV(VkDevice device, const VkCudaFunctionCreateInfoNV* pCreateInfo,
                                                     const VkAllocationCallbacks* pAllocator, VkCudaFunctionNV* pFunction) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateCudaFunctionNV]) {
+        return DispatchCreateCudaFunctionNV(device, pCreateInfo, pAllocator, pFunction);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateCudaFunctionNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateCudaFunctionNV]) {
@@ -13537,6 +14822,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCudaFunctionNV(VkDevice device, const VkCud
 
 VKAPI_ATTR void VKAPI_CALL DestroyCudaModuleNV(VkDevice device, VkCudaModuleNV module, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyCudaModuleNV]) {
+        return DispatchDestroyCudaModuleNV(device, module, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyCudaModuleNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCudaModuleNV]) {
@@ -13559,6 +14847,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyCudaModuleNV(VkDevice device, VkCudaModuleNV m
 VKAPI_ATTR void VKAPI_CALL DestroyCudaFunctionNV(VkDevice device, VkCudaFunctionNV function,
                                                  const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyCudaFunctionNV]) {
+        return DispatchDestroyCudaFunctionNV(device, function, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyCudaFunctionNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyCudaFunctionNV]) {
@@ -13580,6 +14871,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyCudaFunctionNV(VkDevice device, VkCudaFunction
 
 VKAPI_ATTR void VKAPI_CALL CmdCudaLaunchKernelNV(VkCommandBuffer commandBuffer, const VkCudaLaunchInfoNV* pLaunchInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCudaLaunchKernelNV]) {
+        return DispatchCmdCudaLaunchKernelNV(commandBuffer, pLaunchInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCudaLaunchKernelNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCudaLaunchKernelNV]) {
@@ -13602,6 +14896,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCudaLaunchKernelNV(VkCommandBuffer commandBuffer,
 #ifdef VK_USE_PLATFORM_METAL_EXT
 VKAPI_ATTR void VKAPI_CALL ExportMetalObjectsEXT(VkDevice device, VkExportMetalObjectsInfoEXT* pMetalObjectsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdExportMetalObjectsEXT]) {
+        return DispatchExportMetalObjectsEXT(device, pMetalObjectsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkExportMetalObjectsEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateExportMetalObjectsEXT]) {
@@ -13625,6 +14922,9 @@ VKAPI_ATTR void VKAPI_CALL ExportMetalObjectsEXT(VkDevice device, VkExportMetalO
 VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSizeEXT(VkDevice device, VkDescriptorSetLayout layout,
                                                          VkDeviceSize* pLayoutSizeInBytes) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDescriptorSetLayoutSizeEXT]) {
+        return DispatchGetDescriptorSetLayoutSizeEXT(device, layout, pLayoutSizeInBytes);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetLayoutSizeEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13648,6 +14948,9 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSizeEXT(VkDevice device, VkDesc
 VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutBindingOffsetEXT(VkDevice device, VkDescriptorSetLayout layout, uint32_t binding,
                                                                   VkDeviceSize* pOffset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDescriptorSetLayoutBindingOffsetEXT]) {
+        return DispatchGetDescriptorSetLayoutBindingOffsetEXT(device, layout, binding, pOffset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetLayoutBindingOffsetEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13673,6 +14976,9 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutBindingOffsetEXT(VkDevice devic
 VKAPI_ATTR void VKAPI_CALL GetDescriptorEXT(VkDevice device, const VkDescriptorGetInfoEXT* pDescriptorInfo, size_t dataSize,
                                             void* pDescriptor) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDescriptorEXT]) {
+        return DispatchGetDescriptorEXT(device, pDescriptorInfo, dataSize, pDescriptor);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDescriptorEXT]) {
@@ -13695,6 +15001,9 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorEXT(VkDevice device, const VkDescriptorG
 VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount,
                                                        const VkDescriptorBufferBindingInfoEXT* pBindingInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindDescriptorBuffersEXT]) {
+        return DispatchCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindDescriptorBuffersEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13719,6 +15028,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer comm
                                                             VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount,
                                                             const uint32_t* pBufferIndices, const VkDeviceSize* pOffsets) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDescriptorBufferOffsetsEXT]) {
+        return DispatchCmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount,
+                                                        pBufferIndices, pOffsets);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDescriptorBufferOffsetsEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13748,6 +15061,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBufferEmbeddedSamplersEXT(VkCommandB
                                                                       VkPipelineBindPoint pipelineBindPoint,
                                                                       VkPipelineLayout layout, uint32_t set) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindDescriptorBufferEmbeddedSamplersEXT]) {
+        return DispatchCmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindDescriptorBufferEmbeddedSamplersEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13778,6 +15094,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetBufferOpaqueCaptureDescriptorDataEXT(VkDevice
                                                                        const VkBufferCaptureDescriptorDataInfoEXT* pInfo,
                                                                        void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetBufferOpaqueCaptureDescriptorDataEXT]) {
+        return DispatchGetBufferOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferOpaqueCaptureDescriptorDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13806,6 +15125,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageOpaqueCaptureDescriptorDataEXT(VkDevice d
                                                                       const VkImageCaptureDescriptorDataInfoEXT* pInfo,
                                                                       void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageOpaqueCaptureDescriptorDataEXT]) {
+        return DispatchGetImageOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageOpaqueCaptureDescriptorDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -13834,6 +15156,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetImageViewOpaqueCaptureDescriptorDataEXT(VkDevi
                                                                           const VkImageViewCaptureDescriptorDataInfoEXT* pInfo,
                                                                           void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetImageViewOpaqueCaptureDescriptorDataEXT]) {
+        return DispatchGetImageViewOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetImageViewOpaqueCaptureDescriptorDataEXT,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -13863,6 +15188,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSamplerOpaqueCaptureDescriptorDataEXT(VkDevice
                                                                         const VkSamplerCaptureDescriptorDataInfoEXT* pInfo,
                                                                         void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetSamplerOpaqueCaptureDescriptorDataEXT]) {
+        return DispatchGetSamplerOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSamplerOpaqueCaptureDescriptorDataEXT,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -13891,6 +15219,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSamplerOpaqueCaptureDescriptorDataEXT(VkDevice
 VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureOpaqueCaptureDescriptorDataEXT(
     VkDevice device, const VkAccelerationStructureCaptureDescriptorDataInfoEXT* pInfo, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetAccelerationStructureOpaqueCaptureDescriptorDataEXT]) {
+        return DispatchGetAccelerationStructureOpaqueCaptureDescriptorDataEXT(device, pInfo, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -13919,6 +15250,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetAccelerationStructureOpaqueCaptureDescriptorDa
 VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate,
                                                            const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetFragmentShadingRateEnumNV]) {
+        return DispatchCmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetFragmentShadingRateEnumNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -13943,6 +15277,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateEnumNV(VkCommandBuffer comma
 VKAPI_ATTR VkResult VKAPI_CALL GetDeviceFaultInfoEXT(VkDevice device, VkDeviceFaultCountsEXT* pFaultCounts,
                                                      VkDeviceFaultInfoEXT* pFaultInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceFaultInfoEXT]) {
+        return DispatchGetDeviceFaultInfoEXT(device, pFaultCounts, pFaultInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceFaultInfoEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetDeviceFaultInfoEXT]) {
@@ -14077,6 +15414,10 @@ VKAPI_ATTR void VKAPI_CALL CmdSetVertexInputEXT(VkCommandBuffer commandBuffer, u
                                                 uint32_t vertexAttributeDescriptionCount,
                                                 const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetVertexInputEXT]) {
+        return DispatchCmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions,
+                                            vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetVertexInputEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetVertexInputEXT]) {
@@ -14106,6 +15447,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryZirconHandleFUCHSIA(VkDevice device,
                                                             const VkMemoryGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo,
                                                             zx_handle_t* pZirconHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMemoryZirconHandleFUCHSIA]) {
+        return DispatchGetMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryZirconHandleFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14132,6 +15476,9 @@ VKAPI_ATTR VkResult VKAPI_CALL
 GetMemoryZirconHandlePropertiesFUCHSIA(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, zx_handle_t zirconHandle,
                                        VkMemoryZirconHandlePropertiesFUCHSIA* pMemoryZirconHandleProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMemoryZirconHandlePropertiesFUCHSIA]) {
+        return DispatchGetMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryZirconHandlePropertiesFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14163,6 +15510,9 @@ GetMemoryZirconHandlePropertiesFUCHSIA(VkDevice device, VkExternalMemoryHandleTy
 VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreZirconHandleFUCHSIA(
     VkDevice device, const VkImportSemaphoreZirconHandleInfoFUCHSIA* pImportSemaphoreZirconHandleInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdImportSemaphoreZirconHandleFUCHSIA]) {
+        return DispatchImportSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkImportSemaphoreZirconHandleFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14189,6 +15539,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreZirconHandleFUCHSIA(VkDevice device,
                                                                const VkSemaphoreGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo,
                                                                zx_handle_t* pZirconHandle) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetSemaphoreZirconHandleFUCHSIA]) {
+        return DispatchGetSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetSemaphoreZirconHandleFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14216,6 +15569,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferCollectionFUCHSIA(VkDevice device,
                                                              const VkAllocationCallbacks* pAllocator,
                                                              VkBufferCollectionFUCHSIA* pCollection) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateBufferCollectionFUCHSIA]) {
+        return DispatchCreateBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateBufferCollectionFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14241,6 +15597,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferCollectionFUCHSIA(VkDevice device,
 VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionImageConstraintsFUCHSIA(
     VkDevice device, VkBufferCollectionFUCHSIA collection, const VkImageConstraintsInfoFUCHSIA* pImageConstraintsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetBufferCollectionImageConstraintsFUCHSIA]) {
+        return DispatchSetBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetBufferCollectionImageConstraintsFUCHSIA,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -14270,6 +15629,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionImageConstraintsFUCHSIA(
 VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionBufferConstraintsFUCHSIA(
     VkDevice device, VkBufferCollectionFUCHSIA collection, const VkBufferConstraintsInfoFUCHSIA* pBufferConstraintsInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetBufferCollectionBufferConstraintsFUCHSIA]) {
+        return DispatchSetBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetBufferCollectionBufferConstraintsFUCHSIA,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -14300,6 +15662,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionBufferConstraintsFUCHSIA(
 VKAPI_ATTR void VKAPI_CALL DestroyBufferCollectionFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection,
                                                           const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyBufferCollectionFUCHSIA]) {
+        return DispatchDestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyBufferCollectionFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14323,6 +15688,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyBufferCollectionFUCHSIA(VkDevice device, VkBuf
 VKAPI_ATTR VkResult VKAPI_CALL GetBufferCollectionPropertiesFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection,
                                                                     VkBufferCollectionPropertiesFUCHSIA* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetBufferCollectionPropertiesFUCHSIA]) {
+        return DispatchGetBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetBufferCollectionPropertiesFUCHSIA, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -14351,6 +15719,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetBufferCollectionPropertiesFUCHSIA(VkDevice dev
 VKAPI_ATTR VkResult VKAPI_CALL GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(VkDevice device, VkRenderPass renderpass,
                                                                              VkExtent2D* pMaxWorkgroupSize) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI]) {
+        return DispatchGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -14379,6 +15750,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(VkD
 
 VKAPI_ATTR void VKAPI_CALL CmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSubpassShadingHUAWEI]) {
+        return DispatchCmdSubpassShadingHUAWEI(commandBuffer);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSubpassShadingHUAWEI, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSubpassShadingHUAWEI]) {
@@ -14401,6 +15775,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer, VkImageView imageView,
                                                        VkImageLayout imageLayout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindInvocationMaskHUAWEI]) {
+        return DispatchCmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindInvocationMaskHUAWEI,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14425,6 +15802,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryRemoteAddressNV(VkDevice device,
                                                         const VkMemoryGetRemoteAddressInfoNV* pMemoryGetRemoteAddressInfo,
                                                         VkRemoteAddressNV* pAddress) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMemoryRemoteAddressNV]) {
+        return DispatchGetMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMemoryRemoteAddressNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMemoryRemoteAddressNV]) {
@@ -14449,6 +15829,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryRemoteAddressNV(VkDevice device,
 VKAPI_ATTR VkResult VKAPI_CALL GetPipelinePropertiesEXT(VkDevice device, const VkPipelineInfoEXT* pPipelineInfo,
                                                         VkBaseOutStructure* pPipelineProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPipelinePropertiesEXT]) {
+        return DispatchGetPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelinePropertiesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetPipelinePropertiesEXT]) {
@@ -14472,6 +15855,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelinePropertiesEXT(VkDevice device, const V
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer, uint32_t patchControlPoints) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetPatchControlPointsEXT]) {
+        return DispatchCmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPatchControlPointsEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14494,6 +15880,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPatchControlPointsEXT(VkCommandBuffer commandBu
 
 VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetRasterizerDiscardEnableEXT]) {
+        return DispatchCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRasterizerDiscardEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14517,6 +15906,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizerDiscardEnableEXT(VkCommandBuffer comm
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthBiasEnableEXT]) {
+        return DispatchCmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthBiasEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthBiasEnableEXT]) {
@@ -14538,6 +15930,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetLogicOpEXT]) {
+        return DispatchCmdSetLogicOpEXT(commandBuffer, logicOp);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLogicOpEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLogicOpEXT]) {
@@ -14559,6 +15954,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLog
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetPrimitiveRestartEnableEXT]) {
+        return DispatchCmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPrimitiveRestartEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14636,6 +16034,9 @@ VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceScreenPresentationSupportQNX(VkP
 VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
                                                      const VkBool32* pColorWriteEnables) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetColorWriteEnableEXT]) {
+        return DispatchCmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetColorWriteEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorWriteEnableEXT]) {
@@ -14658,6 +16059,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteEnableEXT(VkCommandBuffer commandBuff
 VKAPI_ATTR void VKAPI_CALL CmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo,
                                            uint32_t instanceCount, uint32_t firstInstance, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawMultiEXT]) {
+        return DispatchCmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMultiEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMultiEXT]) {
@@ -14684,6 +16088,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer,
                                                   const VkMultiDrawIndexedInfoEXT* pIndexInfo, uint32_t instanceCount,
                                                   uint32_t firstInstance, uint32_t stride, const int32_t* pVertexOffset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawMultiIndexedEXT]) {
+        return DispatchCmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride,
+                                              pVertexOffset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMultiIndexedEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMultiIndexedEXT]) {
@@ -14709,6 +16117,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer,
 VKAPI_ATTR VkResult VKAPI_CALL CreateMicromapEXT(VkDevice device, const VkMicromapCreateInfoEXT* pCreateInfo,
                                                  const VkAllocationCallbacks* pAllocator, VkMicromapEXT* pMicromap) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateMicromapEXT]) {
+        return DispatchCreateMicromapEXT(device, pCreateInfo, pAllocator, pMicromap);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateMicromapEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateMicromapEXT]) {
@@ -14732,6 +16143,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMicromapEXT(VkDevice device, const VkMicrom
 
 VKAPI_ATTR void VKAPI_CALL DestroyMicromapEXT(VkDevice device, VkMicromapEXT micromap, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyMicromapEXT]) {
+        return DispatchDestroyMicromapEXT(device, micromap, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyMicromapEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyMicromapEXT]) {
@@ -14754,6 +16168,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyMicromapEXT(VkDevice device, VkMicromapEXT mic
 VKAPI_ATTR void VKAPI_CALL CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCount,
                                                 const VkMicromapBuildInfoEXT* pInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBuildMicromapsEXT]) {
+        return DispatchCmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBuildMicromapsEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBuildMicromapsEXT]) {
@@ -14776,6 +16193,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, u
 VKAPI_ATTR VkResult VKAPI_CALL BuildMicromapsEXT(VkDevice device, VkDeferredOperationKHR deferredOperation, uint32_t infoCount,
                                                  const VkMicromapBuildInfoEXT* pInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBuildMicromapsEXT]) {
+        return DispatchBuildMicromapsEXT(device, deferredOperation, infoCount, pInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBuildMicromapsEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateBuildMicromapsEXT]) {
@@ -14800,6 +16220,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BuildMicromapsEXT(VkDevice device, VkDeferredOper
 VKAPI_ATTR VkResult VKAPI_CALL CopyMicromapEXT(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                const VkCopyMicromapInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCopyMicromapEXT]) {
+        return DispatchCopyMicromapEXT(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyMicromapEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMicromapEXT]) {
@@ -14824,6 +16247,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMicromapEXT(VkDevice device, VkDeferredOperat
 VKAPI_ATTR VkResult VKAPI_CALL CopyMicromapToMemoryEXT(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                        const VkCopyMicromapToMemoryInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCopyMicromapToMemoryEXT]) {
+        return DispatchCopyMicromapToMemoryEXT(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyMicromapToMemoryEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMicromapToMemoryEXT]) {
@@ -14848,6 +16274,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMicromapToMemoryEXT(VkDevice device, VkDeferr
 VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToMicromapEXT(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                        const VkCopyMemoryToMicromapInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCopyMemoryToMicromapEXT]) {
+        return DispatchCopyMemoryToMicromapEXT(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyMemoryToMicromapEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCopyMemoryToMicromapEXT]) {
@@ -14872,6 +16301,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToMicromapEXT(VkDevice device, VkDeferr
 VKAPI_ATTR VkResult VKAPI_CALL WriteMicromapsPropertiesEXT(VkDevice device, uint32_t micromapCount, const VkMicromapEXT* pMicromaps,
                                                            VkQueryType queryType, size_t dataSize, void* pData, size_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdWriteMicromapsPropertiesEXT]) {
+        return DispatchWriteMicromapsPropertiesEXT(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWriteMicromapsPropertiesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateWriteMicromapsPropertiesEXT]) {
@@ -14898,6 +16330,9 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteMicromapsPropertiesEXT(VkDevice device, uint
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyMicromapEXT]) {
+        return DispatchCmdCopyMicromapEXT(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMicromapEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMicromapEXT]) {
@@ -14919,6 +16354,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapEXT(VkCommandBuffer commandBuffer, con
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapToMemoryInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyMicromapToMemoryEXT]) {
+        return DispatchCmdCopyMicromapToMemoryEXT(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMicromapToMemoryEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14941,6 +16379,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuf
 
 VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMemoryToMicromapInfoEXT* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyMemoryToMicromapEXT]) {
+        return DispatchCmdCopyMemoryToMicromapEXT(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMemoryToMicromapEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14965,6 +16406,9 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteMicromapsPropertiesEXT(VkCommandBuffer comman
                                                           const VkMicromapEXT* pMicromaps, VkQueryType queryType,
                                                           VkQueryPool queryPool, uint32_t firstQuery) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWriteMicromapsPropertiesEXT]) {
+        return DispatchCmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteMicromapsPropertiesEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -14992,6 +16436,9 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteMicromapsPropertiesEXT(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL GetDeviceMicromapCompatibilityEXT(VkDevice device, const VkMicromapVersionInfoEXT* pVersionInfo,
                                                              VkAccelerationStructureCompatibilityKHR* pCompatibility) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceMicromapCompatibilityEXT]) {
+        return DispatchGetDeviceMicromapCompatibilityEXT(device, pVersionInfo, pCompatibility);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceMicromapCompatibilityEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -15016,6 +16463,9 @@ VKAPI_ATTR void VKAPI_CALL GetMicromapBuildSizesEXT(VkDevice device, VkAccelerat
                                                     const VkMicromapBuildInfoEXT* pBuildInfo,
                                                     VkMicromapBuildSizesInfoEXT* pSizeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetMicromapBuildSizesEXT]) {
+        return DispatchGetMicromapBuildSizesEXT(device, buildType, pBuildInfo, pSizeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetMicromapBuildSizesEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetMicromapBuildSizesEXT]) {
@@ -15038,6 +16488,9 @@ VKAPI_ATTR void VKAPI_CALL GetMicromapBuildSizesEXT(VkDevice device, VkAccelerat
 VKAPI_ATTR void VKAPI_CALL CmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
                                                 uint32_t groupCountZ) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawClusterHUAWEI]) {
+        return DispatchCmdDrawClusterHUAWEI(commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawClusterHUAWEI, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawClusterHUAWEI]) {
@@ -15059,6 +16512,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, u
 
 VKAPI_ATTR void VKAPI_CALL CmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawClusterIndirectHUAWEI]) {
+        return DispatchCmdDrawClusterIndirectHUAWEI(commandBuffer, buffer, offset);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawClusterIndirectHUAWEI,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15082,6 +16538,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandB
 
 VKAPI_ATTR void VKAPI_CALL SetDeviceMemoryPriorityEXT(VkDevice device, VkDeviceMemory memory, float priority) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetDeviceMemoryPriorityEXT]) {
+        return DispatchSetDeviceMemoryPriorityEXT(device, memory, priority);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetDeviceMemoryPriorityEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetDeviceMemoryPriorityEXT]) {
@@ -15105,6 +16564,9 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutHostMappingInfoVALVE(VkDevice d
                                                                       const VkDescriptorSetBindingReferenceVALVE* pBindingReference,
                                                                       VkDescriptorSetLayoutHostMappingInfoVALVE* pHostMapping) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDescriptorSetLayoutHostMappingInfoVALVE]) {
+        return DispatchGetDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetLayoutHostMappingInfoVALVE,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -15131,6 +16593,9 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutHostMappingInfoVALVE(VkDevice d
 
 VKAPI_ATTR void VKAPI_CALL GetDescriptorSetHostMappingVALVE(VkDevice device, VkDescriptorSet descriptorSet, void** ppData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDescriptorSetHostMappingVALVE]) {
+        return DispatchGetDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDescriptorSetHostMappingVALVE, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -15154,6 +16619,9 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetHostMappingVALVE(VkDevice device, VkD
 VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer, VkDeviceAddress copyBufferAddress,
                                                    uint32_t copyCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyMemoryIndirectNV]) {
+        return DispatchCmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMemoryIndirectNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdCopyMemoryIndirectNV]) {
@@ -15178,6 +16646,10 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToImageIndirectNV(VkCommandBuffer comman
                                                           VkImageLayout dstImageLayout,
                                                           const VkImageSubresourceLayers* pImageSubresources) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyMemoryToImageIndirectNV]) {
+        return DispatchCmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout,
+                                                      pImageSubresources);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMemoryToImageIndirectNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15206,6 +16678,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToImageIndirectNV(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryNV(VkCommandBuffer commandBuffer, uint32_t decompressRegionCount,
                                                  const VkDecompressMemoryRegionNV* pDecompressMemoryRegions) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDecompressMemoryNV]) {
+        return DispatchCmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDecompressMemoryNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDecompressMemoryNV]) {
@@ -15230,6 +16705,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountNV(VkCommandBuffer co
                                                               VkDeviceAddress indirectCommandsAddress,
                                                               VkDeviceAddress indirectCommandsCountAddress, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDecompressMemoryIndirectCountNV]) {
+        return DispatchCmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress,
+                                                          stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDecompressMemoryIndirectCountNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15257,6 +16736,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDecompressMemoryIndirectCountNV(VkCommandBuffer co
 VKAPI_ATTR void VKAPI_CALL GetPipelineIndirectMemoryRequirementsNV(VkDevice device, const VkComputePipelineCreateInfo* pCreateInfo,
                                                                    VkMemoryRequirements2* pMemoryRequirements) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPipelineIndirectMemoryRequirementsNV]) {
+        return DispatchGetPipelineIndirectMemoryRequirementsNV(device, pCreateInfo, pMemoryRequirements);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineIndirectMemoryRequirementsNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -15283,6 +16765,9 @@ VKAPI_ATTR void VKAPI_CALL GetPipelineIndirectMemoryRequirementsNV(VkDevice devi
 VKAPI_ATTR void VKAPI_CALL CmdUpdatePipelineIndirectBufferNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
                                                              VkPipeline pipeline) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdUpdatePipelineIndirectBufferNV]) {
+        return DispatchCmdUpdatePipelineIndirectBufferNV(commandBuffer, pipelineBindPoint, pipeline);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdUpdatePipelineIndirectBufferNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15307,6 +16792,9 @@ VKAPI_ATTR void VKAPI_CALL CmdUpdatePipelineIndirectBufferNV(VkCommandBuffer com
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetPipelineIndirectDeviceAddressNV(VkDevice device,
                                                                          const VkPipelineIndirectDeviceAddressInfoNV* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetPipelineIndirectDeviceAddressNV]) {
+        return DispatchGetPipelineIndirectDeviceAddressNV(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetPipelineIndirectDeviceAddressNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -15331,6 +16819,9 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetPipelineIndirectDeviceAddressNV(VkDevic
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthClampEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClampEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthClampEnableEXT]) {
+        return DispatchCmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthClampEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthClampEnableEXT]) {
@@ -15352,6 +16843,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClampEnableEXT(VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL CmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, VkPolygonMode polygonMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetPolygonModeEXT]) {
+        return DispatchCmdSetPolygonModeEXT(commandBuffer, polygonMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetPolygonModeEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetPolygonModeEXT]) {
@@ -15374,6 +16868,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, V
 VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationSamplesEXT(VkCommandBuffer commandBuffer,
                                                          VkSampleCountFlagBits rasterizationSamples) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetRasterizationSamplesEXT]) {
+        return DispatchCmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRasterizationSamplesEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15398,6 +16895,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationSamplesEXT(VkCommandBuffer command
 VKAPI_ATTR void VKAPI_CALL CmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits samples,
                                                const VkSampleMask* pSampleMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetSampleMaskEXT]) {
+        return DispatchCmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetSampleMaskEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetSampleMaskEXT]) {
@@ -15419,6 +16919,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, Vk
 
 VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToCoverageEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToCoverageEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetAlphaToCoverageEnableEXT]) {
+        return DispatchCmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetAlphaToCoverageEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15442,6 +16945,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToCoverageEnableEXT(VkCommandBuffer comman
 
 VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToOneEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetAlphaToOneEnableEXT]) {
+        return DispatchCmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetAlphaToOneEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetAlphaToOneEnableEXT]) {
@@ -15463,6 +16969,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuff
 
 VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer, VkBool32 logicOpEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetLogicOpEnableEXT]) {
+        return DispatchCmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLogicOpEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetLogicOpEnableEXT]) {
@@ -15485,6 +16994,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer,
 VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEnableEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment,
                                                      uint32_t attachmentCount, const VkBool32* pColorBlendEnables) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetColorBlendEnableEXT]) {
+        return DispatchCmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetColorBlendEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorBlendEnableEXT]) {
@@ -15511,6 +17023,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEquationEXT(VkCommandBuffer commandBu
                                                        uint32_t attachmentCount,
                                                        const VkColorBlendEquationEXT* pColorBlendEquations) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetColorBlendEquationEXT]) {
+        return DispatchCmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetColorBlendEquationEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15537,6 +17052,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendEquationEXT(VkCommandBuffer commandBu
 VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment,
                                                    uint32_t attachmentCount, const VkColorComponentFlags* pColorWriteMasks) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetColorWriteMaskEXT]) {
+        return DispatchCmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetColorWriteMaskEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetColorWriteMaskEXT]) {
@@ -15562,6 +17080,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdSetTessellationDomainOriginEXT(VkCommandBuffer commandBuffer,
                                                              VkTessellationDomainOrigin domainOrigin) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetTessellationDomainOriginEXT]) {
+        return DispatchCmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetTessellationDomainOriginEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15585,6 +17106,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetTessellationDomainOriginEXT(VkCommandBuffer com
 
 VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationStreamEXT(VkCommandBuffer commandBuffer, uint32_t rasterizationStream) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetRasterizationStreamEXT]) {
+        return DispatchCmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRasterizationStreamEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15609,6 +17133,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRasterizationStreamEXT(VkCommandBuffer commandB
 VKAPI_ATTR void VKAPI_CALL CmdSetConservativeRasterizationModeEXT(
     VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetConservativeRasterizationModeEXT]) {
+        return DispatchCmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetConservativeRasterizationModeEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15636,6 +17163,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetConservativeRasterizationModeEXT(
 VKAPI_ATTR void VKAPI_CALL CmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBuffer commandBuffer,
                                                                      float extraPrimitiveOverestimationSize) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetExtraPrimitiveOverestimationSizeEXT]) {
+        return DispatchCmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetExtraPrimitiveOverestimationSizeEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15664,6 +17194,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBu
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClipEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthClipEnableEXT]) {
+        return DispatchCmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthClipEnableEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetDepthClipEnableEXT]) {
@@ -15685,6 +17218,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffe
 
 VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEnableEXT(VkCommandBuffer commandBuffer, VkBool32 sampleLocationsEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetSampleLocationsEnableEXT]) {
+        return DispatchCmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetSampleLocationsEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15710,6 +17246,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBu
                                                        uint32_t attachmentCount,
                                                        const VkColorBlendAdvancedEXT* pColorBlendAdvanced) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetColorBlendAdvancedEXT]) {
+        return DispatchCmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetColorBlendAdvancedEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15736,6 +17275,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBu
 VKAPI_ATTR void VKAPI_CALL CmdSetProvokingVertexModeEXT(VkCommandBuffer commandBuffer,
                                                         VkProvokingVertexModeEXT provokingVertexMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetProvokingVertexModeEXT]) {
+        return DispatchCmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetProvokingVertexModeEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15760,6 +17302,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetProvokingVertexModeEXT(VkCommandBuffer commandB
 VKAPI_ATTR void VKAPI_CALL CmdSetLineRasterizationModeEXT(VkCommandBuffer commandBuffer,
                                                           VkLineRasterizationModeEXT lineRasterizationMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetLineRasterizationModeEXT]) {
+        return DispatchCmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLineRasterizationModeEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15783,6 +17328,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineRasterizationModeEXT(VkCommandBuffer comman
 
 VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stippledLineEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetLineStippleEnableEXT]) {
+        return DispatchCmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetLineStippleEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15805,6 +17353,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEnableEXT(VkCommandBuffer commandBuf
 
 VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer commandBuffer, VkBool32 negativeOneToOne) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetDepthClipNegativeOneToOneEXT]) {
+        return DispatchCmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetDepthClipNegativeOneToOneEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15828,6 +17379,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer co
 
 VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingEnableNV(VkCommandBuffer commandBuffer, VkBool32 viewportWScalingEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetViewportWScalingEnableNV]) {
+        return DispatchCmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportWScalingEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15852,6 +17406,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingEnableNV(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL CmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
                                                    const VkViewportSwizzleNV* pViewportSwizzles) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetViewportSwizzleNV]) {
+        return DispatchCmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetViewportSwizzleNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdSetViewportSwizzleNV]) {
@@ -15875,6 +17432,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorEnableNV(VkCommandBuffer commandBuffer, VkBool32 coverageToColorEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetCoverageToColorEnableNV]) {
+        return DispatchCmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageToColorEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15898,6 +17458,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorEnableNV(VkCommandBuffer command
 
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorLocationNV(VkCommandBuffer commandBuffer, uint32_t coverageToColorLocation) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetCoverageToColorLocationNV]) {
+        return DispatchCmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageToColorLocationNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15922,6 +17485,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageToColorLocationNV(VkCommandBuffer comma
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationModeNV(VkCommandBuffer commandBuffer,
                                                           VkCoverageModulationModeNV coverageModulationMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetCoverageModulationModeNV]) {
+        return DispatchCmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageModulationModeNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15946,6 +17512,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationModeNV(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableEnableNV(VkCommandBuffer commandBuffer,
                                                                  VkBool32 coverageModulationTableEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetCoverageModulationTableEnableNV]) {
+        return DispatchCmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageModulationTableEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15973,6 +17542,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableEnableNV(VkCommandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableNV(VkCommandBuffer commandBuffer, uint32_t coverageModulationTableCount,
                                                            const float* pCoverageModulationTable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetCoverageModulationTableNV]) {
+        return DispatchCmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageModulationTableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -15999,6 +17571,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageModulationTableNV(VkCommandBuffer comma
 
 VKAPI_ATTR void VKAPI_CALL CmdSetShadingRateImageEnableNV(VkCommandBuffer commandBuffer, VkBool32 shadingRateImageEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetShadingRateImageEnableNV]) {
+        return DispatchCmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetShadingRateImageEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16023,6 +17598,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetShadingRateImageEnableNV(VkCommandBuffer comman
 VKAPI_ATTR void VKAPI_CALL CmdSetRepresentativeFragmentTestEnableNV(VkCommandBuffer commandBuffer,
                                                                     VkBool32 representativeFragmentTestEnable) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetRepresentativeFragmentTestEnableNV]) {
+        return DispatchCmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRepresentativeFragmentTestEnableNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16052,6 +17630,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRepresentativeFragmentTestEnableNV(VkCommandBuf
 VKAPI_ATTR void VKAPI_CALL CmdSetCoverageReductionModeNV(VkCommandBuffer commandBuffer,
                                                          VkCoverageReductionModeNV coverageReductionMode) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetCoverageReductionModeNV]) {
+        return DispatchCmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetCoverageReductionModeNV,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16076,6 +17657,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoverageReductionModeNV(VkCommandBuffer command
 VKAPI_ATTR void VKAPI_CALL GetShaderModuleIdentifierEXT(VkDevice device, VkShaderModule shaderModule,
                                                         VkShaderModuleIdentifierEXT* pIdentifier) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetShaderModuleIdentifierEXT]) {
+        return DispatchGetShaderModuleIdentifierEXT(device, shaderModule, pIdentifier);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetShaderModuleIdentifierEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16099,6 +17683,9 @@ VKAPI_ATTR void VKAPI_CALL GetShaderModuleIdentifierEXT(VkDevice device, VkShade
 VKAPI_ATTR void VKAPI_CALL GetShaderModuleCreateInfoIdentifierEXT(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                                                   VkShaderModuleIdentifierEXT* pIdentifier) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetShaderModuleCreateInfoIdentifierEXT]) {
+        return DispatchGetShaderModuleCreateInfoIdentifierEXT(device, pCreateInfo, pIdentifier);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetShaderModuleCreateInfoIdentifierEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16155,6 +17742,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateOpticalFlowSessionNV(VkDevice device, const
                                                           const VkAllocationCallbacks* pAllocator,
                                                           VkOpticalFlowSessionNV* pSession) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateOpticalFlowSessionNV]) {
+        return DispatchCreateOpticalFlowSessionNV(device, pCreateInfo, pAllocator, pSession);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateOpticalFlowSessionNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreateOpticalFlowSessionNV]) {
@@ -16179,6 +17769,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateOpticalFlowSessionNV(VkDevice device, const
 VKAPI_ATTR void VKAPI_CALL DestroyOpticalFlowSessionNV(VkDevice device, VkOpticalFlowSessionNV session,
                                                        const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyOpticalFlowSessionNV]) {
+        return DispatchDestroyOpticalFlowSessionNV(device, session, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyOpticalFlowSessionNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyOpticalFlowSessionNV]) {
@@ -16202,6 +17795,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BindOpticalFlowSessionImageNV(VkDevice device, Vk
                                                              VkOpticalFlowSessionBindingPointNV bindingPoint, VkImageView view,
                                                              VkImageLayout layout) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBindOpticalFlowSessionImageNV]) {
+        return DispatchBindOpticalFlowSessionImageNV(device, session, bindingPoint, view, layout);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBindOpticalFlowSessionImageNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16227,6 +17823,9 @@ VKAPI_ATTR VkResult VKAPI_CALL BindOpticalFlowSessionImageNV(VkDevice device, Vk
 VKAPI_ATTR void VKAPI_CALL CmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer, VkOpticalFlowSessionNV session,
                                                    const VkOpticalFlowExecuteInfoNV* pExecuteInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdOpticalFlowExecuteNV]) {
+        return DispatchCmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdOpticalFlowExecuteNV, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdOpticalFlowExecuteNV]) {
@@ -16248,6 +17847,9 @@ VKAPI_ATTR void VKAPI_CALL CmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer
 
 VKAPI_ATTR void VKAPI_CALL DestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyShaderEXT]) {
+        return DispatchDestroyShaderEXT(device, shader, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyShaderEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateDestroyShaderEXT]) {
@@ -16269,6 +17871,9 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderEXT(VkDevice device, VkShaderEXT shader,
 
 VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderEXT shader, size_t* pDataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetShaderBinaryDataEXT]) {
+        return DispatchGetShaderBinaryDataEXT(device, shader, pDataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetShaderBinaryDataEXT, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetShaderBinaryDataEXT]) {
@@ -16293,6 +17898,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderE
 VKAPI_ATTR void VKAPI_CALL CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount,
                                              const VkShaderStageFlagBits* pStages, const VkShaderEXT* pShaders) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBindShadersEXT]) {
+        return DispatchCmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBindShadersEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdBindShadersEXT]) {
@@ -16315,6 +17923,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint
 VKAPI_ATTR VkResult VKAPI_CALL GetFramebufferTilePropertiesQCOM(VkDevice device, VkFramebuffer framebuffer,
                                                                 uint32_t* pPropertiesCount, VkTilePropertiesQCOM* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetFramebufferTilePropertiesQCOM]) {
+        return DispatchGetFramebufferTilePropertiesQCOM(device, framebuffer, pPropertiesCount, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetFramebufferTilePropertiesQCOM, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16341,6 +17952,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFramebufferTilePropertiesQCOM(VkDevice device,
 VKAPI_ATTR VkResult VKAPI_CALL GetDynamicRenderingTilePropertiesQCOM(VkDevice device, const VkRenderingInfo* pRenderingInfo,
                                                                      VkTilePropertiesQCOM* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDynamicRenderingTilePropertiesQCOM]) {
+        return DispatchGetDynamicRenderingTilePropertiesQCOM(device, pRenderingInfo, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDynamicRenderingTilePropertiesQCOM, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16368,6 +17982,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDynamicRenderingTilePropertiesQCOM(VkDevice de
 VKAPI_ATTR VkResult VKAPI_CALL SetLatencySleepModeNV(VkDevice device, VkSwapchainKHR swapchain,
                                                      const VkLatencySleepModeInfoNV* pSleepModeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetLatencySleepModeNV]) {
+        return DispatchSetLatencySleepModeNV(device, swapchain, pSleepModeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetLatencySleepModeNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLatencySleepModeNV]) {
@@ -16391,6 +18008,9 @@ VKAPI_ATTR VkResult VKAPI_CALL SetLatencySleepModeNV(VkDevice device, VkSwapchai
 
 VKAPI_ATTR VkResult VKAPI_CALL LatencySleepNV(VkDevice device, VkSwapchainKHR swapchain, const VkLatencySleepInfoNV* pSleepInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdLatencySleepNV]) {
+        return DispatchLatencySleepNV(device, swapchain, pSleepInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkLatencySleepNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateLatencySleepNV]) {
@@ -16415,6 +18035,9 @@ VKAPI_ATTR VkResult VKAPI_CALL LatencySleepNV(VkDevice device, VkSwapchainKHR sw
 VKAPI_ATTR void VKAPI_CALL SetLatencyMarkerNV(VkDevice device, VkSwapchainKHR swapchain,
                                               const VkSetLatencyMarkerInfoNV* pLatencyMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdSetLatencyMarkerNV]) {
+        return DispatchSetLatencyMarkerNV(device, swapchain, pLatencyMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkSetLatencyMarkerNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateSetLatencyMarkerNV]) {
@@ -16437,6 +18060,9 @@ VKAPI_ATTR void VKAPI_CALL SetLatencyMarkerNV(VkDevice device, VkSwapchainKHR sw
 VKAPI_ATTR void VKAPI_CALL GetLatencyTimingsNV(VkDevice device, VkSwapchainKHR swapchain,
                                                VkGetLatencyMarkerInfoNV* pLatencyMarkerInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetLatencyTimingsNV]) {
+        return DispatchGetLatencyTimingsNV(device, swapchain, pLatencyMarkerInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetLatencyTimingsNV, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateGetLatencyTimingsNV]) {
@@ -16458,6 +18084,9 @@ VKAPI_ATTR void VKAPI_CALL GetLatencyTimingsNV(VkDevice device, VkSwapchainKHR s
 
 VKAPI_ATTR void VKAPI_CALL QueueNotifyOutOfBandNV(VkQueue queue, const VkOutOfBandQueueTypeInfoNV* pQueueTypeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdQueueNotifyOutOfBandNV]) {
+        return DispatchQueueNotifyOutOfBandNV(queue, pQueueTypeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkQueueNotifyOutOfBandNV, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateQueueNotifyOutOfBandNV]) {
@@ -16479,6 +18108,9 @@ VKAPI_ATTR void VKAPI_CALL QueueNotifyOutOfBandNV(VkQueue queue, const VkOutOfBa
 
 VKAPI_ATTR void VKAPI_CALL CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer commandBuffer, VkImageAspectFlags aspectMask) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetAttachmentFeedbackLoopEnableEXT]) {
+        return DispatchCmdSetAttachmentFeedbackLoopEnableEXT(commandBuffer, aspectMask);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetAttachmentFeedbackLoopEnableEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16506,6 +18138,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer
 VKAPI_ATTR VkResult VKAPI_CALL GetScreenBufferPropertiesQNX(VkDevice device, const struct _screen_buffer* buffer,
                                                             VkScreenBufferPropertiesQNX* pProperties) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetScreenBufferPropertiesQNX]) {
+        return DispatchGetScreenBufferPropertiesQNX(device, buffer, pProperties);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetScreenBufferPropertiesQNX, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16534,6 +18169,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(VkDevice device,
                                                               const VkAllocationCallbacks* pAllocator,
                                                               VkAccelerationStructureKHR* pAccelerationStructure) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCreateAccelerationStructureKHR]) {
+        return DispatchCreateAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCreateAccelerationStructureKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16561,6 +18199,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(VkDevice device,
 VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureKHR(VkDevice device, VkAccelerationStructureKHR accelerationStructure,
                                                            const VkAllocationCallbacks* pAllocator) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdDestroyAccelerationStructureKHR]) {
+        return DispatchDestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkDestroyAccelerationStructureKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16585,6 +18226,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
     VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
     const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBuildAccelerationStructuresKHR]) {
+        return DispatchCmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBuildAccelerationStructuresKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16613,6 +18257,10 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresIndirectKHR(VkCommandBu
                                                                      const uint32_t* pIndirectStrides,
                                                                      const uint32_t* const* ppMaxPrimitiveCounts) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdBuildAccelerationStructuresIndirectKHR]) {
+        return DispatchCmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses,
+                                                                 pIndirectStrides, ppMaxPrimitiveCounts);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdBuildAccelerationStructuresIndirectKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16645,6 +18293,9 @@ BuildAccelerationStructuresKHR(VkDevice device, VkDeferredOperationKHR deferredO
                                const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
                                const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdBuildAccelerationStructuresKHR]) {
+        return DispatchBuildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkBuildAccelerationStructuresKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16673,6 +18324,9 @@ BuildAccelerationStructuresKHR(VkDevice device, VkDeferredOperationKHR deferredO
 VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                             const VkCopyAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCopyAccelerationStructureKHR]) {
+        return DispatchCopyAccelerationStructureKHR(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyAccelerationStructureKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16698,6 +18352,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureKHR(VkDevice device, VkD
 VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureToMemoryKHR(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                                     const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCopyAccelerationStructureToMemoryKHR]) {
+        return DispatchCopyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyAccelerationStructureToMemoryKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16725,6 +18382,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureToMemoryKHR(VkDevice dev
 VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation,
                                                                     const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCopyMemoryToAccelerationStructureKHR]) {
+        return DispatchCopyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCopyMemoryToAccelerationStructureKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16754,6 +18414,10 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteAccelerationStructuresPropertiesKHR(VkDevice
                                                                         VkQueryType queryType, size_t dataSize, void* pData,
                                                                         size_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdWriteAccelerationStructuresPropertiesKHR]) {
+        return DispatchWriteAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures,
+                                                                queryType, dataSize, pData, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkWriteAccelerationStructuresPropertiesKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -16786,6 +18450,9 @@ VKAPI_ATTR VkResult VKAPI_CALL WriteAccelerationStructuresPropertiesKHR(VkDevice
 VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer,
                                                            const VkCopyAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyAccelerationStructureKHR]) {
+        return DispatchCmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyAccelerationStructureKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16810,6 +18477,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(VkCommandBuffer comma
 VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(VkCommandBuffer commandBuffer,
                                                                    const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyAccelerationStructureToMemoryKHR]) {
+        return DispatchCmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyAccelerationStructureToMemoryKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16836,6 +18506,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(VkCommandBuff
 VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuffer,
                                                                    const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdCopyMemoryToAccelerationStructureKHR]) {
+        return DispatchCmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdCopyMemoryToAccelerationStructureKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16862,6 +18535,9 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(VkCommandBuff
 VKAPI_ATTR VkDeviceAddress VKAPI_CALL
 GetAccelerationStructureDeviceAddressKHR(VkDevice device, const VkAccelerationStructureDeviceAddressInfoKHR* pInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetAccelerationStructureDeviceAddressKHR]) {
+        return DispatchGetAccelerationStructureDeviceAddressKHR(device, pInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAccelerationStructureDeviceAddressKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -16893,6 +18569,10 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteAccelerationStructuresPropertiesKHR(VkCommand
                                                                        VkQueryType queryType, VkQueryPool queryPool,
                                                                        uint32_t firstQuery) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdWriteAccelerationStructuresPropertiesKHR]) {
+        return DispatchCmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount,
+                                                                   pAccelerationStructures, queryType, queryPool, firstQuery);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdWriteAccelerationStructuresPropertiesKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -16924,6 +18604,9 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceAccelerationStructureCompatibilityKHR(VkDevi
                                                                           const VkAccelerationStructureVersionInfoKHR* pVersionInfo,
                                                                           VkAccelerationStructureCompatibilityKHR* pCompatibility) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetDeviceAccelerationStructureCompatibilityKHR]) {
+        return DispatchGetDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetDeviceAccelerationStructureCompatibilityKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -16953,6 +18636,9 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureBuildSizesKHR(VkDevice device
                                                                  const uint32_t* pMaxPrimitiveCounts,
                                                                  VkAccelerationStructureBuildSizesInfoKHR* pSizeInfo) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetAccelerationStructureBuildSizesKHR]) {
+        return DispatchGetAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetAccelerationStructureBuildSizesKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -16985,6 +18671,10 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(VkCommandBuffer commandBuffer,
                                            const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, uint32_t width,
                                            uint32_t height, uint32_t depth) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdTraceRaysKHR]) {
+        return DispatchCmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable,
+                                       pCallableShaderBindingTable, width, height, depth);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdTraceRaysKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysKHR]) {
@@ -17015,6 +18705,9 @@ VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingCaptureReplayShaderGroupHandlesKHR(V
                                                                                uint32_t firstGroup, uint32_t groupCount,
                                                                                size_t dataSize, void* pData) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetRayTracingCaptureReplayShaderGroupHandlesKHR]) {
+        return DispatchGetRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRayTracingCaptureReplayShaderGroupHandlesKHR,
                           VulkanTypedHandle(device, kVulkanObjectTypeDevice));
@@ -17051,6 +18744,10 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer
                                                    const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable,
                                                    VkDeviceAddress indirectDeviceAddress) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdTraceRaysIndirectKHR]) {
+        return DispatchCmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable,
+                                               pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdTraceRaysIndirectKHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdTraceRaysIndirectKHR]) {
@@ -17080,6 +18777,9 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer
 VKAPI_ATTR VkDeviceSize VKAPI_CALL GetRayTracingShaderGroupStackSizeKHR(VkDevice device, VkPipeline pipeline, uint32_t group,
                                                                         VkShaderGroupShaderKHR groupShader) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(device), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdGetRayTracingShaderGroupStackSizeKHR]) {
+        return DispatchGetRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkGetRayTracingShaderGroupStackSizeKHR, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
     for (const ValidationObject* intercept :
@@ -17105,6 +18805,9 @@ VKAPI_ATTR VkDeviceSize VKAPI_CALL GetRayTracingShaderGroupStackSizeKHR(VkDevice
 
 VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer, uint32_t pipelineStackSize) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdSetRayTracingPipelineStackSizeKHR]) {
+        return DispatchCmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdSetRayTracingPipelineStackSizeKHR,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -17131,6 +18834,9 @@ VKAPI_ATTR void VKAPI_CALL CmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer
 VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
                                                uint32_t groupCountZ) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawMeshTasksEXT]) {
+        return DispatchCmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksEXT, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksEXT]) {
@@ -17153,6 +18859,9 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, ui
 VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                        uint32_t drawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawMeshTasksIndirectEXT]) {
+        return DispatchCmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksIndirectEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -17177,6 +18886,10 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer comm
                                                             VkBuffer countBuffer, VkDeviceSize countBufferOffset,
                                                             uint32_t maxDrawCount, uint32_t stride) {
     auto layer_data = GetLayerDataPtr(GetDispatchKey(commandBuffer), layer_data_map);
+    if (layer_data->passthrough_commands[InterceptCommandIdCmdDrawMeshTasksIndirectCountEXT]) {
+        return DispatchCmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount,
+                                                        stride);
+    }
     bool skip = false;
     ErrorObject error_obj(vvl::Func::vkCmdDrawMeshTasksIndirectCountEXT,
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
@@ -45,6 +45,7 @@
 #include "vk_layer_config.h"
 #include "layer_options.h"
 #include "containers/custom_containers.h"
+#include "containers/handle_table.h"
 #include "error_message/logging.h"
 #include "error_message/error_location.h"
 #include "error_message/record_object.h"
@@ -55,21 +56,6 @@
 #include "vk_extension_helper.h"
 #include "gpu_validation/gpu_settings.h"
 
-extern std::atomic<uint64_t> global_unique_id;
-
-// To avoid re-hashing unique ids on each use, we precompute the hash and store the
-// hash's LSBs in the high 24 bits.
-struct HashedUint64 {
-    static const int HASHED_UINT64_SHIFT = 40;
-    size_t operator()(const uint64_t& t) const { return t >> HASHED_UINT64_SHIFT; }
-
-    static uint64_t hash(uint64_t id) {
-        uint64_t h = (uint64_t)vvl::hash<uint64_t>()(id);
-        id |= h << HASHED_UINT64_SHIFT;
-        return id;
-    }
-};
-
 namespace chassis {
 struct CreateGraphicsPipelines;
 struct CreateComputePipelines;
@@ -79,6 +65,8 @@ struct CreateShaderModule;
 struct ShaderObject;
 struct CreatePipelineLayout;
 struct CreateBuffer;
+struct QueueSubmit;
+struct QueueSubmit2;
 }  // namespace chassis
 
 namespace vvl {
@@ -90,7 +78,7 @@ class Pipeline;
 // Each chassis layer will need to track its own state
 using PipelineStates = std::vector<std::shared_ptr<vvl::Pipeline>>;
 
-extern vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+extern vvl::concurrent_handle_table unique_id_mapping;
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char* funcName);
 
@@ -2216,6 +2204,8 @@ class ValidationObject {
     }
 
     std::vector<std::vector<ValidationObject*>> intercept_vectors;
+    // Indexed by InterceptCommandId, set for the commands which no validation object intercepts at all
+    std::vector<bool> passthrough_commands;
 
     VkLayerInstanceDispatchTable instance_dispatch_table;
     VkLayerDispatchTable device_dispatch_table;
@@ -2227,6 +2217,7 @@ class ValidationObject {
     bool fine_grained_locking{true};
     GpuAVSettings gpuav_settings = {};
     DebugPrintfSettings printf_settings = {};
+    SyncValSettings syncval_settings = {};
 
     VkInstance instance = VK_NULL_HANDLE;
     VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -2401,10 +2392,8 @@ class ValidationObject {
     template <typename HandleType>
     HandleType WrapNew(HandleType new_created_handle) {
         if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
-        auto unique_id = global_unique_id++;
-        unique_id = HashedUint64::hash(unique_id);
+        const uint64_t unique_id = unique_id_mapping.insert(CastToUint64(new_created_handle));
         assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
-        unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
         return (HandleType)unique_id;
     }
 
@@ -4580,6 +4569,17 @@ class ValidationObject {
             PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj);
         };
 
+        // Allow command buffers to be added to the batches of QueueSubmit
+        virtual void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, const RecordObject& record_obj, chassis::QueueSubmit& chassis_state) {
+            PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, chassis::QueueSubmit2& chassis_state) {
+            PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, chassis::QueueSubmit2& chassis_state) {
+            PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj);
+        };
+
         // Modify a parameter to CreateDevice
         virtual void PreCallRecordCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, const RecordObject& record_obj, vku::safe_VkDeviceCreateInfo *modified_create_info) {
             PreCallRecordCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice, record_obj);
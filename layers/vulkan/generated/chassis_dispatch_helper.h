@@ -36,9 +36,6 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateGetDeviceQueue,
     InterceptIdPreCallRecordGetDeviceQueue,
     InterceptIdPostCallRecordGetDeviceQueue,
-    InterceptIdPreCallValidateQueueSubmit,
-    InterceptIdPreCallRecordQueueSubmit,
-    InterceptIdPostCallRecordQueueSubmit,
     InterceptIdPreCallValidateQueueWaitIdle,
     InterceptIdPreCallRecordQueueWaitIdle,
     InterceptIdPostCallRecordQueueWaitIdle,
@@ -486,9 +483,6 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateCmdWriteTimestamp2,
     InterceptIdPreCallRecordCmdWriteTimestamp2,
     InterceptIdPostCallRecordCmdWriteTimestamp2,
-    InterceptIdPreCallValidateQueueSubmit2,
-    InterceptIdPreCallRecordQueueSubmit2,
-    InterceptIdPostCallRecordQueueSubmit2,
     InterceptIdPreCallValidateCmdCopyBuffer2,
     InterceptIdPreCallRecordCmdCopyBuffer2,
     InterceptIdPostCallRecordCmdCopyBuffer2,
@@ -828,9 +822,6 @@ typedef enum InterceptId {
     InterceptIdPreCallValidateCmdWriteTimestamp2KHR,
     InterceptIdPreCallRecordCmdWriteTimestamp2KHR,
     InterceptIdPostCallRecordCmdWriteTimestamp2KHR,
-    InterceptIdPreCallValidateQueueSubmit2KHR,
-    InterceptIdPreCallRecordQueueSubmit2KHR,
-    InterceptIdPostCallRecordQueueSubmit2KHR,
     InterceptIdPreCallValidateCmdWriteBufferMarker2AMD,
     InterceptIdPreCallRecordCmdWriteBufferMarker2AMD,
     InterceptIdPostCallRecordCmdWriteBufferMarker2AMD,
@@ -1704,6 +1695,564 @@ typedef enum InterceptId {
     InterceptIdCount,
 } InterceptId;
 
+// Commands which are passed straight down the chain when no validation object intercepts them
+typedef enum InterceptCommandId {
+    InterceptCommandIdGetDeviceQueue,
+    InterceptCommandIdQueueWaitIdle,
+    InterceptCommandIdDeviceWaitIdle,
+    InterceptCommandIdAllocateMemory,
+    InterceptCommandIdFreeMemory,
+    InterceptCommandIdMapMemory,
+    InterceptCommandIdUnmapMemory,
+    InterceptCommandIdFlushMappedMemoryRanges,
+    InterceptCommandIdInvalidateMappedMemoryRanges,
+    InterceptCommandIdGetDeviceMemoryCommitment,
+    InterceptCommandIdBindBufferMemory,
+    InterceptCommandIdBindImageMemory,
+    InterceptCommandIdGetBufferMemoryRequirements,
+    InterceptCommandIdGetImageMemoryRequirements,
+    InterceptCommandIdGetImageSparseMemoryRequirements,
+    InterceptCommandIdQueueBindSparse,
+    InterceptCommandIdCreateFence,
+    InterceptCommandIdDestroyFence,
+    InterceptCommandIdResetFences,
+    InterceptCommandIdGetFenceStatus,
+    InterceptCommandIdWaitForFences,
+    InterceptCommandIdCreateSemaphore,
+    InterceptCommandIdDestroySemaphore,
+    InterceptCommandIdCreateEvent,
+    InterceptCommandIdDestroyEvent,
+    InterceptCommandIdGetEventStatus,
+    InterceptCommandIdSetEvent,
+    InterceptCommandIdResetEvent,
+    InterceptCommandIdCreateQueryPool,
+    InterceptCommandIdDestroyQueryPool,
+    InterceptCommandIdGetQueryPoolResults,
+    InterceptCommandIdDestroyBuffer,
+    InterceptCommandIdCreateBufferView,
+    InterceptCommandIdDestroyBufferView,
+    InterceptCommandIdCreateImage,
+    InterceptCommandIdDestroyImage,
+    InterceptCommandIdGetImageSubresourceLayout,
+    InterceptCommandIdCreateImageView,
+    InterceptCommandIdDestroyImageView,
+    InterceptCommandIdDestroyShaderModule,
+    InterceptCommandIdCreatePipelineCache,
+    InterceptCommandIdDestroyPipelineCache,
+    InterceptCommandIdGetPipelineCacheData,
+    InterceptCommandIdMergePipelineCaches,
+    InterceptCommandIdDestroyPipeline,
+    InterceptCommandIdDestroyPipelineLayout,
+    InterceptCommandIdCreateSampler,
+    InterceptCommandIdDestroySampler,
+    InterceptCommandIdCreateDescriptorSetLayout,
+    InterceptCommandIdDestroyDescriptorSetLayout,
+    InterceptCommandIdCreateDescriptorPool,
+    InterceptCommandIdDestroyDescriptorPool,
+    InterceptCommandIdResetDescriptorPool,
+    InterceptCommandIdFreeDescriptorSets,
+    InterceptCommandIdUpdateDescriptorSets,
+    InterceptCommandIdCreateFramebuffer,
+    InterceptCommandIdDestroyFramebuffer,
+    InterceptCommandIdCreateRenderPass,
+    InterceptCommandIdDestroyRenderPass,
+    InterceptCommandIdGetRenderAreaGranularity,
+    InterceptCommandIdCreateCommandPool,
+    InterceptCommandIdDestroyCommandPool,
+    InterceptCommandIdResetCommandPool,
+    InterceptCommandIdAllocateCommandBuffers,
+    InterceptCommandIdFreeCommandBuffers,
+    InterceptCommandIdBeginCommandBuffer,
+    InterceptCommandIdEndCommandBuffer,
+    InterceptCommandIdResetCommandBuffer,
+    InterceptCommandIdCmdBindPipeline,
+    InterceptCommandIdCmdSetViewport,
+    InterceptCommandIdCmdSetScissor,
+    InterceptCommandIdCmdSetLineWidth,
+    InterceptCommandIdCmdSetDepthBias,
+    InterceptCommandIdCmdSetBlendConstants,
+    InterceptCommandIdCmdSetDepthBounds,
+    InterceptCommandIdCmdSetStencilCompareMask,
+    InterceptCommandIdCmdSetStencilWriteMask,
+    InterceptCommandIdCmdSetStencilReference,
+    InterceptCommandIdCmdBindDescriptorSets,
+    InterceptCommandIdCmdBindIndexBuffer,
+    InterceptCommandIdCmdBindVertexBuffers,
+    InterceptCommandIdCmdDraw,
+    InterceptCommandIdCmdDrawIndexed,
+    InterceptCommandIdCmdDrawIndirect,
+    InterceptCommandIdCmdDrawIndexedIndirect,
+    InterceptCommandIdCmdDispatch,
+    InterceptCommandIdCmdDispatchIndirect,
+    InterceptCommandIdCmdCopyBuffer,
+    InterceptCommandIdCmdCopyImage,
+    InterceptCommandIdCmdBlitImage,
+    InterceptCommandIdCmdCopyBufferToImage,
+    InterceptCommandIdCmdCopyImageToBuffer,
+    InterceptCommandIdCmdUpdateBuffer,
+    InterceptCommandIdCmdFillBuffer,
+    InterceptCommandIdCmdClearColorImage,
+    InterceptCommandIdCmdClearDepthStencilImage,
+    InterceptCommandIdCmdClearAttachments,
+    InterceptCommandIdCmdResolveImage,
+    InterceptCommandIdCmdSetEvent,
+    InterceptCommandIdCmdResetEvent,
+    InterceptCommandIdCmdWaitEvents,
+    InterceptCommandIdCmdPipelineBarrier,
+    InterceptCommandIdCmdBeginQuery,
+    InterceptCommandIdCmdEndQuery,
+    InterceptCommandIdCmdResetQueryPool,
+    InterceptCommandIdCmdWriteTimestamp,
+    InterceptCommandIdCmdCopyQueryPoolResults,
+    InterceptCommandIdCmdPushConstants,
+    InterceptCommandIdCmdBeginRenderPass,
+    InterceptCommandIdCmdNextSubpass,
+    InterceptCommandIdCmdEndRenderPass,
+    InterceptCommandIdCmdExecuteCommands,
+    InterceptCommandIdBindBufferMemory2,
+    InterceptCommandIdBindImageMemory2,
+    InterceptCommandIdGetDeviceGroupPeerMemoryFeatures,
+    InterceptCommandIdCmdSetDeviceMask,
+    InterceptCommandIdCmdDispatchBase,
+    InterceptCommandIdGetImageMemoryRequirements2,
+    InterceptCommandIdGetBufferMemoryRequirements2,
+    InterceptCommandIdGetImageSparseMemoryRequirements2,
+    InterceptCommandIdTrimCommandPool,
+    InterceptCommandIdGetDeviceQueue2,
+    InterceptCommandIdCreateSamplerYcbcrConversion,
+    InterceptCommandIdDestroySamplerYcbcrConversion,
+    InterceptCommandIdCreateDescriptorUpdateTemplate,
+    InterceptCommandIdDestroyDescriptorUpdateTemplate,
+    InterceptCommandIdUpdateDescriptorSetWithTemplate,
+    InterceptCommandIdGetDescriptorSetLayoutSupport,
+    InterceptCommandIdCmdDrawIndirectCount,
+    InterceptCommandIdCmdDrawIndexedIndirectCount,
+    InterceptCommandIdCreateRenderPass2,
+    InterceptCommandIdCmdBeginRenderPass2,
+    InterceptCommandIdCmdNextSubpass2,
+    InterceptCommandIdCmdEndRenderPass2,
+    InterceptCommandIdResetQueryPool,
+    InterceptCommandIdGetSemaphoreCounterValue,
+    InterceptCommandIdWaitSemaphores,
+    InterceptCommandIdSignalSemaphore,
+    InterceptCommandIdGetBufferDeviceAddress,
+    InterceptCommandIdGetBufferOpaqueCaptureAddress,
+    InterceptCommandIdGetDeviceMemoryOpaqueCaptureAddress,
+    InterceptCommandIdCreatePrivateDataSlot,
+    InterceptCommandIdDestroyPrivateDataSlot,
+    InterceptCommandIdSetPrivateData,
+    InterceptCommandIdGetPrivateData,
+    InterceptCommandIdCmdSetEvent2,
+    InterceptCommandIdCmdResetEvent2,
+    InterceptCommandIdCmdWaitEvents2,
+    InterceptCommandIdCmdPipelineBarrier2,
+    InterceptCommandIdCmdWriteTimestamp2,
+    InterceptCommandIdCmdCopyBuffer2,
+    InterceptCommandIdCmdCopyImage2,
+    InterceptCommandIdCmdCopyBufferToImage2,
+    InterceptCommandIdCmdCopyImageToBuffer2,
+    InterceptCommandIdCmdBlitImage2,
+    InterceptCommandIdCmdResolveImage2,
+    InterceptCommandIdCmdBeginRendering,
+    InterceptCommandIdCmdEndRendering,
+    InterceptCommandIdCmdSetCullMode,
+    InterceptCommandIdCmdSetFrontFace,
+    InterceptCommandIdCmdSetPrimitiveTopology,
+    InterceptCommandIdCmdSetViewportWithCount,
+    InterceptCommandIdCmdSetScissorWithCount,
+    InterceptCommandIdCmdBindVertexBuffers2,
+    InterceptCommandIdCmdSetDepthTestEnable,
+    InterceptCommandIdCmdSetDepthWriteEnable,
+    InterceptCommandIdCmdSetDepthCompareOp,
+    InterceptCommandIdCmdSetDepthBoundsTestEnable,
+    InterceptCommandIdCmdSetStencilTestEnable,
+    InterceptCommandIdCmdSetStencilOp,
+    InterceptCommandIdCmdSetRasterizerDiscardEnable,
+    InterceptCommandIdCmdSetDepthBiasEnable,
+    InterceptCommandIdCmdSetPrimitiveRestartEnable,
+    InterceptCommandIdGetDeviceBufferMemoryRequirements,
+    InterceptCommandIdGetDeviceImageMemoryRequirements,
+    InterceptCommandIdGetDeviceImageSparseMemoryRequirements,
+    InterceptCommandIdCreateSwapchainKHR,
+    InterceptCommandIdDestroySwapchainKHR,
+    InterceptCommandIdGetSwapchainImagesKHR,
+    InterceptCommandIdAcquireNextImageKHR,
+    InterceptCommandIdQueuePresentKHR,
+    InterceptCommandIdGetDeviceGroupPresentCapabilitiesKHR,
+    InterceptCommandIdGetDeviceGroupSurfacePresentModesKHR,
+    InterceptCommandIdAcquireNextImage2KHR,
+    InterceptCommandIdCreateSharedSwapchainsKHR,
+    InterceptCommandIdCreateVideoSessionKHR,
+    InterceptCommandIdDestroyVideoSessionKHR,
+    InterceptCommandIdGetVideoSessionMemoryRequirementsKHR,
+    InterceptCommandIdBindVideoSessionMemoryKHR,
+    InterceptCommandIdCreateVideoSessionParametersKHR,
+    InterceptCommandIdUpdateVideoSessionParametersKHR,
+    InterceptCommandIdDestroyVideoSessionParametersKHR,
+    InterceptCommandIdCmdBeginVideoCodingKHR,
+    InterceptCommandIdCmdEndVideoCodingKHR,
+    InterceptCommandIdCmdControlVideoCodingKHR,
+    InterceptCommandIdCmdDecodeVideoKHR,
+    InterceptCommandIdCmdBeginRenderingKHR,
+    InterceptCommandIdCmdEndRenderingKHR,
+    InterceptCommandIdGetDeviceGroupPeerMemoryFeaturesKHR,
+    InterceptCommandIdCmdSetDeviceMaskKHR,
+    InterceptCommandIdCmdDispatchBaseKHR,
+    InterceptCommandIdTrimCommandPoolKHR,
+    InterceptCommandIdGetMemoryWin32HandleKHR,
+    InterceptCommandIdGetMemoryWin32HandlePropertiesKHR,
+    InterceptCommandIdGetMemoryFdKHR,
+    InterceptCommandIdGetMemoryFdPropertiesKHR,
+    InterceptCommandIdImportSemaphoreWin32HandleKHR,
+    InterceptCommandIdGetSemaphoreWin32HandleKHR,
+    InterceptCommandIdImportSemaphoreFdKHR,
+    InterceptCommandIdGetSemaphoreFdKHR,
+    InterceptCommandIdCmdPushDescriptorSetKHR,
+    InterceptCommandIdCmdPushDescriptorSetWithTemplateKHR,
+    InterceptCommandIdCreateDescriptorUpdateTemplateKHR,
+    InterceptCommandIdDestroyDescriptorUpdateTemplateKHR,
+    InterceptCommandIdUpdateDescriptorSetWithTemplateKHR,
+    InterceptCommandIdCreateRenderPass2KHR,
+    InterceptCommandIdCmdBeginRenderPass2KHR,
+    InterceptCommandIdCmdNextSubpass2KHR,
+    InterceptCommandIdCmdEndRenderPass2KHR,
+    InterceptCommandIdGetSwapchainStatusKHR,
+    InterceptCommandIdImportFenceWin32HandleKHR,
+    InterceptCommandIdGetFenceWin32HandleKHR,
+    InterceptCommandIdImportFenceFdKHR,
+    InterceptCommandIdGetFenceFdKHR,
+    InterceptCommandIdAcquireProfilingLockKHR,
+    InterceptCommandIdReleaseProfilingLockKHR,
+    InterceptCommandIdGetImageMemoryRequirements2KHR,
+    InterceptCommandIdGetBufferMemoryRequirements2KHR,
+    InterceptCommandIdGetImageSparseMemoryRequirements2KHR,
+    InterceptCommandIdCreateSamplerYcbcrConversionKHR,
+    InterceptCommandIdDestroySamplerYcbcrConversionKHR,
+    InterceptCommandIdBindBufferMemory2KHR,
+    InterceptCommandIdBindImageMemory2KHR,
+    InterceptCommandIdGetDescriptorSetLayoutSupportKHR,
+    InterceptCommandIdCmdDrawIndirectCountKHR,
+    InterceptCommandIdCmdDrawIndexedIndirectCountKHR,
+    InterceptCommandIdGetSemaphoreCounterValueKHR,
+    InterceptCommandIdWaitSemaphoresKHR,
+    InterceptCommandIdSignalSemaphoreKHR,
+    InterceptCommandIdCmdSetFragmentShadingRateKHR,
+    InterceptCommandIdCmdSetRenderingAttachmentLocationsKHR,
+    InterceptCommandIdCmdSetRenderingInputAttachmentIndicesKHR,
+    InterceptCommandIdWaitForPresentKHR,
+    InterceptCommandIdGetBufferDeviceAddressKHR,
+    InterceptCommandIdGetBufferOpaqueCaptureAddressKHR,
+    InterceptCommandIdGetDeviceMemoryOpaqueCaptureAddressKHR,
+    InterceptCommandIdCreateDeferredOperationKHR,
+    InterceptCommandIdDestroyDeferredOperationKHR,
+    InterceptCommandIdGetDeferredOperationMaxConcurrencyKHR,
+    InterceptCommandIdGetDeferredOperationResultKHR,
+    InterceptCommandIdDeferredOperationJoinKHR,
+    InterceptCommandIdGetPipelineExecutablePropertiesKHR,
+    InterceptCommandIdGetPipelineExecutableStatisticsKHR,
+    InterceptCommandIdGetPipelineExecutableInternalRepresentationsKHR,
+    InterceptCommandIdMapMemory2KHR,
+    InterceptCommandIdUnmapMemory2KHR,
+    InterceptCommandIdGetEncodedVideoSessionParametersKHR,
+    InterceptCommandIdCmdEncodeVideoKHR,
+    InterceptCommandIdCmdSetEvent2KHR,
+    InterceptCommandIdCmdResetEvent2KHR,
+    InterceptCommandIdCmdWaitEvents2KHR,
+    InterceptCommandIdCmdPipelineBarrier2KHR,
+    InterceptCommandIdCmdWriteTimestamp2KHR,
+    InterceptCommandIdCmdWriteBufferMarker2AMD,
+    InterceptCommandIdGetQueueCheckpointData2NV,
+    InterceptCommandIdCmdCopyBuffer2KHR,
+    InterceptCommandIdCmdCopyImage2KHR,
+    InterceptCommandIdCmdCopyBufferToImage2KHR,
+    InterceptCommandIdCmdCopyImageToBuffer2KHR,
+    InterceptCommandIdCmdBlitImage2KHR,
+    InterceptCommandIdCmdResolveImage2KHR,
+    InterceptCommandIdCmdTraceRaysIndirect2KHR,
+    InterceptCommandIdGetDeviceBufferMemoryRequirementsKHR,
+    InterceptCommandIdGetDeviceImageMemoryRequirementsKHR,
+    InterceptCommandIdGetDeviceImageSparseMemoryRequirementsKHR,
+    InterceptCommandIdCmdBindIndexBuffer2KHR,
+    InterceptCommandIdGetRenderingAreaGranularityKHR,
+    InterceptCommandIdGetDeviceImageSubresourceLayoutKHR,
+    InterceptCommandIdGetImageSubresourceLayout2KHR,
+    InterceptCommandIdCmdSetLineStippleKHR,
+    InterceptCommandIdGetCalibratedTimestampsKHR,
+    InterceptCommandIdCmdBindDescriptorSets2KHR,
+    InterceptCommandIdCmdPushConstants2KHR,
+    InterceptCommandIdCmdPushDescriptorSet2KHR,
+    InterceptCommandIdCmdPushDescriptorSetWithTemplate2KHR,
+    InterceptCommandIdCmdSetDescriptorBufferOffsets2EXT,
+    InterceptCommandIdCmdBindDescriptorBufferEmbeddedSamplers2EXT,
+    InterceptCommandIdDebugMarkerSetObjectTagEXT,
+    InterceptCommandIdDebugMarkerSetObjectNameEXT,
+    InterceptCommandIdCmdDebugMarkerBeginEXT,
+    InterceptCommandIdCmdDebugMarkerEndEXT,
+    InterceptCommandIdCmdDebugMarkerInsertEXT,
+    InterceptCommandIdCmdBindTransformFeedbackBuffersEXT,
+    InterceptCommandIdCmdBeginTransformFeedbackEXT,
+    InterceptCommandIdCmdEndTransformFeedbackEXT,
+    InterceptCommandIdCmdBeginQueryIndexedEXT,
+    InterceptCommandIdCmdEndQueryIndexedEXT,
+    InterceptCommandIdCmdDrawIndirectByteCountEXT,
+    InterceptCommandIdCreateCuModuleNVX,
+    InterceptCommandIdCreateCuFunctionNVX,
+    InterceptCommandIdDestroyCuModuleNVX,
+    InterceptCommandIdDestroyCuFunctionNVX,
+    InterceptCommandIdCmdCuLaunchKernelNVX,
+    InterceptCommandIdGetImageViewHandleNVX,
+    InterceptCommandIdGetImageViewAddressNVX,
+    InterceptCommandIdCmdDrawIndirectCountAMD,
+    InterceptCommandIdCmdDrawIndexedIndirectCountAMD,
+    InterceptCommandIdGetShaderInfoAMD,
+    InterceptCommandIdGetMemoryWin32HandleNV,
+    InterceptCommandIdCmdBeginConditionalRenderingEXT,
+    InterceptCommandIdCmdEndConditionalRenderingEXT,
+    InterceptCommandIdCmdSetViewportWScalingNV,
+    InterceptCommandIdDisplayPowerControlEXT,
+    InterceptCommandIdRegisterDeviceEventEXT,
+    InterceptCommandIdRegisterDisplayEventEXT,
+    InterceptCommandIdGetSwapchainCounterEXT,
+    InterceptCommandIdGetRefreshCycleDurationGOOGLE,
+    InterceptCommandIdGetPastPresentationTimingGOOGLE,
+    InterceptCommandIdCmdSetDiscardRectangleEXT,
+    InterceptCommandIdCmdSetDiscardRectangleEnableEXT,
+    InterceptCommandIdCmdSetDiscardRectangleModeEXT,
+    InterceptCommandIdSetHdrMetadataEXT,
+    InterceptCommandIdSetDebugUtilsObjectNameEXT,
+    InterceptCommandIdSetDebugUtilsObjectTagEXT,
+    InterceptCommandIdQueueBeginDebugUtilsLabelEXT,
+    InterceptCommandIdQueueEndDebugUtilsLabelEXT,
+    InterceptCommandIdQueueInsertDebugUtilsLabelEXT,
+    InterceptCommandIdCmdBeginDebugUtilsLabelEXT,
+    InterceptCommandIdCmdEndDebugUtilsLabelEXT,
+    InterceptCommandIdCmdInsertDebugUtilsLabelEXT,
+    InterceptCommandIdGetAndroidHardwareBufferPropertiesANDROID,
+    InterceptCommandIdGetMemoryAndroidHardwareBufferANDROID,
+    InterceptCommandIdCreateExecutionGraphPipelinesAMDX,
+    InterceptCommandIdGetExecutionGraphPipelineScratchSizeAMDX,
+    InterceptCommandIdGetExecutionGraphPipelineNodeIndexAMDX,
+    InterceptCommandIdCmdInitializeGraphScratchMemoryAMDX,
+    InterceptCommandIdCmdDispatchGraphAMDX,
+    InterceptCommandIdCmdDispatchGraphIndirectAMDX,
+    InterceptCommandIdCmdDispatchGraphIndirectCountAMDX,
+    InterceptCommandIdCmdSetSampleLocationsEXT,
+    InterceptCommandIdGetImageDrmFormatModifierPropertiesEXT,
+    InterceptCommandIdCmdBindShadingRateImageNV,
+    InterceptCommandIdCmdSetViewportShadingRatePaletteNV,
+    InterceptCommandIdCmdSetCoarseSampleOrderNV,
+    InterceptCommandIdCreateAccelerationStructureNV,
+    InterceptCommandIdDestroyAccelerationStructureNV,
+    InterceptCommandIdGetAccelerationStructureMemoryRequirementsNV,
+    InterceptCommandIdBindAccelerationStructureMemoryNV,
+    InterceptCommandIdCmdBuildAccelerationStructureNV,
+    InterceptCommandIdCmdCopyAccelerationStructureNV,
+    InterceptCommandIdCmdTraceRaysNV,
+    InterceptCommandIdGetRayTracingShaderGroupHandlesKHR,
+    InterceptCommandIdGetRayTracingShaderGroupHandlesNV,
+    InterceptCommandIdGetAccelerationStructureHandleNV,
+    InterceptCommandIdCmdWriteAccelerationStructuresPropertiesNV,
+    InterceptCommandIdCompileDeferredNV,
+    InterceptCommandIdGetMemoryHostPointerPropertiesEXT,
+    InterceptCommandIdCmdWriteBufferMarkerAMD,
+    InterceptCommandIdGetCalibratedTimestampsEXT,
+    InterceptCommandIdCmdDrawMeshTasksNV,
+    InterceptCommandIdCmdDrawMeshTasksIndirectNV,
+    InterceptCommandIdCmdDrawMeshTasksIndirectCountNV,
+    InterceptCommandIdCmdSetExclusiveScissorEnableNV,
+    InterceptCommandIdCmdSetExclusiveScissorNV,
+    InterceptCommandIdCmdSetCheckpointNV,
+    InterceptCommandIdGetQueueCheckpointDataNV,
+    InterceptCommandIdInitializePerformanceApiINTEL,
+    InterceptCommandIdUninitializePerformanceApiINTEL,
+    InterceptCommandIdCmdSetPerformanceMarkerINTEL,
+    InterceptCommandIdCmdSetPerformanceStreamMarkerINTEL,
+    InterceptCommandIdCmdSetPerformanceOverrideINTEL,
+    InterceptCommandIdAcquirePerformanceConfigurationINTEL,
+    InterceptCommandIdReleasePerformanceConfigurationINTEL,
+    InterceptCommandIdQueueSetPerformanceConfigurationINTEL,
+    InterceptCommandIdGetPerformanceParameterINTEL,
+    InterceptCommandIdSetLocalDimmingAMD,
+    InterceptCommandIdGetBufferDeviceAddressEXT,
+    InterceptCommandIdAcquireFullScreenExclusiveModeEXT,
+    InterceptCommandIdReleaseFullScreenExclusiveModeEXT,
+    InterceptCommandIdGetDeviceGroupSurfacePresentModes2EXT,
+    InterceptCommandIdCmdSetLineStippleEXT,
+    InterceptCommandIdResetQueryPoolEXT,
+    InterceptCommandIdCmdSetCullModeEXT,
+    InterceptCommandIdCmdSetFrontFaceEXT,
+    InterceptCommandIdCmdSetPrimitiveTopologyEXT,
+    InterceptCommandIdCmdSetViewportWithCountEXT,
+    InterceptCommandIdCmdSetScissorWithCountEXT,
+    InterceptCommandIdCmdBindVertexBuffers2EXT,
+    InterceptCommandIdCmdSetDepthTestEnableEXT,
+    InterceptCommandIdCmdSetDepthWriteEnableEXT,
+    InterceptCommandIdCmdSetDepthCompareOpEXT,
+    InterceptCommandIdCmdSetDepthBoundsTestEnableEXT,
+    InterceptCommandIdCmdSetStencilTestEnableEXT,
+    InterceptCommandIdCmdSetStencilOpEXT,
+    InterceptCommandIdCopyMemoryToImageEXT,
+    InterceptCommandIdCopyImageToMemoryEXT,
+    InterceptCommandIdCopyImageToImageEXT,
+    InterceptCommandIdTransitionImageLayoutEXT,
+    InterceptCommandIdGetImageSubresourceLayout2EXT,
+    InterceptCommandIdReleaseSwapchainImagesEXT,
+    InterceptCommandIdGetGeneratedCommandsMemoryRequirementsNV,
+    InterceptCommandIdCmdPreprocessGeneratedCommandsNV,
+    InterceptCommandIdCmdExecuteGeneratedCommandsNV,
+    InterceptCommandIdCmdBindPipelineShaderGroupNV,
+    InterceptCommandIdCreateIndirectCommandsLayoutNV,
+    InterceptCommandIdDestroyIndirectCommandsLayoutNV,
+    InterceptCommandIdCmdSetDepthBias2EXT,
+    InterceptCommandIdCreatePrivateDataSlotEXT,
+    InterceptCommandIdDestroyPrivateDataSlotEXT,
+    InterceptCommandIdSetPrivateDataEXT,
+    InterceptCommandIdGetPrivateDataEXT,
+    InterceptCommandIdCreateCudaModuleNV,
+    InterceptCommandIdGetCudaModuleCacheNV,
+    InterceptCommandIdCreateCudaFunctionNV,
+    InterceptCommandIdDestroyCudaModuleNV,
+    InterceptCommandIdDestroyCudaFunctionNV,
+    InterceptCommandIdCmdCudaLaunchKernelNV,
+    InterceptCommandIdExportMetalObjectsEXT,
+    InterceptCommandIdGetDescriptorSetLayoutSizeEXT,
+    InterceptCommandIdGetDescriptorSetLayoutBindingOffsetEXT,
+    InterceptCommandIdGetDescriptorEXT,
+    InterceptCommandIdCmdBindDescriptorBuffersEXT,
+    InterceptCommandIdCmdSetDescriptorBufferOffsetsEXT,
+    InterceptCommandIdCmdBindDescriptorBufferEmbeddedSamplersEXT,
+    InterceptCommandIdGetBufferOpaqueCaptureDescriptorDataEXT,
+    InterceptCommandIdGetImageOpaqueCaptureDescriptorDataEXT,
+    InterceptCommandIdGetImageViewOpaqueCaptureDescriptorDataEXT,
+    InterceptCommandIdGetSamplerOpaqueCaptureDescriptorDataEXT,
+    InterceptCommandIdGetAccelerationStructureOpaqueCaptureDescriptorDataEXT,
+    InterceptCommandIdCmdSetFragmentShadingRateEnumNV,
+    InterceptCommandIdGetDeviceFaultInfoEXT,
+    InterceptCommandIdCmdSetVertexInputEXT,
+    InterceptCommandIdGetMemoryZirconHandleFUCHSIA,
+    InterceptCommandIdGetMemoryZirconHandlePropertiesFUCHSIA,
+    InterceptCommandIdImportSemaphoreZirconHandleFUCHSIA,
+    InterceptCommandIdGetSemaphoreZirconHandleFUCHSIA,
+    InterceptCommandIdCreateBufferCollectionFUCHSIA,
+    InterceptCommandIdSetBufferCollectionImageConstraintsFUCHSIA,
+    InterceptCommandIdSetBufferCollectionBufferConstraintsFUCHSIA,
+    InterceptCommandIdDestroyBufferCollectionFUCHSIA,
+    InterceptCommandIdGetBufferCollectionPropertiesFUCHSIA,
+    InterceptCommandIdGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI,
+    InterceptCommandIdCmdSubpassShadingHUAWEI,
+    InterceptCommandIdCmdBindInvocationMaskHUAWEI,
+    InterceptCommandIdGetMemoryRemoteAddressNV,
+    InterceptCommandIdGetPipelinePropertiesEXT,
+    InterceptCommandIdCmdSetPatchControlPointsEXT,
+    InterceptCommandIdCmdSetRasterizerDiscardEnableEXT,
+    InterceptCommandIdCmdSetDepthBiasEnableEXT,
+    InterceptCommandIdCmdSetLogicOpEXT,
+    InterceptCommandIdCmdSetPrimitiveRestartEnableEXT,
+    InterceptCommandIdCmdSetColorWriteEnableEXT,
+    InterceptCommandIdCmdDrawMultiEXT,
+    InterceptCommandIdCmdDrawMultiIndexedEXT,
+    InterceptCommandIdCreateMicromapEXT,
+    InterceptCommandIdDestroyMicromapEXT,
+    InterceptCommandIdCmdBuildMicromapsEXT,
+    InterceptCommandIdBuildMicromapsEXT,
+    InterceptCommandIdCopyMicromapEXT,
+    InterceptCommandIdCopyMicromapToMemoryEXT,
+    InterceptCommandIdCopyMemoryToMicromapEXT,
+    InterceptCommandIdWriteMicromapsPropertiesEXT,
+    InterceptCommandIdCmdCopyMicromapEXT,
+    InterceptCommandIdCmdCopyMicromapToMemoryEXT,
+    InterceptCommandIdCmdCopyMemoryToMicromapEXT,
+    InterceptCommandIdCmdWriteMicromapsPropertiesEXT,
+    InterceptCommandIdGetDeviceMicromapCompatibilityEXT,
+    InterceptCommandIdGetMicromapBuildSizesEXT,
+    InterceptCommandIdCmdDrawClusterHUAWEI,
+    InterceptCommandIdCmdDrawClusterIndirectHUAWEI,
+    InterceptCommandIdSetDeviceMemoryPriorityEXT,
+    InterceptCommandIdGetDescriptorSetLayoutHostMappingInfoVALVE,
+    InterceptCommandIdGetDescriptorSetHostMappingVALVE,
+    InterceptCommandIdCmdCopyMemoryIndirectNV,
+    InterceptCommandIdCmdCopyMemoryToImageIndirectNV,
+    InterceptCommandIdCmdDecompressMemoryNV,
+    InterceptCommandIdCmdDecompressMemoryIndirectCountNV,
+    InterceptCommandIdGetPipelineIndirectMemoryRequirementsNV,
+    InterceptCommandIdCmdUpdatePipelineIndirectBufferNV,
+    InterceptCommandIdGetPipelineIndirectDeviceAddressNV,
+    InterceptCommandIdCmdSetDepthClampEnableEXT,
+    InterceptCommandIdCmdSetPolygonModeEXT,
+    InterceptCommandIdCmdSetRasterizationSamplesEXT,
+    InterceptCommandIdCmdSetSampleMaskEXT,
+    InterceptCommandIdCmdSetAlphaToCoverageEnableEXT,
+    InterceptCommandIdCmdSetAlphaToOneEnableEXT,
+    InterceptCommandIdCmdSetLogicOpEnableEXT,
+    InterceptCommandIdCmdSetColorBlendEnableEXT,
+    InterceptCommandIdCmdSetColorBlendEquationEXT,
+    InterceptCommandIdCmdSetColorWriteMaskEXT,
+    InterceptCommandIdCmdSetTessellationDomainOriginEXT,
+    InterceptCommandIdCmdSetRasterizationStreamEXT,
+    InterceptCommandIdCmdSetConservativeRasterizationModeEXT,
+    InterceptCommandIdCmdSetExtraPrimitiveOverestimationSizeEXT,
+    InterceptCommandIdCmdSetDepthClipEnableEXT,
+    InterceptCommandIdCmdSetSampleLocationsEnableEXT,
+    InterceptCommandIdCmdSetColorBlendAdvancedEXT,
+    InterceptCommandIdCmdSetProvokingVertexModeEXT,
+    InterceptCommandIdCmdSetLineRasterizationModeEXT,
+    InterceptCommandIdCmdSetLineStippleEnableEXT,
+    InterceptCommandIdCmdSetDepthClipNegativeOneToOneEXT,
+    InterceptCommandIdCmdSetViewportWScalingEnableNV,
+    InterceptCommandIdCmdSetViewportSwizzleNV,
+    InterceptCommandIdCmdSetCoverageToColorEnableNV,
+    InterceptCommandIdCmdSetCoverageToColorLocationNV,
+    InterceptCommandIdCmdSetCoverageModulationModeNV,
+    InterceptCommandIdCmdSetCoverageModulationTableEnableNV,
+    InterceptCommandIdCmdSetCoverageModulationTableNV,
+    InterceptCommandIdCmdSetShadingRateImageEnableNV,
+    InterceptCommandIdCmdSetRepresentativeFragmentTestEnableNV,
+    InterceptCommandIdCmdSetCoverageReductionModeNV,
+    InterceptCommandIdGetShaderModuleIdentifierEXT,
+    InterceptCommandIdGetShaderModuleCreateInfoIdentifierEXT,
+    InterceptCommandIdCreateOpticalFlowSessionNV,
+    InterceptCommandIdDestroyOpticalFlowSessionNV,
+    InterceptCommandIdBindOpticalFlowSessionImageNV,
+    InterceptCommandIdCmdOpticalFlowExecuteNV,
+    InterceptCommandIdDestroyShaderEXT,
+    InterceptCommandIdGetShaderBinaryDataEXT,
+    InterceptCommandIdCmdBindShadersEXT,
+    InterceptCommandIdGetFramebufferTilePropertiesQCOM,
+    InterceptCommandIdGetDynamicRenderingTilePropertiesQCOM,
+    InterceptCommandIdSetLatencySleepModeNV,
+    InterceptCommandIdLatencySleepNV,
+    InterceptCommandIdSetLatencyMarkerNV,
+    InterceptCommandIdGetLatencyTimingsNV,
+    InterceptCommandIdQueueNotifyOutOfBandNV,
+    InterceptCommandIdCmdSetAttachmentFeedbackLoopEnableEXT,
+    InterceptCommandIdGetScreenBufferPropertiesQNX,
+    InterceptCommandIdCreateAccelerationStructureKHR,
+    InterceptCommandIdDestroyAccelerationStructureKHR,
+    InterceptCommandIdCmdBuildAccelerationStructuresKHR,
+    InterceptCommandIdCmdBuildAccelerationStructuresIndirectKHR,
+    InterceptCommandIdBuildAccelerationStructuresKHR,
+    InterceptCommandIdCopyAccelerationStructureKHR,
+    InterceptCommandIdCopyAccelerationStructureToMemoryKHR,
+    InterceptCommandIdCopyMemoryToAccelerationStructureKHR,
+    InterceptCommandIdWriteAccelerationStructuresPropertiesKHR,
+    InterceptCommandIdCmdCopyAccelerationStructureKHR,
+    InterceptCommandIdCmdCopyAccelerationStructureToMemoryKHR,
+    InterceptCommandIdCmdCopyMemoryToAccelerationStructureKHR,
+    InterceptCommandIdGetAccelerationStructureDeviceAddressKHR,
+    InterceptCommandIdCmdWriteAccelerationStructuresPropertiesKHR,
+    InterceptCommandIdGetDeviceAccelerationStructureCompatibilityKHR,
+    InterceptCommandIdGetAccelerationStructureBuildSizesKHR,
+    InterceptCommandIdCmdTraceRaysKHR,
+    InterceptCommandIdGetRayTracingCaptureReplayShaderGroupHandlesKHR,
+    InterceptCommandIdCmdTraceRaysIndirectKHR,
+    InterceptCommandIdGetRayTracingShaderGroupStackSizeKHR,
+    InterceptCommandIdCmdSetRayTracingPipelineStackSizeKHR,
+    InterceptCommandIdCmdDrawMeshTasksEXT,
+    InterceptCommandIdCmdDrawMeshTasksIndirectEXT,
+    InterceptCommandIdCmdDrawMeshTasksIndirectCountEXT,
+    InterceptCommandIdCount,
+} InterceptCommandId;
+
 // clang-format off
 void ValidationObject::InitObjectDispatchVectors() {
 
@@ -1719,6 +2268,11 @@ void ValidationObject::InitObjectDispatchVectors() {
                                 typeid(&debug_printf::Validator::name), \
                                 typeid(&SyncValidator::name));
 
+#define BUILD_PASSTHROUGH_FLAG(name) \
+    passthrough_commands[InterceptCommandId ## name] = intercept_vectors[InterceptIdPreCallValidate ## name].empty() && \
+                                                       intercept_vectors[InterceptIdPreCallRecord ## name].empty() && \
+                                                       intercept_vectors[InterceptIdPostCallRecord ## name].empty();
+
     auto init_object_dispatch_vector = [this](InterceptId id,
                                               const std::type_info& vo_typeid,
                                               const std::type_info& tt_typeid,
@@ -1768,1694 +2322,2239 @@ void ValidationObject::InitObjectDispatchVectors() {
     // clang-format on
 
     intercept_vectors.resize(InterceptIdCount);
+    passthrough_commands.resize(InterceptCommandIdCount);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit);
-    BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit);
-    BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PreCallValidateQueueWaitIdle);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueWaitIdle);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueWaitIdle);
+    BUILD_PASSTHROUGH_FLAG(QueueWaitIdle);
     BUILD_DISPATCH_VECTOR(PreCallValidateDeviceWaitIdle);
     BUILD_DISPATCH_VECTOR(PreCallRecordDeviceWaitIdle);
     BUILD_DISPATCH_VECTOR(PostCallRecordDeviceWaitIdle);
+    BUILD_PASSTHROUGH_FLAG(DeviceWaitIdle);
     BUILD_DISPATCH_VECTOR(PreCallValidateAllocateMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordAllocateMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordAllocateMemory);
+    BUILD_PASSTHROUGH_FLAG(AllocateMemory);
     BUILD_DISPATCH_VECTOR(PreCallValidateFreeMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordFreeMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordFreeMemory);
+    BUILD_PASSTHROUGH_FLAG(FreeMemory);
     BUILD_DISPATCH_VECTOR(PreCallValidateMapMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordMapMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordMapMemory);
+    BUILD_PASSTHROUGH_FLAG(MapMemory);
     BUILD_DISPATCH_VECTOR(PreCallValidateUnmapMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordUnmapMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordUnmapMemory);
+    BUILD_PASSTHROUGH_FLAG(UnmapMemory);
     BUILD_DISPATCH_VECTOR(PreCallValidateFlushMappedMemoryRanges);
     BUILD_DISPATCH_VECTOR(PreCallRecordFlushMappedMemoryRanges);
     BUILD_DISPATCH_VECTOR(PostCallRecordFlushMappedMemoryRanges);
+    BUILD_PASSTHROUGH_FLAG(FlushMappedMemoryRanges);
     BUILD_DISPATCH_VECTOR(PreCallValidateInvalidateMappedMemoryRanges);
     BUILD_DISPATCH_VECTOR(PreCallRecordInvalidateMappedMemoryRanges);
     BUILD_DISPATCH_VECTOR(PostCallRecordInvalidateMappedMemoryRanges);
+    BUILD_PASSTHROUGH_FLAG(InvalidateMappedMemoryRanges);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryCommitment);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryCommitment);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryCommitment);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceMemoryCommitment);
     BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory);
+    BUILD_PASSTHROUGH_FLAG(BindBufferMemory);
     BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory);
+    BUILD_PASSTHROUGH_FLAG(BindImageMemory);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements);
+    BUILD_PASSTHROUGH_FLAG(GetBufferMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements);
+    BUILD_PASSTHROUGH_FLAG(GetImageMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements);
+    BUILD_PASSTHROUGH_FLAG(GetImageSparseMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallValidateQueueBindSparse);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueBindSparse);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueBindSparse);
+    BUILD_PASSTHROUGH_FLAG(QueueBindSparse);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateFence);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateFence);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateFence);
+    BUILD_PASSTHROUGH_FLAG(CreateFence);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyFence);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyFence);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyFence);
+    BUILD_PASSTHROUGH_FLAG(DestroyFence);
     BUILD_DISPATCH_VECTOR(PreCallValidateResetFences);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetFences);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetFences);
+    BUILD_PASSTHROUGH_FLAG(ResetFences);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceStatus);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceStatus);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceStatus);
+    BUILD_PASSTHROUGH_FLAG(GetFenceStatus);
     BUILD_DISPATCH_VECTOR(PreCallValidateWaitForFences);
     BUILD_DISPATCH_VECTOR(PreCallRecordWaitForFences);
     BUILD_DISPATCH_VECTOR(PostCallRecordWaitForFences);
+    BUILD_PASSTHROUGH_FLAG(WaitForFences);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateSemaphore);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSemaphore);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSemaphore);
+    BUILD_PASSTHROUGH_FLAG(CreateSemaphore);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroySemaphore);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroySemaphore);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroySemaphore);
+    BUILD_PASSTHROUGH_FLAG(DestroySemaphore);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateEvent);
+    BUILD_PASSTHROUGH_FLAG(CreateEvent);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyEvent);
+    BUILD_PASSTHROUGH_FLAG(DestroyEvent);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetEventStatus);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetEventStatus);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetEventStatus);
+    BUILD_PASSTHROUGH_FLAG(GetEventStatus);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetEvent);
+    BUILD_PASSTHROUGH_FLAG(SetEvent);
     BUILD_DISPATCH_VECTOR(PreCallValidateResetEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetEvent);
+    BUILD_PASSTHROUGH_FLAG(ResetEvent);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateQueryPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateQueryPool);
+    BUILD_PASSTHROUGH_FLAG(CreateQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyQueryPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyQueryPool);
+    BUILD_PASSTHROUGH_FLAG(DestroyQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetQueryPoolResults);
+    BUILD_PASSTHROUGH_FLAG(GetQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyBuffer);
+    BUILD_PASSTHROUGH_FLAG(DestroyBuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateBufferView);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateBufferView);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateBufferView);
+    BUILD_PASSTHROUGH_FLAG(CreateBufferView);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBufferView);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBufferView);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyBufferView);
+    BUILD_PASSTHROUGH_FLAG(DestroyBufferView);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateImage);
+    BUILD_PASSTHROUGH_FLAG(CreateImage);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyImage);
+    BUILD_PASSTHROUGH_FLAG(DestroyImage);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSubresourceLayout);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSubresourceLayout);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSubresourceLayout);
+    BUILD_PASSTHROUGH_FLAG(GetImageSubresourceLayout);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateImageView);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateImageView);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateImageView);
+    BUILD_PASSTHROUGH_FLAG(CreateImageView);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyImageView);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyImageView);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyImageView);
+    BUILD_PASSTHROUGH_FLAG(DestroyImageView);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyShaderModule);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyShaderModule);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyShaderModule);
+    BUILD_PASSTHROUGH_FLAG(DestroyShaderModule);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreatePipelineCache);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreatePipelineCache);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreatePipelineCache);
+    BUILD_PASSTHROUGH_FLAG(CreatePipelineCache);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipelineCache);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipelineCache);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipelineCache);
+    BUILD_PASSTHROUGH_FLAG(DestroyPipelineCache);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineCacheData);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineCacheData);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineCacheData);
+    BUILD_PASSTHROUGH_FLAG(GetPipelineCacheData);
     BUILD_DISPATCH_VECTOR(PreCallValidateMergePipelineCaches);
     BUILD_DISPATCH_VECTOR(PreCallRecordMergePipelineCaches);
     BUILD_DISPATCH_VECTOR(PostCallRecordMergePipelineCaches);
+    BUILD_PASSTHROUGH_FLAG(MergePipelineCaches);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipeline);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipeline);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipeline);
+    BUILD_PASSTHROUGH_FLAG(DestroyPipeline);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPipelineLayout);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPipelineLayout);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPipelineLayout);
+    BUILD_PASSTHROUGH_FLAG(DestroyPipelineLayout);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateSampler);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSampler);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSampler);
+    BUILD_PASSTHROUGH_FLAG(CreateSampler);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroySampler);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroySampler);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroySampler);
+    BUILD_PASSTHROUGH_FLAG(DestroySampler);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorSetLayout);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorSetLayout);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorSetLayout);
+    BUILD_PASSTHROUGH_FLAG(CreateDescriptorSetLayout);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorSetLayout);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorSetLayout);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorSetLayout);
+    BUILD_PASSTHROUGH_FLAG(DestroyDescriptorSetLayout);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorPool);
+    BUILD_PASSTHROUGH_FLAG(CreateDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorPool);
+    BUILD_PASSTHROUGH_FLAG(DestroyDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateResetDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetDescriptorPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetDescriptorPool);
+    BUILD_PASSTHROUGH_FLAG(ResetDescriptorPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateFreeDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallRecordFreeDescriptorSets);
     BUILD_DISPATCH_VECTOR(PostCallRecordFreeDescriptorSets);
+    BUILD_PASSTHROUGH_FLAG(FreeDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSets);
     BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSets);
+    BUILD_PASSTHROUGH_FLAG(UpdateDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateFramebuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateFramebuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateFramebuffer);
+    BUILD_PASSTHROUGH_FLAG(CreateFramebuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyFramebuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyFramebuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyFramebuffer);
+    BUILD_PASSTHROUGH_FLAG(DestroyFramebuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass);
+    BUILD_PASSTHROUGH_FLAG(CreateRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyRenderPass);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyRenderPass);
+    BUILD_PASSTHROUGH_FLAG(DestroyRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetRenderAreaGranularity);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRenderAreaGranularity);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRenderAreaGranularity);
+    BUILD_PASSTHROUGH_FLAG(GetRenderAreaGranularity);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateCommandPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateCommandPool);
+    BUILD_PASSTHROUGH_FLAG(CreateCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCommandPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCommandPool);
+    BUILD_PASSTHROUGH_FLAG(DestroyCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateResetCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetCommandPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetCommandPool);
+    BUILD_PASSTHROUGH_FLAG(ResetCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateAllocateCommandBuffers);
     BUILD_DISPATCH_VECTOR(PreCallRecordAllocateCommandBuffers);
     BUILD_DISPATCH_VECTOR(PostCallRecordAllocateCommandBuffers);
+    BUILD_PASSTHROUGH_FLAG(AllocateCommandBuffers);
     BUILD_DISPATCH_VECTOR(PreCallValidateFreeCommandBuffers);
     BUILD_DISPATCH_VECTOR(PreCallRecordFreeCommandBuffers);
     BUILD_DISPATCH_VECTOR(PostCallRecordFreeCommandBuffers);
+    BUILD_PASSTHROUGH_FLAG(FreeCommandBuffers);
     BUILD_DISPATCH_VECTOR(PreCallValidateBeginCommandBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordBeginCommandBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordBeginCommandBuffer);
+    BUILD_PASSTHROUGH_FLAG(BeginCommandBuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateEndCommandBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordEndCommandBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordEndCommandBuffer);
+    BUILD_PASSTHROUGH_FLAG(EndCommandBuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateResetCommandBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetCommandBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetCommandBuffer);
+    BUILD_PASSTHROUGH_FLAG(ResetCommandBuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindPipeline);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindPipeline);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindPipeline);
+    BUILD_PASSTHROUGH_FLAG(CmdBindPipeline);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewport);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewport);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewport);
+    BUILD_PASSTHROUGH_FLAG(CmdSetViewport);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetScissor);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetScissor);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetScissor);
+    BUILD_PASSTHROUGH_FLAG(CmdSetScissor);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineWidth);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineWidth);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineWidth);
+    BUILD_PASSTHROUGH_FLAG(CmdSetLineWidth);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBias);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBias);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBias);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthBias);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetBlendConstants);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetBlendConstants);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetBlendConstants);
+    BUILD_PASSTHROUGH_FLAG(CmdSetBlendConstants);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBounds);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBounds);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBounds);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthBounds);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilCompareMask);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilCompareMask);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilCompareMask);
+    BUILD_PASSTHROUGH_FLAG(CmdSetStencilCompareMask);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilWriteMask);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilWriteMask);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilWriteMask);
+    BUILD_PASSTHROUGH_FLAG(CmdSetStencilWriteMask);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilReference);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilReference);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilReference);
+    BUILD_PASSTHROUGH_FLAG(CmdSetStencilReference);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorSets);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorSets);
+    BUILD_PASSTHROUGH_FLAG(CmdBindDescriptorSets);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindIndexBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindIndexBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindIndexBuffer);
+    BUILD_PASSTHROUGH_FLAG(CmdBindIndexBuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindVertexBuffers);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindVertexBuffers);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindVertexBuffers);
+    BUILD_PASSTHROUGH_FLAG(CmdBindVertexBuffers);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDraw);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDraw);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDraw);
+    BUILD_PASSTHROUGH_FLAG(CmdDraw);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexed);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexed);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexed);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawIndexed);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirect);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirect);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirect);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawIndirect);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirect);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirect);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirect);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawIndexedIndirect);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatch);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatch);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatch);
+    BUILD_PASSTHROUGH_FLAG(CmdDispatch);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchIndirect);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchIndirect);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchIndirect);
+    BUILD_PASSTHROUGH_FLAG(CmdDispatchIndirect);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBuffer);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyBuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImage);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyImage);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBlitImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBlitImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBlitImage);
+    BUILD_PASSTHROUGH_FLAG(CmdBlitImage);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBufferToImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBufferToImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBufferToImage);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyBufferToImage);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImageToBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImageToBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImageToBuffer);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyImageToBuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdUpdateBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdUpdateBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdUpdateBuffer);
+    BUILD_PASSTHROUGH_FLAG(CmdUpdateBuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdFillBuffer);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdFillBuffer);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdFillBuffer);
+    BUILD_PASSTHROUGH_FLAG(CmdFillBuffer);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearColorImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearColorImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearColorImage);
+    BUILD_PASSTHROUGH_FLAG(CmdClearColorImage);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearDepthStencilImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearDepthStencilImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearDepthStencilImage);
+    BUILD_PASSTHROUGH_FLAG(CmdClearDepthStencilImage);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdClearAttachments);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdClearAttachments);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdClearAttachments);
+    BUILD_PASSTHROUGH_FLAG(CmdClearAttachments);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdResolveImage);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResolveImage);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResolveImage);
+    BUILD_PASSTHROUGH_FLAG(CmdResolveImage);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetEvent);
+    BUILD_PASSTHROUGH_FLAG(CmdSetEvent);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetEvent);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetEvent);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetEvent);
+    BUILD_PASSTHROUGH_FLAG(CmdResetEvent);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWaitEvents);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWaitEvents);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWaitEvents);
+    BUILD_PASSTHROUGH_FLAG(CmdWaitEvents);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdPipelineBarrier);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPipelineBarrier);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPipelineBarrier);
+    BUILD_PASSTHROUGH_FLAG(CmdPipelineBarrier);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginQuery);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginQuery);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginQuery);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginQuery);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndQuery);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndQuery);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndQuery);
+    BUILD_PASSTHROUGH_FLAG(CmdEndQuery);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetQueryPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetQueryPool);
+    BUILD_PASSTHROUGH_FLAG(CmdResetQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteTimestamp);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteTimestamp);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteTimestamp);
+    BUILD_PASSTHROUGH_FLAG(CmdWriteTimestamp);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyQueryPoolResults);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyQueryPoolResults);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushConstants);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushConstants);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushConstants);
+    BUILD_PASSTHROUGH_FLAG(CmdPushConstants);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass);
+    BUILD_PASSTHROUGH_FLAG(CmdNextSubpass);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass);
+    BUILD_PASSTHROUGH_FLAG(CmdEndRenderPass);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdExecuteCommands);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdExecuteCommands);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdExecuteCommands);
+    BUILD_PASSTHROUGH_FLAG(CmdExecuteCommands);
     BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory2);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory2);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory2);
+    BUILD_PASSTHROUGH_FLAG(BindBufferMemory2);
     BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory2);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory2);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory2);
+    BUILD_PASSTHROUGH_FLAG(BindImageMemory2);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPeerMemoryFeatures);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPeerMemoryFeatures);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPeerMemoryFeatures);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceGroupPeerMemoryFeatures);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDeviceMask);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDeviceMask);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDeviceMask);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDeviceMask);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchBase);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchBase);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchBase);
+    BUILD_PASSTHROUGH_FLAG(CmdDispatchBase);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements2);
+    BUILD_PASSTHROUGH_FLAG(GetImageMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements2);
+    BUILD_PASSTHROUGH_FLAG(GetBufferMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements2);
+    BUILD_PASSTHROUGH_FLAG(GetImageSparseMemoryRequirements2);
     BUILD_DISPATCH_VECTOR(PreCallValidateTrimCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordTrimCommandPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordTrimCommandPool);
+    BUILD_PASSTHROUGH_FLAG(TrimCommandPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue2);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue2);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue2);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceQueue2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateSamplerYcbcrConversion);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSamplerYcbcrConversion);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSamplerYcbcrConversion);
+    BUILD_PASSTHROUGH_FLAG(CreateSamplerYcbcrConversion);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroySamplerYcbcrConversion);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroySamplerYcbcrConversion);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroySamplerYcbcrConversion);
+    BUILD_PASSTHROUGH_FLAG(DestroySamplerYcbcrConversion);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorUpdateTemplate);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorUpdateTemplate);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorUpdateTemplate);
+    BUILD_PASSTHROUGH_FLAG(CreateDescriptorUpdateTemplate);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorUpdateTemplate);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorUpdateTemplate);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorUpdateTemplate);
+    BUILD_PASSTHROUGH_FLAG(DestroyDescriptorUpdateTemplate);
     BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSetWithTemplate);
     BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSetWithTemplate);
     BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSetWithTemplate);
+    BUILD_PASSTHROUGH_FLAG(UpdateDescriptorSetWithTemplate);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutSupport);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutSupport);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutSupport);
+    BUILD_PASSTHROUGH_FLAG(GetDescriptorSetLayoutSupport);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCount);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCount);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCount);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawIndirectCount);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCount);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCount);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCount);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawIndexedIndirectCount);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass2);
+    BUILD_PASSTHROUGH_FLAG(CreateRenderPass2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass2);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginRenderPass2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass2);
+    BUILD_PASSTHROUGH_FLAG(CmdNextSubpass2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass2);
+    BUILD_PASSTHROUGH_FLAG(CmdEndRenderPass2);
     BUILD_DISPATCH_VECTOR(PreCallValidateResetQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetQueryPool);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetQueryPool);
+    BUILD_PASSTHROUGH_FLAG(ResetQueryPool);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreCounterValue);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreCounterValue);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreCounterValue);
+    BUILD_PASSTHROUGH_FLAG(GetSemaphoreCounterValue);
     BUILD_DISPATCH_VECTOR(PreCallValidateWaitSemaphores);
     BUILD_DISPATCH_VECTOR(PreCallRecordWaitSemaphores);
     BUILD_DISPATCH_VECTOR(PostCallRecordWaitSemaphores);
+    BUILD_PASSTHROUGH_FLAG(WaitSemaphores);
     BUILD_DISPATCH_VECTOR(PreCallValidateSignalSemaphore);
     BUILD_DISPATCH_VECTOR(PreCallRecordSignalSemaphore);
     BUILD_DISPATCH_VECTOR(PostCallRecordSignalSemaphore);
+    BUILD_PASSTHROUGH_FLAG(SignalSemaphore);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddress);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddress);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddress);
+    BUILD_PASSTHROUGH_FLAG(GetBufferDeviceAddress);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferOpaqueCaptureAddress);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferOpaqueCaptureAddress);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferOpaqueCaptureAddress);
+    BUILD_PASSTHROUGH_FLAG(GetBufferOpaqueCaptureAddress);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryOpaqueCaptureAddress);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryOpaqueCaptureAddress);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryOpaqueCaptureAddress);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceMemoryOpaqueCaptureAddress);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreatePrivateDataSlot);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreatePrivateDataSlot);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreatePrivateDataSlot);
+    BUILD_PASSTHROUGH_FLAG(CreatePrivateDataSlot);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPrivateDataSlot);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPrivateDataSlot);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPrivateDataSlot);
+    BUILD_PASSTHROUGH_FLAG(DestroyPrivateDataSlot);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetPrivateData);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetPrivateData);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetPrivateData);
+    BUILD_PASSTHROUGH_FLAG(SetPrivateData);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPrivateData);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPrivateData);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPrivateData);
+    BUILD_PASSTHROUGH_FLAG(GetPrivateData);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetEvent2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetEvent2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetEvent2);
+    BUILD_PASSTHROUGH_FLAG(CmdSetEvent2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetEvent2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetEvent2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetEvent2);
+    BUILD_PASSTHROUGH_FLAG(CmdResetEvent2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWaitEvents2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWaitEvents2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWaitEvents2);
+    BUILD_PASSTHROUGH_FLAG(CmdWaitEvents2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdPipelineBarrier2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPipelineBarrier2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPipelineBarrier2);
+    BUILD_PASSTHROUGH_FLAG(CmdPipelineBarrier2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteTimestamp2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteTimestamp2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteTimestamp2);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit2);
-    BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit2);
-    BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit2);
+    BUILD_PASSTHROUGH_FLAG(CmdWriteTimestamp2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBuffer2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBuffer2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBuffer2);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyBuffer2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImage2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImage2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImage2);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyImage2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBufferToImage2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBufferToImage2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBufferToImage2);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyBufferToImage2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImageToBuffer2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImageToBuffer2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImageToBuffer2);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyImageToBuffer2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBlitImage2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBlitImage2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBlitImage2);
+    BUILD_PASSTHROUGH_FLAG(CmdBlitImage2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdResolveImage2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResolveImage2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResolveImage2);
+    BUILD_PASSTHROUGH_FLAG(CmdResolveImage2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRendering);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRendering);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRendering);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginRendering);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRendering);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRendering);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRendering);
+    BUILD_PASSTHROUGH_FLAG(CmdEndRendering);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCullMode);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCullMode);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCullMode);
+    BUILD_PASSTHROUGH_FLAG(CmdSetCullMode);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetFrontFace);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetFrontFace);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetFrontFace);
+    BUILD_PASSTHROUGH_FLAG(CmdSetFrontFace);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPrimitiveTopology);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPrimitiveTopology);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPrimitiveTopology);
+    BUILD_PASSTHROUGH_FLAG(CmdSetPrimitiveTopology);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWithCount);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWithCount);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWithCount);
+    BUILD_PASSTHROUGH_FLAG(CmdSetViewportWithCount);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetScissorWithCount);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetScissorWithCount);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetScissorWithCount);
+    BUILD_PASSTHROUGH_FLAG(CmdSetScissorWithCount);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindVertexBuffers2);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindVertexBuffers2);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindVertexBuffers2);
+    BUILD_PASSTHROUGH_FLAG(CmdBindVertexBuffers2);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthTestEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthTestEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthTestEnable);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthTestEnable);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthWriteEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthWriteEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthWriteEnable);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthWriteEnable);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthCompareOp);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthCompareOp);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthCompareOp);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthCompareOp);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBoundsTestEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBoundsTestEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBoundsTestEnable);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthBoundsTestEnable);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilTestEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilTestEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilTestEnable);
+    BUILD_PASSTHROUGH_FLAG(CmdSetStencilTestEnable);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilOp);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilOp);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilOp);
+    BUILD_PASSTHROUGH_FLAG(CmdSetStencilOp);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRasterizerDiscardEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRasterizerDiscardEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRasterizerDiscardEnable);
+    BUILD_PASSTHROUGH_FLAG(CmdSetRasterizerDiscardEnable);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBiasEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBiasEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBiasEnable);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthBiasEnable);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPrimitiveRestartEnable);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPrimitiveRestartEnable);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPrimitiveRestartEnable);
+    BUILD_PASSTHROUGH_FLAG(CmdSetPrimitiveRestartEnable);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceBufferMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceBufferMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceBufferMemoryRequirements);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceBufferMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceImageMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceImageMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceImageMemoryRequirements);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceImageMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceImageSparseMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceImageSparseMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceImageSparseMemoryRequirements);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceImageSparseMemoryRequirements);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateSwapchainKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSwapchainKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSwapchainKHR);
+    BUILD_PASSTHROUGH_FLAG(CreateSwapchainKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroySwapchainKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroySwapchainKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroySwapchainKHR);
+    BUILD_PASSTHROUGH_FLAG(DestroySwapchainKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainImagesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainImagesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainImagesKHR);
+    BUILD_PASSTHROUGH_FLAG(GetSwapchainImagesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateAcquireNextImageKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordAcquireNextImageKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordAcquireNextImageKHR);
+    BUILD_PASSTHROUGH_FLAG(AcquireNextImageKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateQueuePresentKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueuePresentKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueuePresentKHR);
+    BUILD_PASSTHROUGH_FLAG(QueuePresentKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPresentCapabilitiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPresentCapabilitiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPresentCapabilitiesKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceGroupPresentCapabilitiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupSurfacePresentModesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupSurfacePresentModesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupSurfacePresentModesKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceGroupSurfacePresentModesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateAcquireNextImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordAcquireNextImage2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordAcquireNextImage2KHR);
+    BUILD_PASSTHROUGH_FLAG(AcquireNextImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateSharedSwapchainsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSharedSwapchainsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSharedSwapchainsKHR);
+    BUILD_PASSTHROUGH_FLAG(CreateSharedSwapchainsKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateVideoSessionKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateVideoSessionKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateVideoSessionKHR);
+    BUILD_PASSTHROUGH_FLAG(CreateVideoSessionKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyVideoSessionKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyVideoSessionKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyVideoSessionKHR);
+    BUILD_PASSTHROUGH_FLAG(DestroyVideoSessionKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetVideoSessionMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetVideoSessionMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetVideoSessionMemoryRequirementsKHR);
+    BUILD_PASSTHROUGH_FLAG(GetVideoSessionMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateBindVideoSessionMemoryKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindVideoSessionMemoryKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindVideoSessionMemoryKHR);
+    BUILD_PASSTHROUGH_FLAG(BindVideoSessionMemoryKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateVideoSessionParametersKHR);
+    BUILD_PASSTHROUGH_FLAG(CreateVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateUpdateVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordUpdateVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordUpdateVideoSessionParametersKHR);
+    BUILD_PASSTHROUGH_FLAG(UpdateVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyVideoSessionParametersKHR);
+    BUILD_PASSTHROUGH_FLAG(DestroyVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginVideoCodingKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndVideoCodingKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdEndVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdControlVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdControlVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdControlVideoCodingKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdControlVideoCodingKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDecodeVideoKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDecodeVideoKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDecodeVideoKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdDecodeVideoKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderingKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderingKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderingKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginRenderingKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderingKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderingKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderingKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdEndRenderingKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceGroupPeerMemoryFeaturesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDeviceMaskKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDeviceMaskKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDeviceMaskKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDeviceMaskKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchBaseKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchBaseKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchBaseKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdDispatchBaseKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateTrimCommandPoolKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordTrimCommandPoolKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordTrimCommandPoolKHR);
+    BUILD_PASSTHROUGH_FLAG(TrimCommandPoolKHR);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandleKHR);
+    BUILD_PASSTHROUGH_FLAG(GetMemoryWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandlePropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandlePropertiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandlePropertiesKHR);
+    BUILD_PASSTHROUGH_FLAG(GetMemoryWin32HandlePropertiesKHR);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryFdKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryFdKHR);
+    BUILD_PASSTHROUGH_FLAG(GetMemoryFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryFdPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryFdPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryFdPropertiesKHR);
+    BUILD_PASSTHROUGH_FLAG(GetMemoryFdPropertiesKHR);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateImportSemaphoreWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordImportSemaphoreWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordImportSemaphoreWin32HandleKHR);
+    BUILD_PASSTHROUGH_FLAG(ImportSemaphoreWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreWin32HandleKHR);
+    BUILD_PASSTHROUGH_FLAG(GetSemaphoreWin32HandleKHR);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateImportSemaphoreFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordImportSemaphoreFdKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordImportSemaphoreFdKHR);
+    BUILD_PASSTHROUGH_FLAG(ImportSemaphoreFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreFdKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreFdKHR);
+    BUILD_PASSTHROUGH_FLAG(GetSemaphoreFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSetKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSetKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSetKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdPushDescriptorSetKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSetWithTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSetWithTemplateKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSetWithTemplateKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdPushDescriptorSetWithTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateDescriptorUpdateTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateDescriptorUpdateTemplateKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateDescriptorUpdateTemplateKHR);
+    BUILD_PASSTHROUGH_FLAG(CreateDescriptorUpdateTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDescriptorUpdateTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDescriptorUpdateTemplateKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDescriptorUpdateTemplateKHR);
+    BUILD_PASSTHROUGH_FLAG(DestroyDescriptorUpdateTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateUpdateDescriptorSetWithTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordUpdateDescriptorSetWithTemplateKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordUpdateDescriptorSetWithTemplateKHR);
+    BUILD_PASSTHROUGH_FLAG(UpdateDescriptorSetWithTemplateKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateRenderPass2KHR);
+    BUILD_PASSTHROUGH_FLAG(CreateRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginRenderPass2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdNextSubpass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdNextSubpass2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdNextSubpass2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdNextSubpass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndRenderPass2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdEndRenderPass2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainStatusKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainStatusKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainStatusKHR);
+    BUILD_PASSTHROUGH_FLAG(GetSwapchainStatusKHR);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateImportFenceWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordImportFenceWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordImportFenceWin32HandleKHR);
+    BUILD_PASSTHROUGH_FLAG(ImportFenceWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceWin32HandleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceWin32HandleKHR);
+    BUILD_PASSTHROUGH_FLAG(GetFenceWin32HandleKHR);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateImportFenceFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordImportFenceFdKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordImportFenceFdKHR);
+    BUILD_PASSTHROUGH_FLAG(ImportFenceFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetFenceFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetFenceFdKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetFenceFdKHR);
+    BUILD_PASSTHROUGH_FLAG(GetFenceFdKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateAcquireProfilingLockKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordAcquireProfilingLockKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordAcquireProfilingLockKHR);
+    BUILD_PASSTHROUGH_FLAG(AcquireProfilingLockKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateReleaseProfilingLockKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordReleaseProfilingLockKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordReleaseProfilingLockKHR);
+    BUILD_PASSTHROUGH_FLAG(ReleaseProfilingLockKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageMemoryRequirements2KHR);
+    BUILD_PASSTHROUGH_FLAG(GetImageMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferMemoryRequirements2KHR);
+    BUILD_PASSTHROUGH_FLAG(GetBufferMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSparseMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSparseMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSparseMemoryRequirements2KHR);
+    BUILD_PASSTHROUGH_FLAG(GetImageSparseMemoryRequirements2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateSamplerYcbcrConversionKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateSamplerYcbcrConversionKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateSamplerYcbcrConversionKHR);
+    BUILD_PASSTHROUGH_FLAG(CreateSamplerYcbcrConversionKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroySamplerYcbcrConversionKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroySamplerYcbcrConversionKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroySamplerYcbcrConversionKHR);
+    BUILD_PASSTHROUGH_FLAG(DestroySamplerYcbcrConversionKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateBindBufferMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindBufferMemory2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindBufferMemory2KHR);
+    BUILD_PASSTHROUGH_FLAG(BindBufferMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateBindImageMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindImageMemory2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindImageMemory2KHR);
+    BUILD_PASSTHROUGH_FLAG(BindImageMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutSupportKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutSupportKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutSupportKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDescriptorSetLayoutSupportKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCountKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCountKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCountKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawIndirectCountKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCountKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCountKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCountKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawIndexedIndirectCountKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreCounterValueKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreCounterValueKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreCounterValueKHR);
+    BUILD_PASSTHROUGH_FLAG(GetSemaphoreCounterValueKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateWaitSemaphoresKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordWaitSemaphoresKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordWaitSemaphoresKHR);
+    BUILD_PASSTHROUGH_FLAG(WaitSemaphoresKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateSignalSemaphoreKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordSignalSemaphoreKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordSignalSemaphoreKHR);
+    BUILD_PASSTHROUGH_FLAG(SignalSemaphoreKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetFragmentShadingRateKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetFragmentShadingRateKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetFragmentShadingRateKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdSetFragmentShadingRateKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRenderingAttachmentLocationsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRenderingAttachmentLocationsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRenderingAttachmentLocationsKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdSetRenderingAttachmentLocationsKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRenderingInputAttachmentIndicesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRenderingInputAttachmentIndicesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRenderingInputAttachmentIndicesKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdSetRenderingInputAttachmentIndicesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateWaitForPresentKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordWaitForPresentKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordWaitForPresentKHR);
+    BUILD_PASSTHROUGH_FLAG(WaitForPresentKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddressKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddressKHR);
+    BUILD_PASSTHROUGH_FLAG(GetBufferDeviceAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferOpaqueCaptureAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferOpaqueCaptureAddressKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferOpaqueCaptureAddressKHR);
+    BUILD_PASSTHROUGH_FLAG(GetBufferOpaqueCaptureAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMemoryOpaqueCaptureAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMemoryOpaqueCaptureAddressKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceMemoryOpaqueCaptureAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateDeferredOperationKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateDeferredOperationKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateDeferredOperationKHR);
+    BUILD_PASSTHROUGH_FLAG(CreateDeferredOperationKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyDeferredOperationKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyDeferredOperationKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyDeferredOperationKHR);
+    BUILD_PASSTHROUGH_FLAG(DestroyDeferredOperationKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeferredOperationMaxConcurrencyKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeferredOperationMaxConcurrencyKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeferredOperationMaxConcurrencyKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeferredOperationMaxConcurrencyKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeferredOperationResultKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeferredOperationResultKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeferredOperationResultKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeferredOperationResultKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateDeferredOperationJoinKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDeferredOperationJoinKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDeferredOperationJoinKHR);
+    BUILD_PASSTHROUGH_FLAG(DeferredOperationJoinKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutablePropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutablePropertiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutablePropertiesKHR);
+    BUILD_PASSTHROUGH_FLAG(GetPipelineExecutablePropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutableStatisticsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutableStatisticsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutableStatisticsKHR);
+    BUILD_PASSTHROUGH_FLAG(GetPipelineExecutableStatisticsKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineExecutableInternalRepresentationsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineExecutableInternalRepresentationsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineExecutableInternalRepresentationsKHR);
+    BUILD_PASSTHROUGH_FLAG(GetPipelineExecutableInternalRepresentationsKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateMapMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordMapMemory2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordMapMemory2KHR);
+    BUILD_PASSTHROUGH_FLAG(MapMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateUnmapMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordUnmapMemory2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordUnmapMemory2KHR);
+    BUILD_PASSTHROUGH_FLAG(UnmapMemory2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetEncodedVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetEncodedVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetEncodedVideoSessionParametersKHR);
+    BUILD_PASSTHROUGH_FLAG(GetEncodedVideoSessionParametersKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEncodeVideoKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEncodeVideoKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEncodeVideoKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdEncodeVideoKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetEvent2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetEvent2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetEvent2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdSetEvent2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdResetEvent2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResetEvent2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResetEvent2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdResetEvent2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWaitEvents2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWaitEvents2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWaitEvents2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdWaitEvents2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdPipelineBarrier2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPipelineBarrier2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPipelineBarrier2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdPipelineBarrier2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteTimestamp2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteTimestamp2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteTimestamp2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallValidateQueueSubmit2KHR);
-    BUILD_DISPATCH_VECTOR(PreCallRecordQueueSubmit2KHR);
-    BUILD_DISPATCH_VECTOR(PostCallRecordQueueSubmit2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdWriteTimestamp2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteBufferMarker2AMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteBufferMarker2AMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteBufferMarker2AMD);
+    BUILD_PASSTHROUGH_FLAG(CmdWriteBufferMarker2AMD);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetQueueCheckpointData2NV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetQueueCheckpointData2NV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetQueueCheckpointData2NV);
+    BUILD_PASSTHROUGH_FLAG(GetQueueCheckpointData2NV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBuffer2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImage2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImage2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyBufferToImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyBufferToImage2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyBufferToImage2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyBufferToImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyImageToBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyImageToBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyImageToBuffer2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyImageToBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBlitImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBlitImage2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBlitImage2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdBlitImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdResolveImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdResolveImage2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdResolveImage2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdResolveImage2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysIndirect2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysIndirect2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysIndirect2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdTraceRaysIndirect2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceBufferMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceBufferMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceBufferMemoryRequirementsKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceBufferMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceImageMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceImageMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceImageMemoryRequirementsKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceImageMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceImageSparseMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceImageSparseMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceImageSparseMemoryRequirementsKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceImageSparseMemoryRequirementsKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindIndexBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindIndexBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindIndexBuffer2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdBindIndexBuffer2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetRenderingAreaGranularityKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRenderingAreaGranularityKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRenderingAreaGranularityKHR);
+    BUILD_PASSTHROUGH_FLAG(GetRenderingAreaGranularityKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceImageSubresourceLayoutKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceImageSubresourceLayoutKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceImageSubresourceLayoutKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceImageSubresourceLayoutKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSubresourceLayout2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSubresourceLayout2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSubresourceLayout2KHR);
+    BUILD_PASSTHROUGH_FLAG(GetImageSubresourceLayout2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineStippleKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineStippleKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineStippleKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdSetLineStippleKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetCalibratedTimestampsKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetCalibratedTimestampsKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetCalibratedTimestampsKHR);
+    BUILD_PASSTHROUGH_FLAG(GetCalibratedTimestampsKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorSets2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorSets2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorSets2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdBindDescriptorSets2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushConstants2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushConstants2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushConstants2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdPushConstants2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSet2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSet2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSet2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdPushDescriptorSet2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdPushDescriptorSetWithTemplate2KHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPushDescriptorSetWithTemplate2KHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPushDescriptorSetWithTemplate2KHR);
+    BUILD_PASSTHROUGH_FLAG(CmdPushDescriptorSetWithTemplate2KHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDescriptorBufferOffsets2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDescriptorBufferOffsets2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDescriptorBufferOffsets2EXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDescriptorBufferOffsets2EXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorBufferEmbeddedSamplers2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorBufferEmbeddedSamplers2EXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBindDescriptorBufferEmbeddedSamplers2EXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateDebugMarkerSetObjectTagEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDebugMarkerSetObjectTagEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDebugMarkerSetObjectTagEXT);
+    BUILD_PASSTHROUGH_FLAG(DebugMarkerSetObjectTagEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateDebugMarkerSetObjectNameEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDebugMarkerSetObjectNameEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDebugMarkerSetObjectNameEXT);
+    BUILD_PASSTHROUGH_FLAG(DebugMarkerSetObjectNameEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerBeginEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerBeginEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerBeginEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdDebugMarkerBeginEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerEndEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerEndEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerEndEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdDebugMarkerEndEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDebugMarkerInsertEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDebugMarkerInsertEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDebugMarkerInsertEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdDebugMarkerInsertEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindTransformFeedbackBuffersEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindTransformFeedbackBuffersEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindTransformFeedbackBuffersEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBindTransformFeedbackBuffersEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginTransformFeedbackEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginTransformFeedbackEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginTransformFeedbackEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginTransformFeedbackEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndTransformFeedbackEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndTransformFeedbackEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndTransformFeedbackEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdEndTransformFeedbackEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginQueryIndexedEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginQueryIndexedEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginQueryIndexedEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginQueryIndexedEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndQueryIndexedEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndQueryIndexedEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndQueryIndexedEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdEndQueryIndexedEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectByteCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectByteCountEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectByteCountEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawIndirectByteCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateCuModuleNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateCuModuleNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateCuModuleNVX);
+    BUILD_PASSTHROUGH_FLAG(CreateCuModuleNVX);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateCuFunctionNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateCuFunctionNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateCuFunctionNVX);
+    BUILD_PASSTHROUGH_FLAG(CreateCuFunctionNVX);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCuModuleNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCuModuleNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCuModuleNVX);
+    BUILD_PASSTHROUGH_FLAG(DestroyCuModuleNVX);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCuFunctionNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCuFunctionNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCuFunctionNVX);
+    BUILD_PASSTHROUGH_FLAG(DestroyCuFunctionNVX);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCuLaunchKernelNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCuLaunchKernelNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCuLaunchKernelNVX);
+    BUILD_PASSTHROUGH_FLAG(CmdCuLaunchKernelNVX);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageViewHandleNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageViewHandleNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageViewHandleNVX);
+    BUILD_PASSTHROUGH_FLAG(GetImageViewHandleNVX);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageViewAddressNVX);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageViewAddressNVX);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageViewAddressNVX);
+    BUILD_PASSTHROUGH_FLAG(GetImageViewAddressNVX);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndirectCountAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndirectCountAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndirectCountAMD);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawIndirectCountAMD);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawIndexedIndirectCountAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawIndexedIndirectCountAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawIndexedIndirectCountAMD);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawIndexedIndirectCountAMD);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetShaderInfoAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetShaderInfoAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetShaderInfoAMD);
+    BUILD_PASSTHROUGH_FLAG(GetShaderInfoAMD);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryWin32HandleNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryWin32HandleNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryWin32HandleNV);
+    BUILD_PASSTHROUGH_FLAG(GetMemoryWin32HandleNV);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginConditionalRenderingEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginConditionalRenderingEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginConditionalRenderingEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginConditionalRenderingEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndConditionalRenderingEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndConditionalRenderingEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndConditionalRenderingEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdEndConditionalRenderingEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWScalingNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWScalingNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWScalingNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetViewportWScalingNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateDisplayPowerControlEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDisplayPowerControlEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDisplayPowerControlEXT);
+    BUILD_PASSTHROUGH_FLAG(DisplayPowerControlEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateRegisterDeviceEventEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordRegisterDeviceEventEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordRegisterDeviceEventEXT);
+    BUILD_PASSTHROUGH_FLAG(RegisterDeviceEventEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateRegisterDisplayEventEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordRegisterDisplayEventEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordRegisterDisplayEventEXT);
+    BUILD_PASSTHROUGH_FLAG(RegisterDisplayEventEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetSwapchainCounterEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSwapchainCounterEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSwapchainCounterEXT);
+    BUILD_PASSTHROUGH_FLAG(GetSwapchainCounterEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetRefreshCycleDurationGOOGLE);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRefreshCycleDurationGOOGLE);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRefreshCycleDurationGOOGLE);
+    BUILD_PASSTHROUGH_FLAG(GetRefreshCycleDurationGOOGLE);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPastPresentationTimingGOOGLE);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPastPresentationTimingGOOGLE);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPastPresentationTimingGOOGLE);
+    BUILD_PASSTHROUGH_FLAG(GetPastPresentationTimingGOOGLE);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDiscardRectangleEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDiscardRectangleEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDiscardRectangleEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDiscardRectangleEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDiscardRectangleEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDiscardRectangleEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDiscardRectangleEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDiscardRectangleEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDiscardRectangleModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDiscardRectangleModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDiscardRectangleModeEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDiscardRectangleModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetHdrMetadataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetHdrMetadataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetHdrMetadataEXT);
+    BUILD_PASSTHROUGH_FLAG(SetHdrMetadataEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetDebugUtilsObjectNameEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetDebugUtilsObjectNameEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetDebugUtilsObjectNameEXT);
+    BUILD_PASSTHROUGH_FLAG(SetDebugUtilsObjectNameEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetDebugUtilsObjectTagEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetDebugUtilsObjectTagEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetDebugUtilsObjectTagEXT);
+    BUILD_PASSTHROUGH_FLAG(SetDebugUtilsObjectTagEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateQueueBeginDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueBeginDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueBeginDebugUtilsLabelEXT);
+    BUILD_PASSTHROUGH_FLAG(QueueBeginDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateQueueEndDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueEndDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueEndDebugUtilsLabelEXT);
+    BUILD_PASSTHROUGH_FLAG(QueueEndDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateQueueInsertDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueInsertDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueInsertDebugUtilsLabelEXT);
+    BUILD_PASSTHROUGH_FLAG(QueueInsertDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBeginDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBeginDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBeginDebugUtilsLabelEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBeginDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdEndDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdEndDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdEndDebugUtilsLabelEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdEndDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdInsertDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdInsertDebugUtilsLabelEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdInsertDebugUtilsLabelEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdInsertDebugUtilsLabelEXT);
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateGetAndroidHardwareBufferPropertiesANDROID);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAndroidHardwareBufferPropertiesANDROID);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAndroidHardwareBufferPropertiesANDROID);
+    BUILD_PASSTHROUGH_FLAG(GetAndroidHardwareBufferPropertiesANDROID);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryAndroidHardwareBufferANDROID);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryAndroidHardwareBufferANDROID);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryAndroidHardwareBufferANDROID);
+    BUILD_PASSTHROUGH_FLAG(GetMemoryAndroidHardwareBufferANDROID);
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_ENABLE_BETA_EXTENSIONS
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateExecutionGraphPipelinesAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateExecutionGraphPipelinesAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateExecutionGraphPipelinesAMDX);
+    BUILD_PASSTHROUGH_FLAG(CreateExecutionGraphPipelinesAMDX);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetExecutionGraphPipelineScratchSizeAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetExecutionGraphPipelineScratchSizeAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetExecutionGraphPipelineScratchSizeAMDX);
+    BUILD_PASSTHROUGH_FLAG(GetExecutionGraphPipelineScratchSizeAMDX);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetExecutionGraphPipelineNodeIndexAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetExecutionGraphPipelineNodeIndexAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetExecutionGraphPipelineNodeIndexAMDX);
+    BUILD_PASSTHROUGH_FLAG(GetExecutionGraphPipelineNodeIndexAMDX);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdInitializeGraphScratchMemoryAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdInitializeGraphScratchMemoryAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdInitializeGraphScratchMemoryAMDX);
+    BUILD_PASSTHROUGH_FLAG(CmdInitializeGraphScratchMemoryAMDX);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchGraphAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchGraphAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchGraphAMDX);
+    BUILD_PASSTHROUGH_FLAG(CmdDispatchGraphAMDX);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchGraphIndirectAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchGraphIndirectAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchGraphIndirectAMDX);
+    BUILD_PASSTHROUGH_FLAG(CmdDispatchGraphIndirectAMDX);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDispatchGraphIndirectCountAMDX);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDispatchGraphIndirectCountAMDX);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDispatchGraphIndirectCountAMDX);
+    BUILD_PASSTHROUGH_FLAG(CmdDispatchGraphIndirectCountAMDX);
 #endif  // VK_ENABLE_BETA_EXTENSIONS
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetSampleLocationsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetSampleLocationsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetSampleLocationsEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetSampleLocationsEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageDrmFormatModifierPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageDrmFormatModifierPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageDrmFormatModifierPropertiesEXT);
+    BUILD_PASSTHROUGH_FLAG(GetImageDrmFormatModifierPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindShadingRateImageNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindShadingRateImageNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindShadingRateImageNV);
+    BUILD_PASSTHROUGH_FLAG(CmdBindShadingRateImageNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportShadingRatePaletteNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportShadingRatePaletteNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportShadingRatePaletteNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetViewportShadingRatePaletteNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoarseSampleOrderNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoarseSampleOrderNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoarseSampleOrderNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetCoarseSampleOrderNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateAccelerationStructureNV);
+    BUILD_PASSTHROUGH_FLAG(CreateAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyAccelerationStructureNV);
+    BUILD_PASSTHROUGH_FLAG(DestroyAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureMemoryRequirementsNV);
+    BUILD_PASSTHROUGH_FLAG(GetAccelerationStructureMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateBindAccelerationStructureMemoryNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindAccelerationStructureMemoryNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindAccelerationStructureMemoryNV);
+    BUILD_PASSTHROUGH_FLAG(BindAccelerationStructureMemoryNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructureNV);
+    BUILD_PASSTHROUGH_FLAG(CmdBuildAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureNV);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyAccelerationStructureNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysNV);
+    BUILD_PASSTHROUGH_FLAG(CmdTraceRaysNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupHandlesKHR);
+    BUILD_PASSTHROUGH_FLAG(GetRayTracingShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupHandlesNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupHandlesNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupHandlesNV);
+    BUILD_PASSTHROUGH_FLAG(GetRayTracingShaderGroupHandlesNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureHandleNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureHandleNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureHandleNV);
+    BUILD_PASSTHROUGH_FLAG(GetAccelerationStructureHandleNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteAccelerationStructuresPropertiesNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteAccelerationStructuresPropertiesNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteAccelerationStructuresPropertiesNV);
+    BUILD_PASSTHROUGH_FLAG(CmdWriteAccelerationStructuresPropertiesNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCompileDeferredNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCompileDeferredNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCompileDeferredNV);
+    BUILD_PASSTHROUGH_FLAG(CompileDeferredNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryHostPointerPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryHostPointerPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryHostPointerPropertiesEXT);
+    BUILD_PASSTHROUGH_FLAG(GetMemoryHostPointerPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteBufferMarkerAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteBufferMarkerAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteBufferMarkerAMD);
+    BUILD_PASSTHROUGH_FLAG(CmdWriteBufferMarkerAMD);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetCalibratedTimestampsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetCalibratedTimestampsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetCalibratedTimestampsEXT);
+    BUILD_PASSTHROUGH_FLAG(GetCalibratedTimestampsEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksNV);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawMeshTasksNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectNV);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawMeshTasksIndirectNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectCountNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectCountNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectCountNV);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawMeshTasksIndirectCountNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetExclusiveScissorEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetExclusiveScissorEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetExclusiveScissorEnableNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetExclusiveScissorEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetExclusiveScissorNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetExclusiveScissorNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetExclusiveScissorNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetExclusiveScissorNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCheckpointNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCheckpointNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCheckpointNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetCheckpointNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetQueueCheckpointDataNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetQueueCheckpointDataNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetQueueCheckpointDataNV);
+    BUILD_PASSTHROUGH_FLAG(GetQueueCheckpointDataNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateInitializePerformanceApiINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordInitializePerformanceApiINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordInitializePerformanceApiINTEL);
+    BUILD_PASSTHROUGH_FLAG(InitializePerformanceApiINTEL);
     BUILD_DISPATCH_VECTOR(PreCallValidateUninitializePerformanceApiINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordUninitializePerformanceApiINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordUninitializePerformanceApiINTEL);
+    BUILD_PASSTHROUGH_FLAG(UninitializePerformanceApiINTEL);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceMarkerINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceMarkerINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceMarkerINTEL);
+    BUILD_PASSTHROUGH_FLAG(CmdSetPerformanceMarkerINTEL);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceStreamMarkerINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceStreamMarkerINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceStreamMarkerINTEL);
+    BUILD_PASSTHROUGH_FLAG(CmdSetPerformanceStreamMarkerINTEL);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPerformanceOverrideINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPerformanceOverrideINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPerformanceOverrideINTEL);
+    BUILD_PASSTHROUGH_FLAG(CmdSetPerformanceOverrideINTEL);
     BUILD_DISPATCH_VECTOR(PreCallValidateAcquirePerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordAcquirePerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordAcquirePerformanceConfigurationINTEL);
+    BUILD_PASSTHROUGH_FLAG(AcquirePerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PreCallValidateReleasePerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordReleasePerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordReleasePerformanceConfigurationINTEL);
+    BUILD_PASSTHROUGH_FLAG(ReleasePerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PreCallValidateQueueSetPerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueSetPerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueSetPerformanceConfigurationINTEL);
+    BUILD_PASSTHROUGH_FLAG(QueueSetPerformanceConfigurationINTEL);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPerformanceParameterINTEL);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPerformanceParameterINTEL);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPerformanceParameterINTEL);
+    BUILD_PASSTHROUGH_FLAG(GetPerformanceParameterINTEL);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetLocalDimmingAMD);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetLocalDimmingAMD);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetLocalDimmingAMD);
+    BUILD_PASSTHROUGH_FLAG(SetLocalDimmingAMD);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferDeviceAddressEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferDeviceAddressEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferDeviceAddressEXT);
+    BUILD_PASSTHROUGH_FLAG(GetBufferDeviceAddressEXT);
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateAcquireFullScreenExclusiveModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordAcquireFullScreenExclusiveModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordAcquireFullScreenExclusiveModeEXT);
+    BUILD_PASSTHROUGH_FLAG(AcquireFullScreenExclusiveModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateReleaseFullScreenExclusiveModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordReleaseFullScreenExclusiveModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordReleaseFullScreenExclusiveModeEXT);
+    BUILD_PASSTHROUGH_FLAG(ReleaseFullScreenExclusiveModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceGroupSurfacePresentModes2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceGroupSurfacePresentModes2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceGroupSurfacePresentModes2EXT);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceGroupSurfacePresentModes2EXT);
 #endif  // VK_USE_PLATFORM_WIN32_KHR
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineStippleEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineStippleEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineStippleEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetLineStippleEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateResetQueryPoolEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordResetQueryPoolEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordResetQueryPoolEXT);
+    BUILD_PASSTHROUGH_FLAG(ResetQueryPoolEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCullModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCullModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCullModeEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetCullModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetFrontFaceEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetFrontFaceEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetFrontFaceEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetFrontFaceEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPrimitiveTopologyEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPrimitiveTopologyEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPrimitiveTopologyEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetPrimitiveTopologyEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWithCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWithCountEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWithCountEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetViewportWithCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetScissorWithCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetScissorWithCountEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetScissorWithCountEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetScissorWithCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindVertexBuffers2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindVertexBuffers2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindVertexBuffers2EXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBindVertexBuffers2EXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthTestEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthWriteEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthWriteEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthWriteEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthWriteEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthCompareOpEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthCompareOpEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthCompareOpEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthCompareOpEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBoundsTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBoundsTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBoundsTestEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthBoundsTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilTestEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetStencilTestEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetStencilOpEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetStencilOpEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetStencilOpEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetStencilOpEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCopyMemoryToImageEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyMemoryToImageEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyMemoryToImageEXT);
+    BUILD_PASSTHROUGH_FLAG(CopyMemoryToImageEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCopyImageToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyImageToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyImageToMemoryEXT);
+    BUILD_PASSTHROUGH_FLAG(CopyImageToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCopyImageToImageEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyImageToImageEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyImageToImageEXT);
+    BUILD_PASSTHROUGH_FLAG(CopyImageToImageEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateTransitionImageLayoutEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordTransitionImageLayoutEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordTransitionImageLayoutEXT);
+    BUILD_PASSTHROUGH_FLAG(TransitionImageLayoutEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageSubresourceLayout2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageSubresourceLayout2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageSubresourceLayout2EXT);
+    BUILD_PASSTHROUGH_FLAG(GetImageSubresourceLayout2EXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateReleaseSwapchainImagesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordReleaseSwapchainImagesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordReleaseSwapchainImagesEXT);
+    BUILD_PASSTHROUGH_FLAG(ReleaseSwapchainImagesEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetGeneratedCommandsMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetGeneratedCommandsMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetGeneratedCommandsMemoryRequirementsNV);
+    BUILD_PASSTHROUGH_FLAG(GetGeneratedCommandsMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdPreprocessGeneratedCommandsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdPreprocessGeneratedCommandsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdPreprocessGeneratedCommandsNV);
+    BUILD_PASSTHROUGH_FLAG(CmdPreprocessGeneratedCommandsNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdExecuteGeneratedCommandsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdExecuteGeneratedCommandsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdExecuteGeneratedCommandsNV);
+    BUILD_PASSTHROUGH_FLAG(CmdExecuteGeneratedCommandsNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindPipelineShaderGroupNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindPipelineShaderGroupNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindPipelineShaderGroupNV);
+    BUILD_PASSTHROUGH_FLAG(CmdBindPipelineShaderGroupNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateIndirectCommandsLayoutNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateIndirectCommandsLayoutNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateIndirectCommandsLayoutNV);
+    BUILD_PASSTHROUGH_FLAG(CreateIndirectCommandsLayoutNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyIndirectCommandsLayoutNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyIndirectCommandsLayoutNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyIndirectCommandsLayoutNV);
+    BUILD_PASSTHROUGH_FLAG(DestroyIndirectCommandsLayoutNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBias2EXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBias2EXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBias2EXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthBias2EXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreatePrivateDataSlotEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreatePrivateDataSlotEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreatePrivateDataSlotEXT);
+    BUILD_PASSTHROUGH_FLAG(CreatePrivateDataSlotEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyPrivateDataSlotEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyPrivateDataSlotEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyPrivateDataSlotEXT);
+    BUILD_PASSTHROUGH_FLAG(DestroyPrivateDataSlotEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetPrivateDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetPrivateDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetPrivateDataEXT);
+    BUILD_PASSTHROUGH_FLAG(SetPrivateDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPrivateDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPrivateDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPrivateDataEXT);
+    BUILD_PASSTHROUGH_FLAG(GetPrivateDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateCudaModuleNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateCudaModuleNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateCudaModuleNV);
+    BUILD_PASSTHROUGH_FLAG(CreateCudaModuleNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetCudaModuleCacheNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetCudaModuleCacheNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetCudaModuleCacheNV);
+    BUILD_PASSTHROUGH_FLAG(GetCudaModuleCacheNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateCudaFunctionNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateCudaFunctionNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateCudaFunctionNV);
+    BUILD_PASSTHROUGH_FLAG(CreateCudaFunctionNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCudaModuleNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCudaModuleNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCudaModuleNV);
+    BUILD_PASSTHROUGH_FLAG(DestroyCudaModuleNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyCudaFunctionNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyCudaFunctionNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyCudaFunctionNV);
+    BUILD_PASSTHROUGH_FLAG(DestroyCudaFunctionNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCudaLaunchKernelNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCudaLaunchKernelNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCudaLaunchKernelNV);
+    BUILD_PASSTHROUGH_FLAG(CmdCudaLaunchKernelNV);
 #ifdef VK_USE_PLATFORM_METAL_EXT
     BUILD_DISPATCH_VECTOR(PreCallValidateExportMetalObjectsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordExportMetalObjectsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordExportMetalObjectsEXT);
+    BUILD_PASSTHROUGH_FLAG(ExportMetalObjectsEXT);
 #endif  // VK_USE_PLATFORM_METAL_EXT
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutSizeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutSizeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutSizeEXT);
+    BUILD_PASSTHROUGH_FLAG(GetDescriptorSetLayoutSizeEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutBindingOffsetEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutBindingOffsetEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutBindingOffsetEXT);
+    BUILD_PASSTHROUGH_FLAG(GetDescriptorSetLayoutBindingOffsetEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorEXT);
+    BUILD_PASSTHROUGH_FLAG(GetDescriptorEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorBuffersEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorBuffersEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorBuffersEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBindDescriptorBuffersEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDescriptorBufferOffsetsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDescriptorBufferOffsetsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDescriptorBufferOffsetsEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDescriptorBufferOffsetsEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindDescriptorBufferEmbeddedSamplersEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindDescriptorBufferEmbeddedSamplersEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBindDescriptorBufferEmbeddedSamplersEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferOpaqueCaptureDescriptorDataEXT);
+    BUILD_PASSTHROUGH_FLAG(GetBufferOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageOpaqueCaptureDescriptorDataEXT);
+    BUILD_PASSTHROUGH_FLAG(GetImageOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetImageViewOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetImageViewOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetImageViewOpaqueCaptureDescriptorDataEXT);
+    BUILD_PASSTHROUGH_FLAG(GetImageViewOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetSamplerOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSamplerOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSamplerOpaqueCaptureDescriptorDataEXT);
+    BUILD_PASSTHROUGH_FLAG(GetSamplerOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
+    BUILD_PASSTHROUGH_FLAG(GetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetFragmentShadingRateEnumNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetFragmentShadingRateEnumNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetFragmentShadingRateEnumNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetFragmentShadingRateEnumNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceFaultInfoEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceFaultInfoEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceFaultInfoEXT);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceFaultInfoEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetVertexInputEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetVertexInputEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetVertexInputEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetVertexInputEXT);
 #ifdef VK_USE_PLATFORM_FUCHSIA
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryZirconHandleFUCHSIA);
+    BUILD_PASSTHROUGH_FLAG(GetMemoryZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryZirconHandlePropertiesFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryZirconHandlePropertiesFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryZirconHandlePropertiesFUCHSIA);
+    BUILD_PASSTHROUGH_FLAG(GetMemoryZirconHandlePropertiesFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallValidateImportSemaphoreZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordImportSemaphoreZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordImportSemaphoreZirconHandleFUCHSIA);
+    BUILD_PASSTHROUGH_FLAG(ImportSemaphoreZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetSemaphoreZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetSemaphoreZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetSemaphoreZirconHandleFUCHSIA);
+    BUILD_PASSTHROUGH_FLAG(GetSemaphoreZirconHandleFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateBufferCollectionFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateBufferCollectionFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateBufferCollectionFUCHSIA);
+    BUILD_PASSTHROUGH_FLAG(CreateBufferCollectionFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetBufferCollectionImageConstraintsFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetBufferCollectionImageConstraintsFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetBufferCollectionImageConstraintsFUCHSIA);
+    BUILD_PASSTHROUGH_FLAG(SetBufferCollectionImageConstraintsFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetBufferCollectionBufferConstraintsFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetBufferCollectionBufferConstraintsFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetBufferCollectionBufferConstraintsFUCHSIA);
+    BUILD_PASSTHROUGH_FLAG(SetBufferCollectionBufferConstraintsFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyBufferCollectionFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyBufferCollectionFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyBufferCollectionFUCHSIA);
+    BUILD_PASSTHROUGH_FLAG(DestroyBufferCollectionFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetBufferCollectionPropertiesFUCHSIA);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetBufferCollectionPropertiesFUCHSIA);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetBufferCollectionPropertiesFUCHSIA);
+    BUILD_PASSTHROUGH_FLAG(GetBufferCollectionPropertiesFUCHSIA);
 #endif  // VK_USE_PLATFORM_FUCHSIA
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSubpassShadingHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSubpassShadingHUAWEI);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSubpassShadingHUAWEI);
+    BUILD_PASSTHROUGH_FLAG(CmdSubpassShadingHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindInvocationMaskHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindInvocationMaskHUAWEI);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindInvocationMaskHUAWEI);
+    BUILD_PASSTHROUGH_FLAG(CmdBindInvocationMaskHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMemoryRemoteAddressNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMemoryRemoteAddressNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMemoryRemoteAddressNV);
+    BUILD_PASSTHROUGH_FLAG(GetMemoryRemoteAddressNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelinePropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelinePropertiesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelinePropertiesEXT);
+    BUILD_PASSTHROUGH_FLAG(GetPipelinePropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPatchControlPointsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPatchControlPointsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPatchControlPointsEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetPatchControlPointsEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRasterizerDiscardEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRasterizerDiscardEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRasterizerDiscardEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetRasterizerDiscardEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthBiasEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthBiasEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthBiasEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthBiasEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLogicOpEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLogicOpEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLogicOpEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetLogicOpEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPrimitiveRestartEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPrimitiveRestartEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPrimitiveRestartEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetPrimitiveRestartEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetColorWriteEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetColorWriteEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetColorWriteEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetColorWriteEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMultiEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMultiEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMultiEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawMultiEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMultiIndexedEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMultiIndexedEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMultiIndexedEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawMultiIndexedEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateMicromapEXT);
+    BUILD_PASSTHROUGH_FLAG(CreateMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyMicromapEXT);
+    BUILD_PASSTHROUGH_FLAG(DestroyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildMicromapsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildMicromapsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildMicromapsEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBuildMicromapsEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateBuildMicromapsEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordBuildMicromapsEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordBuildMicromapsEXT);
+    BUILD_PASSTHROUGH_FLAG(BuildMicromapsEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCopyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyMicromapEXT);
+    BUILD_PASSTHROUGH_FLAG(CopyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCopyMicromapToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyMicromapToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyMicromapToMemoryEXT);
+    BUILD_PASSTHROUGH_FLAG(CopyMicromapToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCopyMemoryToMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyMemoryToMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyMemoryToMicromapEXT);
+    BUILD_PASSTHROUGH_FLAG(CopyMemoryToMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateWriteMicromapsPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordWriteMicromapsPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordWriteMicromapsPropertiesEXT);
+    BUILD_PASSTHROUGH_FLAG(WriteMicromapsPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMicromapEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMicromapToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMicromapToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMicromapToMemoryEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyMicromapToMemoryEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMemoryToMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMemoryToMicromapEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMemoryToMicromapEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyMemoryToMicromapEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteMicromapsPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteMicromapsPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteMicromapsPropertiesEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdWriteMicromapsPropertiesEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceMicromapCompatibilityEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceMicromapCompatibilityEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceMicromapCompatibilityEXT);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceMicromapCompatibilityEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetMicromapBuildSizesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetMicromapBuildSizesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetMicromapBuildSizesEXT);
+    BUILD_PASSTHROUGH_FLAG(GetMicromapBuildSizesEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawClusterHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawClusterHUAWEI);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawClusterHUAWEI);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawClusterHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawClusterIndirectHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawClusterIndirectHUAWEI);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawClusterIndirectHUAWEI);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawClusterIndirectHUAWEI);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetDeviceMemoryPriorityEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetDeviceMemoryPriorityEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetDeviceMemoryPriorityEXT);
+    BUILD_PASSTHROUGH_FLAG(SetDeviceMemoryPriorityEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetLayoutHostMappingInfoVALVE);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetLayoutHostMappingInfoVALVE);
+    BUILD_PASSTHROUGH_FLAG(GetDescriptorSetLayoutHostMappingInfoVALVE);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDescriptorSetHostMappingVALVE);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDescriptorSetHostMappingVALVE);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDescriptorSetHostMappingVALVE);
+    BUILD_PASSTHROUGH_FLAG(GetDescriptorSetHostMappingVALVE);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMemoryIndirectNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMemoryIndirectNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMemoryIndirectNV);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyMemoryIndirectNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMemoryToImageIndirectNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMemoryToImageIndirectNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMemoryToImageIndirectNV);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyMemoryToImageIndirectNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDecompressMemoryNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDecompressMemoryNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDecompressMemoryNV);
+    BUILD_PASSTHROUGH_FLAG(CmdDecompressMemoryNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDecompressMemoryIndirectCountNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDecompressMemoryIndirectCountNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDecompressMemoryIndirectCountNV);
+    BUILD_PASSTHROUGH_FLAG(CmdDecompressMemoryIndirectCountNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineIndirectMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineIndirectMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineIndirectMemoryRequirementsNV);
+    BUILD_PASSTHROUGH_FLAG(GetPipelineIndirectMemoryRequirementsNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdUpdatePipelineIndirectBufferNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdUpdatePipelineIndirectBufferNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdUpdatePipelineIndirectBufferNV);
+    BUILD_PASSTHROUGH_FLAG(CmdUpdatePipelineIndirectBufferNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetPipelineIndirectDeviceAddressNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetPipelineIndirectDeviceAddressNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetPipelineIndirectDeviceAddressNV);
+    BUILD_PASSTHROUGH_FLAG(GetPipelineIndirectDeviceAddressNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthClampEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthClampEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthClampEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthClampEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetPolygonModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetPolygonModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetPolygonModeEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetPolygonModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRasterizationSamplesEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRasterizationSamplesEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRasterizationSamplesEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetRasterizationSamplesEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetSampleMaskEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetSampleMaskEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetSampleMaskEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetSampleMaskEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetAlphaToCoverageEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetAlphaToCoverageEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetAlphaToCoverageEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetAlphaToCoverageEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetAlphaToOneEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetAlphaToOneEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetAlphaToOneEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetAlphaToOneEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLogicOpEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLogicOpEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLogicOpEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetLogicOpEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetColorBlendEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetColorBlendEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetColorBlendEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetColorBlendEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetColorBlendEquationEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetColorBlendEquationEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetColorBlendEquationEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetColorBlendEquationEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetColorWriteMaskEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetColorWriteMaskEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetColorWriteMaskEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetColorWriteMaskEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetTessellationDomainOriginEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetTessellationDomainOriginEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetTessellationDomainOriginEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetTessellationDomainOriginEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRasterizationStreamEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRasterizationStreamEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRasterizationStreamEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetRasterizationStreamEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetConservativeRasterizationModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetConservativeRasterizationModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetConservativeRasterizationModeEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetConservativeRasterizationModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetExtraPrimitiveOverestimationSizeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetExtraPrimitiveOverestimationSizeEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetExtraPrimitiveOverestimationSizeEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthClipEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthClipEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthClipEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthClipEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetSampleLocationsEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetSampleLocationsEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetSampleLocationsEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetSampleLocationsEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetColorBlendAdvancedEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetColorBlendAdvancedEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetColorBlendAdvancedEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetColorBlendAdvancedEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetProvokingVertexModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetProvokingVertexModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetProvokingVertexModeEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetProvokingVertexModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineRasterizationModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineRasterizationModeEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineRasterizationModeEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetLineRasterizationModeEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetLineStippleEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetLineStippleEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetLineStippleEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetLineStippleEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetDepthClipNegativeOneToOneEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetDepthClipNegativeOneToOneEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetDepthClipNegativeOneToOneEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetDepthClipNegativeOneToOneEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportWScalingEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportWScalingEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportWScalingEnableNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetViewportWScalingEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetViewportSwizzleNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetViewportSwizzleNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetViewportSwizzleNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetViewportSwizzleNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageToColorEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageToColorEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageToColorEnableNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetCoverageToColorEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageToColorLocationNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageToColorLocationNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageToColorLocationNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetCoverageToColorLocationNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageModulationModeNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageModulationModeNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageModulationModeNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetCoverageModulationModeNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageModulationTableEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageModulationTableEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageModulationTableEnableNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetCoverageModulationTableEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageModulationTableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageModulationTableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageModulationTableNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetCoverageModulationTableNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetShadingRateImageEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetShadingRateImageEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetShadingRateImageEnableNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetShadingRateImageEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRepresentativeFragmentTestEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRepresentativeFragmentTestEnableNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRepresentativeFragmentTestEnableNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetRepresentativeFragmentTestEnableNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetCoverageReductionModeNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetCoverageReductionModeNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetCoverageReductionModeNV);
+    BUILD_PASSTHROUGH_FLAG(CmdSetCoverageReductionModeNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetShaderModuleIdentifierEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetShaderModuleIdentifierEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetShaderModuleIdentifierEXT);
+    BUILD_PASSTHROUGH_FLAG(GetShaderModuleIdentifierEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetShaderModuleCreateInfoIdentifierEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetShaderModuleCreateInfoIdentifierEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetShaderModuleCreateInfoIdentifierEXT);
+    BUILD_PASSTHROUGH_FLAG(GetShaderModuleCreateInfoIdentifierEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateOpticalFlowSessionNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateOpticalFlowSessionNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateOpticalFlowSessionNV);
+    BUILD_PASSTHROUGH_FLAG(CreateOpticalFlowSessionNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyOpticalFlowSessionNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyOpticalFlowSessionNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyOpticalFlowSessionNV);
+    BUILD_PASSTHROUGH_FLAG(DestroyOpticalFlowSessionNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateBindOpticalFlowSessionImageNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordBindOpticalFlowSessionImageNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordBindOpticalFlowSessionImageNV);
+    BUILD_PASSTHROUGH_FLAG(BindOpticalFlowSessionImageNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdOpticalFlowExecuteNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdOpticalFlowExecuteNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdOpticalFlowExecuteNV);
+    BUILD_PASSTHROUGH_FLAG(CmdOpticalFlowExecuteNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyShaderEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyShaderEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyShaderEXT);
+    BUILD_PASSTHROUGH_FLAG(DestroyShaderEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetShaderBinaryDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetShaderBinaryDataEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetShaderBinaryDataEXT);
+    BUILD_PASSTHROUGH_FLAG(GetShaderBinaryDataEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBindShadersEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBindShadersEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBindShadersEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdBindShadersEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetFramebufferTilePropertiesQCOM);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetFramebufferTilePropertiesQCOM);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetFramebufferTilePropertiesQCOM);
+    BUILD_PASSTHROUGH_FLAG(GetFramebufferTilePropertiesQCOM);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDynamicRenderingTilePropertiesQCOM);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDynamicRenderingTilePropertiesQCOM);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDynamicRenderingTilePropertiesQCOM);
+    BUILD_PASSTHROUGH_FLAG(GetDynamicRenderingTilePropertiesQCOM);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetLatencySleepModeNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetLatencySleepModeNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetLatencySleepModeNV);
+    BUILD_PASSTHROUGH_FLAG(SetLatencySleepModeNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateLatencySleepNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordLatencySleepNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordLatencySleepNV);
+    BUILD_PASSTHROUGH_FLAG(LatencySleepNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateSetLatencyMarkerNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordSetLatencyMarkerNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordSetLatencyMarkerNV);
+    BUILD_PASSTHROUGH_FLAG(SetLatencyMarkerNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetLatencyTimingsNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetLatencyTimingsNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetLatencyTimingsNV);
+    BUILD_PASSTHROUGH_FLAG(GetLatencyTimingsNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateQueueNotifyOutOfBandNV);
     BUILD_DISPATCH_VECTOR(PreCallRecordQueueNotifyOutOfBandNV);
     BUILD_DISPATCH_VECTOR(PostCallRecordQueueNotifyOutOfBandNV);
+    BUILD_PASSTHROUGH_FLAG(QueueNotifyOutOfBandNV);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetAttachmentFeedbackLoopEnableEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetAttachmentFeedbackLoopEnableEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetAttachmentFeedbackLoopEnableEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdSetAttachmentFeedbackLoopEnableEXT);
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
     BUILD_DISPATCH_VECTOR(PreCallValidateGetScreenBufferPropertiesQNX);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetScreenBufferPropertiesQNX);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetScreenBufferPropertiesQNX);
+    BUILD_PASSTHROUGH_FLAG(GetScreenBufferPropertiesQNX);
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
     BUILD_DISPATCH_VECTOR(PreCallValidateCreateAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCreateAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCreateAccelerationStructureKHR);
+    BUILD_PASSTHROUGH_FLAG(CreateAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateDestroyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordDestroyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordDestroyAccelerationStructureKHR);
+    BUILD_PASSTHROUGH_FLAG(DestroyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructuresKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructuresKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructuresKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdBuildAccelerationStructuresKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdBuildAccelerationStructuresIndirectKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdBuildAccelerationStructuresIndirectKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdBuildAccelerationStructuresIndirectKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdBuildAccelerationStructuresIndirectKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateBuildAccelerationStructuresKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordBuildAccelerationStructuresKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordBuildAccelerationStructuresKHR);
+    BUILD_PASSTHROUGH_FLAG(BuildAccelerationStructuresKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCopyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyAccelerationStructureKHR);
+    BUILD_PASSTHROUGH_FLAG(CopyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCopyAccelerationStructureToMemoryKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyAccelerationStructureToMemoryKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyAccelerationStructureToMemoryKHR);
+    BUILD_PASSTHROUGH_FLAG(CopyAccelerationStructureToMemoryKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCopyMemoryToAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCopyMemoryToAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCopyMemoryToAccelerationStructureKHR);
+    BUILD_PASSTHROUGH_FLAG(CopyMemoryToAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateWriteAccelerationStructuresPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordWriteAccelerationStructuresPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordWriteAccelerationStructuresPropertiesKHR);
+    BUILD_PASSTHROUGH_FLAG(WriteAccelerationStructuresPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyAccelerationStructureToMemoryKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyAccelerationStructureToMemoryKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyAccelerationStructureToMemoryKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyAccelerationStructureToMemoryKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdCopyMemoryToAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdCopyMemoryToAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdCopyMemoryToAccelerationStructureKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdCopyMemoryToAccelerationStructureKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureDeviceAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureDeviceAddressKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureDeviceAddressKHR);
+    BUILD_PASSTHROUGH_FLAG(GetAccelerationStructureDeviceAddressKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdWriteAccelerationStructuresPropertiesKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdWriteAccelerationStructuresPropertiesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceAccelerationStructureCompatibilityKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceAccelerationStructureCompatibilityKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceAccelerationStructureCompatibilityKHR);
+    BUILD_PASSTHROUGH_FLAG(GetDeviceAccelerationStructureCompatibilityKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetAccelerationStructureBuildSizesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetAccelerationStructureBuildSizesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetAccelerationStructureBuildSizesKHR);
+    BUILD_PASSTHROUGH_FLAG(GetAccelerationStructureBuildSizesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdTraceRaysKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingCaptureReplayShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingCaptureReplayShaderGroupHandlesKHR);
+    BUILD_PASSTHROUGH_FLAG(GetRayTracingCaptureReplayShaderGroupHandlesKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdTraceRaysIndirectKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdTraceRaysIndirectKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdTraceRaysIndirectKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdTraceRaysIndirectKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateGetRayTracingShaderGroupStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetRayTracingShaderGroupStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetRayTracingShaderGroupStackSizeKHR);
+    BUILD_PASSTHROUGH_FLAG(GetRayTracingShaderGroupStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdSetRayTracingPipelineStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdSetRayTracingPipelineStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdSetRayTracingPipelineStackSizeKHR);
+    BUILD_PASSTHROUGH_FLAG(CmdSetRayTracingPipelineStackSizeKHR);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawMeshTasksEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawMeshTasksIndirectEXT);
     BUILD_DISPATCH_VECTOR(PreCallValidateCmdDrawMeshTasksIndirectCountEXT);
     BUILD_DISPATCH_VECTOR(PreCallRecordCmdDrawMeshTasksIndirectCountEXT);
     BUILD_DISPATCH_VECTOR(PostCallRecordCmdDrawMeshTasksIndirectCountEXT);
+    BUILD_PASSTHROUGH_FLAG(CmdDrawMeshTasksIndirectCountEXT);
 }
 
 // NOLINTEND
@@ -1831,7 +1831,7 @@ bool CoreChecks::ValidateCmd(const vvl::CommandBuffer& cb_state, const Location&
 
     // Validate the given command being added to the specified cmd buffer,
     // flagging errors if CB is not in the recording state or if there's an issue with the Cmd ordering
-    switch (cb_state.state) {
+    switch (cb_state.GetState()) {
         case CbState::Recording:
             skip |= ValidateCmdSubpassState(cb_state, loc, info.recording_vuid);
             break;
@@ -25,3 +25,4 @@
 #pragma once
 
 #define INST_SHADER_GIT_HASH "63c14b095659ccba95b89465ace08c6a8ab53615"
+#define INST_PASS_GIT_HASH "fdf00f0a2cb2357bf3c9ce7156f727304218a433"
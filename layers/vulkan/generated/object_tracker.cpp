@@ -194,45 +194,35 @@ bool ObjectLifetimes::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitC
             [[maybe_unused]] const Location index0_loc = error_obj.location.dot(Field::pSubmits, index0);
 
             if ((pSubmits[index0].waitSemaphoreCount > 0) && (pSubmits[index0].pWaitSemaphores)) {
-                for (uint32_t index1 = 0; index1 < pSubmits[index0].waitSemaphoreCount; ++index1) {
-                    skip |= ValidateObject(pSubmits[index0].pWaitSemaphores[index1], kVulkanObjectTypeSemaphore, false,
-                                           "VUID-VkSubmitInfo-pWaitSemaphores-parameter", "VUID-VkSubmitInfo-commonparent",
-                                           index0_loc.dot(Field::pWaitSemaphores, index1));
-                }
+                skip |= ValidateObjectArray(pSubmits[index0].pWaitSemaphores, pSubmits[index0].waitSemaphoreCount,
+                                            kVulkanObjectTypeSemaphore, false, "VUID-VkSubmitInfo-pWaitSemaphores-parameter",
+                                            "VUID-VkSubmitInfo-commonparent", index0_loc, Field::pWaitSemaphores);
             }
 
             if ((pSubmits[index0].commandBufferCount > 0) && (pSubmits[index0].pCommandBuffers)) {
-                for (uint32_t index1 = 0; index1 < pSubmits[index0].commandBufferCount; ++index1) {
-                    skip |= ValidateObject(pSubmits[index0].pCommandBuffers[index1], kVulkanObjectTypeCommandBuffer, false,
-                                           "VUID-VkSubmitInfo-pCommandBuffers-parameter", "VUID-VkSubmitInfo-commonparent",
-                                           index0_loc.dot(Field::pCommandBuffers, index1));
-                }
+                skip |= ValidateObjectArray(pSubmits[index0].pCommandBuffers, pSubmits[index0].commandBufferCount,
+                                            kVulkanObjectTypeCommandBuffer, false, "VUID-VkSubmitInfo-pCommandBuffers-parameter",
+                                            "VUID-VkSubmitInfo-commonparent", index0_loc, Field::pCommandBuffers);
             }
 
             if ((pSubmits[index0].signalSemaphoreCount > 0) && (pSubmits[index0].pSignalSemaphores)) {
-                for (uint32_t index1 = 0; index1 < pSubmits[index0].signalSemaphoreCount; ++index1) {
-                    skip |= ValidateObject(pSubmits[index0].pSignalSemaphores[index1], kVulkanObjectTypeSemaphore, false,
-                                           "VUID-VkSubmitInfo-pSignalSemaphores-parameter", "VUID-VkSubmitInfo-commonparent",
-                                           index0_loc.dot(Field::pSignalSemaphores, index1));
-                }
+                skip |= ValidateObjectArray(pSubmits[index0].pSignalSemaphores, pSubmits[index0].signalSemaphoreCount,
+                                            kVulkanObjectTypeSemaphore, false, "VUID-VkSubmitInfo-pSignalSemaphores-parameter",
+                                            "VUID-VkSubmitInfo-commonparent", index0_loc, Field::pSignalSemaphores);
             }
             if ([[maybe_unused]] auto pNext = vku::FindStructInPNextChain<VkFrameBoundaryEXT>(pSubmits[index0].pNext)) {
                 [[maybe_unused]] const Location pNext_loc = index0_loc.pNext(Struct::VkFrameBoundaryEXT);
 
                 if ((pNext->imageCount > 0) && (pNext->pImages)) {
-                    for (uint32_t index2 = 0; index2 < pNext->imageCount; ++index2) {
-                        skip |= ValidateObject(pNext->pImages[index2], kVulkanObjectTypeImage, false,
-                                               "VUID-VkFrameBoundaryEXT-pImages-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
-                                               pNext_loc.dot(Field::pImages, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pImages, pNext->imageCount, kVulkanObjectTypeImage, false,
+                                                "VUID-VkFrameBoundaryEXT-pImages-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
+                                                pNext_loc, Field::pImages);
                 }
 
                 if ((pNext->bufferCount > 0) && (pNext->pBuffers)) {
-                    for (uint32_t index2 = 0; index2 < pNext->bufferCount; ++index2) {
-                        skip |= ValidateObject(pNext->pBuffers[index2], kVulkanObjectTypeBuffer, false,
-                                               "VUID-VkFrameBoundaryEXT-pBuffers-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
-                                               pNext_loc.dot(Field::pBuffers, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pBuffers, pNext->bufferCount, kVulkanObjectTypeBuffer, false,
+                                                "VUID-VkFrameBoundaryEXT-pBuffers-parameter",
+                                                "VUID-VkFrameBoundaryEXT-commonparent", pNext_loc, Field::pBuffers);
                 }
             }
 #ifdef VK_USE_PLATFORM_WIN32_KHR
@@ -241,21 +231,17 @@ bool ObjectLifetimes::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitC
                 [[maybe_unused]] const Location pNext_loc = index0_loc.pNext(Struct::VkWin32KeyedMutexAcquireReleaseInfoKHR);
 
                 if ((pNext->acquireCount > 0) && (pNext->pAcquireSyncs)) {
-                    for (uint32_t index2 = 0; index2 < pNext->acquireCount; ++index2) {
-                        skip |= ValidateObject(pNext->pAcquireSyncs[index2], kVulkanObjectTypeDeviceMemory, false,
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-pAcquireSyncs-parameter",
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-commonparent",
-                                               pNext_loc.dot(Field::pAcquireSyncs, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pAcquireSyncs, pNext->acquireCount, kVulkanObjectTypeDeviceMemory, false,
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-pAcquireSyncs-parameter",
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-commonparent", pNext_loc,
+                                                Field::pAcquireSyncs);
                 }
 
                 if ((pNext->releaseCount > 0) && (pNext->pReleaseSyncs)) {
-                    for (uint32_t index2 = 0; index2 < pNext->releaseCount; ++index2) {
-                        skip |= ValidateObject(pNext->pReleaseSyncs[index2], kVulkanObjectTypeDeviceMemory, false,
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-pReleaseSyncs-parameter",
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-commonparent",
-                                               pNext_loc.dot(Field::pReleaseSyncs, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pReleaseSyncs, pNext->releaseCount, kVulkanObjectTypeDeviceMemory, false,
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-pReleaseSyncs-parameter",
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-commonparent", pNext_loc,
+                                                Field::pReleaseSyncs);
                 }
             }
             if ([[maybe_unused]] auto pNext =
@@ -263,21 +249,17 @@ bool ObjectLifetimes::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitC
                 [[maybe_unused]] const Location pNext_loc = index0_loc.pNext(Struct::VkWin32KeyedMutexAcquireReleaseInfoNV);
 
                 if ((pNext->acquireCount > 0) && (pNext->pAcquireSyncs)) {
-                    for (uint32_t index2 = 0; index2 < pNext->acquireCount; ++index2) {
-                        skip |= ValidateObject(pNext->pAcquireSyncs[index2], kVulkanObjectTypeDeviceMemory, false,
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-pAcquireSyncs-parameter",
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-commonparent",
-                                               pNext_loc.dot(Field::pAcquireSyncs, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pAcquireSyncs, pNext->acquireCount, kVulkanObjectTypeDeviceMemory, false,
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-pAcquireSyncs-parameter",
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-commonparent", pNext_loc,
+                                                Field::pAcquireSyncs);
                 }
 
                 if ((pNext->releaseCount > 0) && (pNext->pReleaseSyncs)) {
-                    for (uint32_t index2 = 0; index2 < pNext->releaseCount; ++index2) {
-                        skip |= ValidateObject(pNext->pReleaseSyncs[index2], kVulkanObjectTypeDeviceMemory, false,
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-pReleaseSyncs-parameter",
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-commonparent",
-                                               pNext_loc.dot(Field::pReleaseSyncs, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pReleaseSyncs, pNext->releaseCount, kVulkanObjectTypeDeviceMemory, false,
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-pReleaseSyncs-parameter",
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-commonparent", pNext_loc,
+                                                Field::pReleaseSyncs);
                 }
             }
 #endif  // VK_USE_PLATFORM_WIN32_KHR
@@ -491,11 +473,9 @@ bool ObjectLifetimes::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t bin
             [[maybe_unused]] const Location index0_loc = error_obj.location.dot(Field::pBindInfo, index0);
 
             if ((pBindInfo[index0].waitSemaphoreCount > 0) && (pBindInfo[index0].pWaitSemaphores)) {
-                for (uint32_t index1 = 0; index1 < pBindInfo[index0].waitSemaphoreCount; ++index1) {
-                    skip |= ValidateObject(pBindInfo[index0].pWaitSemaphores[index1], kVulkanObjectTypeSemaphore, false,
-                                           "VUID-VkBindSparseInfo-pWaitSemaphores-parameter", "VUID-VkBindSparseInfo-commonparent",
-                                           index0_loc.dot(Field::pWaitSemaphores, index1));
-                }
+                skip |= ValidateObjectArray(pBindInfo[index0].pWaitSemaphores, pBindInfo[index0].waitSemaphoreCount,
+                                            kVulkanObjectTypeSemaphore, false, "VUID-VkBindSparseInfo-pWaitSemaphores-parameter",
+                                            "VUID-VkBindSparseInfo-commonparent", index0_loc, Field::pWaitSemaphores);
             }
             if (pBindInfo[index0].pBufferBinds) {
                 for (uint32_t index1 = 0; index1 < pBindInfo[index0].bufferBindCount; ++index1) {
@@ -547,29 +527,23 @@ bool ObjectLifetimes::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t bin
             }
 
             if ((pBindInfo[index0].signalSemaphoreCount > 0) && (pBindInfo[index0].pSignalSemaphores)) {
-                for (uint32_t index1 = 0; index1 < pBindInfo[index0].signalSemaphoreCount; ++index1) {
-                    skip |= ValidateObject(pBindInfo[index0].pSignalSemaphores[index1], kVulkanObjectTypeSemaphore, false,
-                                           "VUID-VkBindSparseInfo-pSignalSemaphores-parameter",
-                                           "VUID-VkBindSparseInfo-commonparent", index0_loc.dot(Field::pSignalSemaphores, index1));
-                }
+                skip |= ValidateObjectArray(pBindInfo[index0].pSignalSemaphores, pBindInfo[index0].signalSemaphoreCount,
+                                            kVulkanObjectTypeSemaphore, false, "VUID-VkBindSparseInfo-pSignalSemaphores-parameter",
+                                            "VUID-VkBindSparseInfo-commonparent", index0_loc, Field::pSignalSemaphores);
             }
             if ([[maybe_unused]] auto pNext = vku::FindStructInPNextChain<VkFrameBoundaryEXT>(pBindInfo[index0].pNext)) {
                 [[maybe_unused]] const Location pNext_loc = index0_loc.pNext(Struct::VkFrameBoundaryEXT);
 
                 if ((pNext->imageCount > 0) && (pNext->pImages)) {
-                    for (uint32_t index2 = 0; index2 < pNext->imageCount; ++index2) {
-                        skip |= ValidateObject(pNext->pImages[index2], kVulkanObjectTypeImage, false,
-                                               "VUID-VkFrameBoundaryEXT-pImages-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
-                                               pNext_loc.dot(Field::pImages, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pImages, pNext->imageCount, kVulkanObjectTypeImage, false,
+                                                "VUID-VkFrameBoundaryEXT-pImages-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
+                                                pNext_loc, Field::pImages);
                 }
 
                 if ((pNext->bufferCount > 0) && (pNext->pBuffers)) {
-                    for (uint32_t index2 = 0; index2 < pNext->bufferCount; ++index2) {
-                        skip |= ValidateObject(pNext->pBuffers[index2], kVulkanObjectTypeBuffer, false,
-                                               "VUID-VkFrameBoundaryEXT-pBuffers-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
-                                               pNext_loc.dot(Field::pBuffers, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pBuffers, pNext->bufferCount, kVulkanObjectTypeBuffer, false,
+                                                "VUID-VkFrameBoundaryEXT-pBuffers-parameter",
+                                                "VUID-VkFrameBoundaryEXT-commonparent", pNext_loc, Field::pBuffers);
                 }
             }
         }
@@ -613,10 +587,8 @@ bool ObjectLifetimes::PreCallValidateResetFences(VkDevice device, uint32_t fence
     // Checked by chassis: device: "VUID-vkResetFences-device-parameter"
 
     if ((fenceCount > 0) && (pFences)) {
-        for (uint32_t index0 = 0; index0 < fenceCount; ++index0) {
-            skip |= ValidateObject(pFences[index0], kVulkanObjectTypeFence, false, "VUID-vkResetFences-pFences-parameter",
-                                   "VUID-vkResetFences-pFences-parent", error_obj.location.dot(Field::pFences, index0));
-        }
+        skip |= ValidateObjectArray(pFences, fenceCount, kVulkanObjectTypeFence, false, "VUID-vkResetFences-pFences-parameter",
+                                    "VUID-vkResetFences-pFences-parent", error_obj.location, Field::pFences);
     }
 
     return skip;
@@ -637,10 +609,8 @@ bool ObjectLifetimes::PreCallValidateWaitForFences(VkDevice device, uint32_t fen
     // Checked by chassis: device: "VUID-vkWaitForFences-device-parameter"
 
     if ((fenceCount > 0) && (pFences)) {
-        for (uint32_t index0 = 0; index0 < fenceCount; ++index0) {
-            skip |= ValidateObject(pFences[index0], kVulkanObjectTypeFence, false, "VUID-vkWaitForFences-pFences-parameter",
-                                   "VUID-vkWaitForFences-pFences-parent", error_obj.location.dot(Field::pFences, index0));
-        }
+        skip |= ValidateObjectArray(pFences, fenceCount, kVulkanObjectTypeFence, false, "VUID-vkWaitForFences-pFences-parameter",
+                                    "VUID-vkWaitForFences-pFences-parent", error_obj.location, Field::pFences);
     }
 
     return skip;
@@ -1049,11 +1019,9 @@ bool ObjectLifetimes::PreCallValidateMergePipelineCaches(VkDevice device, VkPipe
                            "VUID-vkMergePipelineCaches-dstCache-parent", error_obj.location.dot(Field::dstCache));
 
     if ((srcCacheCount > 0) && (pSrcCaches)) {
-        for (uint32_t index0 = 0; index0 < srcCacheCount; ++index0) {
-            skip |= ValidateObject(
-                pSrcCaches[index0], kVulkanObjectTypePipelineCache, false, "VUID-vkMergePipelineCaches-pSrcCaches-parameter",
-                "VUID-vkMergePipelineCaches-pSrcCaches-parent", error_obj.location.dot(Field::pSrcCaches, index0));
-        }
+        skip |= ValidateObjectArray(pSrcCaches, srcCacheCount, kVulkanObjectTypePipelineCache, false,
+                                    "VUID-vkMergePipelineCaches-pSrcCaches-parameter",
+                                    "VUID-vkMergePipelineCaches-pSrcCaches-parent", error_obj.location, Field::pSrcCaches);
     }
 
     return skip;
@@ -1097,11 +1065,9 @@ bool ObjectLifetimes::PreCallValidateCreateGraphicsPipelines(VkDevice device, Vk
                 [[maybe_unused]] const Location pNext_loc = index0_loc.pNext(Struct::VkGraphicsPipelineShaderGroupsCreateInfoNV);
 
                 if ((pNext->pipelineCount > 0) && (pNext->pPipelines)) {
-                    for (uint32_t index2 = 0; index2 < pNext->pipelineCount; ++index2) {
-                        skip |= ValidateObject(pNext->pPipelines[index2], kVulkanObjectTypePipeline, false,
-                                               "VUID-VkGraphicsPipelineShaderGroupsCreateInfoNV-pPipelines-parameter",
-                                               kVUIDUndefined, pNext_loc.dot(Field::pPipelines, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pPipelines, pNext->pipelineCount, kVulkanObjectTypePipeline, false,
+                                                "VUID-VkGraphicsPipelineShaderGroupsCreateInfoNV-pPipelines-parameter",
+                                                kVUIDUndefined, pNext_loc, Field::pPipelines);
                 }
             }
             if ([[maybe_unused]] auto pNext =
@@ -1109,11 +1075,9 @@ bool ObjectLifetimes::PreCallValidateCreateGraphicsPipelines(VkDevice device, Vk
                 [[maybe_unused]] const Location pNext_loc = index0_loc.pNext(Struct::VkPipelineLibraryCreateInfoKHR);
 
                 if ((pNext->libraryCount > 0) && (pNext->pLibraries)) {
-                    for (uint32_t index2 = 0; index2 < pNext->libraryCount; ++index2) {
-                        skip |= ValidateObject(pNext->pLibraries[index2], kVulkanObjectTypePipeline, false,
-                                               "VUID-VkPipelineLibraryCreateInfoKHR-pLibraries-parameter", kVUIDUndefined,
-                                               pNext_loc.dot(Field::pLibraries, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pLibraries, pNext->libraryCount, kVulkanObjectTypePipeline, false,
+                                                "VUID-VkPipelineLibraryCreateInfoKHR-pLibraries-parameter", kVUIDUndefined,
+                                                pNext_loc, Field::pLibraries);
                 }
             }
         }
@@ -1201,11 +1165,9 @@ bool ObjectLifetimes::PreCallValidateCreatePipelineLayout(VkDevice device, const
         [[maybe_unused]] const Location pCreateInfo_loc = error_obj.location.dot(Field::pCreateInfo);
 
         if ((pCreateInfo->setLayoutCount > 0) && (pCreateInfo->pSetLayouts)) {
-            for (uint32_t index1 = 0; index1 < pCreateInfo->setLayoutCount; ++index1) {
-                skip |= ValidateObject(pCreateInfo->pSetLayouts[index1], kVulkanObjectTypeDescriptorSetLayout, true,
-                                       "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined,
-                                       pCreateInfo_loc.dot(Field::pSetLayouts, index1));
-            }
+            skip |= ValidateObjectArray(pCreateInfo->pSetLayouts, pCreateInfo->setLayoutCount, kVulkanObjectTypeDescriptorSetLayout,
+                                        true, "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined,
+                                        pCreateInfo_loc, Field::pSetLayouts);
         }
     }
 
@@ -1711,10 +1673,8 @@ bool ObjectLifetimes::PreCallValidateCmdWaitEvents(
     // Checked by chassis: commandBuffer: "VUID-vkCmdWaitEvents-commonparent"
 
     if ((eventCount > 0) && (pEvents)) {
-        for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
-            skip |= ValidateObject(pEvents[index0], kVulkanObjectTypeEvent, false, "VUID-vkCmdWaitEvents-pEvents-parameter",
-                                   "VUID-vkCmdWaitEvents-commonparent", error_obj.location.dot(Field::pEvents, index0));
-        }
+        skip |= ValidateObjectArray(pEvents, eventCount, kVulkanObjectTypeEvent, false, "VUID-vkCmdWaitEvents-pEvents-parameter",
+                                    "VUID-vkCmdWaitEvents-commonparent", error_obj.location, Field::pEvents);
     }
     if (pBufferMemoryBarriers) {
         for (uint32_t index0 = 0; index0 < bufferMemoryBarrierCount; ++index0) {
@@ -1874,11 +1834,9 @@ bool ObjectLifetimes::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandB
     // Checked by chassis: commandBuffer: "VUID-vkCmdExecuteCommands-commonparent"
 
     if ((commandBufferCount > 0) && (pCommandBuffers)) {
-        for (uint32_t index0 = 0; index0 < commandBufferCount; ++index0) {
-            skip |= ValidateObject(pCommandBuffers[index0], kVulkanObjectTypeCommandBuffer, false,
-                                   "VUID-vkCmdExecuteCommands-pCommandBuffers-parameter", "VUID-vkCmdExecuteCommands-commonparent",
-                                   error_obj.location.dot(Field::pCommandBuffers, index0));
-        }
+        skip |= ValidateObjectArray(pCommandBuffers, commandBufferCount, kVulkanObjectTypeCommandBuffer, false,
+                                    "VUID-vkCmdExecuteCommands-pCommandBuffers-parameter", "VUID-vkCmdExecuteCommands-commonparent",
+                                    error_obj.location, Field::pCommandBuffers);
     }
 
     return skip;
@@ -2218,11 +2176,9 @@ bool ObjectLifetimes::PreCallValidateWaitSemaphores(VkDevice device, const VkSem
         [[maybe_unused]] const Location pWaitInfo_loc = error_obj.location.dot(Field::pWaitInfo);
 
         if ((pWaitInfo->semaphoreCount > 0) && (pWaitInfo->pSemaphores)) {
-            for (uint32_t index1 = 0; index1 < pWaitInfo->semaphoreCount; ++index1) {
-                skip |= ValidateObject(pWaitInfo->pSemaphores[index1], kVulkanObjectTypeSemaphore, false,
-                                       "VUID-VkSemaphoreWaitInfo-pSemaphores-parameter", kVUIDUndefined,
-                                       pWaitInfo_loc.dot(Field::pSemaphores, index1));
-            }
+            skip |= ValidateObjectArray(pWaitInfo->pSemaphores, pWaitInfo->semaphoreCount, kVulkanObjectTypeSemaphore, false,
+                                        "VUID-VkSemaphoreWaitInfo-pSemaphores-parameter", kVUIDUndefined, pWaitInfo_loc,
+                                        Field::pSemaphores);
         }
     }
 
@@ -2364,10 +2320,8 @@ bool ObjectLifetimes::PreCallValidateCmdWaitEvents2(VkCommandBuffer commandBuffe
     // Checked by chassis: commandBuffer: "VUID-vkCmdWaitEvents2-commonparent"
 
     if ((eventCount > 0) && (pEvents)) {
-        for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
-            skip |= ValidateObject(pEvents[index0], kVulkanObjectTypeEvent, false, "VUID-vkCmdWaitEvents2-pEvents-parameter",
-                                   "VUID-vkCmdWaitEvents2-commonparent", error_obj.location.dot(Field::pEvents, index0));
-        }
+        skip |= ValidateObjectArray(pEvents, eventCount, kVulkanObjectTypeEvent, false, "VUID-vkCmdWaitEvents2-pEvents-parameter",
+                                    "VUID-vkCmdWaitEvents2-commonparent", error_obj.location, Field::pEvents);
     }
     if (pDependencyInfos) {
         for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
@@ -2468,19 +2422,15 @@ bool ObjectLifetimes::PreCallValidateQueueSubmit2(VkQueue queue, uint32_t submit
                 [[maybe_unused]] const Location pNext_loc = index0_loc.pNext(Struct::VkFrameBoundaryEXT);
 
                 if ((pNext->imageCount > 0) && (pNext->pImages)) {
-                    for (uint32_t index2 = 0; index2 < pNext->imageCount; ++index2) {
-                        skip |= ValidateObject(pNext->pImages[index2], kVulkanObjectTypeImage, false,
-                                               "VUID-VkFrameBoundaryEXT-pImages-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
-                                               pNext_loc.dot(Field::pImages, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pImages, pNext->imageCount, kVulkanObjectTypeImage, false,
+                                                "VUID-VkFrameBoundaryEXT-pImages-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
+                                                pNext_loc, Field::pImages);
                 }
 
                 if ((pNext->bufferCount > 0) && (pNext->pBuffers)) {
-                    for (uint32_t index2 = 0; index2 < pNext->bufferCount; ++index2) {
-                        skip |= ValidateObject(pNext->pBuffers[index2], kVulkanObjectTypeBuffer, false,
-                                               "VUID-VkFrameBoundaryEXT-pBuffers-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
-                                               pNext_loc.dot(Field::pBuffers, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pBuffers, pNext->bufferCount, kVulkanObjectTypeBuffer, false,
+                                                "VUID-VkFrameBoundaryEXT-pBuffers-parameter",
+                                                "VUID-VkFrameBoundaryEXT-commonparent", pNext_loc, Field::pBuffers);
                 }
             }
 #ifdef VK_USE_PLATFORM_WIN32_KHR
@@ -2489,21 +2439,17 @@ bool ObjectLifetimes::PreCallValidateQueueSubmit2(VkQueue queue, uint32_t submit
                 [[maybe_unused]] const Location pNext_loc = index0_loc.pNext(Struct::VkWin32KeyedMutexAcquireReleaseInfoKHR);
 
                 if ((pNext->acquireCount > 0) && (pNext->pAcquireSyncs)) {
-                    for (uint32_t index2 = 0; index2 < pNext->acquireCount; ++index2) {
-                        skip |= ValidateObject(pNext->pAcquireSyncs[index2], kVulkanObjectTypeDeviceMemory, false,
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-pAcquireSyncs-parameter",
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-commonparent",
-                                               pNext_loc.dot(Field::pAcquireSyncs, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pAcquireSyncs, pNext->acquireCount, kVulkanObjectTypeDeviceMemory, false,
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-pAcquireSyncs-parameter",
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-commonparent", pNext_loc,
+                                                Field::pAcquireSyncs);
                 }
 
                 if ((pNext->releaseCount > 0) && (pNext->pReleaseSyncs)) {
-                    for (uint32_t index2 = 0; index2 < pNext->releaseCount; ++index2) {
-                        skip |= ValidateObject(pNext->pReleaseSyncs[index2], kVulkanObjectTypeDeviceMemory, false,
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-pReleaseSyncs-parameter",
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-commonparent",
-                                               pNext_loc.dot(Field::pReleaseSyncs, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pReleaseSyncs, pNext->releaseCount, kVulkanObjectTypeDeviceMemory, false,
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-pReleaseSyncs-parameter",
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoKHR-commonparent", pNext_loc,
+                                                Field::pReleaseSyncs);
                 }
             }
             if ([[maybe_unused]] auto pNext =
@@ -2511,21 +2457,17 @@ bool ObjectLifetimes::PreCallValidateQueueSubmit2(VkQueue queue, uint32_t submit
                 [[maybe_unused]] const Location pNext_loc = index0_loc.pNext(Struct::VkWin32KeyedMutexAcquireReleaseInfoNV);
 
                 if ((pNext->acquireCount > 0) && (pNext->pAcquireSyncs)) {
-                    for (uint32_t index2 = 0; index2 < pNext->acquireCount; ++index2) {
-                        skip |= ValidateObject(pNext->pAcquireSyncs[index2], kVulkanObjectTypeDeviceMemory, false,
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-pAcquireSyncs-parameter",
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-commonparent",
-                                               pNext_loc.dot(Field::pAcquireSyncs, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pAcquireSyncs, pNext->acquireCount, kVulkanObjectTypeDeviceMemory, false,
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-pAcquireSyncs-parameter",
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-commonparent", pNext_loc,
+                                                Field::pAcquireSyncs);
                 }
 
                 if ((pNext->releaseCount > 0) && (pNext->pReleaseSyncs)) {
-                    for (uint32_t index2 = 0; index2 < pNext->releaseCount; ++index2) {
-                        skip |= ValidateObject(pNext->pReleaseSyncs[index2], kVulkanObjectTypeDeviceMemory, false,
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-pReleaseSyncs-parameter",
-                                               "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-commonparent",
-                                               pNext_loc.dot(Field::pReleaseSyncs, index2));
-                    }
+                    skip |= ValidateObjectArray(pNext->pReleaseSyncs, pNext->releaseCount, kVulkanObjectTypeDeviceMemory, false,
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-pReleaseSyncs-parameter",
+                                                "VUID-VkWin32KeyedMutexAcquireReleaseInfoNV-commonparent", pNext_loc,
+                                                Field::pReleaseSyncs);
                 }
             }
 #endif  // VK_USE_PLATFORM_WIN32_KHR
@@ -2920,48 +2862,38 @@ bool ObjectLifetimes::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPres
         [[maybe_unused]] const Location pPresentInfo_loc = error_obj.location.dot(Field::pPresentInfo);
 
         if ((pPresentInfo->waitSemaphoreCount > 0) && (pPresentInfo->pWaitSemaphores)) {
-            for (uint32_t index1 = 0; index1 < pPresentInfo->waitSemaphoreCount; ++index1) {
-                skip |= ValidateObject(pPresentInfo->pWaitSemaphores[index1], kVulkanObjectTypeSemaphore, false,
-                                       "VUID-VkPresentInfoKHR-pWaitSemaphores-parameter", "VUID-VkPresentInfoKHR-commonparent",
-                                       pPresentInfo_loc.dot(Field::pWaitSemaphores, index1));
-            }
+            skip |= ValidateObjectArray(pPresentInfo->pWaitSemaphores, pPresentInfo->waitSemaphoreCount, kVulkanObjectTypeSemaphore,
+                                        false, "VUID-VkPresentInfoKHR-pWaitSemaphores-parameter",
+                                        "VUID-VkPresentInfoKHR-commonparent", pPresentInfo_loc, Field::pWaitSemaphores);
         }
 
         if ((pPresentInfo->swapchainCount > 0) && (pPresentInfo->pSwapchains)) {
-            for (uint32_t index1 = 0; index1 < pPresentInfo->swapchainCount; ++index1) {
-                skip |= ValidateObject(pPresentInfo->pSwapchains[index1], kVulkanObjectTypeSwapchainKHR, false,
-                                       "VUID-VkPresentInfoKHR-pSwapchains-parameter", "VUID-VkPresentInfoKHR-commonparent",
-                                       pPresentInfo_loc.dot(Field::pSwapchains, index1));
-            }
+            skip |= ValidateObjectArray(pPresentInfo->pSwapchains, pPresentInfo->swapchainCount, kVulkanObjectTypeSwapchainKHR,
+                                        false, "VUID-VkPresentInfoKHR-pSwapchains-parameter", "VUID-VkPresentInfoKHR-commonparent",
+                                        pPresentInfo_loc, Field::pSwapchains);
         }
         if ([[maybe_unused]] auto pNext = vku::FindStructInPNextChain<VkFrameBoundaryEXT>(pPresentInfo->pNext)) {
             [[maybe_unused]] const Location pNext_loc = pPresentInfo_loc.pNext(Struct::VkFrameBoundaryEXT);
 
             if ((pNext->imageCount > 0) && (pNext->pImages)) {
-                for (uint32_t index2 = 0; index2 < pNext->imageCount; ++index2) {
-                    skip |= ValidateObject(pNext->pImages[index2], kVulkanObjectTypeImage, false,
-                                           "VUID-VkFrameBoundaryEXT-pImages-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
-                                           pNext_loc.dot(Field::pImages, index2));
-                }
+                skip |= ValidateObjectArray(pNext->pImages, pNext->imageCount, kVulkanObjectTypeImage, false,
+                                            "VUID-VkFrameBoundaryEXT-pImages-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
+                                            pNext_loc, Field::pImages);
             }
 
             if ((pNext->bufferCount > 0) && (pNext->pBuffers)) {
-                for (uint32_t index2 = 0; index2 < pNext->bufferCount; ++index2) {
-                    skip |= ValidateObject(pNext->pBuffers[index2], kVulkanObjectTypeBuffer, false,
-                                           "VUID-VkFrameBoundaryEXT-pBuffers-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
-                                           pNext_loc.dot(Field::pBuffers, index2));
-                }
+                skip |= ValidateObjectArray(pNext->pBuffers, pNext->bufferCount, kVulkanObjectTypeBuffer, false,
+                                            "VUID-VkFrameBoundaryEXT-pBuffers-parameter", "VUID-VkFrameBoundaryEXT-commonparent",
+                                            pNext_loc, Field::pBuffers);
             }
         }
         if ([[maybe_unused]] auto pNext = vku::FindStructInPNextChain<VkSwapchainPresentFenceInfoEXT>(pPresentInfo->pNext)) {
             [[maybe_unused]] const Location pNext_loc = pPresentInfo_loc.pNext(Struct::VkSwapchainPresentFenceInfoEXT);
 
             if ((pNext->swapchainCount > 0) && (pNext->pFences)) {
-                for (uint32_t index2 = 0; index2 < pNext->swapchainCount; ++index2) {
-                    skip |= ValidateObject(pNext->pFences[index2], kVulkanObjectTypeFence, false,
-                                           "VUID-VkSwapchainPresentFenceInfoEXT-pFences-parameter", kVUIDUndefined,
-                                           pNext_loc.dot(Field::pFences, index2));
-                }
+                skip |= ValidateObjectArray(pNext->pFences, pNext->swapchainCount, kVulkanObjectTypeFence, false,
+                                            "VUID-VkSwapchainPresentFenceInfoEXT-pFences-parameter", kVUIDUndefined, pNext_loc,
+                                            Field::pFences);
             }
         }
     }
@@ -4310,22 +4242,19 @@ bool ObjectLifetimes::PreCallValidateCmdBindDescriptorSets2KHR(VkCommandBuffer c
                                pBindDescriptorSetsInfo_loc.dot(Field::layout));
 
         if ((pBindDescriptorSetsInfo->descriptorSetCount > 0) && (pBindDescriptorSetsInfo->pDescriptorSets)) {
-            for (uint32_t index1 = 0; index1 < pBindDescriptorSetsInfo->descriptorSetCount; ++index1) {
-                skip |= ValidateObject(pBindDescriptorSetsInfo->pDescriptorSets[index1], kVulkanObjectTypeDescriptorSet, false,
-                                       "VUID-VkBindDescriptorSetsInfoKHR-pDescriptorSets-parameter",
-                                       "VUID-VkBindDescriptorSetsInfoKHR-commonparent",
-                                       pBindDescriptorSetsInfo_loc.dot(Field::pDescriptorSets, index1));
-            }
+            skip |= ValidateObjectArray(pBindDescriptorSetsInfo->pDescriptorSets, pBindDescriptorSetsInfo->descriptorSetCount,
+                                        kVulkanObjectTypeDescriptorSet, false,
+                                        "VUID-VkBindDescriptorSetsInfoKHR-pDescriptorSets-parameter",
+                                        "VUID-VkBindDescriptorSetsInfoKHR-commonparent", pBindDescriptorSetsInfo_loc,
+                                        Field::pDescriptorSets);
         }
         if ([[maybe_unused]] auto pNext = vku::FindStructInPNextChain<VkPipelineLayoutCreateInfo>(pBindDescriptorSetsInfo->pNext)) {
             [[maybe_unused]] const Location pNext_loc = pBindDescriptorSetsInfo_loc.pNext(Struct::VkPipelineLayoutCreateInfo);
 
             if ((pNext->setLayoutCount > 0) && (pNext->pSetLayouts)) {
-                for (uint32_t index2 = 0; index2 < pNext->setLayoutCount; ++index2) {
-                    skip |= ValidateObject(pNext->pSetLayouts[index2], kVulkanObjectTypeDescriptorSetLayout, true,
-                                           "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined,
-                                           pNext_loc.dot(Field::pSetLayouts, index2));
-                }
+                skip |= ValidateObjectArray(pNext->pSetLayouts, pNext->setLayoutCount, kVulkanObjectTypeDescriptorSetLayout, true,
+                                            "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined, pNext_loc,
+                                            Field::pSetLayouts);
             }
         }
     }
@@ -4347,11 +4276,9 @@ bool ObjectLifetimes::PreCallValidateCmdPushConstants2KHR(VkCommandBuffer comman
             [[maybe_unused]] const Location pNext_loc = pPushConstantsInfo_loc.pNext(Struct::VkPipelineLayoutCreateInfo);
 
             if ((pNext->setLayoutCount > 0) && (pNext->pSetLayouts)) {
-                for (uint32_t index2 = 0; index2 < pNext->setLayoutCount; ++index2) {
-                    skip |= ValidateObject(pNext->pSetLayouts[index2], kVulkanObjectTypeDescriptorSetLayout, true,
-                                           "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined,
-                                           pNext_loc.dot(Field::pSetLayouts, index2));
-                }
+                skip |= ValidateObjectArray(pNext->pSetLayouts, pNext->setLayoutCount, kVulkanObjectTypeDescriptorSetLayout, true,
+                                            "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined, pNext_loc,
+                                            Field::pSetLayouts);
             }
         }
     }
@@ -4382,11 +4309,9 @@ bool ObjectLifetimes::PreCallValidateCmdPushDescriptorSetWithTemplate2KHR(
                 pPushDescriptorSetWithTemplateInfo_loc.pNext(Struct::VkPipelineLayoutCreateInfo);
 
             if ((pNext->setLayoutCount > 0) && (pNext->pSetLayouts)) {
-                for (uint32_t index2 = 0; index2 < pNext->setLayoutCount; ++index2) {
-                    skip |= ValidateObject(pNext->pSetLayouts[index2], kVulkanObjectTypeDescriptorSetLayout, true,
-                                           "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined,
-                                           pNext_loc.dot(Field::pSetLayouts, index2));
-                }
+                skip |= ValidateObjectArray(pNext->pSetLayouts, pNext->setLayoutCount, kVulkanObjectTypeDescriptorSetLayout, true,
+                                            "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined, pNext_loc,
+                                            Field::pSetLayouts);
             }
         }
     }
@@ -4412,11 +4337,9 @@ bool ObjectLifetimes::PreCallValidateCmdSetDescriptorBufferOffsets2EXT(
                 pSetDescriptorBufferOffsetsInfo_loc.pNext(Struct::VkPipelineLayoutCreateInfo);
 
             if ((pNext->setLayoutCount > 0) && (pNext->pSetLayouts)) {
-                for (uint32_t index2 = 0; index2 < pNext->setLayoutCount; ++index2) {
-                    skip |= ValidateObject(pNext->pSetLayouts[index2], kVulkanObjectTypeDescriptorSetLayout, true,
-                                           "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined,
-                                           pNext_loc.dot(Field::pSetLayouts, index2));
-                }
+                skip |= ValidateObjectArray(pNext->pSetLayouts, pNext->setLayoutCount, kVulkanObjectTypeDescriptorSetLayout, true,
+                                            "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined, pNext_loc,
+                                            Field::pSetLayouts);
             }
         }
     }
@@ -4442,11 +4365,9 @@ bool ObjectLifetimes::PreCallValidateCmdBindDescriptorBufferEmbeddedSamplers2EXT
                 pBindDescriptorBufferEmbeddedSamplersInfo_loc.pNext(Struct::VkPipelineLayoutCreateInfo);
 
             if ((pNext->setLayoutCount > 0) && (pNext->pSetLayouts)) {
-                for (uint32_t index2 = 0; index2 < pNext->setLayoutCount; ++index2) {
-                    skip |= ValidateObject(pNext->pSetLayouts[index2], kVulkanObjectTypeDescriptorSetLayout, true,
-                                           "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined,
-                                           pNext_loc.dot(Field::pSetLayouts, index2));
-                }
+                skip |= ValidateObjectArray(pNext->pSetLayouts, pNext->setLayoutCount, kVulkanObjectTypeDescriptorSetLayout, true,
+                                            "VUID-VkPipelineLayoutCreateInfo-pSetLayouts-parameter", kVUIDUndefined, pNext_loc,
+                                            Field::pSetLayouts);
             }
         }
     }
@@ -4508,11 +4429,9 @@ bool ObjectLifetimes::PreCallValidateCmdBindTransformFeedbackBuffersEXT(VkComman
     // Checked by chassis: commandBuffer: "VUID-vkCmdBindTransformFeedbackBuffersEXT-commonparent"
 
     if ((bindingCount > 0) && (pBuffers)) {
-        for (uint32_t index0 = 0; index0 < bindingCount; ++index0) {
-            skip |= ValidateObject(
-                pBuffers[index0], kVulkanObjectTypeBuffer, false, "VUID-vkCmdBindTransformFeedbackBuffersEXT-pBuffers-parameter",
-                "VUID-vkCmdBindTransformFeedbackBuffersEXT-commonparent", error_obj.location.dot(Field::pBuffers, index0));
-        }
+        skip |= ValidateObjectArray(pBuffers, bindingCount, kVulkanObjectTypeBuffer, false,
+                                    "VUID-vkCmdBindTransformFeedbackBuffersEXT-pBuffers-parameter",
+                                    "VUID-vkCmdBindTransformFeedbackBuffersEXT-commonparent", error_obj.location, Field::pBuffers);
     }
 
     return skip;
@@ -4527,12 +4446,9 @@ bool ObjectLifetimes::PreCallValidateCmdBeginTransformFeedbackEXT(VkCommandBuffe
     // Checked by chassis: commandBuffer: "VUID-vkCmdBeginTransformFeedbackEXT-commonparent"
 
     if ((counterBufferCount > 0) && (pCounterBuffers)) {
-        for (uint32_t index0 = 0; index0 < counterBufferCount; ++index0) {
-            skip |= ValidateObject(pCounterBuffers[index0], kVulkanObjectTypeBuffer, true,
-                                   "VUID-vkCmdBeginTransformFeedbackEXT-counterBufferCount-02607",
-                                   "VUID-vkCmdBeginTransformFeedbackEXT-commonparent",
-                                   error_obj.location.dot(Field::pCounterBuffers, index0));
-        }
+        skip |= ValidateObjectArray(pCounterBuffers, counterBufferCount, kVulkanObjectTypeBuffer, true,
+                                    "VUID-vkCmdBeginTransformFeedbackEXT-counterBufferCount-02607",
+                                    "VUID-vkCmdBeginTransformFeedbackEXT-commonparent", error_obj.location, Field::pCounterBuffers);
     }
 
     return skip;
@@ -4547,12 +4463,9 @@ bool ObjectLifetimes::PreCallValidateCmdEndTransformFeedbackEXT(VkCommandBuffer
     // Checked by chassis: commandBuffer: "VUID-vkCmdEndTransformFeedbackEXT-commonparent"
 
     if ((counterBufferCount > 0) && (pCounterBuffers)) {
-        for (uint32_t index0 = 0; index0 < counterBufferCount; ++index0) {
-            skip |= ValidateObject(pCounterBuffers[index0], kVulkanObjectTypeBuffer, true,
-                                   "VUID-vkCmdEndTransformFeedbackEXT-counterBufferCount-02608",
-                                   "VUID-vkCmdEndTransformFeedbackEXT-commonparent",
-                                   error_obj.location.dot(Field::pCounterBuffers, index0));
-        }
+        skip |= ValidateObjectArray(pCounterBuffers, counterBufferCount, kVulkanObjectTypeBuffer, true,
+                                    "VUID-vkCmdEndTransformFeedbackEXT-counterBufferCount-02608",
+                                    "VUID-vkCmdEndTransformFeedbackEXT-commonparent", error_obj.location, Field::pCounterBuffers);
     }
 
     return skip;
@@ -4940,11 +4853,9 @@ bool ObjectLifetimes::PreCallValidateSetHdrMetadataEXT(VkDevice device, uint32_t
     // Checked by chassis: device: "VUID-vkSetHdrMetadataEXT-device-parameter"
 
     if ((swapchainCount > 0) && (pSwapchains)) {
-        for (uint32_t index0 = 0; index0 < swapchainCount; ++index0) {
-            skip |= ValidateObject(pSwapchains[index0], kVulkanObjectTypeSwapchainKHR, false,
-                                   "VUID-vkSetHdrMetadataEXT-pSwapchains-parameter", "VUID-vkSetHdrMetadataEXT-pSwapchains-parent",
-                                   error_obj.location.dot(Field::pSwapchains, index0));
-        }
+        skip |= ValidateObjectArray(pSwapchains, swapchainCount, kVulkanObjectTypeSwapchainKHR, false,
+                                    "VUID-vkSetHdrMetadataEXT-pSwapchains-parameter", "VUID-vkSetHdrMetadataEXT-pSwapchains-parent",
+                                    error_obj.location, Field::pSwapchains);
     }
 
     return skip;
@@ -5085,11 +4996,10 @@ bool ObjectLifetimes::PreCallValidateCreateExecutionGraphPipelinesAMDX(VkDevice
                 [[maybe_unused]] const Location pLibraryInfo_loc = index0_loc.dot(Field::pLibraryInfo);
 
                 if ((pCreateInfos[index0].pLibraryInfo->libraryCount > 0) && (pCreateInfos[index0].pLibraryInfo->pLibraries)) {
-                    for (uint32_t index2 = 0; index2 < pCreateInfos[index0].pLibraryInfo->libraryCount; ++index2) {
-                        skip |= ValidateObject(pCreateInfos[index0].pLibraryInfo->pLibraries[index2], kVulkanObjectTypePipeline,
-                                               false, "VUID-VkPipelineLibraryCreateInfoKHR-pLibraries-parameter", kVUIDUndefined,
-                                               pLibraryInfo_loc.dot(Field::pLibraries, index2));
-                    }
+                    skip |= ValidateObjectArray(pCreateInfos[index0].pLibraryInfo->pLibraries,
+                                                pCreateInfos[index0].pLibraryInfo->libraryCount, kVulkanObjectTypePipeline, false,
+                                                "VUID-VkPipelineLibraryCreateInfoKHR-pLibraries-parameter", kVUIDUndefined,
+                                                pLibraryInfo_loc, Field::pLibraries);
                 }
             }
             skip |= ValidateObject(pCreateInfos[index0].layout, kVulkanObjectTypePipelineLayout, false,
@@ -5216,12 +5126,9 @@ bool ObjectLifetimes::PreCallValidateMergeValidationCachesEXT(VkDevice device, V
                        "VUID-vkMergeValidationCachesEXT-dstCache-parent", error_obj.location.dot(Field::dstCache));
 
     if ((srcCacheCount > 0) && (pSrcCaches)) {
-        for (uint32_t index0 = 0; index0 < srcCacheCount; ++index0) {
-            skip |= ValidateObject(pSrcCaches[index0], kVulkanObjectTypeValidationCacheEXT, false,
-                                   "VUID-vkMergeValidationCachesEXT-pSrcCaches-parameter",
-                                   "VUID-vkMergeValidationCachesEXT-pSrcCaches-parent",
-                                   error_obj.location.dot(Field::pSrcCaches, index0));
-        }
+        skip |= ValidateObjectArray(pSrcCaches, srcCacheCount, kVulkanObjectTypeValidationCacheEXT, false,
+                                    "VUID-vkMergeValidationCachesEXT-pSrcCaches-parameter",
+                                    "VUID-vkMergeValidationCachesEXT-pSrcCaches-parent", error_obj.location, Field::pSrcCaches);
     }
 
     return skip;
@@ -5542,12 +5449,10 @@ bool ObjectLifetimes::PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(
     // Checked by chassis: commandBuffer: "VUID-vkCmdWriteAccelerationStructuresPropertiesNV-commonparent"
 
     if ((accelerationStructureCount > 0) && (pAccelerationStructures)) {
-        for (uint32_t index0 = 0; index0 < accelerationStructureCount; ++index0) {
-            skip |= ValidateObject(pAccelerationStructures[index0], kVulkanObjectTypeAccelerationStructureNV, false,
-                                   "VUID-vkCmdWriteAccelerationStructuresPropertiesNV-pAccelerationStructures-parameter",
-                                   "VUID-vkCmdWriteAccelerationStructuresPropertiesNV-commonparent",
-                                   error_obj.location.dot(Field::pAccelerationStructures, index0));
-        }
+        skip |= ValidateObjectArray(pAccelerationStructures, accelerationStructureCount, kVulkanObjectTypeAccelerationStructureNV,
+                                    false, "VUID-vkCmdWriteAccelerationStructuresPropertiesNV-pAccelerationStructures-parameter",
+                                    "VUID-vkCmdWriteAccelerationStructuresPropertiesNV-commonparent", error_obj.location,
+                                    Field::pAccelerationStructures);
     }
     skip |= ValidateObject(
         queryPool, kVulkanObjectTypeQueryPool, false, "VUID-vkCmdWriteAccelerationStructuresPropertiesNV-queryPool-parameter",
@@ -6814,11 +6719,9 @@ bool ObjectLifetimes::PreCallValidateWriteMicromapsPropertiesEXT(VkDevice device
     // Checked by chassis: device: "VUID-vkWriteMicromapsPropertiesEXT-device-parameter"
 
     if ((micromapCount > 0) && (pMicromaps)) {
-        for (uint32_t index0 = 0; index0 < micromapCount; ++index0) {
-            skip |= ValidateObject(
-                pMicromaps[index0], kVulkanObjectTypeMicromapEXT, false, "VUID-vkWriteMicromapsPropertiesEXT-pMicromaps-parameter",
-                "VUID-vkWriteMicromapsPropertiesEXT-pMicromaps-parent", error_obj.location.dot(Field::pMicromaps, index0));
-        }
+        skip |= ValidateObjectArray(pMicromaps, micromapCount, kVulkanObjectTypeMicromapEXT, false,
+                                    "VUID-vkWriteMicromapsPropertiesEXT-pMicromaps-parameter",
+                                    "VUID-vkWriteMicromapsPropertiesEXT-pMicromaps-parent", error_obj.location, Field::pMicromaps);
     }
 
     return skip;
@@ -6876,12 +6779,9 @@ bool ObjectLifetimes::PreCallValidateCmdWriteMicromapsPropertiesEXT(VkCommandBuf
     // Checked by chassis: commandBuffer: "VUID-vkCmdWriteMicromapsPropertiesEXT-commonparent"
 
     if ((micromapCount > 0) && (pMicromaps)) {
-        for (uint32_t index0 = 0; index0 < micromapCount; ++index0) {
-            skip |= ValidateObject(pMicromaps[index0], kVulkanObjectTypeMicromapEXT, false,
-                                   "VUID-vkCmdWriteMicromapsPropertiesEXT-pMicromaps-parameter",
-                                   "VUID-vkCmdWriteMicromapsPropertiesEXT-commonparent",
-                                   error_obj.location.dot(Field::pMicromaps, index0));
-        }
+        skip |= ValidateObjectArray(pMicromaps, micromapCount, kVulkanObjectTypeMicromapEXT, false,
+                                    "VUID-vkCmdWriteMicromapsPropertiesEXT-pMicromaps-parameter",
+                                    "VUID-vkCmdWriteMicromapsPropertiesEXT-commonparent", error_obj.location, Field::pMicromaps);
     }
     skip |=
         ValidateObject(queryPool, kVulkanObjectTypeQueryPool, false, "VUID-vkCmdWriteMicromapsPropertiesEXT-queryPool-parameter",
@@ -7247,11 +7147,10 @@ bool ObjectLifetimes::PreCallValidateCreateShadersEXT(VkDevice device, uint32_t
             [[maybe_unused]] const Location index0_loc = error_obj.location.dot(Field::pCreateInfos, index0);
 
             if ((pCreateInfos[index0].setLayoutCount > 0) && (pCreateInfos[index0].pSetLayouts)) {
-                for (uint32_t index1 = 0; index1 < pCreateInfos[index0].setLayoutCount; ++index1) {
-                    skip |= ValidateObject(pCreateInfos[index0].pSetLayouts[index1], kVulkanObjectTypeDescriptorSetLayout, false,
-                                           "VUID-VkShaderCreateInfoEXT-pSetLayouts-parameter", kVUIDUndefined,
-                                           index0_loc.dot(Field::pSetLayouts, index1));
-                }
+                skip |= ValidateObjectArray(pCreateInfos[index0].pSetLayouts, pCreateInfos[index0].setLayoutCount,
+                                            kVulkanObjectTypeDescriptorSetLayout, false,
+                                            "VUID-VkShaderCreateInfoEXT-pSetLayouts-parameter", kVUIDUndefined, index0_loc,
+                                            Field::pSetLayouts);
             }
         }
     }
@@ -7567,12 +7466,10 @@ bool ObjectLifetimes::PreCallValidateWriteAccelerationStructuresPropertiesKHR(
     // Checked by chassis: device: "VUID-vkWriteAccelerationStructuresPropertiesKHR-device-parameter"
 
     if ((accelerationStructureCount > 0) && (pAccelerationStructures)) {
-        for (uint32_t index0 = 0; index0 < accelerationStructureCount; ++index0) {
-            skip |= ValidateObject(pAccelerationStructures[index0], kVulkanObjectTypeAccelerationStructureKHR, false,
-                                   "VUID-vkWriteAccelerationStructuresPropertiesKHR-pAccelerationStructures-parameter",
-                                   "VUID-vkWriteAccelerationStructuresPropertiesKHR-pAccelerationStructures-parent",
-                                   error_obj.location.dot(Field::pAccelerationStructures, index0));
-        }
+        skip |= ValidateObjectArray(pAccelerationStructures, accelerationStructureCount, kVulkanObjectTypeAccelerationStructureKHR,
+                                    false, "VUID-vkWriteAccelerationStructuresPropertiesKHR-pAccelerationStructures-parameter",
+                                    "VUID-vkWriteAccelerationStructuresPropertiesKHR-pAccelerationStructures-parent",
+                                    error_obj.location, Field::pAccelerationStructures);
     }
 
     return skip;
@@ -7646,12 +7543,10 @@ bool ObjectLifetimes::PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR
     // Checked by chassis: commandBuffer: "VUID-vkCmdWriteAccelerationStructuresPropertiesKHR-commonparent"
 
     if ((accelerationStructureCount > 0) && (pAccelerationStructures)) {
-        for (uint32_t index0 = 0; index0 < accelerationStructureCount; ++index0) {
-            skip |= ValidateObject(pAccelerationStructures[index0], kVulkanObjectTypeAccelerationStructureKHR, false,
-                                   "VUID-vkCmdWriteAccelerationStructuresPropertiesKHR-pAccelerationStructures-parameter",
-                                   "VUID-vkCmdWriteAccelerationStructuresPropertiesKHR-commonparent",
-                                   error_obj.location.dot(Field::pAccelerationStructures, index0));
-        }
+        skip |= ValidateObjectArray(pAccelerationStructures, accelerationStructureCount, kVulkanObjectTypeAccelerationStructureKHR,
+                                    false, "VUID-vkCmdWriteAccelerationStructuresPropertiesKHR-pAccelerationStructures-parameter",
+                                    "VUID-vkCmdWriteAccelerationStructuresPropertiesKHR-commonparent", error_obj.location,
+                                    Field::pAccelerationStructures);
     }
     skip |= ValidateObject(
         queryPool, kVulkanObjectTypeQueryPool, false, "VUID-vkCmdWriteAccelerationStructuresPropertiesKHR-queryPool-parameter",
@@ -272,6 +272,7 @@ typedef struct _vuid_spec_text_pair {{
 \n''')
 
     vuid_list = list(val_json.all_vuids)
+    # DebugReport::LogMsg binary searches the table, it must stay sorted by VUID
     vuid_list.sort()
     minor_version = int(val_json.api_version.split('.')[1])
 
@@ -187,22 +187,32 @@ extern const uint32_t {name}[];
         print(source, end="", file=f)
 
 
+def git_hash(path):
+    result = subprocess.run(["git", "hash-object", path], capture_output=True, text=True)
+    object_hash = result.stdout.rstrip('\n')
+
+    try:
+        int(object_hash, 16)
+    except ValueError:
+        raise ValueError(f'git hash of {path} ({object_hash}) must be a SHA1 hash.')
+    if len(object_hash) != 40:
+        raise ValueError(f'git hash of {path} ({object_hash}) must be a SHA1 hash.')
+    return object_hash
+
 def write_inst_hash(generate_shaders, outdir=None):
     # Build a hash of the git hash for all instrumentation shaders
     hash_string = ''
     for shader in generate_shaders:
         if not os.path.basename(shader).startswith('inst_'):
             continue
-        result = subprocess.run(["git", "hash-object", shader], capture_output=True, text=True)
-        git_hash = result.stdout.rstrip('\n')
+        hash_string += git_hash(shader)
 
-        try:
-            int(git_hash, 16)
-        except ValueError:
-            raise ValueError(f'value for INST_SHADER_GIT_HASH ({git_hash}) must be a SHA1 hash.')
-        if len(git_hash) != 40:
-            raise ValueError(f'value for INST_SHADER_GIT_HASH ({git_hash}) must be a SHA1 hash.')
-        hash_string += git_hash
+    # The passes change the instrumented code as much as the shaders they link, the instrumented shader cache needs both
+    pass_hash_string = ''
+    pass_dir = common_ci.RepoRelative('layers/gpu_validation/spirv')
+    for filename in sorted(os.listdir(pass_dir)):
+        if filename.split(".")[-1] in ['cpp', 'h']:
+            pass_hash_string += git_hash(os.path.join(pass_dir, filename))
 
     out = []
     out.append(f'''
@@ -234,6 +244,7 @@ def write_inst_hash(generate_shaders, outdir=None):
 ''')
 
     out.append(f'#define INST_SHADER_GIT_HASH "{hashlib.sha1(hash_string.encode("utf-8")).hexdigest()}"\n')
+    out.append(f'#define INST_PASS_GIT_HASH "{hashlib.sha1(pass_hash_string.encode("utf-8")).hexdigest()}"\n')
 
     if outdir:
       out_file = os.path.join(outdir, 'layers/vulkan/generated')
@@ -136,6 +136,11 @@ void ValidationObject::InitObjectDispatchVectors() {
                                 typeid(&debug_printf::Validator::name), \\
                                 typeid(&SyncValidator::name));
 
+#define BUILD_PASSTHROUGH_FLAG(name) \\
+    passthrough_commands[InterceptCommandId ## name] = intercept_vectors[InterceptIdPreCallValidate ## name].empty() && \\
+                                                       intercept_vectors[InterceptIdPreCallRecord ## name].empty() && \\
+                                                       intercept_vectors[InterceptIdPostCallRecord ## name].empty();
+
     auto init_object_dispatch_vector = [this](InterceptId id,
                                               const std::type_info& vo_typeid,
                                               const std::type_info& tt_typeid,
@@ -185,6 +190,7 @@ void ValidationObject::InitObjectDispatchVectors() {
 // clang-format on
 
     intercept_vectors.resize(InterceptIdCount);
+    passthrough_commands.resize(InterceptCommandIdCount);
 '''
 
 
@@ -217,6 +223,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
         'vkCreateShadersEXT',
         'vkAllocateDescriptorSets',
         'vkCreateBuffer',
+        'vkQueueSubmit',
+        'vkQueueSubmit2',
+        'vkQueueSubmit2KHR',
         # ValidationCache functions do not get dispatched
         'vkCreateValidationCacheEXT',
         'vkDestroyValidationCacheEXT',
@@ -305,6 +314,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "vk_layer_config.h"
             #include "layer_options.h"
             #include "containers/custom_containers.h"
+            #include "containers/handle_table.h"
             #include "error_message/logging.h"
             #include "error_message/error_location.h"
             #include "error_message/record_object.h"
@@ -315,21 +325,6 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "vk_extension_helper.h"
             #include "gpu_validation/gpu_settings.h"
 
-            extern std::atomic<uint64_t> global_unique_id;
-
-            // To avoid re-hashing unique ids on each use, we precompute the hash and store the
-            // hash's LSBs in the high 24 bits.
-            struct HashedUint64 {
-                static const int HASHED_UINT64_SHIFT = 40;
-                size_t operator()(const uint64_t& t) const { return t >> HASHED_UINT64_SHIFT; }
-
-                static uint64_t hash(uint64_t id) {
-                    uint64_t h = (uint64_t)vvl::hash<uint64_t>()(id);
-                    id |= h << HASHED_UINT64_SHIFT;
-                    return id;
-                }
-            };
-
             namespace chassis {
                 struct CreateGraphicsPipelines;
                 struct CreateComputePipelines;
@@ -339,6 +334,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 struct ShaderObject;
                 struct CreatePipelineLayout;
                 struct CreateBuffer;
+                struct QueueSubmit;
+                struct QueueSubmit2;
             }  // namespace chassis
 
             namespace vvl {
@@ -350,7 +347,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             // Each chassis layer will need to track its own state
             using PipelineStates = std::vector<std::shared_ptr<vvl::Pipeline>>;
 
-            extern vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            extern vvl::concurrent_handle_table unique_id_mapping;
 
             VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char* funcName);\n
             ''')
@@ -411,6 +408,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 }
 
                 std::vector<std::vector<ValidationObject*>> intercept_vectors;
+                // Indexed by InterceptCommandId, set for the commands which no validation object intercepts at all
+                std::vector<bool> passthrough_commands;
 
                 VkLayerInstanceDispatchTable instance_dispatch_table;
                 VkLayerDispatchTable device_dispatch_table;
@@ -422,6 +421,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool fine_grained_locking{true};
                 GpuAVSettings gpuav_settings = {};
                 DebugPrintfSettings printf_settings = {};
+                SyncValSettings syncval_settings = {};
 
                 VkInstance instance = VK_NULL_HANDLE;
                 VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -591,10 +591,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 template <typename HandleType>
                 HandleType WrapNew(HandleType new_created_handle) {
                     if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
-                    auto unique_id = global_unique_id++;
-                    unique_id = HashedUint64::hash(unique_id);
+                    const uint64_t unique_id = unique_id_mapping.insert(CastToUint64(new_created_handle));
                     assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
-                    unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
                     return (HandleType)unique_id;
                 }
 
@@ -710,6 +708,17 @@ class LayerChassisOutputGenerator(BaseGenerator):
             PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj);
         };
 
+        // Allow command buffers to be added to the batches of QueueSubmit
+        virtual void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence, const RecordObject& record_obj, chassis::QueueSubmit& chassis_state) {
+            PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, chassis::QueueSubmit2& chassis_state) {
+            PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+        };
+        virtual void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence, const RecordObject& record_obj, chassis::QueueSubmit2& chassis_state) {
+            PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj);
+        };
+
         // Modify a parameter to CreateDevice
         virtual void PreCallRecordCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, const RecordObject& record_obj, vku::safe_VkDeviceCreateInfo *modified_create_info) {
             PreCallRecordCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice, record_obj);
@@ -737,11 +746,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 
-            // Global unique object identifier.
-            std::atomic<uint64_t> global_unique_id(1ULL);
-            // Map uniqueID to actual object handle. Accesses to the map itself are
-            // internally synchronized.
-            vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+            // Map uniqueID to actual object handle. The unique IDs are handed out by the table itself and accesses
+            // to the table are internally synchronized.
+            vvl::concurrent_handle_table unique_id_mapping;
 
             bool wrap_handles = true;
 
@@ -1052,6 +1059,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 bool lock_setting;
                 GpuAVSettings local_gpuav_settings = {};
                 DebugPrintfSettings local_printf_settings = {};
+                SyncValSettings local_syncval_settings = {};
                 ConfigAndEnvSettings config_and_env_settings_data{OBJECT_LAYER_DESCRIPTION,
                                                                 pCreateInfo,
                                                                 local_enables,
@@ -1060,7 +1068,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                                                 &debug_report->duplicate_message_limit,
                                                                 &lock_setting,
                                                                 &local_gpuav_settings,
-                                                                &local_printf_settings};
+                                                                &local_printf_settings,
+                                                                &local_syncval_settings};
                 ProcessConfigAndEnvSettings(&config_and_env_settings_data);
                 LayerDebugMessengerActions(debug_report, OBJECT_LAYER_DESCRIPTION);
 
@@ -1121,6 +1130,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 framework->fine_grained_locking = lock_setting;
                 framework->gpuav_settings = local_gpuav_settings;
                 framework->printf_settings = local_printf_settings;
+                framework->syncval_settings = local_syncval_settings;
 
                 framework->instance = *pInstance;
                 layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -1141,6 +1151,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     intercept->fine_grained_locking = framework->fine_grained_locking;
                     intercept->gpuav_settings = framework->gpuav_settings;
                     intercept->printf_settings = framework->printf_settings;
+                    intercept->syncval_settings = framework->syncval_settings;
                     intercept->instance = *pInstance;
                 }
 
@@ -1270,6 +1281,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     object->fine_grained_locking = instance_interceptor->fine_grained_locking;
                     object->gpuav_settings = instance_interceptor->gpuav_settings;
                     object->printf_settings = instance_interceptor->printf_settings;
+                    object->syncval_settings = instance_interceptor->syncval_settings;
                     object->instance_dispatch_table = instance_interceptor->instance_dispatch_table;
                     object->instance_extensions = instance_interceptor->instance_extensions;
                     object->device_extensions = device_interceptor->device_extensions;
@@ -1320,6 +1332,9 @@ class LayerChassisOutputGenerator(BaseGenerator):
                     delete *item;
                 }
                 FreeLayerDataPtr(key, layer_data_map);
+
+                // Everything reported about the device is in the log output by the time vkDestroyDevice returns
+                instance_interceptor->debug_report->FlushLogOutput();
             }
 
             // Special-case APIs for which core_validation needs custom parameter lists and/or modifies parameters
@@ -1650,6 +1665,109 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 return result;
             }
 
+            // These APIs let a layer add command buffers to the batches
+            VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) {
+                auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+                bool skip = false;
+                ErrorObject error_obj(vvl::Func::vkQueueSubmit, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
+
+                chassis::QueueSubmit chassis_state{};
+                chassis_state.pSubmits = pSubmits;
+
+                for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->ReadLock();
+                    skip |= intercept->PreCallValidateQueueSubmit(queue, submitCount, pSubmits, fence, error_obj);
+                    if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+                }
+
+                RecordObject record_obj(vvl::Func::vkQueueSubmit);
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->WriteLock();
+                    intercept->PreCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj, chassis_state);
+                }
+
+                VkResult result = DispatchQueueSubmit(queue, submitCount, chassis_state.pSubmits, fence);
+                record_obj.result = result;
+
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->WriteLock();
+
+                    if (result == VK_ERROR_DEVICE_LOST) {
+                        intercept->is_device_lost = true;
+                    }
+                    intercept->PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, record_obj);
+                }
+                return result;
+            }
+
+            VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+                auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+                bool skip = false;
+                ErrorObject error_obj(vvl::Func::vkQueueSubmit2, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
+
+                chassis::QueueSubmit2 chassis_state{};
+                chassis_state.pSubmits = pSubmits;
+
+                for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->ReadLock();
+                    skip |= intercept->PreCallValidateQueueSubmit2(queue, submitCount, pSubmits, fence, error_obj);
+                    if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+                }
+
+                RecordObject record_obj(vvl::Func::vkQueueSubmit2);
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->WriteLock();
+                    intercept->PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj, chassis_state);
+                }
+
+                VkResult result = DispatchQueueSubmit2(queue, submitCount, chassis_state.pSubmits, fence);
+                record_obj.result = result;
+
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->WriteLock();
+
+                    if (result == VK_ERROR_DEVICE_LOST) {
+                        intercept->is_device_lost = true;
+                    }
+                    intercept->PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, record_obj);
+                }
+                return result;
+            }
+
+            VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+                auto layer_data = GetLayerDataPtr(GetDispatchKey(queue), layer_data_map);
+                bool skip = false;
+                ErrorObject error_obj(vvl::Func::vkQueueSubmit2KHR, VulkanTypedHandle(queue, kVulkanObjectTypeQueue));
+
+                chassis::QueueSubmit2 chassis_state{};
+                chassis_state.pSubmits = pSubmits;
+
+                for (const ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->ReadLock();
+                    skip |= intercept->PreCallValidateQueueSubmit2KHR(queue, submitCount, pSubmits, fence, error_obj);
+                    if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+                }
+
+                RecordObject record_obj(vvl::Func::vkQueueSubmit2KHR);
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->WriteLock();
+                    intercept->PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj, chassis_state);
+                }
+
+                VkResult result = DispatchQueueSubmit2KHR(queue, submitCount, chassis_state.pSubmits, fence);
+                record_obj.result = result;
+
+                for (ValidationObject* intercept : layer_data->object_dispatch) {
+                    auto lock = intercept->WriteLock();
+
+                    if (result == VK_ERROR_DEVICE_LOST) {
+                        intercept->is_device_lost = true;
+                    }
+                    intercept->PostCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, record_obj);
+                }
+                return result;
+            }
+
             // Handle tooling queries manually as this is a request for layer information
             static const VkPhysicalDeviceToolPropertiesEXT khronos_layer_tool_props = {
                 VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES_EXT,
@@ -1791,6 +1909,21 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 return VK_SUCCESS;
             }
             ''')
+        # Debug utils calls made by the chassis itself before/after the down-chain call
+        pre_dispatch_debug_utils_functions = {
+            'vkDebugMarkerSetObjectNameEXT' : 'layer_data->debug_report->SetMarkerObjectName(pNameInfo);',
+            'vkSetDebugUtilsObjectNameEXT' : 'layer_data->debug_report->SetUtilsObjectName(pNameInfo);',
+            'vkQueueBeginDebugUtilsLabelEXT' : 'layer_data->debug_report->BeginQueueDebugUtilsLabel(queue, pLabelInfo);',
+            'vkQueueInsertDebugUtilsLabelEXT' : 'layer_data->debug_report->InsertQueueDebugUtilsLabel(queue, pLabelInfo);',
+        }
+        post_dispatch_debug_utils_functions = {
+            'vkQueueEndDebugUtilsLabelEXT' : 'layer_data->debug_report->EndQueueDebugUtilsLabel(queue);',
+            'vkCreateDebugReportCallbackEXT' : 'LayerCreateReportCallback(layer_data->debug_report, false, pCreateInfo, pCallback);',
+            'vkDestroyDebugReportCallbackEXT' : 'LayerDestroyCallback(layer_data->debug_report, callback);',
+            'vkCreateDebugUtilsMessengerEXT' : 'LayerCreateMessengerCallback(layer_data->debug_report, false, pCreateInfo, pMessenger);',
+            'vkDestroyDebugUtilsMessengerEXT' : 'LayerDestroyCallback(layer_data->debug_report, messenger);',
+        }
+
         guard_helper = PlatformGuardHelper()
 
         for command in [x for x in self.vk.commands.values() if x.name not in self.ignore_functions and x.name not in self.manual_functions]:
@@ -1803,6 +1936,14 @@ class LayerChassisOutputGenerator(BaseGenerator):
             # Setup common to call wrappers. First parameter is always dispatchable
             out.append(f'auto layer_data = GetLayerDataPtr(GetDispatchKey({command.params[0].name}), layer_data_map);\n')
 
+            # Commands no validation object cares about skip the ErrorObject/RecordObject setup and the intercept loops
+            if (not command.instance and command.name not in pre_dispatch_debug_utils_functions and
+                    command.name not in post_dispatch_debug_utils_functions):
+                out.append(f'''
+                    if (layer_data->passthrough_commands[InterceptCommandId{command.name[2:]}]) {{
+                        return {command.name.replace("vk", "Dispatch")}({paramsList});
+                    }}\n''')
+
             # Declare result variable, if any.
             return_map = {
                 'PFN_vkVoidFunction': 'return nullptr;',
@@ -1843,12 +1984,6 @@ class LayerChassisOutputGenerator(BaseGenerator):
             }}\n''')
 
             # Insert pre-dispatch debug utils function call
-            pre_dispatch_debug_utils_functions = {
-                'vkDebugMarkerSetObjectNameEXT' : 'layer_data->debug_report->SetMarkerObjectName(pNameInfo);',
-                'vkSetDebugUtilsObjectNameEXT' : 'layer_data->debug_report->SetUtilsObjectName(pNameInfo);',
-                'vkQueueBeginDebugUtilsLabelEXT' : 'layer_data->debug_report->BeginQueueDebugUtilsLabel(queue, pLabelInfo);',
-                'vkQueueInsertDebugUtilsLabelEXT' : 'layer_data->debug_report->InsertQueueDebugUtilsLabel(queue, pLabelInfo);',
-            }
             if command.name in pre_dispatch_debug_utils_functions:
                 out.append(f'    {pre_dispatch_debug_utils_functions[command.name]}\n')
 
@@ -1858,13 +1993,6 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
 
             # Insert post-dispatch debug utils function call
-            post_dispatch_debug_utils_functions = {
-                'vkQueueEndDebugUtilsLabelEXT' : 'layer_data->debug_report->EndQueueDebugUtilsLabel(queue);',
-                'vkCreateDebugReportCallbackEXT' : 'LayerCreateReportCallback(layer_data->debug_report, false, pCreateInfo, pCallback);',
-                'vkDestroyDebugReportCallbackEXT' : 'LayerDestroyCallback(layer_data->debug_report, callback);',
-                'vkCreateDebugUtilsMessengerEXT' : 'LayerCreateMessengerCallback(layer_data->debug_report, false, pCreateInfo, pMessenger);',
-                'vkDestroyDebugUtilsMessengerEXT' : 'LayerDestroyCallback(layer_data->debug_report, messenger);',
-            }
             if command.name in post_dispatch_debug_utils_functions:
                 out.append(f'    {post_dispatch_debug_utils_functions[command.name]}\n')
 
@@ -2017,6 +2145,14 @@ const vvl::unordered_map<std::string, function_data> name_to_funcptr_map = {
         out.append('    InterceptIdCount,\n')
         out.append('} InterceptId;\n')
 
+        out.append('\n')
+        out.append('// Commands which are passed straight down the chain when no validation object intercepts them\n')
+        out.append('typedef enum InterceptCommandId{\n')
+        for command in [x for x in self.vk.commands.values() if not x.instance and x.name not in self.manual_functions]:
+            out.append(f'    InterceptCommandId{command.name[2:]},\n')
+        out.append('    InterceptCommandIdCount,\n')
+        out.append('} InterceptCommandId;\n')
+
         out.append(APISpecific.genInitObjectDispatchVectorSource(self.targetApiName))
 
         guard_helper = PlatformGuardHelper()
@@ -2025,6 +2161,7 @@ const vvl::unordered_map<std::string, function_data> name_to_funcptr_map = {
             out.append(f'    BUILD_DISPATCH_VECTOR(PreCallValidate{command.name[2:]});\n')
             out.append(f'    BUILD_DISPATCH_VECTOR(PreCallRecord{command.name[2:]});\n')
             out.append(f'    BUILD_DISPATCH_VECTOR(PostCallRecord{command.name[2:]});\n')
+            out.append(f'    BUILD_PASSTHROUGH_FLAG({command.name[2:]});\n')
         out.extend(guard_helper.add_guard(None))
         out.append('}\n')
         self.write("".join(out))
@@ -735,13 +735,10 @@ bool ObjectLifetimes::ReportUndestroyedDeviceObjects(VkDevice device, const Loca
                     parent_object_type = ", kVulkanObjectTypeDevice"
 
                 if member.length:
-                    location = f'{errorLoc}.dot(Field::{member.name}, {index})'
                     countName = f'{prefix}{member.length}'
                     pre_call_validate += f'''
                         if (({countName} > 0) && ({prefix}{member.name})) {{
-                            for (uint32_t {index} = 0; {index} < {countName}; ++{index}) {{
-                                skip |= ValidateObject({prefix}{member.name}[{index}], kVulkanObjectType{member.type[2:]}, {nullAllowed}, {param_vuid}, {parent_vuid}, {location}{parent_object_type});
-                            }}
+                            skip |= ValidateObjectArray({prefix}{member.name}, {countName}, kVulkanObjectType{member.type[2:]}, {nullAllowed}, {param_vuid}, {parent_vuid}, {errorLoc}, Field::{member.name}{parent_object_type});
                         }}\n'''
                 elif 'basePipelineHandle' in member.name:
                     pre_call_validate += f'if (({prefix}flags & VK_PIPELINE_CREATE_DERIVATIVE_BIT) && ({prefix}basePipelineIndex == -1))\n'
@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "benchmark_device.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include "generated/vk_function_pointers.h"
+
+static void Check(VkResult result, const char *call) {
+    if (result != VK_SUCCESS) {
+        fprintf(stderr, "%s failed with %d, the benchmarks need the validation layer and a working (mock) ICD\n", call, result);
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+static std::mutex devices_lock;
+static std::map<std::string, std::unique_ptr<BenchmarkDevice>> devices;
+
+BenchmarkDevice &BenchmarkDevice::Get(const LayerConfig &config) {
+    std::lock_guard<std::mutex> guard(devices_lock);
+    auto &device = devices[config.name];
+    if (!device) {
+        device.reset(new BenchmarkDevice(config));
+    }
+    return *device;
+}
+
+bool BenchmarkDevice::DestroyAll() {
+    std::lock_guard<std::mutex> guard(devices_lock);
+    bool clean = true;
+    for (const auto &[name, device] : devices) {
+        if (device->ErrorCount() != 0) {
+            fprintf(stderr, "Configuration %s reported %u validation error(s)\n", name.c_str(), device->ErrorCount());
+            clean = false;
+        }
+    }
+    devices.clear();
+    return clean;
+}
+
+BenchmarkDevice::BenchmarkDevice(const LayerConfig &config) {
+    const char *layer_name = "VK_LAYER_KHRONOS_validation";
+    const VkBool32 validate_core = config.validate_core;
+    const VkBool32 thread_safety = config.thread_safety;
+    const VkBool32 object_lifetime = config.object_lifetime;
+    const VkBool32 stateless_param = config.stateless_param;
+    const VkBool32 unique_handles = config.unique_handles;
+    const VkBool32 validate_sync = config.validate_sync;
+    const VkBool32 check_shaders_caching = config.check_shaders_caching;
+    const VkLayerSettingEXT settings[] = {
+        {layer_name, "validate_core", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &validate_core},
+        {layer_name, "thread_safety", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &thread_safety},
+        {layer_name, "object_lifetime", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &object_lifetime},
+        {layer_name, "stateless_param", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &stateless_param},
+        {layer_name, "unique_handles", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &unique_handles},
+        {layer_name, "validate_sync", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &validate_sync},
+        {layer_name, "check_shaders_caching", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &check_shaders_caching},
+    };
+    VkLayerSettingsCreateInfoEXT settings_info = vku::InitStructHelper();
+    settings_info.settingCount = static_cast<uint32_t>(std::size(settings));
+    settings_info.pSettings = settings;
+
+    VkApplicationInfo app_info = vku::InitStructHelper();
+    app_info.pApplicationName = "vk_layer_benchmarks";
+    app_info.apiVersion = VK_API_VERSION_1_3;
+
+    const char *instance_extensions[] = {VK_EXT_DEBUG_UTILS_EXTENSION_NAME};
+    VkInstanceCreateInfo instance_ci = vku::InitStructHelper(&settings_info);
+    instance_ci.pApplicationInfo = &app_info;
+    instance_ci.enabledLayerCount = 1;
+    instance_ci.ppEnabledLayerNames = &layer_name;
+    instance_ci.enabledExtensionCount = static_cast<uint32_t>(std::size(instance_extensions));
+    instance_ci.ppEnabledExtensionNames = instance_extensions;
+    Check(vk::CreateInstance(&instance_ci, nullptr, &instance_), "vkCreateInstance");
+    vk::InitInstanceExtension(instance_, VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+
+    VkDebugUtilsMessengerCreateInfoEXT messenger_ci = vku::InitStructHelper();
+    messenger_ci.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    messenger_ci.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    messenger_ci.pfnUserCallback = MessengerCallback;
+    messenger_ci.pUserData = this;
+    Check(vk::CreateDebugUtilsMessengerEXT(instance_, &messenger_ci, nullptr, &messenger_), "vkCreateDebugUtilsMessengerEXT");
+
+    uint32_t physical_device_count = 1;
+    const VkResult enumerate_result = vk::EnumeratePhysicalDevices(instance_, &physical_device_count, &physical_device_);
+    if (enumerate_result != VK_INCOMPLETE) {
+        Check(enumerate_result, "vkEnumeratePhysicalDevices");
+    }
+    if (physical_device_count == 0) {
+        Check(VK_ERROR_INITIALIZATION_FAILED, "vkEnumeratePhysicalDevices");
+    }
+    vk::GetPhysicalDeviceMemoryProperties(physical_device_, &memory_properties_);
+
+    uint32_t queue_family_count = 0;
+    vk::GetPhysicalDeviceQueueFamilyProperties(physical_device_, &queue_family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+    vk::GetPhysicalDeviceQueueFamilyProperties(physical_device_, &queue_family_count, queue_families.data());
+    uint32_t queue_count = 0;
+    for (uint32_t i = 0; i < queue_family_count; ++i) {
+        const VkQueueFlags required = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT;
+        if ((queue_families[i].queueFlags & required) == required) {
+            queue_family_ = i;
+            queue_count = queue_families[i].queueCount;
+            break;
+        }
+    }
+    if (queue_count == 0) {
+        Check(VK_ERROR_FEATURE_NOT_PRESENT, "Finding a graphics and compute queue");
+    }
+
+    std::vector<float> priorities(queue_count, 1.0f);
+    VkDeviceQueueCreateInfo queue_ci = vku::InitStructHelper();
+    queue_ci.queueFamilyIndex = queue_family_;
+    queue_ci.queueCount = queue_count;
+    queue_ci.pQueuePriorities = priorities.data();
+
+    VkPhysicalDeviceVulkan12Features features12 = vku::InitStructHelper();
+    features12.timelineSemaphore = VK_TRUE;
+    // Bindless descriptor sets (descriptors.cpp)
+    features12.runtimeDescriptorArray = VK_TRUE;
+    features12.descriptorBindingPartiallyBound = VK_TRUE;
+    features12.descriptorBindingVariableDescriptorCount = VK_TRUE;
+    features12.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+    VkPhysicalDeviceVulkan13Features features13 = vku::InitStructHelper(&features12);
+    features13.synchronization2 = VK_TRUE;
+    VkDeviceCreateInfo device_ci = vku::InitStructHelper(&features13);
+    device_ci.queueCreateInfoCount = 1;
+    device_ci.pQueueCreateInfos = &queue_ci;
+    Check(vk::CreateDevice(physical_device_, &device_ci, nullptr, &device_), "vkCreateDevice");
+
+    queues_.resize(queue_count);
+    for (uint32_t i = 0; i < queue_count; ++i) {
+        vk::GetDeviceQueue(device_, queue_family_, i, &queues_[i]);
+    }
+}
+
+BenchmarkDevice::~BenchmarkDevice() {
+    vk::DeviceWaitIdle(device_);
+    for (VkShaderModule shader_module : shader_modules_) {
+        vk::DestroyShaderModule(device_, shader_module, nullptr);
+    }
+    for (VkImage image : images_) {
+        vk::DestroyImage(device_, image, nullptr);
+    }
+    for (VkBuffer buffer : buffers_) {
+        vk::DestroyBuffer(device_, buffer, nullptr);
+    }
+    for (VkDeviceMemory memory : memories_) {
+        vk::FreeMemory(device_, memory, nullptr);
+    }
+    vk::DestroyDevice(device_, nullptr);
+    vk::DestroyDebugUtilsMessengerEXT(instance_, messenger_, nullptr);
+    vk::DestroyInstance(instance_, nullptr);
+}
+
+void BenchmarkDevice::BindMemory(const VkMemoryRequirements &requirements, VkDeviceMemory &memory) {
+    VkMemoryAllocateInfo allocate_info = vku::InitStructHelper();
+    allocate_info.allocationSize = requirements.size;
+    allocate_info.memoryTypeIndex = memory_properties_.memoryTypeCount;
+    for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i) {
+        if (requirements.memoryTypeBits & (1u << i)) {
+            allocate_info.memoryTypeIndex = i;
+            break;
+        }
+    }
+    Check(vk::AllocateMemory(device_, &allocate_info, nullptr, &memory), "vkAllocateMemory");
+    {
+        std::lock_guard<std::mutex> guard(objects_lock_);
+        memories_.push_back(memory);
+    }
+}
+
+VkBuffer BenchmarkDevice::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage) {
+    VkBufferCreateInfo buffer_ci = vku::InitStructHelper();
+    buffer_ci.size = size;
+    buffer_ci.usage = usage;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    Check(vk::CreateBuffer(device_, &buffer_ci, nullptr, &buffer), "vkCreateBuffer");
+    {
+        std::lock_guard<std::mutex> guard(objects_lock_);
+        buffers_.push_back(buffer);
+    }
+
+    VkMemoryRequirements requirements;
+    vk::GetBufferMemoryRequirements(device_, buffer, &requirements);
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    BindMemory(requirements, memory);
+    Check(vk::BindBufferMemory(device_, buffer, memory, 0), "vkBindBufferMemory");
+    return buffer;
+}
+
+VkImage BenchmarkDevice::CreateImage(VkFormat format, uint32_t extent, uint32_t mip_levels, uint32_t array_layers,
+                                     VkImageUsageFlags usage) {
+    VkImageCreateInfo image_ci = vku::InitStructHelper();
+    image_ci.imageType = VK_IMAGE_TYPE_2D;
+    image_ci.format = format;
+    image_ci.extent = {extent, extent, 1};
+    image_ci.mipLevels = mip_levels;
+    image_ci.arrayLayers = array_layers;
+    image_ci.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_ci.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_ci.usage = usage;
+    image_ci.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkImage image = VK_NULL_HANDLE;
+    Check(vk::CreateImage(device_, &image_ci, nullptr, &image), "vkCreateImage");
+    {
+        std::lock_guard<std::mutex> guard(objects_lock_);
+        images_.push_back(image);
+    }
+
+    VkMemoryRequirements requirements;
+    vk::GetImageMemoryRequirements(device_, image, &requirements);
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    BindMemory(requirements, memory);
+    Check(vk::BindImageMemory(device_, image, memory, 0), "vkBindImageMemory");
+    return image;
+}
+
+VkBuffer BenchmarkDevice::SharedBuffer(VkDeviceSize size, VkBufferUsageFlags usage) {
+    std::lock_guard<std::mutex> guard(shared_buffer_lock_);
+    if (shared_buffer_ == VK_NULL_HANDLE) {
+        shared_buffer_ = CreateBuffer(size, usage);
+    }
+    return shared_buffer_;
+}
+
+VkShaderModuleCreateInfo ComputeShaderCreateInfo() {
+    // OpCapability Shader
+    // OpMemoryModel Logical GLSL450
+    // OpEntryPoint GLCompute %main "main"
+    // OpExecutionMode %main LocalSize 1 1 1
+    // %void = OpTypeVoid
+    // %fn = OpTypeFunction %void
+    // %main = OpFunction %void None %fn
+    // %label = OpLabel
+    // OpReturn
+    // OpFunctionEnd
+    static const uint32_t kSpirv[] = {
+        0x07230203, 0x00010000, 0x00000000, 0x00000005, 0x00000000,  // header, bound 5
+        0x00020011, 0x00000001,                                      // OpCapability
+        0x0003000E, 0x00000000, 0x00000001,                          // OpMemoryModel
+        0x0005000F, 0x00000005, 0x00000003, 0x6E69616D, 0x00000000,  // OpEntryPoint
+        0x00060010, 0x00000003, 0x00000011, 0x00000001, 0x00000001, 0x00000001,  // OpExecutionMode
+        0x00020013, 0x00000001,                                                  // OpTypeVoid
+        0x00030021, 0x00000002, 0x00000001,                                      // OpTypeFunction
+        0x00050036, 0x00000001, 0x00000003, 0x00000000, 0x00000002,              // OpFunction
+        0x000200F8, 0x00000004,                                                  // OpLabel
+        0x000100FD,                                                              // OpReturn
+        0x00010038,                                                              // OpFunctionEnd
+    };
+    VkShaderModuleCreateInfo module_ci = vku::InitStructHelper();
+    module_ci.codeSize = sizeof(kSpirv);
+    module_ci.pCode = kSpirv;
+    return module_ci;
+}
+
+VkShaderModuleCreateInfo StorageBufferComputeShaderCreateInfo() {
+    // OpCapability Shader
+    // OpMemoryModel Logical GLSL450
+    // OpEntryPoint GLCompute %main "main"
+    // OpExecutionMode %main LocalSize 1 1 1
+    // OpDecorate %block BufferBlock
+    // OpMemberDecorate %block 0 Offset 0
+    // OpDecorate %buffer DescriptorSet 0
+    // OpDecorate %buffer Binding 0
+    // %void = OpTypeVoid
+    // %fn = OpTypeFunction %void
+    // %uint = OpTypeInt 32 0
+    // %block = OpTypeStruct %uint
+    // %block_ptr = OpTypePointer Uniform %block
+    // %buffer = OpVariable %block_ptr Uniform
+    // %uint_0 = OpConstant %uint 0
+    // %uint_ptr = OpTypePointer Uniform %uint
+    // %main = OpFunction %void None %fn
+    // %label = OpLabel
+    // %member = OpAccessChain %uint_ptr %buffer %uint_0
+    // %value = OpLoad %uint %member
+    // OpReturn
+    // OpFunctionEnd
+    static const uint32_t kSpirv[] = {
+        0x07230203, 0x00010000, 0x00000000, 0x0000000D, 0x00000000,              // header, bound 13
+        0x00020011, 0x00000001,                                                  // OpCapability
+        0x0003000E, 0x00000000, 0x00000001,                                      // OpMemoryModel
+        0x0005000F, 0x00000005, 0x00000001, 0x6E69616D, 0x00000000,              // OpEntryPoint
+        0x00060010, 0x00000001, 0x00000011, 0x00000001, 0x00000001, 0x00000001,  // OpExecutionMode
+        0x00030047, 0x00000005, 0x00000003,                                      // OpDecorate BufferBlock
+        0x00050048, 0x00000005, 0x00000000, 0x00000023, 0x00000000,              // OpMemberDecorate Offset
+        0x00040047, 0x00000007, 0x00000022, 0x00000000,                          // OpDecorate DescriptorSet
+        0x00040047, 0x00000007, 0x00000021, 0x00000000,                          // OpDecorate Binding
+        0x00020013, 0x00000002,                                                  // OpTypeVoid
+        0x00030021, 0x00000003, 0x00000002,                                      // OpTypeFunction
+        0x00040015, 0x00000004, 0x00000020, 0x00000000,                          // OpTypeInt
+        0x0003001E, 0x00000005, 0x00000004,                                      // OpTypeStruct
+        0x00040020, 0x00000006, 0x00000002, 0x00000005,                          // OpTypePointer
+        0x0004003B, 0x00000006, 0x00000007, 0x00000002,                          // OpVariable
+        0x0004002B, 0x00000004, 0x00000008, 0x00000000,                          // OpConstant
+        0x00040020, 0x00000009, 0x00000002, 0x00000004,                          // OpTypePointer
+        0x00050036, 0x00000002, 0x00000001, 0x00000000, 0x00000003,              // OpFunction
+        0x000200F8, 0x0000000A,                                                  // OpLabel
+        0x00050041, 0x00000009, 0x0000000B, 0x00000007, 0x00000008,              // OpAccessChain
+        0x0004003D, 0x00000004, 0x0000000C, 0x0000000B,                          // OpLoad
+        0x000100FD,                                                              // OpReturn
+        0x00010038,                                                              // OpFunctionEnd
+    };
+    VkShaderModuleCreateInfo module_ci = vku::InitStructHelper();
+    module_ci.codeSize = sizeof(kSpirv);
+    module_ci.pCode = kSpirv;
+    return module_ci;
+}
+
+VkShaderModule BenchmarkDevice::CreateComputeShader() { return CreateShaderModule(ComputeShaderCreateInfo()); }
+
+VkShaderModule BenchmarkDevice::CreateStorageBufferComputeShader() {
+    return CreateShaderModule(StorageBufferComputeShaderCreateInfo());
+}
+
+VkShaderModule BenchmarkDevice::CreateShaderModule(const VkShaderModuleCreateInfo &module_ci) {
+    VkShaderModule shader_module = VK_NULL_HANDLE;
+    Check(vk::CreateShaderModule(device_, &module_ci, nullptr, &shader_module), "vkCreateShaderModule");
+    {
+        std::lock_guard<std::mutex> guard(objects_lock_);
+        shader_modules_.push_back(shader_module);
+    }
+    return shader_module;
+}
+
+VKAPI_ATTR VkBool32 VKAPI_CALL BenchmarkDevice::MessengerCallback(VkDebugUtilsMessageSeverityFlagBitsEXT,
+                                                                  VkDebugUtilsMessageTypeFlagsEXT,
+                                                                  const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                                  void *user_data) {
+    auto *device = static_cast<BenchmarkDevice *>(user_data);
+    // Only print the first few, a benchmark which triggers an error usually does so in every iteration
+    if (device->error_count_.fetch_add(1) < 8) {
+        fprintf(stderr, "%s\n", callback_data->pMessage);
+    }
+    return VK_FALSE;
+}
+
+CommandContext::CommandContext(BenchmarkDevice &device) : device_(device) {
+    VkCommandPoolCreateInfo pool_ci = vku::InitStructHelper();
+    pool_ci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_ci.queueFamilyIndex = device_.QueueFamily();
+    Check(vk::CreateCommandPool(device_.Device(), &pool_ci, nullptr, &pool_), "vkCreateCommandPool");
+
+    VkCommandBufferAllocateInfo allocate_info = vku::InitStructHelper();
+    allocate_info.commandPool = pool_;
+    allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate_info.commandBufferCount = 1;
+    Check(vk::AllocateCommandBuffers(device_.Device(), &allocate_info, &command_buffer_), "vkAllocateCommandBuffers");
+
+    VkFenceCreateInfo fence_ci = vku::InitStructHelper();
+    Check(vk::CreateFence(device_.Device(), &fence_ci, nullptr, &fence_), "vkCreateFence");
+}
+
+CommandContext::~CommandContext() {
+    vk::DestroyFence(device_.Device(), fence_, nullptr);
+    vk::DestroyCommandPool(device_.Device(), pool_, nullptr);
+}
+
+VkCommandBuffer CommandContext::Begin() {
+    VkCommandBufferBeginInfo begin_info = vku::InitStructHelper();
+    Check(vk::BeginCommandBuffer(command_buffer_, &begin_info), "vkBeginCommandBuffer");
+    return command_buffer_;
+}
+
+void CommandContext::End() { Check(vk::EndCommandBuffer(command_buffer_), "vkEndCommandBuffer"); }
+
+void CommandContext::SubmitAndWait(VkQueue queue) {
+    VkSubmitInfo submit_info = vku::InitStructHelper();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &command_buffer_;
+    Check(vk::QueueSubmit(queue, 1, &submit_info, fence_), "vkQueueSubmit");
+    Check(vk::WaitForFences(device_.Device(), 1, &fence_, VK_TRUE, UINT64_MAX), "vkWaitForFences");
+    Check(vk::ResetFences(device_.Device(), 1, &fence_), "vkResetFences");
+}
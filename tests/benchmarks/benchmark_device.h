@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <vulkan/vulkan.h>
+
+// Which parts of the validation layer a benchmark runs with, passed to the layer with VK_EXT_layer_settings
+struct LayerConfig {
+    const char *name;
+    bool validate_core;
+    bool thread_safety;
+    bool object_lifetime;
+    bool stateless_param;
+    bool unique_handles;
+    bool validate_sync;
+    bool check_shaders_caching;
+};
+
+namespace configs {
+// Layer loaded but every validation object disabled, measures the chassis and handle wrapping
+inline constexpr LayerConfig kChassis = {"chassis", false, false, false, false, true, false, false};
+// The default set of validation objects
+inline constexpr LayerConfig kDefault = {"default", true, true, true, true, true, false, true};
+inline constexpr LayerConfig kCore = {"core", true, false, false, false, true, false, true};
+inline constexpr LayerConfig kThreadSafety = {"thread_safety", false, true, false, false, true, false, false};
+inline constexpr LayerConfig kObjectLifetime = {"object_lifetime", false, false, true, false, true, false, false};
+inline constexpr LayerConfig kSyncVal = {"syncval", false, false, false, false, true, true, false};
+}  // namespace configs
+
+// Instance and device with the validation layer enabled, created on first use of a configuration and shared by every
+// benchmark which uses it. Benchmarks are meant to be run against the mock ICD, so the numbers are the cost of the layer
+// rather than of a driver.
+class BenchmarkDevice {
+  public:
+    static BenchmarkDevice &Get(const LayerConfig &config);
+    // Returns false if any device reported validation errors, main() then fails the run
+    static bool DestroyAll();
+
+    ~BenchmarkDevice();
+    BenchmarkDevice(const BenchmarkDevice &) = delete;
+    BenchmarkDevice &operator=(const BenchmarkDevice &) = delete;
+
+    VkDevice Device() const { return device_; }
+    uint32_t QueueFamily() const { return queue_family_; }
+    // Every queue of the queue family, the first one is used by single threaded benchmarks
+    const std::vector<VkQueue> &Queues() const { return queues_; }
+    VkQueue Queue() const { return queues_[0]; }
+
+    // Objects created here live as long as the device
+    VkBuffer CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage);
+    VkImage CreateImage(VkFormat format, uint32_t extent, uint32_t mip_levels, uint32_t array_layers, VkImageUsageFlags usage);
+    VkShaderModule CreateComputeShader();
+    VkShaderModule CreateStorageBufferComputeShader();
+    // A single buffer per device, created by whichever benchmark thread asks first, for threads which use the same object
+    VkBuffer SharedBuffer(VkDeviceSize size, VkBufferUsageFlags usage);
+
+    // Validation messages reported while the benchmarks run, they should all be clean
+    uint32_t ErrorCount() const { return error_count_.load(); }
+
+  private:
+    explicit BenchmarkDevice(const LayerConfig &config);
+    VkShaderModule CreateShaderModule(const VkShaderModuleCreateInfo &module_ci);
+    void BindMemory(const VkMemoryRequirements &requirements, VkDeviceMemory &memory);
+
+    static VKAPI_ATTR VkBool32 VKAPI_CALL MessengerCallback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                            VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                            const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                            void *user_data);
+
+    VkInstance instance_ = VK_NULL_HANDLE;
+    VkDebugUtilsMessengerEXT messenger_ = VK_NULL_HANDLE;
+    VkPhysicalDevice physical_device_ = VK_NULL_HANDLE;
+    VkPhysicalDeviceMemoryProperties memory_properties_{};
+    VkDevice device_ = VK_NULL_HANDLE;
+    uint32_t queue_family_ = 0;
+    std::vector<VkQueue> queues_;
+
+    // Benchmark threads create their objects concurrently
+    std::mutex objects_lock_;
+    std::vector<VkBuffer> buffers_;
+    std::vector<VkImage> images_;
+    std::vector<VkShaderModule> shader_modules_;
+    std::vector<VkDeviceMemory> memories_;
+    std::mutex shared_buffer_lock_;
+    VkBuffer shared_buffer_ = VK_NULL_HANDLE;
+    std::atomic<uint32_t> error_count_{0};
+};
+
+// Compute shader with an empty main, its SPIR-V is static
+VkShaderModuleCreateInfo ComputeShaderCreateInfo();
+// Compute shader loading from the storage buffer at set 0, binding 0, so draw time validation looks at that binding
+VkShaderModuleCreateInfo StorageBufferComputeShaderCreateInfo();
+
+// Fails the benchmark it is declared in if the layer reports validation errors while it runs, the numbers of a benchmark
+// which hits an error path are not the ones it is meant to measure
+class ErrorCheck {
+  public:
+    ErrorCheck(const BenchmarkDevice &device, benchmark::State &state)
+        : device_(device), state_(state), error_count_(device.ErrorCount()) {}
+    ~ErrorCheck() {
+        if (device_.ErrorCount() != error_count_) {
+            state_.SkipWithError("The validation layer reported errors");
+        }
+    }
+    ErrorCheck(const ErrorCheck &) = delete;
+    ErrorCheck &operator=(const ErrorCheck &) = delete;
+
+  private:
+    const BenchmarkDevice &device_;
+    benchmark::State &state_;
+    const uint32_t error_count_;
+};
+
+// Command pool and a primary command buffer, one per recording thread
+class CommandContext {
+  public:
+    explicit CommandContext(BenchmarkDevice &device);
+    ~CommandContext();
+    CommandContext(const CommandContext &) = delete;
+    CommandContext &operator=(const CommandContext &) = delete;
+
+    VkCommandBuffer Begin();
+    void End();
+    // Submits the recorded command buffer and waits until it has retired
+    void SubmitAndWait(VkQueue queue);
+
+    VkCommandBuffer Handle() const { return command_buffer_; }
+
+  private:
+    BenchmarkDevice &device_;
+    VkCommandPool pool_ = VK_NULL_HANDLE;
+    VkCommandBuffer command_buffer_ = VK_NULL_HANDLE;
+    VkFence fence_ = VK_NULL_HANDLE;
+};
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include "benchmark_device.h"
+#include "generated/vk_function_pointers.h"
+
+// Per call cost of recording common commands. Each iteration records a whole command buffer, so Begin/End are
+// amortized over kCommandsPerBuffer commands.
+static constexpr uint32_t kCommandsPerBuffer = 1000;
+
+static void CmdSetViewport(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    CommandContext context(device);
+    const VkViewport viewport = {0.0f, 0.0f, 64.0f, 64.0f, 0.0f, 1.0f};
+    for (auto _ : state) {
+        VkCommandBuffer cb = context.Begin();
+        for (uint32_t i = 0; i < kCommandsPerBuffer; ++i) {
+            vk::CmdSetViewport(cb, 0, 1, &viewport);
+        }
+        context.End();
+    }
+    state.SetItemsProcessed(state.iterations() * kCommandsPerBuffer);
+}
+
+static void CmdCopyBuffer(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    CommandContext context(device);
+    const VkBuffer src = device.CreateBuffer(1024 * 1024, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    const VkBuffer dst = device.CreateBuffer(1024 * 1024, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    for (auto _ : state) {
+        VkCommandBuffer cb = context.Begin();
+        for (uint32_t i = 0; i < kCommandsPerBuffer; ++i) {
+            // Disjoint regions, so syncval does not see write after write hazards
+            const VkBufferCopy region = {0, i * 1024ull, 1024};
+            vk::CmdCopyBuffer(cb, src, dst, 1, &region);
+        }
+        context.End();
+    }
+    state.SetItemsProcessed(state.iterations() * kCommandsPerBuffer);
+}
+
+static void CmdDispatch(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    CommandContext context(device);
+
+    VkPipelineLayoutCreateInfo layout_ci = vku::InitStructHelper();
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    vk::CreatePipelineLayout(device.Device(), &layout_ci, nullptr, &pipeline_layout);
+    VkComputePipelineCreateInfo pipeline_ci = vku::InitStructHelper();
+    pipeline_ci.stage = vku::InitStructHelper();
+    pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_ci.stage.module = device.CreateComputeShader();
+    pipeline_ci.stage.pName = "main";
+    pipeline_ci.layout = pipeline_layout;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    vk::CreateComputePipelines(device.Device(), VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &pipeline);
+
+    for (auto _ : state) {
+        VkCommandBuffer cb = context.Begin();
+        vk::CmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        for (uint32_t i = 0; i < kCommandsPerBuffer; ++i) {
+            vk::CmdDispatch(cb, 1, 1, 1);
+        }
+        context.End();
+    }
+    state.SetItemsProcessed(state.iterations() * kCommandsPerBuffer);
+
+    vk::DestroyPipeline(device.Device(), pipeline, nullptr);
+    vk::DestroyPipelineLayout(device.Device(), pipeline_layout, nullptr);
+}
+
+// Layout transitions of an image with 8 mips and 6 layers, either of the whole image (range(0) == 0) or one mip level at
+// a time (range(0) == 1), which is what the image layout tracking is sensitive to.
+static void CmdPipelineBarrierImage(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    CommandContext context(device);
+    constexpr uint32_t kMipLevels = 8;
+    constexpr uint32_t kArrayLayers = 6;
+    const VkImage image = device.CreateImage(VK_FORMAT_R8G8B8A8_UNORM, 256, kMipLevels, kArrayLayers,
+                                             VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    const bool per_mip = state.range(0) != 0;
+
+    VkImageMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, per_mip ? 1u : kMipLevels, 0, kArrayLayers};
+
+    for (auto _ : state) {
+        VkCommandBuffer cb = context.Begin();
+        VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        for (uint32_t i = 0; i < kCommandsPerBuffer; ++i) {
+            const VkImageLayout new_layout =
+                (i % 2) ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            if (per_mip) {
+                for (uint32_t mip = 0; mip < kMipLevels; ++mip) {
+                    barrier.oldLayout = layout;
+                    barrier.newLayout = new_layout;
+                    barrier.subresourceRange.baseMipLevel = mip;
+                    vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                                           nullptr, 1, &barrier);
+                }
+            } else {
+                barrier.oldLayout = layout;
+                barrier.newLayout = new_layout;
+                vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                                       nullptr, 1, &barrier);
+            }
+            layout = new_layout;
+        }
+        context.End();
+    }
+    state.SetItemsProcessed(state.iterations() * kCommandsPerBuffer);
+}
+
+BENCHMARK_CAPTURE(CmdSetViewport, chassis, &configs::kChassis);
+BENCHMARK_CAPTURE(CmdSetViewport, default, &configs::kDefault);
+BENCHMARK_CAPTURE(CmdSetViewport, syncval, &configs::kSyncVal);
+BENCHMARK_CAPTURE(CmdCopyBuffer, chassis, &configs::kChassis);
+BENCHMARK_CAPTURE(CmdCopyBuffer, default, &configs::kDefault);
+BENCHMARK_CAPTURE(CmdCopyBuffer, object_lifetime, &configs::kObjectLifetime);
+BENCHMARK_CAPTURE(CmdCopyBuffer, thread_safety, &configs::kThreadSafety);
+BENCHMARK_CAPTURE(CmdCopyBuffer, syncval, &configs::kSyncVal);
+BENCHMARK_CAPTURE(CmdDispatch, chassis, &configs::kChassis);
+BENCHMARK_CAPTURE(CmdDispatch, default, &configs::kDefault);
+BENCHMARK_CAPTURE(CmdDispatch, syncval, &configs::kSyncVal);
+BENCHMARK_CAPTURE(CmdPipelineBarrierImage, core, &configs::kCore)->ArgName("per_mip")->Arg(0)->Arg(1);
+BENCHMARK_CAPTURE(CmdPipelineBarrierImage, syncval, &configs::kSyncVal)->ArgName("per_mip")->Arg(0)->Arg(1);
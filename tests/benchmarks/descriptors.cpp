@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdio>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#include <benchmark/benchmark.h>
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include "benchmark_device.h"
+#include "generated/vk_function_pointers.h"
+
+static constexpr uint32_t kSetCount = 64;
+
+struct DescriptorSets {
+    DescriptorSets(BenchmarkDevice &device, uint32_t descriptor_count) : device_(device) {
+        VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptor_count, VK_SHADER_STAGE_ALL, nullptr};
+        VkDescriptorSetLayoutCreateInfo layout_ci = vku::InitStructHelper();
+        layout_ci.bindingCount = 1;
+        layout_ci.pBindings = &binding;
+        vk::CreateDescriptorSetLayout(device_.Device(), &layout_ci, nullptr, &layout);
+
+        const VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptor_count * kSetCount};
+        VkDescriptorPoolCreateInfo pool_ci = vku::InitStructHelper();
+        pool_ci.maxSets = kSetCount;
+        pool_ci.poolSizeCount = 1;
+        pool_ci.pPoolSizes = &pool_size;
+        vk::CreateDescriptorPool(device_.Device(), &pool_ci, nullptr, &pool);
+
+        const std::vector<VkDescriptorSetLayout> layouts(kSetCount, layout);
+        VkDescriptorSetAllocateInfo allocate_info = vku::InitStructHelper();
+        allocate_info.descriptorPool = pool;
+        allocate_info.descriptorSetCount = kSetCount;
+        allocate_info.pSetLayouts = layouts.data();
+        sets.resize(kSetCount);
+        vk::AllocateDescriptorSets(device_.Device(), &allocate_info, sets.data());
+    }
+    ~DescriptorSets() {
+        vk::DestroyDescriptorPool(device_.Device(), pool, nullptr);
+        vk::DestroyDescriptorSetLayout(device_.Device(), layout, nullptr);
+    }
+
+    BenchmarkDevice &device_;
+    VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> sets;
+};
+
+// vkUpdateDescriptorSets throughput, each iteration rewrites range(0) storage buffer descriptors in every set
+static void UpdateDescriptorSets(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    const uint32_t descriptor_count = static_cast<uint32_t>(state.range(0));
+    DescriptorSets descriptor_sets(device, descriptor_count);
+    const VkBuffer buffer = device.CreateBuffer(descriptor_count * 256ull, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    std::vector<VkDescriptorBufferInfo> buffer_infos(descriptor_count);
+    for (uint32_t i = 0; i < descriptor_count; ++i) {
+        buffer_infos[i] = {buffer, i * 256ull, 256};
+    }
+    std::vector<VkWriteDescriptorSet> writes(kSetCount);
+    for (uint32_t i = 0; i < kSetCount; ++i) {
+        writes[i] = vku::InitStructHelper();
+        writes[i].dstSet = descriptor_sets.sets[i];
+        writes[i].dstBinding = 0;
+        writes[i].descriptorCount = descriptor_count;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[i].pBufferInfo = buffer_infos.data();
+    }
+
+    for (auto _ : state) {
+        vk::UpdateDescriptorSets(device.Device(), kSetCount, writes.data(), 0, nullptr);
+    }
+    state.SetItemsProcessed(state.iterations() * kSetCount * descriptor_count);
+}
+
+// Dispatch time descriptor validation of a set which was updated since the last dispatch, the shader reads binding 0
+static void DispatchAfterUpdate(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    const uint32_t descriptor_count = static_cast<uint32_t>(state.range(0));
+    DescriptorSets descriptor_sets(device, descriptor_count);
+    CommandContext context(device);
+    const VkBuffer buffer = device.CreateBuffer(descriptor_count * 256ull, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    VkPipelineLayoutCreateInfo layout_ci = vku::InitStructHelper();
+    layout_ci.setLayoutCount = 1;
+    layout_ci.pSetLayouts = &descriptor_sets.layout;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    vk::CreatePipelineLayout(device.Device(), &layout_ci, nullptr, &pipeline_layout);
+    VkComputePipelineCreateInfo pipeline_ci = vku::InitStructHelper();
+    pipeline_ci.stage = vku::InitStructHelper();
+    pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_ci.stage.module = device.CreateStorageBufferComputeShader();
+    pipeline_ci.stage.pName = "main";
+    pipeline_ci.layout = pipeline_layout;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    vk::CreateComputePipelines(device.Device(), VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &pipeline);
+
+    std::vector<VkDescriptorBufferInfo> buffer_infos(descriptor_count);
+    for (uint32_t i = 0; i < descriptor_count; ++i) {
+        buffer_infos[i] = {buffer, i * 256ull, 256};
+    }
+    VkWriteDescriptorSet write = vku::InitStructHelper();
+    write.dstSet = descriptor_sets.sets[0];
+    write.descriptorCount = descriptor_count;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    write.pBufferInfo = buffer_infos.data();
+    vk::UpdateDescriptorSets(device.Device(), 1, &write, 0, nullptr);
+
+    // A single descriptor changes between dispatches, the rest of the set does not need to be validated again
+    write.descriptorCount = 1;
+    uint32_t iteration = 0;
+    for (auto _ : state) {
+        write.dstArrayElement = iteration++ % descriptor_count;
+        write.pBufferInfo = &buffer_infos[write.dstArrayElement];
+        vk::UpdateDescriptorSets(device.Device(), 1, &write, 0, nullptr);
+
+        VkCommandBuffer cb = context.Begin();
+        vk::CmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        vk::CmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0, 1, &descriptor_sets.sets[0], 0,
+                                  nullptr);
+        vk::CmdDispatch(cb, 1, 1, 1);
+        context.End();
+    }
+
+    vk::DestroyPipeline(device.Device(), pipeline, nullptr);
+    vk::DestroyPipelineLayout(device.Device(), pipeline_layout, nullptr);
+}
+
+// Resident memory of the process in bytes, 0 where it is not implemented
+static size_t ResidentMemory() {
+#if defined(__linux__)
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    FILE *statm = std::fopen("/proc/self/statm", "r");
+    if (!statm) {
+        return 0;
+    }
+    const int read_count = std::fscanf(statm, "%zu %zu", &total_pages, &resident_pages);
+    std::fclose(statm);
+    return read_count == 2 ? resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE)) : 0;
+#else
+    return 0;
+#endif
+}
+
+// Large variable count, update after bind sets of which the application only writes a few descriptors. The time covers
+// allocating the sets, writing them and resetting the pool. The resident_bytes_per_set counter is the growth of the process
+// memory while the sets are allocated the first time, the difference with the chassis run is what the layer keeps per set.
+static void AllocateBindlessSets(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    const uint32_t descriptor_count = static_cast<uint32_t>(state.range(0));
+    const uint32_t set_count = 16;
+    const uint32_t written_count = 16;
+    const VkBuffer buffer = device.CreateBuffer(written_count * 256ull, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+    const VkDescriptorBindingFlags binding_flags = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+                                                   VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+                                                   VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT;
+    VkDescriptorSetLayoutBindingFlagsCreateInfo flags_ci = vku::InitStructHelper();
+    flags_ci.bindingCount = 1;
+    flags_ci.pBindingFlags = &binding_flags;
+    VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptor_count, VK_SHADER_STAGE_ALL, nullptr};
+    VkDescriptorSetLayoutCreateInfo layout_ci = vku::InitStructHelper(&flags_ci);
+    layout_ci.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+    layout_ci.bindingCount = 1;
+    layout_ci.pBindings = &binding;
+    VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+    vk::CreateDescriptorSetLayout(device.Device(), &layout_ci, nullptr, &layout);
+
+    const VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptor_count * set_count};
+    VkDescriptorPoolCreateInfo pool_ci = vku::InitStructHelper();
+    pool_ci.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+    pool_ci.maxSets = set_count;
+    pool_ci.poolSizeCount = 1;
+    pool_ci.pPoolSizes = &pool_size;
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    vk::CreateDescriptorPool(device.Device(), &pool_ci, nullptr, &pool);
+
+    const std::vector<VkDescriptorSetLayout> layouts(set_count, layout);
+    const std::vector<uint32_t> variable_counts(set_count, descriptor_count);
+    VkDescriptorSetVariableDescriptorCountAllocateInfo variable_count_info = vku::InitStructHelper();
+    variable_count_info.descriptorSetCount = set_count;
+    variable_count_info.pDescriptorCounts = variable_counts.data();
+    VkDescriptorSetAllocateInfo allocate_info = vku::InitStructHelper(&variable_count_info);
+    allocate_info.descriptorPool = pool;
+    allocate_info.descriptorSetCount = set_count;
+    allocate_info.pSetLayouts = layouts.data();
+    std::vector<VkDescriptorSet> sets(set_count);
+
+    // Spread over the whole binding, as an application writing the descriptors of the resources it currently uses would
+    std::vector<VkDescriptorBufferInfo> buffer_infos(written_count);
+    std::vector<VkWriteDescriptorSet> writes(set_count * written_count);
+    for (uint32_t i = 0; i < written_count; ++i) {
+        buffer_infos[i] = {buffer, i * 256ull, 256};
+    }
+    auto allocate_and_write = [&]() {
+        vk::AllocateDescriptorSets(device.Device(), &allocate_info, sets.data());
+        for (uint32_t set = 0; set < set_count; ++set) {
+            for (uint32_t i = 0; i < written_count; ++i) {
+                VkWriteDescriptorSet &write = writes[set * written_count + i];
+                write = vku::InitStructHelper();
+                write.dstSet = sets[set];
+                write.dstArrayElement = i * (descriptor_count / written_count);
+                write.descriptorCount = 1;
+                write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                write.pBufferInfo = &buffer_infos[i];
+            }
+        }
+        vk::UpdateDescriptorSets(device.Device(), static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+    };
+
+    const size_t memory_before = ResidentMemory();
+    allocate_and_write();
+    const size_t memory_after = ResidentMemory();
+    vk::ResetDescriptorPool(device.Device(), pool, 0);
+    if (memory_before != 0) {
+        state.counters["resident_bytes_per_set"] =
+            benchmark::Counter(static_cast<double>(memory_after > memory_before ? memory_after - memory_before : 0) / set_count);
+    }
+
+    for (auto _ : state) {
+        allocate_and_write();
+        vk::ResetDescriptorPool(device.Device(), pool, 0);
+    }
+    state.SetItemsProcessed(state.iterations() * set_count);
+
+    vk::DestroyDescriptorPool(device.Device(), pool, nullptr);
+    vk::DestroyDescriptorSetLayout(device.Device(), layout, nullptr);
+}
+
+BENCHMARK_CAPTURE(UpdateDescriptorSets, chassis, &configs::kChassis)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK_CAPTURE(UpdateDescriptorSets, default, &configs::kDefault)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK_CAPTURE(DispatchAfterUpdate, default, &configs::kDefault)->Arg(4)->Arg(64);
+BENCHMARK_CAPTURE(DispatchAfterUpdate, syncval, &configs::kSyncVal)->Arg(4)->Arg(64);
+BENCHMARK_CAPTURE(AllocateBindlessSets, chassis, &configs::kChassis)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_CAPTURE(AllocateBindlessSets, core, &configs::kCore)->Arg(1 << 12)->Arg(1 << 16);
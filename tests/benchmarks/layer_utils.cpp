@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "containers/handle_table.h"
+#include "containers/mpsc_ring_buffer.h"
+#include "error_message/logging.h"
+
+// Micro benchmarks of the containers on the hot paths of the layer, these don't need a device
+
+static constexpr uint32_t kHandleCount = 4096;
+
+struct HandleTableData {
+    HandleTableData() {
+        for (uint64_t i = 0; i < kHandleCount; ++i) {
+            keys.push_back(table.insert(0x1000 + i));
+        }
+    }
+    vvl::concurrent_handle_table table;
+    std::vector<uint64_t> keys;
+};
+
+// Unwrapping handles, which every call with a handle parameter does, from several threads at once
+static void HandleTableFind(benchmark::State &state) {
+    static HandleTableData data;
+    uint64_t sum = 0;
+    uint32_t index = static_cast<uint32_t>(state.thread_index()) * 97;
+    for (auto _ : state) {
+        sum += data.table.find(data.keys[index++ % kHandleCount])->second;
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Creating and destroying handles while other threads do the same
+static void HandleTableInsertErase(benchmark::State &state) {
+    static vvl::concurrent_handle_table table;
+    for (auto _ : state) {
+        const uint64_t key = table.insert(1);
+        table.erase(key);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Filtering of reported message ids, which LogMsg does for every message
+static void MessageIdFilter(benchmark::State &state) {
+    MessageIdSet filter;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(state.range(0)); ++i) {
+        filter.insert(i * 0x9E3779B9u);
+    }
+    uint32_t message_id = 0;
+    uint32_t hits = 0;
+    for (auto _ : state) {
+        message_id = message_id * 1664525u + 1013904223u;
+        hits += filter.contains(message_id) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(hits);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Duplicate message counting from several threads, the count limits how often a message is logged
+static void MessageIdCount(benchmark::State &state) {
+    static MessageIdCounts counts;
+    uint32_t message_id = static_cast<uint32_t>(state.thread_index());
+    uint32_t logged = 0;
+    for (auto _ : state) {
+        message_id = message_id * 1664525u + 1013904223u;
+        logged += counts.TryIncrement(message_id & 0xFF, 10) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(logged);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Round trip of the queue behind the asynchronous log sink
+static void MpscRingBufferPushPop(benchmark::State &state) {
+    vvl::mpsc_ring_buffer<uint64_t> queue(4096);
+    const uint32_t batch = static_cast<uint32_t>(state.range(0));
+    uint64_t value = 0;
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < batch; ++i) {
+            queue.try_push(uint64_t(i));
+        }
+        for (uint32_t i = 0; i < batch; ++i) {
+            queue.try_pop(value);
+        }
+    }
+    benchmark::DoNotOptimize(value);
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+
+BENCHMARK(HandleTableFind)->Threads(1)->Threads(4)->Threads(16)->UseRealTime();
+BENCHMARK(HandleTableInsertErase)->Threads(1)->Threads(4)->Threads(16)->UseRealTime();
+BENCHMARK(MessageIdFilter)->Arg(0)->Arg(16)->Arg(1024);
+BENCHMARK(MessageIdCount)->Threads(1)->Threads(4)->Threads(16)->UseRealTime();
+BENCHMARK(MpscRingBufferPushPop)->Arg(1)->Arg(64)->Arg(1024);
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_device.h"
+#include "generated/vk_function_pointers.h"
+
+int main(int argc, char **argv) {
+    vk::InitCore("vulkan");
+
+    // Results are always written as JSON as well, so they can be tracked from commit to commit.
+    // Passing --benchmark_out changes where they go.
+    std::string out_arg = "--benchmark_out=vk_layer_benchmarks.json";
+    std::string out_format_arg = "--benchmark_out_format=json";
+    std::vector<char *> args(argv, argv + argc);
+    bool has_out = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string_view(argv[i]).rfind("--benchmark_out=", 0) == 0) {
+            has_out = true;
+        }
+    }
+    if (!has_out) {
+        args.push_back(out_arg.data());
+        args.push_back(out_format_arg.data());
+    }
+    int arg_count = static_cast<int>(args.size());
+
+    benchmark::Initialize(&arg_count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(arg_count, args.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    // A run in which the layer reported validation errors did not measure what the benchmarks are meant to measure
+    return BenchmarkDevice::DestroyAll() ? 0 : 1;
+}
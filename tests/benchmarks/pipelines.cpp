@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include "benchmark_device.h"
+#include "generated/vk_function_pointers.h"
+
+// The "core" configuration has check_shaders_caching on, "core_no_shader_cache" runs the same checks without the
+// layer's shader validation cache
+static constexpr LayerConfig kCoreNoShaderCache = {"core_no_shader_cache", true, false, false, false, true, false, false};
+
+// vkCreateComputePipelines of the same shader, with (range(0) == 1) or without an application VkPipelineCache
+static void CreateComputePipeline(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    const bool use_pipeline_cache = state.range(0) != 0;
+
+    VkPipelineCache pipeline_cache = VK_NULL_HANDLE;
+    if (use_pipeline_cache) {
+        VkPipelineCacheCreateInfo cache_ci = vku::InitStructHelper();
+        vk::CreatePipelineCache(device.Device(), &cache_ci, nullptr, &pipeline_cache);
+    }
+    VkPipelineLayoutCreateInfo layout_ci = vku::InitStructHelper();
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    vk::CreatePipelineLayout(device.Device(), &layout_ci, nullptr, &pipeline_layout);
+
+    VkComputePipelineCreateInfo pipeline_ci = vku::InitStructHelper();
+    pipeline_ci.stage = vku::InitStructHelper();
+    pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_ci.stage.module = device.CreateComputeShader();
+    pipeline_ci.stage.pName = "main";
+    pipeline_ci.layout = pipeline_layout;
+
+    for (auto _ : state) {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        vk::CreateComputePipelines(device.Device(), pipeline_cache, 1, &pipeline_ci, nullptr, &pipeline);
+        vk::DestroyPipeline(device.Device(), pipeline, nullptr);
+    }
+
+    vk::DestroyPipelineLayout(device.Device(), pipeline_layout, nullptr);
+    if (pipeline_cache != VK_NULL_HANDLE) {
+        vk::DestroyPipelineCache(device.Device(), pipeline_cache, nullptr);
+    }
+}
+
+// Shader module creation, where the SPIR-V is parsed and validated unless the layer finds it in its cache
+static void CreateShaderModule(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    const VkShaderModuleCreateInfo module_ci = ComputeShaderCreateInfo();
+    for (auto _ : state) {
+        VkShaderModule shader_module = VK_NULL_HANDLE;
+        vk::CreateShaderModule(device.Device(), &module_ci, nullptr, &shader_module);
+        vk::DestroyShaderModule(device.Device(), shader_module, nullptr);
+    }
+}
+
+BENCHMARK_CAPTURE(CreateComputePipeline, chassis, &configs::kChassis)->ArgName("pipeline_cache")->Arg(0)->Arg(1);
+BENCHMARK_CAPTURE(CreateComputePipeline, core, &configs::kCore)->ArgName("pipeline_cache")->Arg(0)->Arg(1);
+BENCHMARK_CAPTURE(CreateComputePipeline, core_no_shader_cache, &kCoreNoShaderCache)->ArgName("pipeline_cache")->Arg(0)->Arg(1);
+BENCHMARK_CAPTURE(CreateShaderModule, core, &configs::kCore);
+BENCHMARK_CAPTURE(CreateShaderModule, core_no_shader_cache, &kCoreNoShaderCache);
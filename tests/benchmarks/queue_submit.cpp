@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include "benchmark_device.h"
+#include "generated/vk_function_pointers.h"
+
+static constexpr uint32_t kCopiesPerSubmit = 64;
+
+// Records copies into a buffer and a whole image transition, so submit time validation has both buffer accesses and
+// image layouts to check
+static void RecordCopies(BenchmarkDevice &device, CommandContext &context) {
+    const VkBuffer src = device.CreateBuffer(kCopiesPerSubmit * 1024ull, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    const VkBuffer dst = device.CreateBuffer(kCopiesPerSubmit * 1024ull, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    const VkImage image = device.CreateImage(VK_FORMAT_R8G8B8A8_UNORM, 64, 1, 1, VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+
+    VkCommandBuffer cb = context.Begin();
+    VkImageMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.image = image;
+    barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                           &barrier);
+    for (uint32_t i = 0; i < kCopiesPerSubmit; ++i) {
+        const VkBufferCopy region = {i * 1024ull, i * 1024ull, 1024};
+        vk::CmdCopyBuffer(cb, src, dst, 1, &region);
+    }
+    // Make the next submission of the same command buffer safe for syncval
+    VkMemoryBarrier memory_barrier = vku::InitStructHelper();
+    memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memory_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &memory_barrier, 0, nullptr,
+                           0, nullptr);
+    context.End();
+}
+
+// vkQueueSubmit of one command buffer followed by a fence wait, covering submit time validation and retirement
+static void QueueSubmit(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    CommandContext context(device);
+    RecordCopies(device, context);
+    for (auto _ : state) {
+        context.SubmitAndWait(device.Queue());
+    }
+}
+
+// Every benchmark thread submits to its own queue of the same device
+static void QueueSubmitThreads(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    if (static_cast<size_t>(state.threads()) > device.Queues().size()) {
+        state.SkipWithError("Not enough queues for one queue per thread");
+        return;
+    }
+    CommandContext context(device);
+    RecordCopies(device, context);
+    const VkQueue queue = device.Queues()[state.thread_index()];
+    for (auto _ : state) {
+        context.SubmitAndWait(queue);
+    }
+}
+
+BENCHMARK_CAPTURE(QueueSubmit, chassis, &configs::kChassis);
+BENCHMARK_CAPTURE(QueueSubmit, default, &configs::kDefault);
+BENCHMARK_CAPTURE(QueueSubmit, syncval, &configs::kSyncVal);
+BENCHMARK_CAPTURE(QueueSubmitThreads, default, &configs::kDefault)->Threads(1)->Threads(2)->Threads(4)->UseRealTime();
+BENCHMARK_CAPTURE(QueueSubmitThreads, syncval, &configs::kSyncVal)->Threads(1)->Threads(2)->Threads(4)->UseRealTime();
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <benchmark/benchmark.h>
+#include <vulkan/utility/vk_struct_helper.hpp>
+
+#include "benchmark_device.h"
+#include "generated/vk_function_pointers.h"
+
+static constexpr uint32_t kCopiesPerBuffer = 256;
+
+// Scaling of command recording with the number of threads. Each thread records into its own command buffer, either
+// copying from its own buffer (range(0) == 0), or from one buffer shared by all threads (range(0) == 1), which is where
+// the per object bookkeeping of thread safety and handle unwrapping is contended.
+static void RecordThreads(benchmark::State &state, const LayerConfig *config) {
+    BenchmarkDevice &device = BenchmarkDevice::Get(*config);
+    const ErrorCheck error_check(device, state);
+    const bool shared = state.range(0) != 0;
+    CommandContext context(device);
+    const VkDeviceSize size = kCopiesPerBuffer * 1024ull;
+    const VkBuffer dst = device.CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    const VkBuffer src = shared ? device.SharedBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT)
+                                : device.CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    for (auto _ : state) {
+        VkCommandBuffer cb = context.Begin();
+        for (uint32_t i = 0; i < kCopiesPerBuffer; ++i) {
+            const VkBufferCopy region = {i * 1024ull, i * 1024ull, 1024};
+            vk::CmdCopyBuffer(cb, src, dst, 1, &region);
+        }
+        context.End();
+    }
+    state.SetItemsProcessed(state.iterations() * kCopiesPerBuffer);
+}
+
+#define RECORD_THREADS(name, config)                      \
+    BENCHMARK_CAPTURE(RecordThreads, name, config)        \
+        ->ArgName("shared")                               \
+        ->Arg(0)                                          \
+        ->Arg(1)                                          \
+        ->Threads(1)                                      \
+        ->Threads(4)                                      \
+        ->Threads(16)                                     \
+        ->UseRealTime()
+
+RECORD_THREADS(chassis, &configs::kChassis);
+RECORD_THREADS(default, &configs::kDefault);
+RECORD_THREADS(thread_safety, &configs::kThreadSafety);
+RECORD_THREADS(object_lifetime, &configs::kObjectLifetime);
+RECORD_THREADS(syncval, &configs::kSyncVal);
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <glslang/Public/ResourceLimits.h>
+#include <glslang/Public/ShaderLang.h>
+#include <glslang/SPIRV/GlslangToSpv.h>
+
+#include "gpu_validation/spirv/module.h"
+#include "generated/gpu_pre_copy_buffer_to_image_comp.h"
+#include "generated/gpu_pre_dispatch_comp.h"
+#include "generated/gpu_pre_draw_vert.h"
+#include "generated/gpu_pre_trace_rays_rgen.h"
+
+// GPU-AV shader instrumentation, from parsing the SPIR-V to writing out the instrumented binary, these don't need a device.
+// There are 2 corpora by default, GPU-AV's own shaders and the application like shaders of tests/benchmarks/shaders, which
+// cover all the passes. Setting VVL_BENCHMARK_SHADERS to a directory of .spv files (for example a checkout of
+// https://github.com/LunarG/SPIRV-Database) adds a benchmark over all of them.
+
+static constexpr uint32_t kShaderId = 23;
+static constexpr uint32_t kInstDescriptorSet = 7;
+
+using ShaderCorpus = std::vector<std::vector<uint32_t>>;
+
+static const ShaderCorpus &InternalShaders() {
+    static const ShaderCorpus corpus = {
+        {gpu_pre_copy_buffer_to_image_comp, gpu_pre_copy_buffer_to_image_comp + gpu_pre_copy_buffer_to_image_comp_size},
+        {gpu_pre_dispatch_comp, gpu_pre_dispatch_comp + gpu_pre_dispatch_comp_size},
+        {gpu_pre_draw_vert, gpu_pre_draw_vert + gpu_pre_draw_vert_size},
+        {gpu_pre_trace_rays_rgen, gpu_pre_trace_rays_rgen + gpu_pre_trace_rays_rgen_size},
+    };
+    return corpus;
+}
+
+// Compiled for Vulkan 1.2 (SPIR-V 1.5), so the linked variables are also added to the entry point interfaces
+static bool CompileGlsl(const std::filesystem::path &path, std::vector<uint32_t> &spirv) {
+    const std::string extension = path.extension().string();
+    EShLanguage stage;
+    if (extension == ".vert") {
+        stage = EShLangVertex;
+    } else if (extension == ".frag") {
+        stage = EShLangFragment;
+    } else if (extension == ".comp") {
+        stage = EShLangCompute;
+    } else {
+        return false;
+    }
+
+    std::ifstream file(path);
+    std::stringstream source_stream;
+    source_stream << file.rdbuf();
+    const std::string source = source_stream.str();
+    const char *strings[] = {source.c_str()};
+
+    const EShMessages messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+    glslang::TShader shader(stage);
+    shader.setStrings(strings, 1);
+    shader.setEnvInput(glslang::EShSourceGlsl, stage, glslang::EShClientVulkan, 100);
+    shader.setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_2);
+    shader.setEnvTarget(glslang::EshTargetSpv, glslang::EShTargetSpv_1_5);
+    if (!shader.parse(GetDefaultResources(), 460, false, messages)) {
+        std::fprintf(stderr, "%s: %s\n", path.string().c_str(), shader.getInfoLog());
+        return false;
+    }
+    glslang::TProgram program;
+    program.addShader(&shader);
+    if (!program.link(messages)) {
+        std::fprintf(stderr, "%s: %s\n", path.string().c_str(), program.getInfoLog());
+        return false;
+    }
+    glslang::GlslangToSpv(*program.getIntermediate(stage), spirv);
+    return true;
+}
+
+// Shipped with the benchmarks, VVL_BENCHMARK_SHADER_CORPUS is set by CMake
+static const ShaderCorpus &CorpusShaders() {
+    static const ShaderCorpus corpus = [] {
+        std::vector<std::filesystem::path> paths;
+        for (const auto &entry : std::filesystem::directory_iterator(VVL_BENCHMARK_SHADER_CORPUS)) {
+            if (entry.is_regular_file()) {
+                paths.emplace_back(entry.path());
+            }
+        }
+        // Same order on every platform
+        std::sort(paths.begin(), paths.end());
+
+        glslang::InitializeProcess();
+        ShaderCorpus shaders;
+        for (const auto &path : paths) {
+            std::vector<uint32_t> spirv;
+            if (!CompileGlsl(path, spirv)) {
+                // A partial corpus would give numbers which can't be compared with other runs
+                shaders.clear();
+                break;
+            }
+            shaders.emplace_back(std::move(spirv));
+        }
+        glslang::FinalizeProcess();
+        return shaders;
+    }();
+    return corpus;
+}
+
+static ShaderCorpus LoadShaders(const std::filesystem::path &directory) {
+    ShaderCorpus corpus;
+    for (const auto &entry : std::filesystem::recursive_directory_iterator(directory)) {
+        if (!entry.is_regular_file() || entry.path().extension() != ".spv") {
+            continue;
+        }
+        const size_t size = static_cast<size_t>(entry.file_size());
+        std::vector<uint32_t> words(size / sizeof(uint32_t));
+        std::ifstream file(entry.path(), std::ios::binary);
+        file.read(reinterpret_cast<char *>(words.data()), static_cast<std::streamsize>(words.size() * sizeof(uint32_t)));
+        if (file && words.size() > 5 && words[0] == spv::MagicNumber) {
+            corpus.emplace_back(std::move(words));
+        }
+    }
+    return corpus;
+}
+
+static const ShaderCorpus &DirectoryShaders() {
+    static const ShaderCorpus corpus = LoadShaders(std::getenv("VVL_BENCHMARK_SHADERS"));
+    return corpus;
+}
+
+using ShaderCorpusGetter = const ShaderCorpus &(*)();
+
+// Same steps as gpuav::Validator::InstrumentShader() with every pass enabled. The corpus is only loaded once a benchmark which
+// uses it runs.
+static void InstrumentShaders(benchmark::State &state, ShaderCorpusGetter get_corpus) {
+    const ShaderCorpus &corpus = get_corpus();
+    if (corpus.empty()) {
+        state.SkipWithError("No SPIR-V found");
+        return;
+    }
+    size_t words = 0;
+    for (const auto &spirv : corpus) {
+        words += spirv.size();
+    }
+
+    std::vector<uint32_t> instrumented_spirv;
+    for (auto _ : state) {
+        for (const auto &spirv : corpus) {
+            gpuav::spirv::Module module(spirv, kShaderId, kInstDescriptorSet);
+            module.RunPassBindlessDescriptor();
+            module.RunPassBufferDeviceAddress();
+            module.RunPassRayQuery();
+            for (const auto &info : module.link_info_) {
+                module.LinkFunction(info);
+            }
+            module.RemoveDeadLinkedCode();
+            module.ToBinary(instrumented_spirv);
+            benchmark::DoNotOptimize(instrumented_spirv.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(corpus.size()));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(words * sizeof(uint32_t)));
+}
+
+BENCHMARK_CAPTURE(InstrumentShaders, internal, InternalShaders)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(InstrumentShaders, corpus, CorpusShaders)->Unit(benchmark::kMicrosecond);
+
+static bool RegisterShaderDirectory() {
+    const char *directory = std::getenv("VVL_BENCHMARK_SHADERS");
+    if (!directory || !std::filesystem::is_directory(directory)) {
+        return false;
+    }
+    benchmark::RegisterBenchmark("InstrumentShaders/directory", InstrumentShaders, DirectoryShaders)->Unit(benchmark::kMillisecond);
+    return true;
+}
+[[maybe_unused]] static const bool kShaderDirectoryRegistered = RegisterShaderDirectory();
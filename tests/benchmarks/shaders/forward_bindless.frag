@@ -0,0 +1,117 @@
+// Copyright (c) 2024 The Khronos Group Inc.
+// Copyright (c) 2024 Valve Corporation
+// Copyright (c) 2024 LunarG, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Forward PBR shading, the material textures are indexed from a bindless array
+
+#version 460
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout(set = 0, binding = 0) uniform Camera {
+    mat4 view_proj;
+    vec3 position;
+    uint light_count;
+} camera;
+
+struct Light {
+    vec4 position_radius;
+    vec4 color_intensity;
+};
+
+layout(set = 0, binding = 1, std430) readonly buffer Lights {
+    Light lights[];
+};
+
+struct Material {
+    vec4 base_color;
+    uint albedo_index;
+    uint normal_index;
+    uint metal_rough_index;
+    float alpha_cutoff;
+};
+
+layout(set = 0, binding = 2, std430) readonly buffer Materials {
+    Material materials[];
+};
+
+layout(set = 1, binding = 0) uniform sampler2D textures[];
+
+layout(location = 0) in vec3 in_position;
+layout(location = 1) in vec3 in_normal;
+layout(location = 2) in vec4 in_tangent;
+layout(location = 3) in vec2 in_uv;
+layout(location = 4) flat in uint in_material;
+
+layout(location = 0) out vec4 out_color;
+
+const float kPi = 3.14159265;
+
+float DistributionGGX(float n_dot_h, float roughness) {
+    float a = roughness * roughness;
+    float a2 = a * a;
+    float d = n_dot_h * n_dot_h * (a2 - 1.0) + 1.0;
+    return a2 / (kPi * d * d);
+}
+
+float GeometrySmith(float n_dot_v, float n_dot_l, float roughness) {
+    float k = (roughness + 1.0) * (roughness + 1.0) / 8.0;
+    return (n_dot_v / (n_dot_v * (1.0 - k) + k)) * (n_dot_l / (n_dot_l * (1.0 - k) + k));
+}
+
+vec3 FresnelSchlick(float cos_theta, vec3 f0) {
+    return f0 + (1.0 - f0) * pow(clamp(1.0 - cos_theta, 0.0, 1.0), 5.0);
+}
+
+void main() {
+    Material material = materials[in_material];
+    vec4 albedo = material.base_color * texture(textures[nonuniformEXT(material.albedo_index)], in_uv);
+    if (albedo.a < material.alpha_cutoff) {
+        discard;
+    }
+    vec2 metal_rough = texture(textures[nonuniformEXT(material.metal_rough_index)], in_uv).bg;
+    vec3 tangent_normal = texture(textures[nonuniformEXT(material.normal_index)], in_uv).xyz * 2.0 - 1.0;
+
+    vec3 n = normalize(in_normal);
+    vec3 t = normalize(in_tangent.xyz - n * dot(n, in_tangent.xyz));
+    vec3 b = cross(n, t) * in_tangent.w;
+    n = normalize(mat3(t, b, n) * tangent_normal);
+    vec3 v = normalize(camera.position - in_position);
+    float n_dot_v = max(dot(n, v), 1e-4);
+    vec3 f0 = mix(vec3(0.04), albedo.rgb, metal_rough.x);
+
+    vec3 color = vec3(0.0);
+    for (uint i = 0; i < camera.light_count; i++) {
+        Light light = lights[i];
+        vec3 to_light = light.position_radius.xyz - in_position;
+        float light_distance = length(to_light);
+        if (light_distance > light.position_radius.w) {
+            continue;
+        }
+        vec3 l = to_light / light_distance;
+        vec3 h = normalize(v + l);
+        float n_dot_l = max(dot(n, l), 0.0);
+        float falloff = clamp(1.0 - pow(light_distance / light.position_radius.w, 4.0), 0.0, 1.0);
+        float attenuation = falloff * falloff / (light_distance * light_distance + 1.0);
+        vec3 radiance = light.color_intensity.rgb * light.color_intensity.a * attenuation;
+
+        vec3 f = FresnelSchlick(max(dot(h, v), 0.0), f0);
+        float d = DistributionGGX(max(dot(n, h), 0.0), metal_rough.y);
+        float g = GeometrySmith(n_dot_v, n_dot_l, metal_rough.y);
+        vec3 specular = d * g * f / (4.0 * n_dot_v * n_dot_l + 1e-4);
+        vec3 diffuse = (1.0 - f) * (1.0 - metal_rough.x) * albedo.rgb / kPi;
+        color += (diffuse + specular) * radiance * n_dot_l;
+    }
+    out_color = vec4(color + albedo.rgb * 0.03, albedo.a);
+}
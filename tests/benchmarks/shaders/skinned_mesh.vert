@@ -0,0 +1,72 @@
+// Copyright (c) 2024 The Khronos Group Inc.
+// Copyright (c) 2024 Valve Corporation
+// Copyright (c) 2024 LunarG, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Skinned mesh vertex shader, the per instance data and joint matrices are read from storage buffers
+
+#version 460
+
+layout(set = 0, binding = 0) uniform Camera {
+    mat4 view_proj;
+    vec3 position;
+    uint light_count;
+} camera;
+
+struct Instance {
+    mat4 model;
+    uint material;
+    uint first_joint;
+    uint pad0;
+    uint pad1;
+};
+
+layout(set = 2, binding = 0, std430) readonly buffer Instances {
+    Instance instances[];
+};
+
+layout(set = 2, binding = 1, std430) readonly buffer Joints {
+    mat4 joints[];
+};
+
+layout(location = 0) in vec3 in_position;
+layout(location = 1) in vec3 in_normal;
+layout(location = 2) in vec4 in_tangent;
+layout(location = 3) in vec2 in_uv;
+layout(location = 4) in uvec4 in_joints;
+layout(location = 5) in vec4 in_weights;
+
+layout(location = 0) out vec3 out_position;
+layout(location = 1) out vec3 out_normal;
+layout(location = 2) out vec4 out_tangent;
+layout(location = 3) out vec2 out_uv;
+layout(location = 4) flat out uint out_material;
+
+void main() {
+    Instance instance = instances[gl_InstanceIndex];
+    mat4 skin = in_weights.x * joints[instance.first_joint + in_joints.x] +
+                in_weights.y * joints[instance.first_joint + in_joints.y] +
+                in_weights.z * joints[instance.first_joint + in_joints.z] +
+                in_weights.w * joints[instance.first_joint + in_joints.w];
+    mat4 model = instance.model * skin;
+    vec4 world_position = model * vec4(in_position, 1.0);
+    mat3 normal_matrix = transpose(inverse(mat3(model)));
+
+    out_position = world_position.xyz;
+    out_normal = normal_matrix * in_normal;
+    out_tangent = vec4(normal_matrix * in_tangent.xyz, in_tangent.w);
+    out_uv = in_uv;
+    out_material = instance.material;
+    gl_Position = camera.view_proj * world_position;
+}
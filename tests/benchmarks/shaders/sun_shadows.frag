@@ -0,0 +1,55 @@
+// Copyright (c) 2024 The Khronos Group Inc.
+// Copyright (c) 2024 Valve Corporation
+// Copyright (c) 2024 LunarG, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Deferred sun light with shadows traced by a ray query
+
+#version 460
+#extension GL_EXT_ray_query : require
+
+layout(set = 0, binding = 0) uniform accelerationStructureEXT scene;
+layout(set = 0, binding = 1) uniform sampler2D gbuffer_position;
+layout(set = 0, binding = 2) uniform sampler2D gbuffer_normal;
+layout(set = 0, binding = 3) uniform sampler2D gbuffer_albedo;
+
+layout(set = 0, binding = 4) uniform Sun {
+    vec4 direction;
+    vec4 color;
+} sun;
+
+layout(location = 0) in vec2 in_uv;
+
+layout(location = 0) out vec4 out_color;
+
+void main() {
+    vec3 position = texture(gbuffer_position, in_uv).xyz;
+    vec3 normal = normalize(texture(gbuffer_normal, in_uv).xyz);
+    vec3 albedo = texture(gbuffer_albedo, in_uv).rgb;
+    vec3 to_sun = -normalize(sun.direction.xyz);
+    float n_dot_l = max(dot(normal, to_sun), 0.0);
+
+    float visibility = 0.0;
+    if (n_dot_l > 0.0) {
+        rayQueryEXT query;
+        rayQueryInitializeEXT(query, scene, gl_RayFlagsTerminateOnFirstHitEXT | gl_RayFlagsOpaqueEXT, 0xFFu,
+                              position + normal * 0.01, 0.001, to_sun, 10000.0);
+        while (rayQueryProceedEXT(query)) {
+        }
+        if (rayQueryGetIntersectionTypeEXT(query, true) == gl_RayQueryCommittedIntersectionNoneEXT) {
+            visibility = 1.0;
+        }
+    }
+    out_color = vec4(albedo * sun.color.rgb * n_dot_l * visibility, 1.0);
+}
@@ -311,7 +311,7 @@ class NegativeDebugPrintf : public VkLayerTest {
 
 class VkSyncValTest : public VkLayerTest {
   public:
-    void InitSyncValFramework(bool disable_queue_submit_validation = false);
+    void InitSyncValFramework(bool disable_queue_submit_validation = false, uint32_t submit_validation_threads = 1);
 
   protected:
     const VkValidationFeatureEnableEXT enables_[1] = {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT};
@@ -126,6 +126,7 @@ int main(int argc, char** argv) {
     for (const auto info : module.link_info_) {
         module.LinkFunction(info);
     }
+    module.RemoveDeadLinkedCode();
     module.ToBinary(spirv_data);
 
     fp = fopen(out_file, "wb");
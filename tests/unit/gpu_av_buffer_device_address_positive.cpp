@@ -22,7 +22,7 @@ void GpuAVBufferDeviceAddressTest::InitGpuVUBufferDeviceAddress(void *p_next) {
     AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
     AddRequiredFeature(vkt::Feature::shaderInt64);
     AddDisabledFeature(vkt::Feature::robustBufferAccess);
-    RETURN_IF_SKIP(InitGpuAvFramework());
+    RETURN_IF_SKIP(InitGpuAvFramework(p_next));
     RETURN_IF_SKIP(InitState());
 }
 
@@ -426,4 +426,80 @@ TEST_F(PositiveGpuAVBufferDeviceAddress, DISABLED_ArrayOfStruct) {
 
     m_default_queue->submit(*m_commandBuffer);
     m_default_queue->wait();
-}
\ No newline at end of file
+}
+
+TEST_F(PositiveGpuAVBufferDeviceAddress, ManyBuffers) {
+    TEST_DESCRIPTION("Use more buffer device addresses than the BDA table initially has room for");
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    const uint32_t max_addresses = 2;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "gpuav_max_buffer_device_addresses", VK_LAYER_SETTING_TYPE_UINT32_EXT,
+                                       1, &max_addresses};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitGpuVUBufferDeviceAddress(&layer_settings_create_info));
+
+    char const *shader_source = R"glsl(
+        #version 450
+        #extension GL_EXT_buffer_reference : enable
+
+        layout(buffer_reference, buffer_reference_align = 16) buffer bdaStruct;
+
+        layout(set = 0, binding = 0) buffer foo {
+            bdaStruct data;
+        } in_buffer;
+
+        layout(buffer_reference, std140) buffer bdaStruct {
+            int a[4];
+        };
+
+        void main() {
+            in_buffer.data.a[3] = 0xca7;
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}};
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, shader_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.CreateComputePipeline();
+
+    VkMemoryPropertyFlags mem_props = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    VkMemoryAllocateFlagsInfo allocate_flag_info = vku::InitStructHelper();
+    allocate_flag_info.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+    std::vector<vkt::Buffer> bda_buffers(16);
+    for (auto &bda_buffer : bda_buffers) {
+        bda_buffer.init(*m_device, 64, VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR, mem_props, &allocate_flag_info);
+        bda_buffer.address();
+    }
+
+    vkt::Buffer in_buffer(*m_device, 8, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, mem_props);
+    pipe.descriptor_set_->WriteDescriptorBufferInfo(0, in_buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    pipe.descriptor_set_->UpdateDescriptorSets();
+
+    // The table grows at the next submission, command buffers recorded after it use the grown table
+    VkSubmitInfo empty_submit_info = vku::InitStructHelper();
+    vk::QueueSubmit(m_default_queue->handle(), 1, &empty_submit_info, VK_NULL_HANDLE);
+    m_default_queue->wait();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.pipeline_layout_.handle(), 0, 1,
+                              &pipe.descriptor_set_->set_, 0, nullptr);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    // Every buffer must be found in the table, whatever its position in it
+    for (size_t i = 0; i < bda_buffers.size(); i++) {
+        VkDeviceAddress buffer_ptr = bda_buffers[i].address();
+        uint8_t *in_buffer_ptr = (uint8_t *)in_buffer.memory().map();
+        memcpy(in_buffer_ptr, &buffer_ptr, sizeof(VkDeviceAddress));
+        in_buffer.memory().unmap();
+
+        m_default_queue->submit(*m_commandBuffer);
+        m_default_queue->wait();
+
+        // Destroying buffers removes them from the table
+        if (i % 2 == 1) {
+            bda_buffers[i - 1].destroy();
+        }
+    }
+}
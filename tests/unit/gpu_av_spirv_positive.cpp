@@ -351,3 +351,122 @@ TEST_F(PositiveGpuAVSpirv, VulkanMemoryModelDeviceScope) {
     m_default_queue->submit(*m_commandBuffer);
     m_default_queue->wait();
 }
+
+TEST_F(PositiveGpuAVSpirv, RemoveDeadLinkedCodeSpirv15) {
+    TEST_DESCRIPTION("Unused linked variables are removed from the entry point interface of a SPIR-V 1.4+ shader");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "gpuav_debug_validate_instrumented_shaders",
+                                       VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    uint32_t *data = (uint32_t *)buffer.memory().map();
+    data[0] = 1;
+    buffer.memory().unmap();
+
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                                 });
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer.handle(), 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer InOut {
+            uint x;
+            uint bar[8];
+        } foo;
+        void main() {
+            foo.bar[0] = foo.bar[foo.x];
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+    pipe.cp_ci_.layout = pipeline_layout.handle();
+    pipe.CreateComputePipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipe.Handle());
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_commandBuffer->end();
+
+    m_default_queue->submit(*m_commandBuffer);
+    m_default_queue->wait();
+}
+
+TEST_F(PositiveGpuAVSpirv, InstrumentPipelinesConcurrently) {
+    TEST_DESCRIPTION("Instrument the shaders of several pipelines from several threads at once");
+    AddRequiredExtensions(VK_EXT_LAYER_SETTINGS_EXTENSION_NAME);
+    AddRequiredExtensions(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::graphicsPipelineLibrary);
+    const VkBool32 value = true;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "gpuav_debug_validate_instrumented_shaders",
+                                       VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &value};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitGpuAvFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                                 });
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+
+    // Shaders given inline to pipeline libraries are instrumented when the pipelines are created, all the shaders of a call
+    // in parallel. Every shader is different, so none of them is found in the instrumented shader cache.
+    constexpr uint32_t kThreadCount = 4;
+    constexpr uint32_t kPipelineCount = 8;
+    const char *vs_source_begin = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) readonly buffer In {
+            uint x;
+            uint bar[8];
+        } foo;
+        void main() {
+            gl_Position = vec4(float(foo.bar[foo.x] + )glsl";
+    std::vector<std::vector<uint32_t>> spirv(kThreadCount * kPipelineCount);
+    for (uint32_t i = 0; i < spirv.size(); ++i) {
+        const std::string vs_source = vs_source_begin + std::to_string(i) + "u));\n}\n";
+        ASSERT_TRUE(GLSLtoSPV(&m_device->phy().limits_, VK_SHADER_STAGE_VERTEX_BIT, vs_source.c_str(), spirv[i]));
+    }
+
+    // Each module links its own copy of the instrumentation functions, the function IDs must not leak between them
+    const auto create_pipelines = [&](uint32_t thread) {
+        std::vector<std::unique_ptr<vkt::GraphicsPipelineLibraryStage>> stages;
+        std::vector<std::unique_ptr<CreatePipelineHelper>> pipes;
+        std::vector<VkGraphicsPipelineCreateInfo> pipeline_cis;
+        for (uint32_t i = 0; i < kPipelineCount; ++i) {
+            stages.emplace_back(std::make_unique<vkt::GraphicsPipelineLibraryStage>(spirv[thread * kPipelineCount + i],
+                                                                                    VK_SHADER_STAGE_VERTEX_BIT));
+            pipes.emplace_back(std::make_unique<CreatePipelineHelper>(*this));
+            pipes.back()->InitPreRasterLibInfo(&stages.back()->stage_ci);
+            pipes.back()->gp_ci_.layout = pipeline_layout.handle();
+            pipes.back()->LateBindPipelineInfo();
+            pipeline_cis.emplace_back(pipes.back()->gp_ci_);
+        }
+        std::array<VkPipeline, kPipelineCount> pipelines;
+        vk::CreateGraphicsPipelines(device(), VK_NULL_HANDLE, kPipelineCount, pipeline_cis.data(), nullptr, pipelines.data());
+        for (VkPipeline pipeline : pipelines) {
+            vk::DestroyPipeline(device(), pipeline, nullptr);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < kThreadCount; ++i) {
+        threads.emplace_back(create_pipelines, i);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
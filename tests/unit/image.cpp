@@ -5616,3 +5616,75 @@ TEST_F(NegativeImage, IncompatibleArrayAndSparseFlags) {
     vk::CreateImage(*m_device, &create_info, nullptr, &image);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativeImage, WholeAndPerSubresourceLayoutTransitions) {
+    TEST_DESCRIPTION("Mismatched layouts when going from whole image to per mip level layout transitions and back");
+    RETURN_IF_SKIP(Init());
+
+    // A single array layer, so each mismatch is for one subresource
+    const VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    vkt::Image image(*m_device, 32, 32, 4, VK_FORMAT_R8G8B8A8_UNORM, usage);
+
+    auto transition = [&image](vkt::CommandBuffer &cb, VkImageLayout old_layout, VkImageLayout new_layout, uint32_t base_mip,
+                               uint32_t mip_count) {
+        VkImageMemoryBarrier barrier = vku::InitStructHelper();
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
+        barrier.oldLayout = old_layout;
+        barrier.newLayout = new_layout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image.handle();
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, base_mip, mip_count, 0, 1};
+        vk::CmdPipelineBarrier(cb.handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr,
+                               0, nullptr, 1, &barrier);
+    };
+
+    vkt::CommandBuffer cb_init(*m_device, m_commandPool);
+    cb_init.begin();
+    transition(cb_init, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, VK_REMAINING_MIP_LEVELS);
+    cb_init.end();
+    cb_init.QueueCommandBuffer();
+
+    // Within one command buffer, a whole image transition after a per mip level one
+    m_commandBuffer->begin();
+    transition(*m_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, 1, 1);
+    m_errorMonitor->SetDesiredError("VUID-VkImageMemoryBarrier-oldLayout-01197");
+    transition(*m_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0,
+               VK_REMAINING_MIP_LEVELS);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+
+    // Across submissions, the image is left with a mip level in its own layout
+    vkt::CommandBuffer cb_split(*m_device, m_commandPool);
+    cb_split.begin();
+    transition(cb_split, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, 1, 1);
+    cb_split.end();
+    cb_split.QueueCommandBuffer();
+
+    vkt::CommandBuffer cb_whole(*m_device, m_commandPool);
+    cb_whole.begin();
+    transition(cb_whole, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0,
+               VK_REMAINING_MIP_LEVELS);
+    cb_whole.end();
+    m_errorMonitor->SetDesiredError("UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout");
+    cb_whole.QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+
+    // Once the mip level is back in the layout of the others, the whole image transition is valid
+    vkt::CommandBuffer cb_merge(*m_device, m_commandPool);
+    cb_merge.begin();
+    transition(cb_merge, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, 1);
+    cb_merge.end();
+    cb_merge.QueueCommandBuffer();
+    cb_whole.QueueCommandBuffer();
+
+    // A per mip level transition from the layout the image had before it was whole again
+    vkt::CommandBuffer cb_stale(*m_device, m_commandPool);
+    cb_stale.begin();
+    transition(cb_stale, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL, 2, 1);
+    cb_stale.end();
+    m_errorMonitor->SetDesiredError("UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout");
+    cb_stale.QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+}
@@ -1199,4 +1199,64 @@ TEST_F(PositiveImage, BlockTexelViewCompatibleMultipleLayers) {
     ivci.subresourceRange.levelCount = 1;
     ivci.subresourceRange.layerCount = 2;
     vkt::ImageView view(*m_device, ivci);
-}
\ No newline at end of file
+}
+
+TEST_F(PositiveImage, WholeAndPerSubresourceLayoutTransitions) {
+    TEST_DESCRIPTION("Go from whole image to per mip level layout transitions and back, within and across command buffers");
+    RETURN_IF_SKIP(Init());
+
+    const VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    vkt::Image image(*m_device, vkt::Image::ImageCreateInfo2D(32, 32, 4, 2, VK_FORMAT_R8G8B8A8_UNORM, usage));
+
+    auto transition = [&image](vkt::CommandBuffer &cb, VkImageLayout old_layout, VkImageLayout new_layout, uint32_t base_mip,
+                               uint32_t mip_count) {
+        VkImageMemoryBarrier barrier = vku::InitStructHelper();
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
+        barrier.oldLayout = old_layout;
+        barrier.newLayout = new_layout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image.handle();
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, base_mip, mip_count, 0, VK_REMAINING_ARRAY_LAYERS};
+        vk::CmdPipelineBarrier(cb.handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0, nullptr,
+                               0, nullptr, 1, &barrier);
+    };
+
+    // Within one command buffer
+    m_commandBuffer->begin();
+    transition(*m_commandBuffer, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, VK_REMAINING_MIP_LEVELS);
+    transition(*m_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, 1, 1);
+    VkImageCopy region = {};
+    region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 1, 0, 2};
+    region.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 2};
+    region.extent = {16, 16, 1};
+    vk::CmdCopyImage(m_commandBuffer->handle(), image.handle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image.handle(),
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    transition(*m_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, 1);
+    transition(*m_commandBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0,
+               VK_REMAINING_MIP_LEVELS);
+    m_commandBuffer->end();
+    m_commandBuffer->QueueCommandBuffer();
+
+    // Across submissions, the image is left with a mip level in its own layout
+    vkt::CommandBuffer cb_split(*m_device, m_commandPool);
+    cb_split.begin();
+    transition(cb_split, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, 2, 1);
+    cb_split.end();
+    cb_split.QueueCommandBuffer();
+
+    vkt::CommandBuffer cb_whole(*m_device, m_commandPool);
+    cb_whole.begin();
+    transition(cb_whole, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 2, 1);
+    transition(cb_whole, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL, 0, VK_REMAINING_MIP_LEVELS);
+    cb_whole.end();
+    cb_whole.QueueCommandBuffer();
+
+    // The image has a single layout again
+    vkt::CommandBuffer cb_after(*m_device, m_commandPool);
+    cb_after.begin();
+    transition(cb_after, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 0, VK_REMAINING_MIP_LEVELS);
+    cb_after.end();
+    cb_after.QueueCommandBuffer();
+}
@@ -1231,3 +1231,53 @@ TEST_F(NegativeObjectLifetime, FreeDescriptorSetsNull) {
     vk::FreeDescriptorSets(device(), ds_pool.handle(), 1, &invalid_set);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativeObjectLifetime, BufferInUseBySecondaryDestroyed) {
+    TEST_DESCRIPTION("Delete a buffer used by a secondary command buffer while the primary executing it is in flight.");
+    RETURN_IF_SKIP(Init());
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    vkt::CommandBuffer secondary(*m_device, m_commandPool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary.begin();
+    vk::CmdFillBuffer(secondary.handle(), buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    secondary.end();
+
+    m_commandBuffer->begin();
+    vk::CmdExecuteCommands(m_commandBuffer->handle(), 1, &secondary.handle());
+    m_commandBuffer->end();
+
+    m_default_queue->submit(*m_commandBuffer);
+
+    m_errorMonitor->SetDesiredError("VUID-vkDestroyBuffer-buffer-00922");
+    vk::DestroyBuffer(m_device->handle(), buffer.handle(), nullptr);
+    m_errorMonitor->VerifyFound();
+
+    m_default_queue->wait();
+}
+
+TEST_F(NegativeObjectLifetime, BufferDestroyedBreaksOnlyItsCommandBuffer) {
+    TEST_DESCRIPTION("Delete a buffer recorded in one of two command buffers, only that one becomes invalid.");
+    RETURN_IF_SKIP(Init());
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer other_buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    vkt::CommandBuffer other_cb(*m_device, m_commandPool);
+    other_cb.begin();
+    vk::CmdFillBuffer(other_cb.handle(), other_buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    other_cb.end();
+
+    m_commandBuffer->begin();
+    vk::CmdFillBuffer(m_commandBuffer->handle(), buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    m_commandBuffer->end();
+
+    buffer.destroy();
+
+    m_default_queue->submit(other_cb);
+    m_default_queue->wait();
+
+    m_errorMonitor->SetDesiredError("VUID-vkQueueSubmit-pCommandBuffers-00070");
+    m_default_queue->submit(*m_commandBuffer);
+    m_errorMonitor->VerifyFound();
+}
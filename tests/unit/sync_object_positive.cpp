@@ -2471,3 +2471,177 @@ TEST_F(PositiveSyncObject, SingleSubmitSignalBinarySemaphoreTwoTimes) {
     vk::QueueSubmit2(*m_default_queue, 3, submits, VK_NULL_HANDLE);
     m_default_queue->wait();
 }
+
+// Returns a queue of device other than queue, or nullptr if there is only one
+static vkt::Queue *FindOtherQueue(vkt::Device &device, const vkt::Queue *queue) {
+    for (const auto *queues : {&device.graphics_queues(), &device.compute_queues(), &device.dma_queues()}) {
+        for (vkt::Queue *other : *queues) {
+            if (other != queue) {
+                return other;
+            }
+        }
+    }
+    return nullptr;
+}
+
+// Submits cb to queue, waiting for wait_value (unless it is 0) and then signaling signal_value of the timeline semaphore
+static void SubmitTimeline(const vkt::Queue &queue, const vkt::Semaphore &semaphore, uint64_t wait_value, uint64_t signal_value,
+                           const vkt::CommandBuffer *cb = nullptr, VkFence fence = VK_NULL_HANDLE) {
+    VkTimelineSemaphoreSubmitInfoKHR timeline_submit_info = vku::InitStructHelper();
+    timeline_submit_info.waitSemaphoreValueCount = wait_value ? 1 : 0;
+    timeline_submit_info.pWaitSemaphoreValues = &wait_value;
+    timeline_submit_info.signalSemaphoreValueCount = signal_value ? 1 : 0;
+    timeline_submit_info.pSignalSemaphoreValues = &signal_value;
+
+    const VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkSubmitInfo submit_info = vku::InitStructHelper(&timeline_submit_info);
+    submit_info.waitSemaphoreCount = wait_value ? 1 : 0;
+    submit_info.pWaitSemaphores = &semaphore.handle();
+    submit_info.pWaitDstStageMask = &wait_stage;
+    submit_info.signalSemaphoreCount = signal_value ? 1 : 0;
+    submit_info.pSignalSemaphores = &semaphore.handle();
+    submit_info.commandBufferCount = cb ? 1 : 0;
+    submit_info.pCommandBuffers = cb ? &cb->handle() : nullptr;
+    vk::QueueSubmit(queue.handle(), 1, &submit_info, fence);
+}
+
+TEST_F(PositiveSyncObject, TimelineWaitsAcrossQueues) {
+    TEST_DESCRIPTION("Submissions of two queues waiting on each other in turns, all retired by one host wait");
+    AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::timelineSemaphore);
+    RETURN_IF_SKIP(Init());
+
+    vkt::Queue *q0 = m_default_queue;
+    vkt::Queue *q1 = FindOtherQueue(*m_device, q0);
+    if (q1 == nullptr) {
+        GTEST_SKIP() << "Test requires 2 queues";
+    }
+
+    VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, transfer_usage);
+    vkt::Buffer buffer_b(*m_device, 256, transfer_usage);
+    vkt::Buffer buffer_c(*m_device, 256, transfer_usage);
+    VkBufferCopy region = {0, 0, 256};
+
+    vkt::CommandPool pool0(*m_device, q0->get_family_index());
+    vkt::CommandBuffer cb_a_to_b(*m_device, &pool0);
+    cb_a_to_b.begin();
+    vk::CmdCopyBuffer(cb_a_to_b.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb_a_to_b.end();
+    vkt::CommandBuffer cb_c_to_a(*m_device, &pool0);
+    cb_c_to_a.begin();
+    vk::CmdCopyBuffer(cb_c_to_a.handle(), buffer_c.handle(), buffer_a.handle(), 1, &region);
+    cb_c_to_a.end();
+
+    vkt::CommandPool pool1(*m_device, q1->get_family_index());
+    vkt::CommandBuffer cb_b_to_c(*m_device, &pool1);
+    cb_b_to_c.begin();
+    vk::CmdCopyBuffer(cb_b_to_c.handle(), buffer_b.handle(), buffer_c.handle(), 1, &region);
+    cb_b_to_c.end();
+
+    VkSemaphoreTypeCreateInfo semaphore_type_create_info = vku::InitStructHelper();
+    semaphore_type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    VkSemaphoreCreateInfo semaphore_create_info = vku::InitStructHelper(&semaphore_type_create_info);
+    vkt::Semaphore semaphore(*m_device, semaphore_create_info);
+
+    // 1 is signaled by the host, every submission waits for the one before it on the other queue.
+    // The last submission of q0 can only retire after q1, which can only retire after the first submission of q0.
+    SubmitTimeline(*q0, semaphore, 1, 2, &cb_a_to_b);
+    SubmitTimeline(*q1, semaphore, 2, 3, &cb_b_to_c);
+    SubmitTimeline(*q0, semaphore, 3, 4, &cb_c_to_a);
+
+    VkSemaphoreSignalInfo signal_info = vku::InitStructHelper();
+    signal_info.semaphore = semaphore.handle();
+    signal_info.value = 1;
+    vk::SignalSemaphoreKHR(device(), &signal_info);
+
+    uint64_t wait_value = 4;
+    VkSemaphoreWaitInfo wait_info = vku::InitStructHelper();
+    wait_info.semaphoreCount = 1;
+    wait_info.pSemaphores = &semaphore.handle();
+    wait_info.pValues = &wait_value;
+    vk::WaitSemaphoresKHR(device(), &wait_info, kWaitTimeout);
+
+    // Every command buffer is retired, the buffers are not in use anymore
+    buffer_a.destroy();
+    buffer_b.destroy();
+    buffer_c.destroy();
+    m_device->wait();
+}
+
+TEST_F(PositiveSyncObject, ParkedQueueWokenBySignal) {
+    TEST_DESCRIPTION("Wait for a submission which waits on a signal of another queue that nothing asked to retire");
+    AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::timelineSemaphore);
+    RETURN_IF_SKIP(Init());
+
+    vkt::Queue *q0 = m_default_queue;
+    vkt::Queue *q1 = FindOtherQueue(*m_device, q0);
+    if (q1 == nullptr) {
+        GTEST_SKIP() << "Test requires 2 queues";
+    }
+
+    VkBufferUsageFlags transfer_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer buffer_a(*m_device, 256, transfer_usage);
+    vkt::Buffer buffer_b(*m_device, 256, transfer_usage);
+    VkBufferCopy region = {0, 0, 256};
+
+    vkt::CommandPool pool1(*m_device, q1->get_family_index());
+    vkt::CommandBuffer cb1(*m_device, &pool1);
+    cb1.begin();
+    vk::CmdCopyBuffer(cb1.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    cb1.end();
+
+    VkSemaphoreTypeCreateInfo semaphore_type_create_info = vku::InitStructHelper();
+    semaphore_type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    VkSemaphoreCreateInfo semaphore_create_info = vku::InitStructHelper(&semaphore_type_create_info);
+    vkt::Semaphore semaphore(*m_device, semaphore_create_info);
+    vkt::Fence fence(*m_device);
+
+    // The wait is submitted before the signal
+    SubmitTimeline(*q1, semaphore, 1, 0, &cb1, fence.handle());
+    SubmitTimeline(*q0, semaphore, 0, 1);
+
+    // Only q1 is asked to retire. It has to be parked until q0 retires the signal, which then lets q1 continue.
+    // Any of the two being missed would time out here.
+    fence.wait(kWaitTimeout);
+    buffer_a.destroy();
+    buffer_b.destroy();
+    m_device->wait();
+}
+
+TEST_F(PositiveSyncObject, DestroyDeviceWhileRetiring) {
+    TEST_DESCRIPTION("Destroy a device right after a host wait, while its queues may still be retiring submissions");
+    AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::timelineSemaphore);
+    RETURN_IF_SKIP(Init());
+
+    VkPhysicalDeviceTimelineSemaphoreFeatures timeline_features = vku::InitStructHelper();
+    timeline_features.timelineSemaphore = VK_TRUE;
+    vkt::Device test_device(gpu(), m_device_extension_names, nullptr, &timeline_features);
+    vkt::Queue *q0 = test_device.graphics_queues()[0];
+    vkt::Queue *q1 = FindOtherQueue(test_device, q0);
+    if (q1 == nullptr) {
+        GTEST_SKIP() << "Test requires 2 queues";
+    }
+
+    VkSemaphoreTypeCreateInfo semaphore_type_create_info = vku::InitStructHelper();
+    semaphore_type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    VkSemaphoreCreateInfo semaphore_create_info = vku::InitStructHelper(&semaphore_type_create_info);
+    for (uint32_t i = 0; i < 16; ++i) {
+        vkt::Semaphore semaphore(test_device, semaphore_create_info);
+        // q1 gets parked on the signal of q0
+        SubmitTimeline(*q1, semaphore, 1, 2);
+        SubmitTimeline(*q0, semaphore, 0, 1);
+
+        // Returns as soon as q1 retired the signal, the scheduler thread may still be popping the submission
+        uint64_t wait_value = 2;
+        VkSemaphoreWaitInfo wait_info = vku::InitStructHelper();
+        wait_info.semaphoreCount = 1;
+        wait_info.pSemaphores = &semaphore.handle();
+        wait_info.pValues = &wait_value;
+        vk::WaitSemaphoresKHR(test_device.handle(), &wait_info, kWaitTimeout);
+    }
+    // Removes the queues from the scheduler, which must not touch them afterwards
+    test_device.destroy();
+}
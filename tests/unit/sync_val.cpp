@@ -6699,3 +6699,49 @@ TEST_F(NegativeSyncVal, RenderPassStoreOpNone) {
     m_errorMonitor->VerifyFound();
     m_commandBuffer->end();
 }
+
+TEST_F(NegativeSyncVal, SubmitManyCommandBuffersHazard) {
+    TEST_DESCRIPTION("Hazards between command buffers of a submit large enough to be validated in parallel");
+    RETURN_IF_SKIP(InitSyncValFramework(false, 4));
+    RETURN_IF_SKIP(InitState());
+
+    constexpr int cb_count = 8;
+    std::vector<std::unique_ptr<vkt::Buffer>> buffers;
+    std::vector<std::unique_ptr<vkt::CommandBuffer>> cbs;
+    std::vector<const vkt::CommandBuffer *> submit_cbs;
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    VkBufferCopy region = {0, 0, 256};
+    for (int i = 0; i < cb_count; i++) {
+        buffers.emplace_back(std::make_unique<vkt::Buffer>(*m_device, 256, usage));
+        buffers.emplace_back(std::make_unique<vkt::Buffer>(*m_device, 256, usage));
+        cbs.emplace_back(std::make_unique<vkt::CommandBuffer>(*m_device, m_commandPool));
+        submit_cbs.emplace_back(cbs.back().get());
+    }
+    // Each command buffer copies its own buffer pair, except the last one which writes the source of the second one
+    for (int i = 0; i < cb_count; i++) {
+        const vkt::Buffer &src = *buffers[2 * i];
+        const vkt::Buffer &dst = (i == cb_count - 1) ? *buffers[2] : *buffers[2 * i + 1];
+        cbs[i]->begin();
+        vk::CmdCopyBuffer(*cbs[i], src, dst, 1, &region);
+        cbs[i]->end();
+    }
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-READ");
+    m_default_queue->submit(submit_cbs, vkt::Fence{}, false);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->wait();
+
+    // Hazard against a previous submit, with all command buffers of the second submit independent of each other
+    vkt::CommandBuffer fill_cb(*m_device, m_commandPool);
+    fill_cb.begin();
+    vk::CmdFillBuffer(fill_cb, *buffers[4], 0, 256, 1);
+    fill_cb.end();
+    m_default_queue->submit(fill_cb);
+
+    cbs[cb_count - 1]->begin();
+    vk::CmdCopyBuffer(*cbs[cb_count - 1], *buffers[2 * (cb_count - 1)], *buffers[2 * (cb_count - 1) + 1], 1, &region);
+    cbs[cb_count - 1]->end();
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-READ-AFTER-WRITE");
+    m_default_queue->submit(submit_cbs, vkt::Fence{}, false);
+    m_errorMonitor->VerifyFound();
+    m_default_queue->wait();
+}
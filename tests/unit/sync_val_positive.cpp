@@ -20,7 +20,7 @@
 
 class PositiveSyncVal : public VkSyncValTest {};
 
-void VkSyncValTest::InitSyncValFramework(bool disable_queue_submit_validation) {
+void VkSyncValTest::InitSyncValFramework(bool disable_queue_submit_validation, uint32_t submit_validation_threads) {
     // Enable synchronization validation
     features_ = {VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT, nullptr, 1u, enables_, 4, disables_};
 
@@ -29,16 +29,22 @@ void VkSyncValTest::InitSyncValFramework(bool disable_queue_submit_validation) {
         features_.disabledValidationFeatureCount = 0;
     }
 
-    // Optionally disable syncval submit validation
+    // Optionally disable syncval submit validation or validate submits on more threads
     static const char *kDisableQueuSubmitSyncValidation[] = {"VALIDATION_CHECK_DISABLE_SYNCHRONIZATION_VALIDATION_QUEUE_SUBMIT"};
-    static const VkLayerSettingEXT settings[] = {
-        {OBJECT_LAYER_NAME, "disables", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, kDisableQueuSubmitSyncValidation}};
+    std::vector<VkLayerSettingEXT> settings;
+    if (disable_queue_submit_validation) {
+        settings.push_back({OBJECT_LAYER_NAME, "disables", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, kDisableQueuSubmitSyncValidation});
+    }
+    if (submit_validation_threads != 1) {
+        settings.push_back({OBJECT_LAYER_NAME, "syncval_submit_validation_threads", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                            &submit_validation_threads});
+    }
     // The pNext of qs_settings is modified by InitFramework that's why it can't
     // be static (should be separate instance per stack frame). Also we show
     // explicitly that it's not const (InitFramework casts const pNext to non-const).
     VkLayerSettingsCreateInfoEXT qs_settings{VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
-                                             static_cast<uint32_t>(std::size(settings)), settings};
-    if (disable_queue_submit_validation) {
+                                             static_cast<uint32_t>(settings.size()), settings.data()};
+    if (!settings.empty()) {
         features_.pNext = &qs_settings;
     }
     InitFramework(&features_);
@@ -1822,3 +1828,86 @@ TEST_F(PositiveSyncVal, CopyBufferToCompressedImageASTC3) {
     vk::CmdCopyBufferToImage(*m_commandBuffer, src_buffer, dst_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &buffer_copy[1]);
     m_commandBuffer->end();
 }
+
+TEST_F(PositiveSyncVal, ThreadedCommandBufferRecording) {
+    TEST_DESCRIPTION("Record command buffers from multiple threads while other threads submit work");
+    RETURN_IF_SKIP(InitSyncValFramework());
+    RETURN_IF_SKIP(InitState());
+
+    constexpr int worker_count = 8;
+    ThreadTimeoutHelper timeout_helper(worker_count + 1 /* submitting thread */);
+
+    auto worker_thread = [&]() {
+        auto timeout_guard = timeout_helper.ThreadGuard();
+        // Command pool and resources per worker thread, so the recorded commands do not conflict with each other
+        vkt::CommandPool pool(*m_device, m_device->graphics_queue_node_index_, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+        vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+        VkBufferCopy region = {0, 0, 256};
+        VkMemoryBarrier barrier = vku::InitStructHelper();
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        constexpr int iteration_count = 200;
+        for (int i = 0; i < iteration_count; i++) {
+            vkt::CommandBuffer cb(*m_device, &pool);
+            cb.begin();
+            vk::CmdCopyBuffer(cb, buffer_a, buffer_b, 1, &region);
+            vk::CmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr,
+                                   0, nullptr);
+            vk::CmdCopyBuffer(cb, buffer_b, buffer_a, 1, &region);
+            cb.end();
+        }
+    };
+
+    // Queue level state is updated while the workers record
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    m_commandBuffer->begin();
+    vk::CmdFillBuffer(*m_commandBuffer, buffer, 0, 256, 1);
+    m_commandBuffer->end();
+    auto submitting_thread = [&]() {
+        auto timeout_guard = timeout_helper.ThreadGuard();
+        for (int i = 0; i < 200; i++) {
+            m_default_queue->submit(*m_commandBuffer);
+            m_default_queue->wait();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < worker_count; i++) {
+        workers.emplace_back(worker_thread);
+    }
+    workers.emplace_back(submitting_thread);
+    constexpr int wait_time = 60;
+    if (!timeout_helper.WaitForThreads(wait_time)) {
+        ADD_FAILURE() << "The waiting time for the worker threads exceeded the maximum limit: " << wait_time << " seconds.";
+        return;
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+TEST_F(PositiveSyncVal, SubmitManyIndependentCommandBuffers) {
+    TEST_DESCRIPTION("Submit enough command buffers without sync ops to validate them in parallel");
+    RETURN_IF_SKIP(InitSyncValFramework(false, 4));
+    RETURN_IF_SKIP(InitState());
+
+    constexpr int cb_count = 16;
+    std::vector<std::unique_ptr<vkt::Buffer>> buffers;
+    std::vector<std::unique_ptr<vkt::CommandBuffer>> cbs;
+    std::vector<const vkt::CommandBuffer *> submit_cbs;
+    VkBufferCopy region = {0, 0, 256};
+    for (int i = 0; i < cb_count; i++) {
+        auto &src = buffers.emplace_back(std::make_unique<vkt::Buffer>(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT));
+        auto &dst = buffers.emplace_back(std::make_unique<vkt::Buffer>(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT));
+        auto &cb = cbs.emplace_back(std::make_unique<vkt::CommandBuffer>(*m_device, m_commandPool));
+        cb->begin();
+        vk::CmdCopyBuffer(*cb, *src, *dst, 1, &region);
+        cb->end();
+        submit_cbs.emplace_back(cb.get());
+    }
+    m_default_queue->submit(submit_cbs, vkt::Fence{});
+    m_default_queue->wait();
+}
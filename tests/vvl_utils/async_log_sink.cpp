@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <cstdarg>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../framework/test_common.h"
+
+#include "error_message/logging.h"
+
+namespace {
+
+void Log(DebugReport &debug_report, const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    debug_report.LogMsg(kErrorBit, LogObjectList{}, nullptr, "UNASSIGNED-test-async-log", format, argptr);
+    va_end(argptr);
+}
+
+std::string ReadFile(const std::string &path) {
+    std::ifstream file(path, std::ifstream::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+TEST(AsyncLogSink, FlushedOnDeviceDestroy) {
+    constexpr uint32_t kThreads = 4;
+    constexpr uint32_t kMessagesPerThread = 200;
+    const std::string path = (std::filesystem::temp_directory_path() / "vvl_test_async_log_sink.txt").string();
+    FILE *log_output = fopen(path.c_str(), "w");
+    ASSERT_NE(log_output, nullptr);
+
+    {
+        // Set up the same way as LayerDebugMessengerActions() does with the log_async setting
+        DebugReport debug_report;
+        debug_report.async_log_sink = std::make_unique<AsyncLogSink>(log_output);
+        VkDebugUtilsMessengerCreateInfoEXT create_info = vku::InitStructHelper();
+        create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+        create_info.pfnUserCallback = MessengerAsyncLogCallback;
+        create_info.pUserData = debug_report.async_log_sink.get();
+        VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+        LayerCreateMessengerCallback(&debug_report, true, &create_info, &messenger);
+
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&debug_report, t]() {
+                for (uint32_t i = 0; i < kMessagesPerThread; ++i) {
+                    Log(debug_report, "message %u from thread %u", i, t);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        // What vkDestroyDevice does, the instance and the writer thread are still alive afterwards
+        debug_report.FlushLogOutput();
+        const std::string log = ReadFile(path);
+        ASSERT_EQ(debug_report.async_log_sink->DroppedCount(), 0u);
+        for (uint32_t t = 0; t < kThreads; ++t) {
+            for (uint32_t i = 0; i < kMessagesPerThread; ++i) {
+                const std::string message = "message " + std::to_string(i) + " from thread " + std::to_string(t) + "\n";
+                ASSERT_NE(log.find(message), std::string::npos) << message;
+            }
+        }
+
+        // Nothing logged since, flushing again returns right away
+        debug_report.FlushLogOutput();
+        ASSERT_EQ(ReadFile(path), log);
+    }
+
+    fclose(log_output);
+    std::remove(path.c_str());
+}
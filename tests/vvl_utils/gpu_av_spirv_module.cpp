@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "../framework/test_common.h"
+#include "spirv-tools/libspirv.hpp"
+
+#include "gpu_validation/spirv/module.h"
+#include "generated/inst_bindless_descriptor_comp.h"
+
+using gpuav::spirv::Instruction;
+using gpuav::spirv::LinkFunctions;
+using gpuav::spirv::LinkInfo;
+using gpuav::spirv::Module;
+
+namespace {
+
+constexpr uint32_t kShaderId = 23;
+constexpr uint32_t kInstDescriptorSet = 7;
+constexpr spv_target_env kSpirvEnv = SPV_ENV_VULKAN_1_2;
+
+// SPIR-V 1.5, so the linked variables are added to the interface of the entry point. The OpStore through a
+// PhysicalStorageBuffer pointer is instrumented by the BufferDeviceAddress pass.
+const char *kBufferDeviceAddressShader = R"(
+               OpCapability Shader
+               OpCapability PhysicalStorageBufferAddresses
+               OpMemoryModel PhysicalStorageBuffer64 GLSL450
+               OpEntryPoint GLCompute %main "main" %pc
+               OpExecutionMode %main LocalSize 1 1 1
+               OpDecorate %Data Block
+               OpMemberDecorate %Data 0 Offset 0
+               OpDecorate %PushConstants Block
+               OpMemberDecorate %PushConstants 0 Offset 0
+       %void = OpTypeVoid
+   %void_fn = OpTypeFunction %void
+       %uint = OpTypeInt 32 0
+        %int = OpTypeInt 32 1
+      %int_0 = OpConstant %int 0
+     %uint_7 = OpConstant %uint 7
+       %Data = OpTypeStruct %uint
+   %data_ptr = OpTypePointer PhysicalStorageBuffer %Data
+%PushConstants = OpTypeStruct %data_ptr
+     %pc_ptr = OpTypePointer PushConstant %PushConstants
+         %pc = OpVariable %pc_ptr PushConstant
+%pc_data_ptr = OpTypePointer PushConstant %data_ptr
+   %uint_ptr = OpTypePointer PhysicalStorageBuffer %uint
+       %main = OpFunction %void None %void_fn
+      %entry = OpLabel
+          %1 = OpAccessChain %pc_data_ptr %pc %int_0
+          %2 = OpLoad %data_ptr %1
+          %3 = OpAccessChain %uint_ptr %2 %int_0
+               OpStore %3 %uint_7 Aligned 4
+               OpReturn
+               OpFunctionEnd
+)";
+
+std::vector<uint32_t> Assemble(const char *source) {
+    spvtools::SpirvTools tools(kSpirvEnv);
+    std::vector<uint32_t> spirv;
+    tools.Assemble(source, &spirv);
+    return spirv;
+}
+
+bool Validate(const std::vector<uint32_t> &spirv) { return spvtools::SpirvTools(kSpirvEnv).Validate(spirv); }
+
+// Links the bindless descriptor function into the module without anything calling it
+uint32_t AddUncalledLink(Module &module) {
+    LinkInfo info = {inst_bindless_descriptor_comp, inst_bindless_descriptor_comp_size, LinkFunctions::inst_bindless_descriptor,
+                     module.TakeNextId(), "inst_bindless_descriptor"};
+    module.link_info_.push_back(info);
+    return info.function_id;
+}
+
+// What the instrumented binary defines and references
+struct Binary {
+    explicit Binary(const std::vector<uint32_t> &spirv) {
+        for (uint32_t offset = 5; offset < spirv.size(); offset += spirv[offset] >> 16) {
+            const Instruction inst(&spirv[offset]);
+            const uint32_t opcode = inst.Opcode();
+            if (opcode == spv::OpEntryPoint) {
+                entry_point_words.assign(spirv.begin() + offset, spirv.begin() + offset + inst.Length());
+                entry_point_interface = EntryPointInterface(inst);
+                continue;
+            }
+            if (opcode == spv::OpName || opcode == spv::OpMemberName || opcode == spv::OpDecorate ||
+                opcode == spv::OpMemberDecorate) {
+                targets.push_back(inst.Word(1));
+                continue;
+            }
+            if (opcode == spv::OpFunction) {
+                functions.push_back(inst.ResultId());
+            } else if (opcode == spv::OpVariable && inst.Word(3) != spv::StorageClassFunction) {
+                global_variables.push_back(inst.ResultId());
+            }
+            if (inst.ResultId() != 0) {
+                defined_ids.push_back(inst.ResultId());
+                if (GetSpvType(opcode) != SpvType::Empty || gpuav::spirv::ConstantOperation(opcode)) {
+                    types_constants.push_back(inst.ResultId());
+                }
+            }
+            inst.AppendUsedIds(used_ids);
+        }
+    }
+
+    static std::vector<uint32_t> EntryPointInterface(const Instruction &entry_point) {
+        // The interface comes after the name, the last word of a string has its highest byte as null
+        uint32_t word = 3;
+        while ((entry_point.Word(word) >> 24) != 0) {
+            word++;
+        }
+        std::vector<uint32_t> interface;
+        for (word++; word < entry_point.Length(); word++) {
+            interface.push_back(entry_point.Word(word));
+        }
+        return interface;
+    }
+
+    static bool Contains(const std::vector<uint32_t> &ids, uint32_t id) {
+        return std::find(ids.begin(), ids.end(), id) != ids.end();
+    }
+    bool IsDefined(uint32_t id) const { return Contains(defined_ids, id); }
+    bool IsUsed(uint32_t id) const { return Contains(used_ids, id); }
+
+    std::vector<uint32_t> entry_point_words;
+    std::vector<uint32_t> entry_point_interface;
+    // OpName, OpMemberName, OpDecorate and OpMemberDecorate targets
+    std::vector<uint32_t> targets;
+    std::vector<uint32_t> functions;
+    std::vector<uint32_t> global_variables;
+    std::vector<uint32_t> types_constants;
+    std::vector<uint32_t> defined_ids;
+    // Referenced by an instruction other than the ones in |targets| or the entry point
+    std::vector<uint32_t> used_ids;
+};
+
+}  // namespace
+
+TEST(GpuAVSpirvModule, RemoveUncalledLinkedFunction) {
+    const std::vector<uint32_t> spirv = Assemble(kBufferDeviceAddressShader);
+    ASSERT_TRUE(Validate(spirv));
+    const Binary original(spirv);
+
+    // No pass is ran, so nothing calls the linked function
+    Module module(spirv, kShaderId, kInstDescriptorSet);
+    const uint32_t function_id = AddUncalledLink(module);
+    const uint32_t first_linked_id = module.header_.bound;
+    for (const auto &info : module.link_info_) {
+        module.LinkFunction(info);
+    }
+
+    std::vector<uint32_t> linked_spirv;
+    module.ToBinary(linked_spirv);
+    const Binary linked(linked_spirv);
+    ASSERT_TRUE(linked.IsDefined(function_id));
+    ASSERT_GT(linked.entry_point_interface.size(), original.entry_point_interface.size());
+
+    module.RemoveDeadLinkedCode();
+    std::vector<uint32_t> instrumented_spirv;
+    module.ToBinary(instrumented_spirv);
+    ASSERT_TRUE(Validate(instrumented_spirv));
+    const Binary instrumented(instrumented_spirv);
+
+    // Everything the linked module brought in is gone, only what was already in the shader is left
+    ASSERT_EQ(instrumented.functions, original.functions);
+    ASSERT_FALSE(instrumented.IsDefined(function_id));
+    for (uint32_t id : instrumented.defined_ids) {
+        ASSERT_LT(id, first_linked_id);
+    }
+    for (uint32_t id : instrumented.targets) {
+        ASSERT_TRUE(instrumented.IsDefined(id));
+    }
+    ASSERT_EQ(instrumented.entry_point_words, original.entry_point_words);
+    ASSERT_EQ(instrumented.global_variables, original.global_variables);
+}
+
+TEST(GpuAVSpirvModule, RemoveDeadLinkedCode) {
+    const std::vector<uint32_t> spirv = Assemble(kBufferDeviceAddressShader);
+    ASSERT_TRUE(Validate(spirv));
+    const Binary original(spirv);
+
+    Module module(spirv, kShaderId, kInstDescriptorSet);
+    module.RunPassBufferDeviceAddress();
+    ASSERT_EQ(module.link_info_.size(), 1u);
+    const uint32_t called_function_id = module.link_info_[0].function_id;
+    const uint32_t uncalled_function_id = AddUncalledLink(module);
+    const uint32_t first_linked_id = module.header_.bound;
+    for (const auto &info : module.link_info_) {
+        module.LinkFunction(info);
+    }
+
+    std::vector<uint32_t> linked_spirv;
+    module.ToBinary(linked_spirv);
+    const Binary linked(linked_spirv);
+
+    module.RemoveDeadLinkedCode();
+    std::vector<uint32_t> instrumented_spirv;
+    module.ToBinary(instrumented_spirv);
+    ASSERT_TRUE(Validate(instrumented_spirv));
+    const Binary instrumented(instrumented_spirv);
+
+    // The called function is kept, the uncalled one is dropped
+    ASSERT_EQ(instrumented.functions.size(), original.functions.size() + 1);
+    ASSERT_TRUE(instrumented.IsDefined(called_function_id));
+    ASSERT_FALSE(instrumented.IsDefined(uncalled_function_id));
+
+    // Globals only the uncalled function used were removed as well
+    ASSERT_LT(instrumented.types_constants.size(), linked.types_constants.size());
+    ASSERT_LT(instrumented.global_variables.size(), linked.global_variables.size());
+    ASSERT_LT(instrumented.targets.size(), linked.targets.size());
+    ASSERT_LT(instrumented.entry_point_interface.size(), linked.entry_point_interface.size());
+
+    // Every linked Type, Constant and Variable left is used by a function or another one left
+    for (uint32_t id : instrumented.types_constants) {
+        if (id >= first_linked_id) {
+            ASSERT_TRUE(instrumented.IsUsed(id));
+        }
+    }
+    for (uint32_t id : instrumented.global_variables) {
+        if (id >= first_linked_id) {
+            ASSERT_TRUE(instrumented.IsUsed(id));
+        }
+    }
+
+    // No name, decoration or interface entry is left for a removed ID
+    for (uint32_t id : instrumented.targets) {
+        ASSERT_TRUE(instrumented.IsDefined(id));
+    }
+    for (uint32_t id : instrumented.entry_point_interface) {
+        ASSERT_TRUE(Binary::Contains(instrumented.global_variables, id));
+    }
+}
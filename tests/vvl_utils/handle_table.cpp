@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include "containers/handle_table.h"
+
+TEST(CustomContainer, HandleTableInsertFindPop) {
+    vvl::concurrent_handle_table table;
+    ASSERT_TRUE(table.find(0) == table.end());
+
+    const uint64_t key_a = table.insert(0xA);
+    const uint64_t key_b = table.insert(0xB);
+    ASSERT_NE(key_a, 0u);
+    ASSERT_NE(key_b, 0u);
+    ASSERT_NE(key_a, key_b);
+    ASSERT_EQ(table.size(), 2u);
+
+    auto iter = table.find(key_a);
+    ASSERT_TRUE(iter != table.end());
+    ASSERT_EQ(iter->second, 0xAu);
+    ASSERT_EQ(table.find(key_b)->second, 0xBu);
+
+    iter = table.pop(key_a);
+    ASSERT_TRUE(iter != table.end());
+    ASSERT_EQ(iter->second, 0xAu);
+    ASSERT_TRUE(table.find(key_a) == table.end());
+    ASSERT_TRUE(table.pop(key_a) == table.end());
+    ASSERT_FALSE(table.erase(key_a));
+
+    ASSERT_TRUE(table.erase(key_b));
+    ASSERT_EQ(table.size(), 0u);
+}
+
+TEST(CustomContainer, HandleTableStaleKey) {
+    vvl::concurrent_handle_table table;
+    const uint64_t stale_key = table.insert(1);
+    table.erase(stale_key);
+
+    // The freed slot is reused, but the old key must not resolve to the new value
+    const uint64_t new_key = table.insert(2);
+    ASSERT_NE(stale_key, new_key);
+    ASSERT_EQ(static_cast<uint32_t>(stale_key), static_cast<uint32_t>(new_key));
+    ASSERT_TRUE(table.find(stale_key) == table.end());
+    ASSERT_EQ(table.find(new_key)->second, 2u);
+
+    // Keys which were never handed out
+    ASSERT_TRUE(table.find(new_key + (1ull << 32)) == table.end());
+    ASSERT_TRUE(table.find(0xFFFFFFFFull) == table.end());
+}
+
+TEST(CustomContainer, HandleTableGrow) {
+    vvl::concurrent_handle_table table;
+    std::vector<uint64_t> keys;
+    // Spans several segments
+    for (uint64_t i = 0; i < 100000; ++i) {
+        keys.push_back(table.insert(i));
+    }
+    for (uint64_t i = 0; i < keys.size(); ++i) {
+        auto iter = table.find(keys[i]);
+        ASSERT_TRUE(iter != table.end());
+        ASSERT_EQ(iter->second, i);
+    }
+    for (size_t i = 0; i < keys.size(); i += 2) {
+        table.erase(keys[i]);
+    }
+    ASSERT_EQ(table.size(), keys.size() / 2);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ(table.find(keys[i]) != table.end(), (i % 2) == 1);
+    }
+}
+
+TEST(CustomContainer, HandleTableConcurrent) {
+    vvl::concurrent_handle_table table;
+    constexpr uint32_t kThreads = 8;
+    constexpr uint32_t kIterations = 10000;
+
+    // Long lived handles that are looked up while other threads create and destroy handles
+    std::vector<uint64_t> shared_keys;
+    for (uint64_t i = 0; i < 64; ++i) {
+        shared_keys.push_back(table.insert(i));
+    }
+
+    std::atomic<uint32_t> errors{0};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (uint32_t i = 0; i < kIterations; ++i) {
+                const uint64_t value = (uint64_t(t) << 32) | i;
+                const uint64_t key = table.insert(value);
+                for (uint64_t s = 0; s < shared_keys.size(); ++s) {
+                    auto iter = table.find(shared_keys[s]);
+                    if (iter == table.end() || iter->second != s) {
+                        errors++;
+                    }
+                }
+                auto iter = table.pop(key);
+                if (iter == table.end() || iter->second != value) {
+                    errors++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(errors.load(), 0u);
+    ASSERT_EQ(table.size(), shared_keys.size());
+}
+
+TEST(CustomContainer, WrappedHandleMap) {
+    vvl::concurrent_handle_table table;
+    vvl::concurrent_wrapped_handle_map map;
+    const uint64_t key_a = table.insert(0xA);
+    const uint64_t key_b = table.insert(0xB);
+    ASSERT_TRUE(map.find(key_a) == map.end());
+
+    ASSERT_TRUE(map.insert(key_a, 1));
+    ASSERT_TRUE(map.insert(key_b, 2));
+    ASSERT_EQ(map.find(key_a)->second, 1u);
+    ASSERT_EQ(map.find(key_b)->second, 2u);
+    ASSERT_FALSE(map.insert(key_a, 3));
+
+    // Only removed when mapped to the expected value
+    ASSERT_FALSE(map.erase(key_a, 2));
+    ASSERT_TRUE(map.find(key_a) != map.end());
+
+    // The handle table reuses the slot of key_a before key_a is erased from the map
+    table.erase(key_a);
+    const uint64_t key_c = table.insert(0xC);
+    ASSERT_EQ(static_cast<uint32_t>(key_a), static_cast<uint32_t>(key_c));
+    ASSERT_FALSE(map.insert(key_c, 3));
+    ASSERT_TRUE(map.find(key_c) == map.end());
+
+    ASSERT_TRUE(map.erase(key_a, 1));
+    ASSERT_TRUE(map.find(key_a) == map.end());
+    ASSERT_TRUE(map.insert(key_c, 3));
+    ASSERT_EQ(map.find(key_c)->second, 3u);
+    ASSERT_TRUE(map.find(key_a) == map.end());
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../framework/test_common.h"
+
+#include "gpu_validation/gpu_shader_cache.h"
+
+using gpu_tracker::InstrumentedShaderCache;
+
+namespace {
+
+// Offsets in InstrumentedShaderCache::FileHeader
+constexpr size_t kFileVersionOffset = 4;
+constexpr size_t kPassIdOffset = 56;
+constexpr size_t kHeaderSize = 120;
+
+constexpr uint64_t kConfig = 0x1234;
+constexpr uint64_t kOtherConfig = 0x5678;
+
+class ShaderCacheFile {
+  public:
+    explicit ShaderCacheFile(const char *name) : path_((std::filesystem::temp_directory_path() / name).string()) {
+        std::remove(path_.c_str());
+    }
+    ~ShaderCacheFile() { std::remove(path_.c_str()); }
+
+    const std::string &Path() const { return path_; }
+
+    std::vector<char> Read() const {
+        std::ifstream file(path_, std::ifstream::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    void Write(const std::vector<char> &data) const {
+        std::ofstream file(path_, std::ofstream::binary | std::ofstream::trunc);
+        file.write(data.data(), data.size());
+    }
+
+  private:
+    std::string path_;
+};
+
+void SaveEntries(const std::string &path, uint64_t config_hash,
+                 const std::vector<std::pair<uint32_t, std::vector<uint32_t>>> &entries) {
+    InstrumentedShaderCache cache;
+    cache.Load(path, config_hash);
+    for (const auto &[shader_hash, code] : entries) {
+        cache.Add(shader_hash, code);
+    }
+    cache.Save();
+}
+
+bool Contains(InstrumentedShaderCache &cache, uint32_t shader_hash, const std::vector<uint32_t> &code) {
+    const auto found = cache.Find(shader_hash);
+    return std::vector<uint32_t>(found.begin(), found.end()) == code;
+}
+
+const std::vector<uint32_t> kCodeA = {0x07230203, 0x00010000, 1, 2, 3};
+const std::vector<uint32_t> kCodeB = {0x07230203, 0x00010300, 4, 5, 6, 7, 8};
+
+}  // namespace
+
+TEST(InstrumentedShaderCache, RoundTrip) {
+    ShaderCacheFile file("vvl_test_shader_cache_round_trip.bin");
+    SaveEntries(file.Path(), kConfig, {{1, kCodeA}, {2, kCodeB}});
+    ASSERT_FALSE(file.Read().empty());
+
+    InstrumentedShaderCache cache;
+    cache.Load(file.Path(), kConfig);
+    ASSERT_TRUE(Contains(cache, 1, kCodeA));
+    ASSERT_TRUE(Contains(cache, 2, kCodeB));
+    ASSERT_TRUE(cache.Find(3).empty());
+
+    // Adding to a loaded cache keeps the entries already in the file
+    cache.Add(3, kCodeA);
+    cache.Save();
+    InstrumentedShaderCache reloaded;
+    reloaded.Load(file.Path(), kConfig);
+    ASSERT_TRUE(Contains(reloaded, 1, kCodeA));
+    ASSERT_TRUE(Contains(reloaded, 2, kCodeB));
+    ASSERT_TRUE(Contains(reloaded, 3, kCodeA));
+}
+
+TEST(InstrumentedShaderCache, NothingToSave) {
+    ShaderCacheFile file("vvl_test_shader_cache_nothing_to_save.bin");
+    InstrumentedShaderCache cache;
+    cache.Load(file.Path(), kConfig);
+    ASSERT_TRUE(cache.Find(1).empty());
+    cache.Save();
+    ASSERT_TRUE(file.Read().empty());
+}
+
+TEST(InstrumentedShaderCache, ConfigHashMismatch) {
+    ShaderCacheFile file("vvl_test_shader_cache_config_hash.bin");
+    SaveEntries(file.Path(), kConfig, {{1, kCodeA}});
+
+    {
+        InstrumentedShaderCache cache;
+        cache.Load(file.Path(), kOtherConfig);
+        ASSERT_TRUE(cache.Find(1).empty());
+        cache.Add(1, kCodeB);
+        cache.Save();
+    }
+
+    // Both configurations are kept in the file
+    InstrumentedShaderCache cache;
+    cache.Load(file.Path(), kConfig);
+    ASSERT_TRUE(Contains(cache, 1, kCodeA));
+    InstrumentedShaderCache other_cache;
+    other_cache.Load(file.Path(), kOtherConfig);
+    ASSERT_TRUE(Contains(other_cache, 1, kCodeB));
+}
+
+TEST(InstrumentedShaderCache, TruncatedFile) {
+    ShaderCacheFile file("vvl_test_shader_cache_truncated.bin");
+    SaveEntries(file.Path(), kConfig, {{1, kCodeA}, {2, kCodeB}});
+    const std::vector<char> data = file.Read();
+    ASSERT_GT(data.size(), kHeaderSize);
+
+    // Within the header, within the entry table and within the code of the last entry
+    for (size_t size : {kHeaderSize / 2, kHeaderSize + 8, data.size() - sizeof(uint32_t)}) {
+        file.Write(std::vector<char>(data.begin(), data.begin() + size));
+        InstrumentedShaderCache cache;
+        cache.Load(file.Path(), kConfig);
+        ASSERT_TRUE(cache.Find(1).empty());
+        ASSERT_TRUE(cache.Find(2).empty());
+    }
+}
+
+TEST(InstrumentedShaderCache, CorruptedFile) {
+    ShaderCacheFile file("vvl_test_shader_cache_corrupted.bin");
+    SaveEntries(file.Path(), kConfig, {{1, kCodeA}});
+    const std::vector<char> data = file.Read();
+
+    // Entry table
+    std::vector<char> corrupted = data;
+    corrupted[kHeaderSize] ^= 1;
+    file.Write(corrupted);
+    {
+        InstrumentedShaderCache cache;
+        cache.Load(file.Path(), kConfig);
+        ASSERT_TRUE(cache.Find(1).empty());
+    }
+
+    // Code, only noticed when the entry is looked up
+    corrupted = data;
+    corrupted.back() ^= 1;
+    file.Write(corrupted);
+    {
+        InstrumentedShaderCache cache;
+        cache.Load(file.Path(), kConfig);
+        ASSERT_TRUE(cache.Find(1).empty());
+        cache.Add(2, kCodeB);
+        cache.Save();
+    }
+
+    // The corrupted entry is dropped when the file is rewritten
+    InstrumentedShaderCache cache;
+    cache.Load(file.Path(), kConfig);
+    ASSERT_TRUE(cache.Find(1).empty());
+    ASSERT_TRUE(Contains(cache, 2, kCodeB));
+}
+
+TEST(InstrumentedShaderCache, WrongVersion) {
+    ShaderCacheFile file("vvl_test_shader_cache_version.bin");
+    SaveEntries(file.Path(), kConfig, {{1, kCodeA}});
+    const std::vector<char> data = file.Read();
+
+    // File layout version and instrumentation passes of another build
+    for (size_t offset : {kFileVersionOffset, kPassIdOffset}) {
+        std::vector<char> other_version = data;
+        other_version[offset] ^= 1;
+        file.Write(other_version);
+        InstrumentedShaderCache cache;
+        cache.Load(file.Path(), kConfig);
+        ASSERT_TRUE(cache.Find(1).empty());
+    }
+
+    // Files of another build are replaced rather than merged
+    {
+        InstrumentedShaderCache cache;
+        cache.Load(file.Path(), kConfig);
+        cache.Add(2, kCodeB);
+        cache.Save();
+    }
+    InstrumentedShaderCache cache;
+    cache.Load(file.Path(), kConfig);
+    ASSERT_TRUE(cache.Find(1).empty());
+    ASSERT_TRUE(Contains(cache, 2, kCodeB));
+}
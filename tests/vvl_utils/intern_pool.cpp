@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <bitset>
+#include <thread>
+#include <vector>
+
+#include "../framework/test_common.h"
+
+#include "containers/intern_pool.h"
+
+using TestFlags = std::bitset<192>;
+
+TEST(CustomContainer, InternPoolIntern) {
+    vvl::intern_pool<TestFlags> pool(1);
+    ASSERT_EQ(pool.Size(), 1u);
+    ASSERT_EQ(pool.Intern(TestFlags()), pool.kDefault);
+    ASSERT_TRUE(pool.Get(pool.kDefault).none());
+
+    TestFlags a;
+    a.set(3);
+    TestFlags b;
+    b.set(3).set(130);
+    const auto index_a = pool.Intern(a);
+    const auto index_b = pool.Intern(b);
+    ASSERT_NE(index_a, index_b);
+    ASSERT_EQ(pool.Get(index_a), a);
+    ASSERT_EQ(pool.Get(index_b), b);
+    ASSERT_EQ(pool.Size(), 3u);
+
+    // Equal values share the index, whether they come from the thread cache or the locked lookup
+    ASSERT_EQ(pool.Intern(a), index_a);
+    ASSERT_EQ(pool.Intern(TestFlags(b)), index_b);
+    std::thread([&]() { ASSERT_EQ(pool.Intern(b), index_b); }).join();
+    ASSERT_EQ(pool.Size(), 3u);
+}
+
+TEST(CustomContainer, InternPoolCacheSharedBetweenPools) {
+    // The per thread cache is shared by the pools of a type, an index of one pool must not be returned by another
+    TestFlags a;
+    a.set(7);
+    TestFlags b;
+    b.set(8);
+    vvl::intern_pool<TestFlags> first(1);
+    const auto first_a = first.Intern(a);
+    vvl::intern_pool<TestFlags> second(1);
+    const auto second_b = second.Intern(b);
+    ASSERT_EQ(first_a, second_b);
+    const auto second_a = second.Intern(a);
+    ASSERT_NE(second_a, second_b);
+    ASSERT_EQ(second.Get(second_a), a);
+    ASSERT_EQ(first.Intern(a), first_a);
+}
+
+TEST(CustomContainer, InternPoolOverflow) {
+    vvl::intern_pool<TestFlags> pool(2);
+    std::vector<uint32_t> indices;
+    // Index 0 is taken by the default value
+    for (size_t i = 1; i < pool.Capacity(); ++i) {
+        TestFlags flags(i);
+        indices.push_back(pool.Intern(flags));
+        ASSERT_NE(indices.back(), pool.kOverflow);
+    }
+    ASSERT_EQ(pool.Size(), pool.Capacity());
+
+    // New values are refused once full, the ones already interned are still found
+    TestFlags extra;
+    extra.set(191);
+    ASSERT_EQ(pool.Intern(extra), pool.kOverflow);
+    ASSERT_EQ(pool.Size(), pool.Capacity());
+    for (size_t i = 1; i < pool.Capacity(); ++i) {
+        TestFlags flags(i);
+        ASSERT_EQ(pool.Intern(flags), indices[i - 1]);
+        ASSERT_EQ(pool.Get(indices[i - 1]), flags);
+    }
+    ASSERT_EQ(pool.Intern(TestFlags()), pool.kDefault);
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <thread>
+
+#include "../framework/test_common.h"
+
+#include "error_message/logging.h"
+
+TEST(MessageIds, FilterSet) {
+    MessageIdSet filter;
+    ASSERT_TRUE(filter.empty());
+    filter.insert(0x1234);
+    // Shares its prefilter bit with 0x1234
+    filter.insert(0x1234 + 4096);
+    ASSERT_EQ(filter.size(), 2u);
+    ASSERT_TRUE(filter.contains(0x1234));
+    ASSERT_TRUE(filter.contains(0x1234 + 4096));
+    ASSERT_FALSE(filter.contains(0x1235));
+    ASSERT_FALSE(filter.contains(0x1234 + 2 * 4096));
+}
+
+TEST(MessageIds, DuplicateCounts) {
+    MessageIdCounts counts;
+    // Message id 0 must not be confused with an empty slot
+    for (uint32_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(counts.TryIncrement(0, 3));
+    }
+    ASSERT_FALSE(counts.TryIncrement(0, 3));
+
+    // Ids which all want the same slot end up in the overflow map once the probes run out
+    for (uint32_t i = 0; i < 32; ++i) {
+        const uint32_t message_id = 7 + i * 4096;
+        ASSERT_TRUE(counts.TryIncrement(message_id, 2));
+        ASSERT_TRUE(counts.TryIncrement(message_id, 2));
+        ASSERT_FALSE(counts.TryIncrement(message_id, 2));
+    }
+
+    constexpr uint32_t kThreads = 8;
+    constexpr uint32_t kLimit = 10;
+    constexpr uint32_t kMessageIds = 40;
+    std::atomic<uint32_t> logged{0};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&]() {
+            for (uint32_t i = 0; i < 1000; ++i) {
+                for (uint32_t id = 0; id < kMessageIds; ++id) {
+                    if (counts.TryIncrement(0x10000 + id * 4096, kLimit)) {
+                        logged++;
+                    }
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(logged.load(), kMessageIds * kLimit);
+}
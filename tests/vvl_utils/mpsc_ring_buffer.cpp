@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../framework/test_common.h"
+
+#include "containers/mpsc_ring_buffer.h"
+
+TEST(CustomContainer, MpscRingBufferBounded) {
+    vvl::mpsc_ring_buffer<std::string> queue(4);
+    std::string value;
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_pop(value));
+
+    for (int lap = 0; lap < 3; ++lap) {
+        for (uint32_t i = 0; i < queue.capacity(); ++i) {
+            ASSERT_TRUE(queue.try_push(std::to_string(lap * 10 + i)));
+        }
+        // Full until the consumer catches up
+        ASSERT_FALSE(queue.try_push("overflow"));
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, std::to_string(lap * 10));
+        ASSERT_TRUE(queue.try_push(std::to_string(lap * 10 + 4)));
+        for (uint32_t i = 1; i <= queue.capacity(); ++i) {
+            ASSERT_TRUE(queue.try_pop(value));
+            ASSERT_EQ(value, std::to_string(lap * 10 + i));
+        }
+        ASSERT_TRUE(queue.empty());
+    }
+}
+
+TEST(CustomContainer, MpscRingBufferConcurrent) {
+    constexpr uint32_t kProducers = 4;
+    constexpr uint32_t kValuesPerProducer = 20000;
+    vvl::mpsc_ring_buffer<uint64_t> queue(256);
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (uint32_t i = 0; i < kValuesPerProducer; ++i) {
+                uint64_t value = (uint64_t(p) << 32) | i;
+                while (!queue.try_push(std::move(value))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Values of a single producer must come out in the order they were pushed
+    std::vector<uint32_t> next(kProducers, 0);
+    uint64_t popped = 0;
+    while (popped < uint64_t(kProducers) * kValuesPerProducer) {
+        uint64_t value;
+        if (!queue.try_pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const uint32_t producer = static_cast<uint32_t>(value >> 32);
+        ASSERT_LT(producer, kProducers);
+        ASSERT_EQ(static_cast<uint32_t>(value), next[producer]);
+        next[producer]++;
+        popped++;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    ASSERT_TRUE(queue.empty());
+}
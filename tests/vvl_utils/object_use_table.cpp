@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include "thread_tracker/object_use_table.h"
+
+TEST(CustomContainer, ObjectUseTableInsertFindErase) {
+    ObjectUseTable table;
+    const uint64_t handle_a = (1ull << 32) | 5;
+    const uint64_t handle_b = (2ull << 32) | 5;
+    ASSERT_EQ(table.Find(5, handle_a), nullptr);
+
+    ASSERT_TRUE(table.Insert(5, handle_a));
+    ObjectUseData *use_data = table.Find(5, handle_a);
+    ASSERT_NE(use_data, nullptr);
+    // Inserting the holder again is not an error
+    ASSERT_TRUE(table.Insert(5, handle_a));
+    ASSERT_EQ(table.Find(5, handle_a), use_data);
+
+    // The slot is still held by handle_a, so handle_b must be tracked elsewhere
+    ASSERT_FALSE(table.Insert(5, handle_b));
+    ASSERT_EQ(table.Find(5, handle_b), nullptr);
+    ASSERT_FALSE(table.Erase(5, handle_b));
+
+    ASSERT_TRUE(table.Erase(5, handle_a));
+    ASSERT_EQ(table.Find(5, handle_a), nullptr);
+    ASSERT_TRUE(table.Insert(5, handle_b));
+    ASSERT_EQ(table.Find(5, handle_b), use_data);
+
+    // Indices in segments which were never allocated
+    ASSERT_EQ(table.Find(0xFFFFFFFF, handle_a), nullptr);
+    ASSERT_FALSE(table.Erase(0xFFFFFFFF, handle_a));
+}
+
+TEST(CustomContainer, ObjectUseTableReuseResetsCounts) {
+    ObjectUseTable table;
+    const uint32_t index = table.Allocate(0xA);
+    ObjectUseData *use_data = table.Get(index);
+    // Object destroyed while it is still being written
+    use_data->AddWriter();
+    use_data->AddReader();
+    table.Release(index);
+
+    const uint32_t reused_index = table.Allocate(0xB);
+    ASSERT_EQ(reused_index, index);
+    ASSERT_EQ(table.Get(reused_index), use_data);
+    ASSERT_EQ(use_data->GetCount().GetWriteCount(), 0);
+    ASSERT_EQ(use_data->GetCount().GetReadCount(), 0);
+
+    // Spans several segments, slots must not move as the table grows
+    std::vector<uint32_t> indices;
+    for (uint64_t i = 0; i < 10000; ++i) {
+        indices.push_back(table.Allocate(0x100 + i));
+    }
+    ASSERT_EQ(table.Get(reused_index), use_data);
+    for (uint64_t i = 0; i < indices.size(); ++i) {
+        ASSERT_NE(table.Get(indices[i]), nullptr);
+        ASSERT_EQ(table.Find(indices[i], 0x100 + i), table.Get(indices[i]));
+    }
+}
+
+TEST(CustomContainer, ObjectUseTableConcurrent) {
+    ObjectUseTable table;
+    constexpr uint32_t kThreads = 8;
+    constexpr uint32_t kIterations = 10000;
+
+    // Long lived objects which every thread reads while the other threads create and destroy their own objects
+    constexpr uint32_t kSharedCount = 64;
+    for (uint32_t i = 0; i < kSharedCount; ++i) {
+        table.Insert(i, (1ull << 32) | i);
+    }
+
+    std::atomic<uint32_t> errors{0};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (uint32_t i = 0; i < kIterations; ++i) {
+                const uint32_t index = kSharedCount + t * kIterations + i;
+                const uint64_t handle = (1ull << 32) | index;
+                if (!table.Insert(index, handle)) {
+                    errors++;
+                }
+                for (uint32_t s = 0; s < kSharedCount; ++s) {
+                    ObjectUseData *use_data = table.Find(s, (1ull << 32) | s);
+                    if (!use_data) {
+                        errors++;
+                        continue;
+                    }
+                    use_data->AddReader();
+                    use_data->RemoveReader();
+                }
+                ObjectUseData *own = table.Find(index, handle);
+                if (!own || own->AddWriter().GetWriteCount() != 0) {
+                    errors++;
+                } else {
+                    own->RemoveWriter();
+                }
+                if (!table.Erase(index, handle)) {
+                    errors++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(errors.load(), 0u);
+    for (uint32_t s = 0; s < kSharedCount; ++s) {
+        ObjectUseData *use_data = table.Find(s, (1ull << 32) | s);
+        ASSERT_NE(use_data, nullptr);
+        ASSERT_EQ(use_data->GetCount().GetReadCount(), 0);
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+
+#include "containers/range_vector.h"
+
+using ArenaRangeMap = sparse_container::range_map<uint64_t, std::vector<uint32_t>, sparse_container::range<uint64_t>,
+                                                  sparse_container::arena_map<uint64_t, std::vector<uint32_t>>>;
+using ArenaRange = ArenaRangeMap::key_type;
+
+TEST(CustomContainer, ArenaRangeMapSplitAndInfill) {
+    ArenaRangeMap map;
+    map.insert(std::make_pair(ArenaRange(0, 100), std::vector<uint32_t>{1}));
+    map.insert(std::make_pair(ArenaRange(200, 300), std::vector<uint32_t>{2}));
+
+    // Split the existing entries and fill the gap between them
+    sparse_container::split(map.lower_bound(ArenaRange(50, 100)), map, ArenaRange(50, 100));
+    sparse_container::split(map.lower_bound(ArenaRange(200, 250)), map, ArenaRange(200, 250));
+    map.overwrite_range(std::make_pair(ArenaRange(100, 200), std::vector<uint32_t>{3}));
+
+    std::vector<std::pair<ArenaRange, uint32_t>> expected = {
+        {{0, 50}, 1}, {{50, 100}, 1}, {{100, 200}, 3}, {{200, 250}, 2}, {{250, 300}, 2}};
+    ASSERT_EQ(map.size(), expected.size());
+    size_t index = 0;
+    for (const auto &entry : map) {
+        ASSERT_EQ(entry.first, expected[index].first);
+        ASSERT_EQ(entry.second[0], expected[index].second);
+        ++index;
+    }
+    ASSERT_EQ(map.get_implementation_map().get_allocator().arena().live_count(), expected.size());
+}
+
+TEST(CustomContainer, ArenaRangeMapClearRewinds) {
+    ArenaRangeMap map;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        map.insert(std::make_pair(ArenaRange(i * 2, i * 2 + 1), std::vector<uint32_t>{uint32_t(i)}));
+    }
+    const auto &arena = map.get_implementation_map().get_allocator().arena();
+    const size_t capacity = arena.capacity();
+    ASSERT_GE(capacity, 1000u);
+
+    map.clear();
+    ASSERT_EQ(arena.live_count(), 0u);
+
+    // Refilling reuses the memory kept by the arena
+    for (uint64_t i = 0; i < 1000; ++i) {
+        map.insert(std::make_pair(ArenaRange(i * 2, i * 2 + 1), std::vector<uint32_t>{uint32_t(i)}));
+    }
+    ASSERT_EQ(arena.capacity(), capacity);
+    ASSERT_EQ(arena.live_count(), 1000u);
+}
+
+TEST(CustomContainer, ArenaRangeMapCopyAndMove) {
+    ArenaRangeMap map;
+    for (uint64_t i = 0; i < 100; ++i) {
+        map.insert(std::make_pair(ArenaRange(i * 2, i * 2 + 1), std::vector<uint32_t>{uint32_t(i)}));
+    }
+
+    // A copy gets its own arena and outlives the source
+    auto source = std::make_unique<ArenaRangeMap>(map);
+    ArenaRangeMap copy(*source);
+    ASSERT_FALSE(copy.get_implementation_map().get_allocator() == source->get_implementation_map().get_allocator());
+    source.reset();
+    ASSERT_EQ(copy.size(), 100u);
+
+    // A moved map shares its arena with the moved-from map, which stays usable
+    ArenaRangeMap moved(std::move(copy));
+    ASSERT_EQ(moved.size(), 100u);
+    copy.clear();
+    copy.insert(std::make_pair(ArenaRange(0, 1), std::vector<uint32_t>{7}));
+    ASSERT_EQ(copy.size(), 1u);
+    ArenaRangeMap assigned;
+    assigned = std::move(moved);
+    ASSERT_EQ(assigned.size(), 100u);
+    moved.clear();
+    for (uint64_t i = 0; i < 10; ++i) {
+        moved.insert(std::make_pair(ArenaRange(i * 2, i * 2 + 1), std::vector<uint32_t>{uint32_t(i)}));
+    }
+    ASSERT_EQ(moved.size(), 10u);
+    copy.clear();
+
+    uint32_t expected = 0;
+    for (const auto &entry : assigned) {
+        ASSERT_EQ(entry.first, ArenaRange(expected * 2, expected * 2 + 1));
+        ASSERT_EQ(entry.second[0], expected);
+        ++expected;
+    }
+
+    assigned = map;
+    ASSERT_EQ(assigned.size(), 100u);
+}
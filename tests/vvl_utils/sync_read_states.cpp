@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <thread>
+#include <vector>
+
+#include "../framework/test_common.h"
+
+#include "sync/sync_access_state.h"
+
+using TestReadStates = SharedReadStates<int>;
+
+TEST(SyncReadStates, CopyOnWrite) {
+    TestReadStates reads;
+    ASSERT_TRUE(reads.empty());
+    ASSERT_FALSE(reads.IsShared());
+    reads.Mutable().emplace_back(1);
+    reads.Mutable().emplace_back(2);
+
+    TestReadStates copy = reads;
+    ASSERT_TRUE(reads.IsShared());
+    ASSERT_TRUE(copy.IsShared());
+    ASSERT_EQ(copy, reads);
+    ASSERT_EQ(copy.begin(), reads.begin());
+
+    // Writing the copy clones the list, the original keeps its reads
+    copy.Mutable()[0] = 10;
+    ASSERT_FALSE(reads.IsShared());
+    ASSERT_FALSE(copy.IsShared());
+    ASSERT_NE(copy.begin(), reads.begin());
+    ASSERT_EQ(reads[0], 1);
+    ASSERT_EQ(copy[0], 10);
+    ASSERT_EQ(copy[1], 2);
+
+    // The last owner writes in place
+    const int *list = reads.begin();
+    reads.Mutable()[0] = 5;
+    ASSERT_EQ(reads.begin(), list);
+    ASSERT_EQ(reads[0], 5);
+    reads.Mutable().emplace_back(3);
+    ASSERT_EQ(reads.size(), 3u);
+
+    copy = reads;
+    reads.clear();
+    ASSERT_TRUE(reads.empty());
+    ASSERT_FALSE(copy.IsShared());
+    ASSERT_EQ(copy.size(), 3u);
+
+    TestReadStates moved = std::move(copy);
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(moved.size(), 3u);
+    ASSERT_FALSE(moved.IsShared());
+}
+
+TEST(SyncReadStates, CopiesReleasedByOtherThreads) {
+    TestReadStates reads;
+    reads.Mutable().emplace_back(0);
+    for (int round = 0; round < 100; ++round) {
+        std::vector<TestReadStates> copies(8, reads);
+        std::vector<std::thread> threads;
+        for (auto &copy : copies) {
+            threads.emplace_back([&copy]() {
+                int sum = 0;
+                for (int value : copy) {
+                    sum += value;
+                }
+                ASSERT_GE(sum, 0);
+                copy.clear();
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        // All the copies are gone, so the list is written in place
+        ASSERT_FALSE(reads.IsShared());
+        const int *list = reads.begin();
+        reads.Mutable()[0] = round;
+        ASSERT_EQ(reads.begin(), list);
+    }
+}
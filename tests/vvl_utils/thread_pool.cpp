@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../framework/test_common.h"
+
+#include "utils/thread_pool.h"
+
+TEST(ThreadPool, ParallelFor) {
+    for (uint32_t worker_count : {0u, 1u, 4u}) {
+        vvl::ThreadPool pool(worker_count);
+        ASSERT_EQ(pool.WorkerCount(), worker_count);
+        for (size_t count : {size_t(0), size_t(1), size_t(3), size_t(1000)}) {
+            std::vector<std::atomic<uint32_t>> calls(count);
+            pool.ParallelFor(count, [&calls](size_t i) { calls[i]++; });
+            for (size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(calls[i].load(), 1u);
+            }
+        }
+    }
+}
+
+TEST(ThreadPool, ConcurrentCallers) {
+    vvl::ThreadPool pool(2);
+    constexpr uint32_t kThreads = 4;
+    std::atomic<uint64_t> sum{0};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&]() {
+            for (uint32_t iteration = 0; iteration < 100; ++iteration) {
+                // Nested calls run on a worker, which must not deadlock waiting on other workers
+                pool.ParallelFor(8, [&](size_t i) { pool.ParallelFor(4, [&](size_t j) { sum += i * 4 + j; }); });
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    // Sum of [0, 32) per iteration
+    ASSERT_EQ(sum.load(), uint64_t(kThreads) * 100 * (31 * 32 / 2));
+}
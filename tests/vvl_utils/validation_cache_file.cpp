@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2024 The Khronos Group Inc.
+ * Copyright (c) 2024 Valve Corporation
+ * Copyright (c) 2024 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../framework/test_common.h"
+
+#include "utils/validation_cache_file.h"
+
+using vvl::ValidationCacheFile;
+
+namespace {
+
+// Offsets in the header of the file
+constexpr size_t kFileVersionOffset = 4;
+constexpr size_t kBuildIdOffset = 8;
+constexpr size_t kHeaderSize = 72;
+
+constexpr uint32_t kConfig = 0x1234;
+constexpr uint32_t kOtherConfig = 0x5678;
+
+class CacheFile {
+  public:
+    explicit CacheFile(const char *name) : path_((std::filesystem::temp_directory_path() / name).string()) {
+        std::remove(path_.c_str());
+    }
+    ~CacheFile() { std::remove(path_.c_str()); }
+
+    const std::string &Path() const { return path_; }
+
+    std::vector<char> Read() const {
+        std::ifstream file(path_, std::ifstream::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    void Write(const std::vector<char> &data) const {
+        std::ofstream file(path_, std::ofstream::binary | std::ofstream::trunc);
+        file.write(data.data(), data.size());
+    }
+
+  private:
+    std::string path_;
+};
+
+void SaveHashes(const std::string &path, uint32_t config_id, const vvl::unordered_set<uint32_t> &hashes) {
+    ValidationCacheFile cache_file;
+    cache_file.Load(path, config_id);
+    ASSERT_TRUE(cache_file.Save(hashes));
+}
+
+}  // namespace
+
+TEST(ValidationCacheFile, RoundTrip) {
+    CacheFile file("vvl_test_validation_cache_round_trip.bin");
+    {
+        ValidationCacheFile cache_file;
+        ASSERT_FALSE(cache_file.Load(file.Path(), kConfig));
+        ASSERT_FALSE(cache_file.Contains(1));
+        ASSERT_TRUE(cache_file.Save({1, 2, 3}));
+    }
+
+    ValidationCacheFile cache_file;
+    ASSERT_TRUE(cache_file.Load(file.Path(), kConfig));
+    ASSERT_TRUE(cache_file.Contains(1));
+    ASSERT_TRUE(cache_file.Contains(2));
+    ASSERT_TRUE(cache_file.Contains(3));
+    ASSERT_FALSE(cache_file.Contains(4));
+    ASSERT_EQ(cache_file.ConfigKeys().size(), 3u);
+
+    // New hashes are merged with the ones of the file
+    ASSERT_TRUE(cache_file.Save({4}));
+    ASSERT_FALSE(cache_file.IsOpen());
+    ValidationCacheFile reloaded;
+    ASSERT_TRUE(reloaded.Load(file.Path(), kConfig));
+    ASSERT_EQ(reloaded.ConfigKeys().size(), 4u);
+    ASSERT_TRUE(reloaded.Contains(1));
+    ASSERT_TRUE(reloaded.Contains(4));
+}
+
+TEST(ValidationCacheFile, NothingNew) {
+    CacheFile file("vvl_test_validation_cache_nothing_new.bin");
+    SaveHashes(file.Path(), kConfig, {1});
+    const std::vector<char> data = file.Read();
+
+    ValidationCacheFile cache_file;
+    ASSERT_TRUE(cache_file.Load(file.Path(), kConfig));
+    ASSERT_TRUE(cache_file.Save({}));
+    ASSERT_EQ(file.Read(), data);
+}
+
+TEST(ValidationCacheFile, Configs) {
+    CacheFile file("vvl_test_validation_cache_configs.bin");
+    SaveHashes(file.Path(), kConfig, {1});
+
+    {
+        ValidationCacheFile cache_file;
+        ASSERT_TRUE(cache_file.Load(file.Path(), kOtherConfig));
+        ASSERT_FALSE(cache_file.Contains(1));
+        ASSERT_TRUE(cache_file.ConfigKeys().empty());
+        ASSERT_TRUE(cache_file.Save({2}));
+    }
+
+    // Both configs are kept in the file
+    ValidationCacheFile cache_file;
+    ASSERT_TRUE(cache_file.Load(file.Path(), kConfig));
+    ASSERT_TRUE(cache_file.Contains(1));
+    ASSERT_FALSE(cache_file.Contains(2));
+    ValidationCacheFile other_cache_file;
+    ASSERT_TRUE(other_cache_file.Load(file.Path(), kOtherConfig));
+    ASSERT_FALSE(other_cache_file.Contains(1));
+    ASSERT_TRUE(other_cache_file.Contains(2));
+}
+
+TEST(ValidationCacheFile, TruncatedFile) {
+    CacheFile file("vvl_test_validation_cache_truncated.bin");
+    SaveHashes(file.Path(), kConfig, {1, 2});
+    const std::vector<char> data = file.Read();
+    ASSERT_GT(data.size(), kHeaderSize);
+
+    // Within the header, within the first key and within the last key
+    for (size_t size : {kHeaderSize / 2, kHeaderSize + 4, data.size() - 1}) {
+        file.Write(std::vector<char>(data.begin(), data.begin() + size));
+        ValidationCacheFile cache_file;
+        ASSERT_FALSE(cache_file.Load(file.Path(), kConfig));
+        ASSERT_FALSE(cache_file.Contains(1));
+        ASSERT_FALSE(cache_file.Contains(2));
+    }
+
+    // The file is replaced by the next save
+    SaveHashes(file.Path(), kConfig, {3});
+    ValidationCacheFile cache_file;
+    ASSERT_TRUE(cache_file.Load(file.Path(), kConfig));
+    ASSERT_FALSE(cache_file.Contains(1));
+    ASSERT_TRUE(cache_file.Contains(3));
+}
+
+TEST(ValidationCacheFile, CorruptedFile) {
+    CacheFile file("vvl_test_validation_cache_corrupted.bin");
+    SaveHashes(file.Path(), kConfig, {1, 2});
+    std::vector<char> data = file.Read();
+
+    data[kHeaderSize] ^= 1;
+    file.Write(data);
+    ValidationCacheFile cache_file;
+    ASSERT_FALSE(cache_file.Load(file.Path(), kConfig));
+    ASSERT_FALSE(cache_file.Contains(1));
+    ASSERT_FALSE(cache_file.Contains(2));
+}
+
+TEST(ValidationCacheFile, WrongVersion) {
+    CacheFile file("vvl_test_validation_cache_version.bin");
+    SaveHashes(file.Path(), kConfig, {1});
+    const std::vector<char> data = file.Read();
+
+    // File layout version and spirv-val of another build
+    for (size_t offset : {kFileVersionOffset, kBuildIdOffset}) {
+        std::vector<char> other_version = data;
+        other_version[offset] ^= 1;
+        file.Write(other_version);
+        ValidationCacheFile cache_file;
+        ASSERT_FALSE(cache_file.Load(file.Path(), kConfig));
+        ASSERT_FALSE(cache_file.Contains(1));
+    }
+}